@@ -15,6 +15,7 @@
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QEventLoop>
+#include <QtCore/QJsonObject>
 #include <QtCore/QStandardPaths>
 #include <QtNetwork/QNetworkDiskCache>
 #include <QtNetwork/QNetworkRequest>
@@ -40,6 +41,7 @@
 #include <ScriptEngine.h>
 #include <ScriptEngines.h>
 #include <ScriptManager.h>
+#include <SharedUtil.h>
 #include <SoundCacheScriptingInterface.h>
 #include <SoundCache.h>
 #include <UserActivityLoggerScriptingInterface.h>
@@ -196,6 +198,13 @@ void Agent::run() {
 
     ThreadedAssignment::commonInit(AGENT_LOGGING_NAME, NodeType::Agent);
 
+    // agents of the same machine often play the same recordings and sounds, load them once for all of them
+    if (!_sharedCacheDirectory.isEmpty()) {
+        qDebug() << "Sharing recordings and sounds in" << _sharedCacheDirectory;
+        DependencyManager::get<recording::ClipCache>()->setSharedCacheDirectory(_sharedCacheDirectory + "/recordings");
+        DependencyManager::get<SoundCache>()->setSharedCacheDirectory(_sharedCacheDirectory + "/sounds");
+    }
+
     // Setup MessagesClient
     auto messagesClient = DependencyManager::set<MessagesClient>();
     messagesClient->startThread();
@@ -212,6 +221,68 @@ void Agent::run() {
     });
 }
 
+void Agent::sendStatsPacket() {
+    QJsonObject statsObject;
+
+    ProcessUsageInfo usage;
+    if (getProcessUsageInfo(usage)) {
+        quint64 now = usecTimestampNow();
+        if (_lastStatsTimestamp > 0 && now > _lastStatsTimestamp) {
+            statsObject["cpu_usage_percent"] =
+                100.0 * (double)(usage.cpuTimeUsecs - _lastStatsCPUTimeUsecs) / (double)(now - _lastStatsTimestamp);
+        }
+        _lastStatsCPUTimeUsecs = usage.cpuTimeUsecs;
+        _lastStatsTimestamp = now;
+
+        statsObject["resident_memory_mb"] = (double)usage.residentMemoryBytes / BYTES_PER_MEGABYTES;
+    }
+
+    auto addSharedCacheStats = [&](const QString& name, const std::shared_ptr<MappedFileCache>& sharedCache) {
+        if (!sharedCache) {
+            return;
+        }
+        QJsonObject cacheStats;
+        cacheStats["mapped_mb"] = (double)sharedCache->getMappedBytes() / BYTES_PER_MEGABYTES;
+        cacheStats["hits"] = (double)sharedCache->getHits();
+        cacheStats["misses"] = (double)sharedCache->getMisses();
+        cacheStats["stale_replacements"] = (double)sharedCache->getStaleReplacements();
+        statsObject[name] = cacheStats;
+    };
+    addSharedCacheStats("shared_recordings", DependencyManager::get<recording::ClipCache>()->getSharedCache());
+    addSharedCacheStats("shared_sounds", DependencyManager::get<SoundCache>()->getSharedCache());
+
+    addPacketStatsAndSendStatsPacket(statsObject);
+}
+
+void Agent::collectMetrics(OpenMetricsWriter& metrics) {
+    ThreadedAssignment::collectMetrics(metrics);
+
+    ProcessUsageInfo usage;
+    if (getProcessUsageInfo(usage)) {
+        metrics.addCounter("overte_agent_cpu_seconds", "CPU time used by this agent process",
+                           (double)usage.cpuTimeUsecs / USECS_PER_SECOND);
+        metrics.addGauge("overte_agent_resident_memory_bytes", "Resident memory of this agent process",
+                         (double)usage.residentMemoryBytes);
+    }
+
+    auto addSharedCacheMetrics = [&](const QString& type, const std::shared_ptr<MappedFileCache>& sharedCache) {
+        if (!sharedCache) {
+            return;
+        }
+        const OpenMetricsWriter::Labels labels { { "type", type } };
+        metrics.addGauge("overte_agent_shared_mapped_bytes", "Bytes of shared files mapped by this agent",
+                         (double)sharedCache->getMappedBytes(), labels);
+        metrics.addCounter("overte_agent_shared_hits", "Loads served by files another agent shared",
+                           (double)sharedCache->getHits(), labels);
+        metrics.addCounter("overte_agent_shared_misses", "Loads that were not shared by another agent yet",
+                           (double)sharedCache->getMisses(), labels);
+        metrics.addCounter("overte_agent_shared_stale_replacements", "Shared files replaced because their contents changed",
+                           (double)sharedCache->getStaleReplacements(), labels);
+    };
+    addSharedCacheMetrics("recording", DependencyManager::get<recording::ClipCache>()->getSharedCache());
+    addSharedCacheMetrics("sound", DependencyManager::get<SoundCache>()->getSharedCache());
+}
+
 void Agent::requestScript() {
     auto nodeList = DependencyManager::get<NodeList>();
     disconnect(&nodeList->getDomainHandler(), &DomainHandler::connectedToDomain, this, &Agent::requestScript);
@@ -26,6 +26,7 @@
 
 #include <EntityEditPacketSender.h>
 #include <EntityTree.h>
+#include <OpenMetrics.h>
 #include <ScriptEngine.h>
 #include <ThreadedAssignment.h>
 
@@ -78,6 +79,11 @@ public slots:
 
     Q_INVOKABLE virtual void stop() override;
 
+    void sendStatsPacket() override;
+
+protected:
+    void collectMetrics(OpenMetricsWriter& metrics) override;
+
 private slots:
     void requestScript();
     void scriptRequestFinished();
@@ -129,6 +135,10 @@ private:
     Encoder* _encoder { nullptr };
     QTimer _avatarAudioTimer;
     bool _flushEncoder { false };
+
+    // process CPU time at the last stats packet, to report the usage in between two of them
+    quint64 _lastStatsCPUTimeUsecs { 0 };
+    quint64 _lastStatsTimestamp { 0 };
 };
 
 #endif // hifi_Agent_h
@@ -25,10 +25,12 @@
 #include <AddressManager.h>
 #include <Assignment.h>
 #include <CrashAnnotations.h>
+#include <HTTPConnection.h>
 #include <LogHandler.h>
 #include <LogUtils.h>
 #include <LimitedNodeList.h>
 #include <NodeList.h>
+#include <OpenMetrics.h>
 #include <udt/PacketHeaders.h>
 #include <SharedUtil.h>
 #include <ShutdownEventListener.h>
@@ -47,8 +49,10 @@ const long long ASSIGNMENT_REQUEST_INTERVAL_MSECS = 1 * 1000;
 AssignmentClient::AssignmentClient(Assignment::Type requestAssignmentType, QString assignmentPool,
                                    quint16 listenPort, QString assignmentServerHostname,
                                    quint16 assignmentServerPort, quint16 assignmentMonitorPort,
-                                   bool disableDomainPortAutoDiscovery) :
-    _assignmentServerHostname(DEFAULT_ASSIGNMENT_SERVER_HOSTNAME)
+                                   bool disableDomainPortAutoDiscovery, quint16 metricsPort,
+                                   QString sharedCacheDirectory) :
+    _assignmentServerHostname(DEFAULT_ASSIGNMENT_SERVER_HOSTNAME),
+    _sharedCacheDirectory(sharedCacheDirectory)
 {
     LogUtils::init();
 
@@ -111,6 +115,12 @@ AssignmentClient::AssignmentClient(Assignment::Type requestAssignmentType, QStri
     // Create Singleton objects on main thread
     NetworkAccessManager::getInstance();
 
+    // did we get a port to serve metrics scrapes on?
+    if (metricsPort > 0) {
+        qCDebug(assignment_client) << "Serving metrics on local port" << metricsPort;
+        _metricsManager.reset(new HTTPManager(QHostAddress::LocalHost, metricsPort, "", this));
+    }
+
     // did we get an assignment-client monitor port?
     if (assignmentMonitorPort > 0) {
         _assignmentClientMonitorSocket = SockAddr(SocketType::UDP, DEFAULT_ASSIGNMENT_CLIENT_MONITOR_HOSTNAME, 
@@ -275,6 +285,11 @@ void AssignmentClient::handleCreateAssignmentPacket(QSharedPointer<ReceivedMessa
         // once the worker thread says it is done, we consider the assignment completed
         connect(workerThread, &QThread::destroyed, this, &AssignmentClient::assignmentCompleted);
 
+        if (_metricsManager) {
+            _assignmentMetrics = std::make_shared<AssignmentMetrics>(_currentAssignment->getTypeName());
+            _currentAssignment->setMetrics(_assignmentMetrics);
+        }
+        _currentAssignment->setSharedCacheDirectory(_sharedCacheDirectory);
         _currentAssignment->moveToThread(workerThread);
 
         // Starts an event loop, and emits workerThread->started()
@@ -284,6 +299,29 @@ void AssignmentClient::handleCreateAssignmentPacket(QSharedPointer<ReceivedMessa
     }
 }
 
+bool AssignmentClient::handleHTTPRequest(HTTPConnection* connection, const QUrl& url, bool skipSubHandler) {
+    if (url.path() != "/metrics") {
+        connection->respond(HTTPConnection::StatusCode404);
+        return true;
+    }
+
+    // the assignment collects its own snapshot on its thread, we only hand out the latest one and never touch the
+    // assignment, which its thread may delete at any time
+    QByteArray content;
+    if (_assignmentMetrics) {
+        content = _assignmentMetrics->getContent();
+    }
+
+    OpenMetricsWriter metrics;
+    metrics.addGauge("overte_assignment_assigned", "Whether this assignment client is running an assignment",
+                     _assignmentMetrics ? 1.0 : 0.0,
+                     { { "type", _assignmentMetrics ? _assignmentMetrics->getTypeName() : "none" } });
+    content.prepend(metrics.getContent());
+
+    connection->respond(HTTPConnection::StatusCode200, content, OpenMetricsWriter::CONTENT_TYPE);
+    return true;
+}
+
 void AssignmentClient::handleStopNodePacket(QSharedPointer<ReceivedMessage> message) {
     const SockAddr& senderSockAddr = message->getSenderSockAddr();
 
@@ -329,6 +367,7 @@ void AssignmentClient::assignmentCompleted() {
 
     // reset our current assignment pointer to null now that it has been deleted
     _currentAssignment = nullptr;
+    _assignmentMetrics.reset();
 
     // reset the logging target to the the CHILD_TARGET_NAME
     LogHandler::getInstance().setTargetName(ASSIGNMENT_CLIENT_TARGET_NAME);
@@ -17,21 +17,25 @@
 #include <QtCore/QPointer>
 #include <QtCore/QSharedPointer>
 
+#include <HTTPManager.h>
 #include <shared/WebRTC.h>
 
 #include "ThreadedAssignment.h"
 
 class QSharedMemory;
 
-class AssignmentClient : public QObject {
+class AssignmentClient : public QObject, public HTTPRequestHandler {
     Q_OBJECT
 public:
     AssignmentClient(Assignment::Type requestAssignmentType, QString assignmentPool,
                      quint16 listenPort, QString assignmentServerHostname,
                      quint16 assignmentServerPort, quint16 assignmentMonitorPort,
-                     bool disableDomainPortAutoDiscovery);
+                     bool disableDomainPortAutoDiscovery, quint16 metricsPort = 0,
+                     QString sharedCacheDirectory = QString());
     ~AssignmentClient();
 
+    bool handleHTTPRequest(HTTPConnection* connection, const QUrl& url, bool skipSubHandler = false) override;
+
 public slots:
     void aboutToQuit();
 
@@ -65,6 +69,9 @@ private:
     QTimer _statsTimerACM; // timer for sending stats to assignment client monitor
     QUuid _childAssignmentUUID = QUuid::createUuid();
     bool _disableDomainPortAutoDiscovery { false };
+    std::unique_ptr<HTTPManager> _metricsManager;
+    AssignmentMetricsPointer _assignmentMetrics; // only touched on this thread, the assignment has its own reference
+    QString _sharedCacheDirectory;
 
  protected:
     SockAddr _assignmentClientMonitorSocket;
@@ -95,6 +95,14 @@ AssignmentClientApp::AssignmentClientApp(int argc, char* argv[]) :
     const QCommandLineOption httpStatusPortOption(ASSIGNMENT_HTTP_STATUS_PORT, "http status server port", "http-status-port");
     parser.addOption(httpStatusPortOption);
 
+    const QCommandLineOption metricsPortOption(ASSIGNMENT_METRICS_PORT_OPTION,
+                                               "local HTTP port serving /metrics for this assignment client", "port");
+    parser.addOption(metricsPortOption);
+
+    const QCommandLineOption minChildMetricsPortOption(ASSIGNMENT_MONITOR_MIN_CHILDREN_METRICS_PORT_OPTION,
+                                                       "Minimum local HTTP /metrics port for children", "port");
+    parser.addOption(minChildMetricsPortOption);
+
     const QCommandLineOption logDirectoryOption(ASSIGNMENT_LOG_DIRECTORY, "directory to store logs", "log-directory");
     parser.addOption(logDirectoryOption);
 
@@ -102,6 +110,10 @@ AssignmentClientApp::AssignmentClientApp(int argc, char* argv[]) :
         "assignment clients automatically search for the domain server on the local machine, if networking is being managed, then disable automatic discovery of the domain server port");
     parser.addOption(disableDomainPortAutoDiscoveryOption);
 
+    const QCommandLineOption sharedCacheDirectoryOption(ASSIGNMENT_SHARED_CACHE_DIRECTORY_OPTION,
+        "directory where the agents of this machine share the recordings and sounds they load", "directory");
+    parser.addOption(sharedCacheDirectoryOption);
+
     const QCommandLineOption parentPIDOption(PARENT_PID_OPTION, "PID of the parent process", "parent-pid");
     parser.addOption(parentPIDOption);
 
@@ -169,6 +181,16 @@ AssignmentClientApp::AssignmentClientApp(int argc, char* argv[]) :
         httpStatusPort = parser.value(httpStatusPortOption).toUShort();
     }
 
+    quint16 metricsPort { 0 };
+    if (parser.isSet(metricsPortOption)) {
+        metricsPort = parser.value(metricsPortOption).toUShort();
+    }
+
+    quint16 childMinMetricsPort { 0 };
+    if (parser.isSet(minChildMetricsPortOption)) {
+        childMinMetricsPort = parser.value(minChildMetricsPortOption).toUShort();
+    }
+
     QString logDirectory;
     if (parser.isSet(logDirectoryOption)) {
         logDirectory = parser.value(logDirectoryOption);
@@ -179,6 +201,11 @@ AssignmentClientApp::AssignmentClientApp(int argc, char* argv[]) :
         disableDomainPortAutoDiscovery = true;
     }
 
+    QString sharedCacheDirectory;
+    if (parser.isSet(sharedCacheDirectoryOption)) {
+        sharedCacheDirectory = parser.value(sharedCacheDirectoryOption);
+    }
+
 
     Assignment::Type requestAssignmentType = Assignment::AllTypes;
     if (argumentVariantMap.contains(ASSIGNMENT_TYPE_OVERRIDE_OPTION)) {
@@ -273,14 +300,16 @@ AssignmentClientApp::AssignmentClientApp(int argc, char* argv[]) :
                                                                         requestAssignmentType, assignmentPool, listenPort,
                                                                         childMinListenPort, assignmentServerHostname,
                                                                         assignmentServerPort, httpStatusPort, logDirectory,
-                                                                        disableDomainPortAutoDiscovery);
+                                                                        disableDomainPortAutoDiscovery, childMinMetricsPort,
+                                                                        sharedCacheDirectory);
         monitor->setParent(this);
         connect(this, &QCoreApplication::aboutToQuit, monitor, &AssignmentClientMonitor::aboutToQuit);
     } else {
         AssignmentClient* client = new AssignmentClient(requestAssignmentType, assignmentPool, listenPort,
                                                         assignmentServerHostname,
                                                         assignmentServerPort, monitorPort,
-                                                        disableDomainPortAutoDiscovery);
+                                                        disableDomainPortAutoDiscovery, metricsPort,
+                                                        sharedCacheDirectory);
         client->setParent(this);
         connect(this, &QCoreApplication::aboutToQuit, client, &AssignmentClient::aboutToQuit);
     }
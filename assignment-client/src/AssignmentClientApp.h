@@ -27,8 +27,11 @@ const QString ASSIGNMENT_MIN_FORKS_OPTION = "min";
 const QString ASSIGNMENT_MAX_FORKS_OPTION = "max";
 const QString ASSIGNMENT_CLIENT_MONITOR_PORT_OPTION = "monitor-port";
 const QString ASSIGNMENT_HTTP_STATUS_PORT = "http-status-port";
+const QString ASSIGNMENT_METRICS_PORT_OPTION = "metrics-port";
+const QString ASSIGNMENT_MONITOR_MIN_CHILDREN_METRICS_PORT_OPTION = "min-metrics-port";
 const QString ASSIGNMENT_LOG_DIRECTORY = "log-directory";
 const QString ASSIGNMENT_DISABLE_DOMAIN_AUTO_PORT_DISCOVERY = "disable-domain-port-auto-discovery";
+const QString ASSIGNMENT_SHARED_CACHE_DIRECTORY_OPTION = "shared-cache-directory";
 
 class AssignmentClientApp : public QCoreApplication {
     Q_OBJECT
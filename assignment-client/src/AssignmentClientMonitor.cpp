@@ -43,7 +43,8 @@ AssignmentClientMonitor::AssignmentClientMonitor(const unsigned int numAssignmen
                                                  Assignment::Type requestAssignmentType, QString assignmentPool,
                                                  quint16 listenPort, quint16 childMinListenPort, QString assignmentServerHostname,
                                                  quint16 assignmentServerPort, quint16 httpStatusServerPort, QString logDirectory,
-                                                 bool disableDomainPortAutoDiscovery) :
+                                                 bool disableDomainPortAutoDiscovery, quint16 childMinMetricsPort,
+                                                 QString sharedCacheDirectory) :
     _httpManager(QHostAddress::LocalHost, httpStatusServerPort, "", this),
     _numAssignmentClientForks(numAssignmentClientForks),
     _minAssignmentClientForks(minAssignmentClientForks),
@@ -53,6 +54,7 @@ AssignmentClientMonitor::AssignmentClientMonitor(const unsigned int numAssignmen
     _assignmentServerHostname(assignmentServerHostname),
     _assignmentServerPort(assignmentServerPort),
     _childMinListenPort(childMinListenPort),
+    _childMinMetricsPort(childMinMetricsPort),
     _disableDomainPortAutoDiscovery(disableDomainPortAutoDiscovery)
 {
     qDebug() << "_requestAssignmentType =" << _requestAssignmentType;
@@ -103,13 +105,17 @@ void AssignmentClientMonitor::simultaneousWaitOnChildren(int waitMsecs) {
     }
 }
 
-void AssignmentClientMonitor::childProcessFinished(qint64 pid, quint16 listenPort, int exitCode, QProcess::ExitStatus exitStatus) {
+void AssignmentClientMonitor::childProcessFinished(qint64 pid, quint16 listenPort, quint16 metricsPort,
+                                                   int exitCode, QProcess::ExitStatus exitStatus) {
     auto message = "Child process " + QString::number(pid) + " on port " + QString::number(listenPort) +
                    "has %1 with exit code " + QString::number(exitCode) + ".";
 
     if (listenPort) {
         _childListenPorts.remove(listenPort);
     }
+    if (metricsPort) {
+        _childMetricsPorts.remove(metricsPort);
+    }
 
     if (_childProcesses.remove(pid)) {
         message.append(" Removed from internal map.");
@@ -178,6 +184,21 @@ void AssignmentClientMonitor::spawnChildClient() {
         _childListenPorts.insert(listenPort);
     }
 
+    quint16 metricsPort = 0;
+    if (_childMinMetricsPort) {
+        for (metricsPort = _childMinMetricsPort; _childMetricsPorts.contains(metricsPort); metricsPort++) {
+            if (_maxAssignmentClientForks &&
+                (metricsPort >= _maxAssignmentClientForks + _childMinMetricsPort)) {
+                metricsPort = 0;
+                qDebug() << "Insufficient metrics ports";
+                break;
+            }
+        }
+    }
+    if (metricsPort) {
+        _childMetricsPorts.insert(metricsPort);
+    }
+
     // unparse the parts of the command-line that the child cares about
     QStringList _childArguments;
     if (_assignmentPool != "") {
@@ -199,12 +220,21 @@ void AssignmentClientMonitor::spawnChildClient() {
     if (_disableDomainPortAutoDiscovery) {
         _childArguments.append("--" + ASSIGNMENT_DISABLE_DOMAIN_AUTO_PORT_DISCOVERY);
     }
+    if (!sharedCacheDirectory.isEmpty()) {
+        _childArguments.append("--" + ASSIGNMENT_SHARED_CACHE_DIRECTORY_OPTION);
+        _childArguments.append(sharedCacheDirectory);
+    }
 
     if (listenPort) {
         _childArguments.append("-" + ASSIGNMENT_CLIENT_LISTEN_PORT_OPTION);
         _childArguments.append(QString::number(listenPort));
     }
 
+    if (metricsPort) {
+        _childArguments.append("--" + ASSIGNMENT_METRICS_PORT_OPTION);
+        _childArguments.append(QString::number(metricsPort));
+    }
+
     // tell children which assignment monitor port to use
     // for now they simply talk to us on localhost
     _childArguments.append("--" + ASSIGNMENT_CLIENT_MONITOR_PORT_OPTION);
@@ -276,8 +306,8 @@ void AssignmentClientMonitor::spawnChildClient() {
         auto pid = assignmentClient->processId();
         // make sure we hear that this process has finished when it does
         connect(assignmentClient, static_cast<void(QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished),
-                this, [this, listenPort, pid](int exitCode, QProcess::ExitStatus exitStatus) {
-                    childProcessFinished(pid, listenPort, exitCode, exitStatus);
+                this, [this, listenPort, metricsPort, pid](int exitCode, QProcess::ExitStatus exitStatus) {
+                    childProcessFinished(pid, listenPort, metricsPort, exitCode, exitStatus);
             });
 
         qDebug() << "Spawned a child client with PID" << assignmentClient->processId();
@@ -41,13 +41,14 @@ public:
                             const unsigned int maxAssignmentClientForks, Assignment::Type requestAssignmentType,
                             QString assignmentPool, quint16 listenPort, quint16 childMinListenPort,
                             QString assignmentServerHostname, quint16 assignmentServerPort, quint16 httpStatusServerPort,
-                            QString logDirectory, bool disableDomainPortAutoDiscovery);
+                            QString logDirectory, bool disableDomainPortAutoDiscovery, quint16 childMinMetricsPort = 0,
+                            QString sharedCacheDirectory = QString());
     ~AssignmentClientMonitor();
 
     void stopChildProcesses();
 private slots:
     void checkSpares();
-    void childProcessFinished(qint64 pid, quint16 port, int exitCode, QProcess::ExitStatus exitStatus);
+    void childProcessFinished(qint64 pid, quint16 port, quint16 metricsPort, int exitCode, QProcess::ExitStatus exitStatus);
     void handleChildStatusPacket(QSharedPointer<ReceivedMessage> message);
 
     bool handleHTTPRequest(HTTPConnection* connection, const QUrl& url, bool skipSubHandler = false) override;
@@ -80,6 +81,9 @@ private:
     quint16 _childMinListenPort;
     QSet<quint16> _childListenPorts;
 
+    quint16 _childMinMetricsPort;
+    QSet<quint16> _childMetricsPorts;
+
     bool _wantsChildFileLogging { false };
     bool _disableDomainPortAutoDiscovery { false };
 };
@@ -0,0 +1,299 @@
+//
+//  AssetChunkStore.cpp
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "AssetChunkStore.h"
+
+#include <algorithm>
+#include <array>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDataStream>
+#include <QtCore/QFile>
+#include <QtCore/QSaveFile>
+#include <QtCore/QSet>
+
+#include "AssetServerLogging.h"
+
+static const QString MANIFESTS_SUBDIR = "manifests";
+static const QString CHUNKS_SUBDIR = "chunks";
+
+static const quint32 MANIFEST_MAGIC = 0x41434d31; // "ACM1"
+static const QDataStream::Version MANIFEST_STREAM_VERSION = QDataStream::Qt_5_6;
+
+// the magic and chunk count, then per chunk its hash as a length prefixed byte array and its size
+static const qint64 MANIFEST_HEADER_SIZE = sizeof(quint32) + sizeof(quint32);
+static const qint64 MANIFEST_ENTRY_SIZE = sizeof(quint32) + AssetUtils::SHA256_HASH_LENGTH + sizeof(qint64);
+
+// past the minimum chunk size, a boundary falls on average every 64KB. As in FastCDC, the mask takes the high bits of the
+// fingerprint, which depend on the last 64 bytes, where the low bits would only depend on the last 16.
+static const uint64_t BOUNDARY_MASK = ((1ULL << 16) - 1) << 48;
+
+// The random values the rolling fingerprint adds for each byte (a "gear" hash). They have to stay the same forever,
+// or new uploads would stop sharing chunks with what is already stored.
+static const std::array<uint64_t, 256>& gearTable() {
+    static const std::array<uint64_t, 256> table = [] {
+        std::array<uint64_t, 256> values;
+        uint64_t state = 0x4f7665727465ULL;
+        for (auto& value : values) {
+            // splitmix64
+            uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            value = z ^ (z >> 31);
+        }
+        return values;
+    }();
+    return table;
+}
+
+AssetChunkStore::AssetChunkStore(const QDir& directory) :
+    _manifestsDirectory(directory),
+    _chunksDirectory(directory)
+{
+    directory.mkpath(MANIFESTS_SUBDIR);
+    directory.mkpath(CHUNKS_SUBDIR);
+    _manifestsDirectory.cd(MANIFESTS_SUBDIR);
+    _chunksDirectory.cd(CHUNKS_SUBDIR);
+}
+
+QString AssetChunkStore::getManifestPath(const AssetUtils::AssetHash& hash) const {
+    return _manifestsDirectory.absoluteFilePath(hash);
+}
+
+QString AssetChunkStore::getChunkPath(const AssetUtils::AssetHash& chunkHash) const {
+    return _chunksDirectory.absoluteFilePath(chunkHash);
+}
+
+bool AssetChunkStore::hasAsset(const AssetUtils::AssetHash& hash) const {
+    return QFile::exists(getManifestPath(hash));
+}
+
+bool AssetChunkStore::loadManifest(const AssetUtils::AssetHash& hash, AssetUtils::AssetChunkManifest& manifest) const {
+    QFile manifestFile { getManifestPath(hash) };
+    if (!manifestFile.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QDataStream stream { &manifestFile };
+    stream.setVersion(MANIFEST_STREAM_VERSION);
+
+    quint32 magic;
+    quint32 numChunks;
+    stream >> magic >> numChunks;
+    if (stream.status() != QDataStream::Ok || magic != MANIFEST_MAGIC) {
+        qCWarning(asset_server) << "Invalid chunk manifest for" << hash;
+        return false;
+    }
+
+    // don't trust the count further than the file can back it, before reserving room for it
+    if ((qint64)numChunks != (manifestFile.size() - MANIFEST_HEADER_SIZE) / MANIFEST_ENTRY_SIZE) {
+        qCWarning(asset_server) << "Chunk count of the manifest for" << hash << "doesn't match its size";
+        return false;
+    }
+
+    manifest.clear();
+    manifest.reserve(numChunks);
+    for (quint32 i = 0; i < numChunks; ++i) {
+        QByteArray chunkHash;
+        qint64 size;
+        stream >> chunkHash >> size;
+        manifest.push_back({ chunkHash.toHex(), size });
+    }
+
+    if (stream.status() != QDataStream::Ok) {
+        qCWarning(asset_server) << "Truncated chunk manifest for" << hash;
+        return false;
+    }
+
+    return true;
+}
+
+bool AssetChunkStore::storeChunk(const QByteArray& chunk, AssetUtils::AssetChunkManifest& manifest, int& numNewChunks) {
+    AssetUtils::AssetHash chunkHash = AssetUtils::hashData(chunk).toHex();
+    manifest.push_back({ chunkHash, chunk.size() });
+
+    auto chunkPath = getChunkPath(chunkHash);
+    if (QFile::exists(chunkPath)) {
+        return true;
+    }
+
+    // uploads run in parallel, so two of them may write the same chunk; the atomic commit makes that harmless
+    QSaveFile chunkFile { chunkPath };
+    if (!chunkFile.open(QIODevice::WriteOnly) || chunkFile.write(chunk) != chunk.size() || !chunkFile.commit()) {
+        qCWarning(asset_server) << "Failed to write chunk" << chunkHash;
+        return false;
+    }
+
+    ++numNewChunks;
+    return true;
+}
+
+bool AssetChunkStore::storeAsset(const AssetUtils::AssetHash& hash, const ReceivedMessage::Spans& data) {
+    const auto& gear = gearTable();
+
+    AssetUtils::AssetChunkManifest manifest;
+    int numNewChunks = 0;
+
+    QByteArray chunk;
+    chunk.reserve(MAX_CHUNK_SIZE);
+    int64_t chunkSize = 0;
+    uint64_t fingerprint = 0;
+
+    for (const auto& span : data) {
+        const char* runStart = span.data;
+        const char* end = span.data + span.size;
+
+        for (const char* byte = span.data; byte < end; ++byte) {
+            fingerprint = (fingerprint << 1) + gear[(uint8_t)*byte];
+            ++chunkSize;
+
+            if ((chunkSize >= MIN_CHUNK_SIZE && (fingerprint & BOUNDARY_MASK) == 0) || chunkSize >= MAX_CHUNK_SIZE) {
+                chunk.append(runStart, (int)(byte + 1 - runStart));
+                runStart = byte + 1;
+
+                if (!storeChunk(chunk, manifest, numNewChunks)) {
+                    return false;
+                }
+
+                chunk.resize(0);
+                chunkSize = 0;
+                fingerprint = 0;
+            }
+        }
+
+        chunk.append(runStart, (int)(end - runStart));
+    }
+
+    if (!chunk.isEmpty() && !storeChunk(chunk, manifest, numNewChunks)) {
+        return false;
+    }
+
+    // the manifest goes last, so an asset is only visible once all of its chunks are
+    QSaveFile manifestFile { getManifestPath(hash) };
+    if (!manifestFile.open(QIODevice::WriteOnly)) {
+        qCWarning(asset_server) << "Failed to open chunk manifest for" << hash;
+        return false;
+    }
+
+    {
+        QDataStream stream { &manifestFile };
+        stream.setVersion(MANIFEST_STREAM_VERSION);
+
+        stream << MANIFEST_MAGIC << (quint32)manifest.size();
+        for (const auto& manifestChunk : manifest) {
+            stream << QByteArray::fromHex(manifestChunk.hash.toLatin1()) << (qint64)manifestChunk.size;
+        }
+    }
+
+    if (!manifestFile.commit()) {
+        qCWarning(asset_server) << "Failed to write chunk manifest for" << hash;
+        return false;
+    }
+
+    qCDebug(asset_server) << "Stored" << hash << "as" << manifest.size() << "chunks," << numNewChunks << "of them new";
+    return true;
+}
+
+bool AssetChunkStore::readRange(const AssetUtils::AssetChunkManifest& manifest, qint64 offset, qint64 size,
+                                const DataCallback& callback) const {
+    qint64 chunkStart = 0;
+    qint64 rangeEnd = offset + size;
+
+    for (const auto& chunk : manifest) {
+        qint64 chunkEnd = chunkStart + chunk.size;
+
+        if (chunkEnd > offset && chunkStart < rangeEnd) {
+            QFile chunkFile { getChunkPath(chunk.hash) };
+            if (!chunkFile.open(QIODevice::ReadOnly) || chunkFile.size() != chunk.size) {
+                qCWarning(asset_server) << "Missing or damaged chunk" << chunk.hash;
+                return false;
+            }
+
+            qint64 from = std::max(offset, chunkStart) - chunkStart;
+            qint64 to = std::min(rangeEnd, chunkEnd) - chunkStart;
+
+            chunkFile.seek(from);
+            auto data = chunkFile.read(to - from);
+            if (data.size() != to - from) {
+                return false;
+            }
+            callback(data.constData(), data.size());
+        }
+
+        if (chunkEnd >= rangeEnd) {
+            break;
+        }
+        chunkStart = chunkEnd;
+    }
+
+    return true;
+}
+
+bool AssetChunkStore::materialize(const AssetUtils::AssetHash& hash, const QString& filePath) const {
+    AssetUtils::AssetChunkManifest manifest;
+    if (!loadManifest(hash, manifest)) {
+        return false;
+    }
+
+    QSaveFile file { filePath };
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+
+    qint64 assetSize = 0;
+    for (const auto& chunk : manifest) {
+        assetSize += chunk.size;
+    }
+
+    bool writeFailed = false;
+    bool read = readRange(manifest, 0, assetSize, [&](const char* data, qint64 size) {
+        writeFailed = writeFailed || file.write(data, size) != size;
+    });
+
+    return read && !writeFailed && file.commit();
+}
+
+bool AssetChunkStore::removeAsset(const AssetUtils::AssetHash& hash) {
+    return QFile::remove(getManifestPath(hash));
+}
+
+QStringList AssetChunkStore::getAssetHashes() const {
+    return _manifestsDirectory.entryList(QDir::Files);
+}
+
+int AssetChunkStore::removeUnreferencedChunks() {
+    QSet<AssetUtils::AssetHash> referencedChunks;
+    for (const auto& hash : getAssetHashes()) {
+        AssetUtils::AssetChunkManifest manifest;
+        if (!loadManifest(hash, manifest)) {
+            // keep everything rather than risk deleting the chunks of an asset we couldn't read
+            qCWarning(asset_server) << "Skipping chunk cleanup since the manifest of" << hash << "could not be read";
+            return 0;
+        }
+
+        for (const auto& chunk : manifest) {
+            referencedChunks.insert(chunk.hash);
+        }
+    }
+
+    int numRemoved = 0;
+    for (const auto& chunkHash : _chunksDirectory.entryList(QDir::Files)) {
+        if (!referencedChunks.contains(chunkHash) && QFile::remove(getChunkPath(chunkHash))) {
+            ++numRemoved;
+        }
+    }
+
+    if (numRemoved > 0) {
+        qCInfo(asset_server) << "Deleted" << numRemoved << "chunks that no asset refers to anymore";
+    }
+
+    return numRemoved;
+}
@@ -0,0 +1,67 @@
+//
+//  AssetChunkStore.h
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Stores assets as deduplicated, content defined chunks
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_AssetChunkStore_h
+#define hifi_AssetChunkStore_h
+
+#include <functional>
+
+#include <QtCore/QDir>
+
+#include <AssetUtils.h>
+#include <ReceivedMessage.h>
+
+/// An optional storage backend for the asset server that splits assets into chunks at boundaries picked from their
+/// content, and stores each chunk once by its own hash. An edit to part of a large asset only changes the chunks around
+/// the edit, so the new version shares the rest of its chunks with the old one.
+///
+/// The store keeps a manifest per asset, listing its chunks in order, under <directory>/manifests and the chunks under
+/// <directory>/chunks. Chunks are only removed by removeUnreferencedChunks, since any number of assets may share them.
+class AssetChunkStore {
+public:
+    static const int64_t MIN_CHUNK_SIZE { 16 * 1024 };
+    static const int64_t MAX_CHUNK_SIZE { 256 * 1024 };
+
+    using DataCallback = std::function<void(const char* data, qint64 size)>;
+
+    AssetChunkStore(const QDir& directory);
+
+    bool hasAsset(const AssetUtils::AssetHash& hash) const;
+    bool loadManifest(const AssetUtils::AssetHash& hash, AssetUtils::AssetChunkManifest& manifest) const;
+
+    /// Splits the asset into chunks, writes those that aren't stored yet and then the manifest of the asset
+    bool storeAsset(const AssetUtils::AssetHash& hash, const ReceivedMessage::Spans& data);
+
+    /// Calls callback with the bytes of the asset from offset to offset + size, a chunk at a time
+    bool readRange(const AssetUtils::AssetChunkManifest& manifest, qint64 offset, qint64 size, const DataCallback& callback) const;
+
+    /// Writes the whole asset out to a regular file
+    bool materialize(const AssetUtils::AssetHash& hash, const QString& filePath) const;
+
+    bool removeAsset(const AssetUtils::AssetHash& hash);
+
+    QStringList getAssetHashes() const;
+
+    /// Deletes the chunks that no manifest refers to anymore, returns how many were deleted
+    int removeUnreferencedChunks();
+
+private:
+    QString getManifestPath(const AssetUtils::AssetHash& hash) const;
+    QString getChunkPath(const AssetUtils::AssetHash& chunkHash) const;
+    bool storeChunk(const QByteArray& chunk, AssetUtils::AssetChunkManifest& manifest, int& numNewChunks);
+
+    QDir _manifestsDirectory;
+    QDir _chunksDirectory;
+};
+
+#endif // hifi_AssetChunkStore_h
@@ -0,0 +1,243 @@
+//
+//  AssetMappingLog.cpp
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "AssetMappingLog.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDataStream>
+#include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QSaveFile>
+
+#include "AssetServerLogging.h"
+
+static const quint32 TRANSACTION_MAGIC = 0x414d4c31; // "AML1"
+static const QDataStream::Version LOG_STREAM_VERSION = QDataStream::Qt_5_6;
+static const QCryptographicHash::Algorithm LOG_CHECKSUM = QCryptographicHash::Md5;
+
+// the log is folded back into the snapshot once it grows past this
+static const qint64 MAX_LOG_SIZE = 4 * 1024 * 1024;
+
+AssetMappingLog::AssetMappingLog(const QString& snapshotPath, const QString& logPath) :
+    _snapshotPath(snapshotPath),
+    _logPath(logPath)
+{
+}
+
+bool AssetMappingLog::load(AssetUtils::Mappings& mappings) {
+    return loadSnapshot(mappings) && replayLog(mappings);
+}
+
+bool AssetMappingLog::loadSnapshot(AssetUtils::Mappings& mappings) {
+    QFile mapFile { _snapshotPath };
+    if (mapFile.exists()) {
+        if (mapFile.open(QIODevice::ReadOnly)) {
+            QJsonParseError error;
+
+            auto jsonDocument = QJsonDocument::fromJson(mapFile.readAll(), &error);
+
+            if (error.error == QJsonParseError::NoError) {
+                if (!jsonDocument.isObject()) {
+                    qCWarning(asset_server) << "Failed to read mapping file, root value in" << _snapshotPath << "is not an object";
+                    return false;
+                }
+
+                auto root = jsonDocument.object();
+                for (auto it = root.begin(); it != root.end(); ++it) {
+                    auto key = it.key();
+                    auto value = it.value();
+
+                    if (!value.isString()) {
+                        qCWarning(asset_server) << "Skipping" << key << ":" << value << "because it is not a string";
+                        continue;
+                    }
+
+                    if (!AssetUtils::isValidFilePath(key)) {
+                        qCWarning(asset_server) << "Will not keep mapping for" << key << "since it is not a valid path.";
+                        continue;
+                    }
+
+                    if (!AssetUtils::isValidHash(value.toString())) {
+                        qCWarning(asset_server) << "Will not keep mapping for" << key << "since it does not have a valid hash.";
+                        continue;
+                    }
+
+                    mappings[key] = value.toString();
+                }
+
+                qCInfo(asset_server) << "Loaded" << mappings.size() << "mappings from map file at" << _snapshotPath;
+                return true;
+            }
+        }
+
+        qCCritical(asset_server) << "Failed to read mapping file at" << _snapshotPath;
+        return false;
+    } else {
+        qCInfo(asset_server) << "No existing mappings loaded from file since no file was found at" << _snapshotPath;
+    }
+
+    return true;
+}
+
+bool AssetMappingLog::replayLog(AssetUtils::Mappings& mappings) {
+    QFile logFile { _logPath };
+    if (!logFile.exists()) {
+        _logSize = 0;
+        return true;
+    }
+
+    if (!logFile.open(QIODevice::ReadWrite)) {
+        qCCritical(asset_server) << "Failed to open mapping log at" << _logPath;
+        return false;
+    }
+
+    QDataStream stream { &logFile };
+    stream.setVersion(LOG_STREAM_VERSION);
+
+    qint64 lastCompleteTransaction = 0;
+    int numTransactions = 0;
+
+    while (!stream.atEnd()) {
+        quint32 magic;
+        QByteArray payload;
+        QByteArray checksum;
+        stream >> magic >> payload >> checksum;
+
+        // anything after the last transaction that reads back intact was cut short, and is dropped as a whole
+        if (stream.status() != QDataStream::Ok || magic != TRANSACTION_MAGIC ||
+            checksum != QCryptographicHash::hash(payload, LOG_CHECKSUM)) {
+            break;
+        }
+
+        QDataStream payloadStream { payload };
+        payloadStream.setVersion(LOG_STREAM_VERSION);
+
+        quint32 numChanges;
+        payloadStream >> numChanges;
+
+        Changes changes;
+        for (quint32 i = 0; i < numChanges && payloadStream.status() == QDataStream::Ok; ++i) {
+            Change change;
+            payloadStream >> change.first >> change.second;
+            changes.push_back(change);
+        }
+
+        if (payloadStream.status() != QDataStream::Ok) {
+            break;
+        }
+
+        for (const auto& change : changes) {
+            if (change.second.isEmpty()) {
+                mappings.erase(change.first);
+            } else {
+                mappings[change.first] = change.second;
+            }
+        }
+
+        lastCompleteTransaction = logFile.pos();
+        ++numTransactions;
+    }
+
+    if (lastCompleteTransaction < logFile.size()) {
+        qCWarning(asset_server) << "Discarding" << logFile.size() - lastCompleteTransaction
+            << "bytes of incomplete mapping changes at the end of" << _logPath;
+
+        if (!logFile.resize(lastCompleteTransaction)) {
+            qCCritical(asset_server) << "Failed to truncate mapping log at" << _logPath;
+            return false;
+        }
+    }
+
+    _logSize = lastCompleteTransaction;
+
+    qCInfo(asset_server) << "Replayed" << numTransactions << "mapping transactions from" << _logPath;
+    return true;
+}
+
+bool AssetMappingLog::append(const Changes& changes) {
+    QByteArray payload;
+    {
+        QDataStream payloadStream { &payload, QIODevice::WriteOnly };
+        payloadStream.setVersion(LOG_STREAM_VERSION);
+
+        payloadStream << (quint32)changes.size();
+        for (const auto& change : changes) {
+            payloadStream << change.first << change.second;
+        }
+    }
+
+    QByteArray transaction;
+    {
+        QDataStream stream { &transaction, QIODevice::WriteOnly };
+        stream.setVersion(LOG_STREAM_VERSION);
+        stream << TRANSACTION_MAGIC << payload << QCryptographicHash::hash(payload, LOG_CHECKSUM);
+    }
+
+    QFile logFile { _logPath };
+    if (!logFile.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qCWarning(asset_server) << "Failed to open mapping log at" << _logPath;
+        return false;
+    }
+
+    if (logFile.write(transaction) != transaction.size() || !logFile.flush()) {
+        qCWarning(asset_server) << "Failed to append mapping changes to" << _logPath;
+
+        // don't leave a partial transaction behind for the next append to follow
+        logFile.resize(_logSize);
+        return false;
+    }
+
+    _logSize += transaction.size();
+    return true;
+}
+
+bool AssetMappingLog::compact(const AssetUtils::Mappings& mappings) {
+    QSaveFile mapFile { _snapshotPath };
+    if (mapFile.open(QIODevice::WriteOnly)) {
+        QJsonObject root;
+
+        for (auto it : mappings) {
+            root[it.first] = it.second;
+        }
+
+        QJsonDocument jsonDocument { root };
+
+        if (mapFile.write(jsonDocument.toJson()) != -1) {
+            if (mapFile.commit()) {
+                qCDebug(asset_server) << "Wrote JSON mappings to file at" << _snapshotPath;
+            } else {
+                qCWarning(asset_server) << "Failed to commit JSON mappings to file at" << _snapshotPath;
+                return false;
+            }
+        } else {
+            qCWarning(asset_server) << "Failed to write JSON mappings to file at" << _snapshotPath;
+            return false;
+        }
+    } else {
+        qCWarning(asset_server) << "Failed to open map file at" << _snapshotPath;
+        return false;
+    }
+
+    // the snapshot now holds everything in the log, which would only be replayed again if we stopped before emptying it
+    QFile logFile { _logPath };
+    if (logFile.exists() && !logFile.resize(0)) {
+        qCWarning(asset_server) << "Failed to empty mapping log at" << _logPath;
+        return false;
+    }
+
+    _logSize = 0;
+    return true;
+}
+
+bool AssetMappingLog::needsCompaction() const {
+    return _logSize > MAX_LOG_SIZE;
+}
@@ -0,0 +1,60 @@
+//
+//  AssetMappingLog.h
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Persists the asset server mappings as a snapshot plus an append-only log of changes
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_AssetMappingLog_h
+#define hifi_AssetMappingLog_h
+
+#include <utility>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "AssetUtils.h"
+
+/// Keeps the mappings in a JSON snapshot (map.json) and records every edit as a checksummed transaction appended to a
+/// log, so an edit costs a write proportional to its size rather than to the size of the whole mapping table.
+///
+/// A transaction is only applied on load if it was written completely, so an edit interrupted by a crash is either
+/// fully recovered or not at all. Compaction rewrites the snapshot atomically and then empties the log; since the log
+/// only holds absolute sets and deletes, replaying it over a snapshot that already contains it is harmless.
+class AssetMappingLog {
+public:
+    /// A mapping to set, or to delete when the hash is empty
+    using Change = std::pair<AssetUtils::AssetPath, AssetUtils::AssetHash>;
+    using Changes = std::vector<Change>;
+
+    AssetMappingLog(const QString& snapshotPath, const QString& logPath);
+
+    /// Reads the snapshot and replays the complete transactions of the log over it
+    bool load(AssetUtils::Mappings& mappings);
+
+    /// Appends changes to the log as a single transaction
+    bool append(const Changes& changes);
+
+    /// Rewrites the snapshot from mappings and empties the log
+    bool compact(const AssetUtils::Mappings& mappings);
+
+    bool needsCompaction() const;
+    qint64 getLogSize() const { return _logSize; }
+
+private:
+    bool loadSnapshot(AssetUtils::Mappings& mappings);
+    bool replayLog(AssetUtils::Mappings& mappings);
+
+    QString _snapshotPath;
+    QString _logPath;
+
+    qint64 _logSize { 0 };
+};
+
+#endif // hifi_AssetMappingLog_h
@@ -36,7 +36,6 @@
 #include <image/TextureProcessing.h>
 
 #include "AssetServerLogging.h"
-#include "BakeAssetTask.h"
 #include "SendAssetTask.h"
 #include "UploadAssetTask.h"
 
@@ -115,17 +114,8 @@ const QString ASSET_SERVER_LOGGING_TARGET_NAME = "asset-server";
 
 void AssetServer::bakeAsset(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath) {
     qDebug() << "Starting bake for: " << assetPath << assetHash;
-    auto it = _pendingBakes.find(assetHash);
-    if (it == _pendingBakes.end()) {
-        auto task = std::make_shared<BakeAssetTask>(assetHash, assetPath, filePath);
-        task->setAutoDelete(false);
-        _pendingBakes[assetHash] = task;
-
-        connect(task.get(), &BakeAssetTask::bakeComplete, this, &AssetServer::handleCompletedBake);
-        connect(task.get(), &BakeAssetTask::bakeFailed, this, &AssetServer::handleFailedBake);
-        connect(task.get(), &BakeAssetTask::bakeAborted, this, &AssetServer::handleAbortedBake);
-
-        _bakingTaskPool.start(task.get());
+    if (!_bakingService->hasBake(assetHash)) {
+        _bakingService->queueBake(assetHash, assetPath, filePath, assetTypeForFilename(assetPath));
     } else {
         qDebug() << "Already in queue";
     }
@@ -135,10 +125,21 @@ QString AssetServer::getPathToAssetHash(const AssetUtils::AssetHash& assetHash)
     return _filesDirectory.absoluteFilePath(assetHash);
 }
 
+static const QString BAKE_SOURCES_SUBDIR = "bake-sources";
+
+QString AssetServer::getBakeSourcePath(const AssetUtils::AssetHash& assetHash) {
+    return _resourcesDirectory.absoluteFilePath(BAKE_SOURCES_SUBDIR + "/" + assetHash);
+}
+
+void AssetServer::removeBakeSource(const AssetUtils::AssetHash& assetHash) {
+    if (_chunkStore) {
+        QFile::remove(getBakeSourcePath(assetHash));
+    }
+}
+
 std::pair<AssetUtils::BakingStatus, QString> AssetServer::getAssetStatus(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash) {
-    auto it = _pendingBakes.find(hash);
-    if (it != _pendingBakes.end()) {
-        return { (*it)->isBaking() ? AssetUtils::Baking : AssetUtils::Pending, "" };
+    if (_bakingService->hasBake(hash)) {
+        return { _bakingService->isBaking(hash) ? AssetUtils::Baking : AssetUtils::Pending, "" };
     }
 
     if (path.startsWith(AssetUtils::HIDDEN_BAKED_CONTENT_FOLDER)) {
@@ -192,7 +193,18 @@ void AssetServer::bakeAssets() {
 void AssetServer::maybeBake(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash) {
     if (needsToBeBaked(path, hash)) {
         qDebug() << "Queuing bake of: " << path;
-        bakeAsset(hash, path, getPathToAssetHash(hash));
+
+        auto filePath = getPathToAssetHash(hash);
+        if (_chunkStore && !_bakingService->hasBake(hash) && !QFile::exists(filePath) && _chunkStore->hasAsset(hash)) {
+            // bakers read from a whole file, so give them a reassembled copy of a chunked asset
+            filePath = getBakeSourcePath(hash);
+            if (!_chunkStore->materialize(hash, filePath)) {
+                qCWarning(asset_server) << "Could not reassemble chunked asset" << hash << "for baking";
+                return;
+            }
+        }
+
+        bakeAsset(hash, path, filePath);
     }
 }
 
@@ -294,7 +306,7 @@ void updateConsumedCores() {
 AssetServer::AssetServer(ReceivedMessage& message) :
     ThreadedAssignment(message),
     _transferTaskPool(this),
-    _bakingTaskPool(this),
+    _bakingService(new BakingService(this)),
     _filesizeLimit(AssetUtils::MAX_UPLOAD_SIZE)
 {
     BAKEABLE_TEXTURE_EXTENSIONS = image::getSupportedFormats();
@@ -304,7 +316,19 @@ AssetServer::AssetServer(ReceivedMessage& message) :
     // so the ideal is greater than the number of cores on the system.
     static const int TASK_POOL_THREAD_COUNT = 50;
     _transferTaskPool.setMaxThreadCount(TASK_POOL_THREAD_COUNT);
-    _bakingTaskPool.setMaxThreadCount(1);
+
+    // each bake runs in its own oven process. models are the heaviest to bake, so they get a single oven and
+    // can't crowd out texture bakes, which are many and quick.
+    static const int MAX_CONCURRENT_MODEL_BAKES = 1;
+    static const int MAX_CONCURRENT_TEXTURE_BAKES = 2;
+    static const int MAX_CONCURRENT_SCRIPT_BAKES = 1;
+    _bakingService->setMaxConcurrentBakes(BakedAssetType::Model, MAX_CONCURRENT_MODEL_BAKES);
+    _bakingService->setMaxConcurrentBakes(BakedAssetType::Texture, MAX_CONCURRENT_TEXTURE_BAKES);
+    _bakingService->setMaxConcurrentBakes(BakedAssetType::Script, MAX_CONCURRENT_SCRIPT_BAKES);
+
+    connect(_bakingService, &BakingService::bakeComplete, this, &AssetServer::handleCompletedBake);
+    connect(_bakingService, &BakingService::bakeFailed, this, &AssetServer::handleFailedBake);
+    connect(_bakingService, &BakingService::bakeAborted, this, &AssetServer::handleAbortedBake);
 
     // Queue all requests until the Asset Server is fully setup
     auto& packetReceiver = DependencyManager::get<NodeList>()->getPacketReceiver();
@@ -331,24 +355,20 @@ void AssetServer::aboutToFinish() {
     // remove pending transfer tasks
     _transferTaskPool.clear();
 
-    // abort each of our still running bake tasks, remove pending bakes that were never put on the thread pool
-    auto it = _pendingBakes.begin();
-    while (it != _pendingBakes.end()) {
-        auto pendingRunnable =  _bakingTaskPool.tryTake(it->get());
-
-        if (pendingRunnable) {
-            it = _pendingBakes.erase(it);
-        } else {
-            qDebug() << "Aborting bake for" << it.key();
-            it.value()->abort();
-            ++it;
-        }
+    // abort each of our still running bakes, remove pending bakes that never reached an oven
+    for (const auto& hash : _bakingService->abortAll()) {
+        removeBakeSource(hash);
     }
 
     // make sure all bakers are finished or aborted
-    while (_pendingBakes.size() > 0) {
+    while (!_bakingService->isEmpty()) {
         QCoreApplication::processEvents();
     }
+
+    // leave a single up to date mapping file behind
+    if (_mappingLog && _mappingLog->getLogSize() > 0) {
+        _mappingLog->compact(_fileMappings);
+    }
 }
 
 void AssetServer::run() {
@@ -364,6 +384,7 @@ void AssetServer::run() {
 }
 
 static const QString ASSET_FILES_SUBDIR = "files";
+static const QString ASSET_CHUNKS_SUBDIR = "chunked";
 
 void AssetServer::completeSetup() {
     auto nodeList = DependencyManager::get<NodeList>();
@@ -427,6 +448,14 @@ void AssetServer::completeSetup() {
         return;
     }
 
+    // assets stored in chunks stay readable after chunked storage is turned off, only new uploads go back to whole files
+    static const QString CHUNKED_STORAGE_OPTION = "chunked_storage";
+    _storeUploadsInChunks = assetServerObject[CHUNKED_STORAGE_OPTION].toBool(false);
+    if (_storeUploadsInChunks || _resourcesDirectory.exists(ASSET_CHUNKS_SUBDIR)) {
+        _chunkStore = std::make_shared<AssetChunkStore>(QDir(_resourcesDirectory.absoluteFilePath(ASSET_CHUNKS_SUBDIR)));
+        _resourcesDirectory.mkpath(BAKE_SOURCES_SUBDIR);
+    }
+
     // load whatever mappings we currently have from the local file
     if (loadMappingsFromFile()) {
         qCInfo(asset_server) << "Serving files from: " << _filesDirectory.path();
@@ -555,6 +584,23 @@ void AssetServer::cleanupUnmappedFiles() {
             }
         }
     }
+
+    if (_chunkStore) {
+        QSet<AssetUtils::AssetHash> mappedHashes;
+        for (auto& pair : _fileMappings) {
+            mappedHashes.insert(pair.second);
+        }
+
+        for (const auto& hash : _chunkStore->getAssetHashes()) {
+            if (!mappedHashes.contains(hash) && _chunkStore->removeAsset(hash)) {
+                qCDebug(asset_server) << "\tDeleted chunked asset" << hash << "since it is unmapped.";
+
+                removeBakedPathsForDeletedAsset(hash);
+            }
+        }
+
+        _chunkStore->removeUnreferencedChunks();
+    }
 }
 
 void AssetServer::cleanupBakedFilesForDeletedAssets() {
@@ -840,8 +886,8 @@ void AssetServer::handleAssetGetInfo(QSharedPointer<ReceivedMessage> message, Sh
     message->readPrimitive(&messageID);
     assetHash = message->readWithoutCopy(AssetUtils::SHA256_HASH_LENGTH);
 
-    auto size = qint64(sizeof(MessageID) + AssetUtils::SHA256_HASH_LENGTH + sizeof(AssetUtils::AssetServerError) + sizeof(qint64));
-    auto replyPacket = NLPacket::create(PacketType::AssetGetInfoReply, size, true);
+    // a packet list, since the chunk manifest of a large asset doesn't fit in a single packet
+    auto replyPacket = NLPacketList::create(PacketType::AssetGetInfoReply, QByteArray(), true, true);
 
     QByteArray hexHash = assetHash.toHex();
 
@@ -851,17 +897,35 @@ void AssetServer::handleAssetGetInfo(QSharedPointer<ReceivedMessage> message, Sh
     QString fileName = QString(hexHash);
     QFileInfo fileInfo { _filesDirectory.filePath(fileName) };
 
+    AssetUtils::AssetChunkManifest manifest;
+
     if (fileInfo.exists() && fileInfo.isReadable()) {
         qCDebug(asset_server) << "Opening file: " << fileInfo.filePath();
         replyPacket->writePrimitive(AssetUtils::AssetServerError::NoError);
         replyPacket->writePrimitive(fileInfo.size());
+        replyPacket->writePrimitive((uint32_t)0);
+    } else if (_chunkStore && _chunkStore->loadManifest(fileName, manifest)) {
+        qint64 size = 0;
+        for (const auto& chunk : manifest) {
+            size += chunk.size;
+        }
+
+        replyPacket->writePrimitive(AssetUtils::AssetServerError::NoError);
+        replyPacket->writePrimitive(size);
+
+        // the chunk manifest lets clients request and resume an asset a chunk at a time
+        replyPacket->writePrimitive((uint32_t)manifest.size());
+        for (const auto& chunk : manifest) {
+            replyPacket->write(QByteArray::fromHex(chunk.hash.toLatin1()));
+            replyPacket->writePrimitive((int64_t)chunk.size);
+        }
     } else {
         qCDebug(asset_server) << "Asset not found: " << QString(hexHash);
         replyPacket->writePrimitive(AssetUtils::AssetServerError::AssetNotFound);
     }
 
     auto nodeList = DependencyManager::get<NodeList>();
-    nodeList->sendPacket(std::move(replyPacket), *senderNode);
+    nodeList->sendPacketList(std::move(replyPacket), *senderNode);
 }
 
 void AssetServer::handleAssetGet(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
@@ -874,7 +938,7 @@ void AssetServer::handleAssetGet(QSharedPointer<ReceivedMessage> message, Shared
     }
 
     // Queue task
-    auto task = new SendAssetTask(message, senderNode, _filesDirectory);
+    auto task = new SendAssetTask(message, senderNode, _filesDirectory, _assetCache, _chunkStore);
     _transferTaskPool.start(task);
 }
 
@@ -888,7 +952,8 @@ void AssetServer::handleAssetUpload(QSharedPointer<ReceivedMessage> message, Sha
     if (canWriteToAssetServer) {
         qCDebug(asset_server) << "Starting an UploadAssetTask for upload from" << message->getSourceID();
 
-        auto task = new UploadAssetTask(message, senderNode, _filesDirectory, _filesizeLimit);
+        auto task = new UploadAssetTask(message, senderNode, _filesDirectory, _filesizeLimit,
+                                        _storeUploadsInChunks ? _chunkStore : nullptr);
         _transferTaskPool.start(task);
     } else {
         // this is a node the domain told us is not allowed to rez entities
@@ -967,97 +1032,109 @@ void AssetServer::sendStatsPacket() {
         serverStats[uuid] = nodeStats;
     });
 
+    auto cacheStats = _assetCache->getStats();
+    auto now = usecTimestampNow();
+    float secondsSinceLastStats = (float)(now - _lastStatsTime) / USECS_PER_SECOND;
+
+    QJsonObject cacheObject;
+    auto requests = cacheStats.hits + cacheStats.misses;
+    cacheObject["hit_rate"] = requests > 0 ? (double)cacheStats.hits / requests : 0.0;
+    cacheObject["hits"] = (double)cacheStats.hits;
+    cacheObject["misses"] = (double)cacheStats.misses;
+    cacheObject["bypasses"] = (double)cacheStats.bypasses;
+    cacheObject["cached_assets"] = (int)cacheStats.cachedAssets;
+    cacheObject["cached_bytes"] = (double)cacheStats.cachedBytes;
+    cacheObject["bytes_served_per_second"] = secondsSinceLastStats > 0.0f ?
+        (double)(cacheStats.bytesServed - _lastStatsBytesServed) / secondsSinceLastStats : 0.0;
+    serverStats["asset_cache"] = cacheObject;
+
+    auto bakingStats = _bakingService->getStats();
+    auto startedBakes = bakingStats.completedBakes + bakingStats.failedBakes + bakingStats.abortedBakes;
+    static const float SECONDS_PER_MINUTE = 60.0f;
+
+    QJsonObject bakingObject;
+    bakingObject["queued"] = (int)bakingStats.queuedBakes;
+    bakingObject["running"] = (int)bakingStats.runningBakes;
+    bakingObject["completed"] = (double)bakingStats.completedBakes;
+    bakingObject["failed"] = (double)bakingStats.failedBakes;
+    bakingObject["aborted"] = (double)bakingStats.abortedBakes;
+    bakingObject["oven_restarts"] = bakingStats.workerRestarts;
+    bakingObject["completed_per_minute"] = secondsSinceLastStats > 0.0f ?
+        (double)(bakingStats.completedBakes - _lastStatsCompletedBakes) * SECONDS_PER_MINUTE / secondsSinceLastStats : 0.0;
+    bakingObject["average_queue_latency_msecs"] = startedBakes + bakingStats.runningBakes > 0 ?
+        (double)bakingStats.totalQueueUsecs / (startedBakes + bakingStats.runningBakes) / USECS_PER_MSEC : 0.0;
+    bakingObject["average_bake_time_msecs"] = startedBakes > 0 ?
+        (double)bakingStats.totalBakeUsecs / startedBakes / USECS_PER_MSEC : 0.0;
+    serverStats["baking"] = bakingObject;
+
+    _lastStatsBytesServed = cacheStats.bytesServed;
+    _lastStatsCompletedBakes = bakingStats.completedBakes;
+    _lastStatsTime = now;
+
     // send off the stats packets
     ThreadedAssignment::addPacketStatsAndSendStatsPacket(serverStats);
 }
 
 static const QString MAP_FILE_NAME = "map.json";
+static const QString MAP_LOG_FILE_NAME = "map.log";
 
 bool AssetServer::loadMappingsFromFile() {
+    _mappingLog.reset(new AssetMappingLog(_resourcesDirectory.absoluteFilePath(MAP_FILE_NAME),
+                                          _resourcesDirectory.absoluteFilePath(MAP_LOG_FILE_NAME)));
 
-    auto mapFilePath = _resourcesDirectory.absoluteFilePath(MAP_FILE_NAME);
-
-    QFile mapFile { mapFilePath };
-    if (mapFile.exists()) {
-        if (mapFile.open(QIODevice::ReadOnly)) {
-            QJsonParseError error;
-
-            auto jsonDocument = QJsonDocument::fromJson(mapFile.readAll(), &error);
-
-            if (error.error == QJsonParseError::NoError) {
-                if (!jsonDocument.isObject()) {
-                    qCWarning(asset_server) << "Failed to read mapping file, root value in" << mapFilePath << "is not an object";
-                    return false;
-                }
-
-                //_fileMappings = jsonDocument.object().toVariantHash();
-                auto root = jsonDocument.object();
-                for (auto it = root.begin(); it != root.end(); ++it) {
-                    auto key = it.key();
-                    auto value = it.value();
-
-                    if (!value.isString()) {
-                        qCWarning(asset_server) << "Skipping" << key << ":" << value << "because it is not a string";
-                        continue;
-                    }
-
-                    if (!AssetUtils::isValidFilePath(key)) {
-                        qCWarning(asset_server) << "Will not keep mapping for" << key << "since it is not a valid path.";
-                        continue;
-                    }
-
-                    if (!AssetUtils::isValidHash(value.toString())) {
-                        qCWarning(asset_server) << "Will not keep mapping for" << key << "since it does not have a valid hash.";
-                        continue;
-                    }
-
-
-                    qDebug() << "Added " << key << value.toString();
-                    _fileMappings[key] = value.toString();
-                }
-
-                qCInfo(asset_server) << "Loaded" << _fileMappings.size() << "mappings from map file at" << mapFilePath;
-                return true;
-            }
-        }
-
-        qCCritical(asset_server) << "Failed to read mapping file at" << mapFilePath;
+    if (!_mappingLog->load(_fileMappings)) {
         return false;
-    } else {
-        qCInfo(asset_server) << "No existing mappings loaded from file since no file was found at" << mapFilePath;
+    }
+
+    // start from a fresh snapshot so the log only has to hold this run's changes
+    if (_mappingLog->getLogSize() > 0 && !_mappingLog->compact(_fileMappings)) {
+        qCWarning(asset_server) << "Failed to fold the mapping log into the mapping file, will keep appending to it";
     }
 
     return true;
 }
 
-bool AssetServer::writeMappingsToFile() {
-    auto mapFilePath = _resourcesDirectory.absoluteFilePath(MAP_FILE_NAME);
+bool AssetServer::commitMappingChanges(const AssetMappingLog::Changes& changes) {
+    if (changes.empty()) {
+        return true;
+    }
 
-    QSaveFile mapFile { mapFilePath };
-    if (mapFile.open(QIODevice::WriteOnly)) {
-        QJsonObject root;
+    // remember what each change replaced in case persistence fails
+    AssetMappingLog::Changes undo;
+    undo.reserve(changes.size());
 
-        for (auto it : _fileMappings) {
-            root[it.first] = it.second;
-        }
+    for (const auto& change : changes) {
+        auto it = _fileMappings.find(change.first);
+        undo.emplace_back(change.first, it != _fileMappings.end() ? it->second : AssetUtils::AssetHash());
 
-        QJsonDocument jsonDocument { root };
+        if (change.second.isEmpty()) {
+            if (it != _fileMappings.end()) {
+                _fileMappings.erase(it);
+            }
+        } else {
+            _fileMappings[change.first] = change.second;
+        }
+    }
 
-        if (mapFile.write(jsonDocument.toJson()) != -1) {
-            if (mapFile.commit()) {
-                qCDebug(asset_server) << "Wrote JSON mappings to file at" << mapFilePath;
-                return true;
+    if (!_mappingLog->append(changes)) {
+        // put back the old mappings in reverse order, so that a path changed twice ends up with its original value
+        for (auto it = undo.rbegin(); it != undo.rend(); ++it) {
+            if (it->second.isEmpty()) {
+                _fileMappings.erase(it->first);
             } else {
-                qCWarning(asset_server) << "Failed to commit JSON mappings to file at" << mapFilePath;
+                _fileMappings[it->first] = it->second;
             }
-        } else {
-            qCWarning(asset_server) << "Failed to write JSON mappings to file at" << mapFilePath;
         }
-    } else {
-        qCWarning(asset_server) << "Failed to open map file at" << mapFilePath;
+
+        return false;
     }
 
-    return false;
+    if (_mappingLog->needsCompaction() && !_mappingLog->compact(_fileMappings)) {
+        // the changes are safe in the log, we'll try to compact again after the next one
+        qCWarning(asset_server) << "Failed to compact mapping log";
+    }
+
+    return true;
 }
 
 bool AssetServer::setMapping(AssetUtils::AssetPath path, AssetUtils::AssetHash hash) {
@@ -1073,27 +1150,12 @@ bool AssetServer::setMapping(AssetUtils::AssetPath path, AssetUtils::AssetHash h
         return false;
     }
 
-    // remember what the old mapping was in case persistence fails
-    auto it = _fileMappings.find(path);
-    auto oldMapping = it != _fileMappings.end() ? it->second : "";
-
-    // update the in memory QHash
-    _fileMappings[path] = hash;
-
-    // attempt to write to file
-    if (writeMappingsToFile()) {
+    if (commitMappingChanges({ { path, hash } })) {
         // persistence succeeded, we are good to go
         qCDebug(asset_server) << "Set mapping:" << path << "=>" << hash;
         maybeBake(path, hash);
         return true;
     } else {
-        // failed to persist this mapping to file - put back the old one in our in-memory representation
-        if (oldMapping.isEmpty()) {
-            _fileMappings.erase(_fileMappings.find(path));
-        } else {
-            _fileMappings[path] = oldMapping;
-        }
-
         qCWarning(asset_server) << "Failed to persist mapping:" << path << "=>" << hash;
 
         return false;
@@ -1104,6 +1166,14 @@ bool pathIsFolder(const AssetUtils::AssetPath& path) {
     return path.endsWith('/');
 }
 
+// Mappings are sorted by path, so the mappings below a folder are the contiguous run that starts at the folder path
+template <typename F>
+static void forEachMappingInFolder(const AssetUtils::Mappings& mappings, const AssetUtils::AssetPath& folder, F f) {
+    for (auto it = mappings.lower_bound(folder); it != mappings.end() && it->first.startsWith(folder); ++it) {
+        f(*it);
+    }
+}
+
 void AssetServer::removeBakedPathsForDeletedAsset(AssetUtils::AssetHash hash) {
     // we deleted the file with this hash
 
@@ -1117,35 +1187,25 @@ void AssetServer::removeBakedPathsForDeletedAsset(AssetUtils::AssetHash hash) {
 }
 
 bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
-    // take a copy of the current mappings in case persistence of these deletes fails
-    auto oldMappings = _fileMappings;
-
+    AssetMappingLog::Changes changes;
     QSet<QString> hashesToCheckForDeletion;
 
-    // enumerate the paths to delete and remove them all
+    // enumerate the paths to delete and collect the mappings they remove
     for (const auto& rawPath : paths) {
         auto path = rawPath.trimmed();
 
         // figure out if this path will delete a file or folder
         if (pathIsFolder(path)) {
-            // enumerate the in memory file mappings and remove anything that matches
-            auto it = _fileMappings.begin();
-            auto sizeBefore = _fileMappings.size();
+            auto sizeBefore = changes.size();
 
-            while (it != _fileMappings.end()) {
-                if (it->first.startsWith(path)) {
-                    // add this hash to the list we need to check for asset removal from the server
-                    hashesToCheckForDeletion << it->second;
+            forEachMappingInFolder(_fileMappings, path, [&](const AssetUtils::Mappings::value_type& mapping) {
+                // add this hash to the list we need to check for asset removal from the server
+                hashesToCheckForDeletion << mapping.second;
+                changes.emplace_back(mapping.first, AssetUtils::AssetHash());
+            });
 
-                    it = _fileMappings.erase(it);
-                } else {
-                    ++it;
-                }
-            }
-
-            auto sizeNow = _fileMappings.size();
-            if (sizeBefore != sizeNow) {
-                qCDebug(asset_server) << "Deleted" << sizeBefore - sizeNow << "mappings in folder: " << path;
+            if (changes.size() != sizeBefore) {
+                qCDebug(asset_server) << "Deleted" << changes.size() - sizeBefore << "mappings in folder: " << path;
             } else {
                 qCDebug(asset_server) << "Did not find any mappings to delete in folder:" << path;
             }
@@ -1158,15 +1218,15 @@ bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
 
                 qCDebug(asset_server) << "Deleted a mapping:" << path << "=>" << it->second;
 
-                _fileMappings.erase(it);
+                changes.emplace_back(path, AssetUtils::AssetHash());
             } else {
                 qCDebug(asset_server) << "Unable to delete a mapping that was not found:" << path;
             }
         }
     }
 
-    // deleted the old mappings, attempt to persist to file
-    if (writeMappingsToFile()) {
+    // delete the mappings and attempt to persist that
+    if (commitMappingChanges(changes)) {
         // persistence succeeded we are good to go
 
         // TODO iterate through hashesToCheckForDeletion instead
@@ -1182,9 +1242,16 @@ bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
             // remove the unmapped file
             QFile removeableFile { _filesDirectory.absoluteFilePath(hash) };
 
-            if (removeableFile.remove()) {
+            // an asset is stored either whole or in chunks, whose unreferenced chunks go at the next startup
+            bool removed = removeableFile.remove();
+            if (_chunkStore && _chunkStore->removeAsset(hash)) {
+                removed = true;
+            }
+
+            if (removed) {
                 qCDebug(asset_server) << "\tDeleted" << hash << "from asset files directory since it is now unmapped.";
 
+                _assetCache->remove(hash);
                 removeBakedPathsForDeletedAsset(hash);
             } else {
                 qCDebug(asset_server) << "\tAttempt to delete unmapped file" << hash << "failed";
@@ -1195,9 +1262,6 @@ bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
     } else {
         qCWarning(asset_server) << "Failed to persist deleted mappings, rolling back";
 
-        // we didn't delete the previous mapping, put it back in our in-memory representation
-        _fileMappings = oldMappings;
-
         return false;
     }
 }
@@ -1222,35 +1286,23 @@ bool AssetServer::renameMapping(AssetUtils::AssetPath oldPath, AssetUtils::Asset
             return false;
         }
 
-        // take a copy of the old mappings
-        auto oldMappings = _fileMappings;
+        // move each mapping below the renamed folder, in path order
+        AssetMappingLog::Changes changes;
 
-        // iterate the current mappings and adjust any that matches the renamed folder
-        auto it = oldMappings.begin();
+        forEachMappingInFolder(_fileMappings, oldPath, [&](const AssetUtils::Mappings::value_type& mapping) {
+            auto newKey = mapping.first;
+            newKey.replace(0, oldPath.size(), newPath);
 
-        while (it != oldMappings.end()) {
-            auto& oldKey = it->first;
-            if (oldKey.startsWith(oldPath)) {
-                auto newKey = oldKey;
-                newKey.replace(0, oldPath.size(), newPath);
-
-                // remove the old version from the in memory file mappings
-                _fileMappings.erase(_fileMappings.find(oldKey));
-                _fileMappings[newKey] = it->second;
-            }
-
-            ++it;
-        }
+            changes.emplace_back(mapping.first, AssetUtils::AssetHash());
+            changes.emplace_back(newKey, mapping.second);
+        });
 
-        if (writeMappingsToFile()) {
+        if (commitMappingChanges(changes)) {
             // persisted the changed mappings, return success
             qCDebug(asset_server) << "Renamed folder mapping:" << oldPath << "=>" << newPath;
 
             return true;
         } else {
-            // couldn't persist the renamed paths, rollback and return failure
-            _fileMappings = oldMappings;
-
             qCWarning(asset_server) << "Failed to persist renamed folder mapping:" << oldPath << "=>" << newPath;
 
             return false;
@@ -1263,34 +1315,16 @@ bool AssetServer::renameMapping(AssetUtils::AssetPath oldPath, AssetUtils::Asset
             return false;
         }
 
-        // take the old hash to remove the old mapping
         auto it = _fileMappings.find(oldPath);
-        auto oldSourceMapping = it->second;
-        _fileMappings.erase(it);
-
-        // in case we're overwriting, keep the current destination mapping for potential rollback
-        auto oldDestinationIt = _fileMappings.find(newPath);
 
-        if (!oldSourceMapping.isEmpty()) {
-            _fileMappings[newPath] = oldSourceMapping;
-
-            if (writeMappingsToFile()) {
+        if (it != _fileMappings.end()) {
+            // remove the old mapping and overwrite whatever was at the destination
+            if (commitMappingChanges({ { oldPath, AssetUtils::AssetHash() }, { newPath, it->second } })) {
                 // persisted the renamed mapping, return success
                 qCDebug(asset_server) << "Renamed mapping:" << oldPath << "=>" << newPath;
 
                 return true;
             } else {
-                // we couldn't persist the renamed mapping, rollback and return failure
-                _fileMappings[oldPath] = oldSourceMapping;
-
-                if (oldDestinationIt != _fileMappings.end()) {
-                    // put back the overwritten mapping for the destination path
-                    _fileMappings[newPath] = oldDestinationIt->second;
-                } else {
-                    // clear the new mapping
-                    _fileMappings.erase(_fileMappings.find(newPath));
-                }
-
                 qCDebug(asset_server) << "Failed to persist renamed mapping:" << oldPath << "=>" << newPath;
 
                 return false;
@@ -1319,7 +1353,7 @@ void AssetServer::handleFailedBake(QString originalAssetHash, QString assetPath,
 
     writeMetaFile(originalAssetHash, meta);
 
-    _pendingBakes.remove(originalAssetHash);
+    removeBakeSource(originalAssetHash);
 }
 
 void AssetServer::handleCompletedBake(QString originalAssetHash, QString originalAssetPath,
@@ -1342,7 +1376,7 @@ void AssetServer::handleCompletedBake(QString originalAssetHash, QString origina
 
         writeMetaFile(originalAssetHash, meta);
 
-        _pendingBakes.remove(originalAssetHash);
+        removeBakeSource(originalAssetHash);
     };
 
     bool errorCompletingBake { false };
@@ -1474,8 +1508,8 @@ void AssetServer::handleCompletedBake(QString originalAssetHash, QString origina
 void AssetServer::handleAbortedBake(QString originalAssetHash, QString assetPath) {
     qDebug() << "Aborted bake:" << originalAssetHash;
 
-    // for an aborted bake we don't do anything but remove the BakeAssetTask from our pending bakes
-    _pendingBakes.remove(originalAssetHash);
+    // for an aborted bake we don't do anything but clean up after it, the baking service has already forgotten it
+    removeBakeSource(originalAssetHash);
 }
 
 static const QString BAKE_VERSION_KEY = "bake_version";
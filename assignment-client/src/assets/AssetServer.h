@@ -19,7 +19,11 @@
 
 #include <ThreadedAssignment.h>
 
+#include "AssetChunkStore.h"
+#include "AssetMappingLog.h"
 #include "AssetUtils.h"
+#include "BakingService.h"
+#include "HotAssetCache.h"
 #include "ReceivedMessage.h"
 
 #include "RegisteredMetaTypes.h"
@@ -69,8 +73,6 @@ struct AssetMeta {
     QString redirectTarget;
 };
 
-class BakeAssetTask;
-
 class AssetServer : public ThreadedAssignment {
     Q_OBJECT
 public:
@@ -107,7 +109,9 @@ private:
 
     // Mapping file operations must be called from main assignment thread only
     bool loadMappingsFromFile();
-    bool writeMappingsToFile();
+
+    /// Apply changes to the in-memory mappings and persist them as one transaction, rolling back if that fails
+    bool commitMappingChanges(const AssetMappingLog::Changes& changes);
 
     /// Set the mapping for path to hash
     bool setMapping(AssetUtils::AssetPath path, AssetUtils::AssetHash hash);
@@ -128,6 +132,10 @@ private:
 
     QString getPathToAssetHash(const AssetUtils::AssetHash& assetHash);
 
+    /// Path of the reassembled copy of a chunked asset that bakers read from
+    QString getBakeSourcePath(const AssetUtils::AssetHash& assetHash);
+    void removeBakeSource(const AssetUtils::AssetHash& assetHash);
+
     std::pair<AssetUtils::BakingStatus, QString> getAssetStatus(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash);
 
     void bakeAssets();
@@ -150,15 +158,25 @@ private:
     void removeBakedPathsForDeletedAsset(AssetUtils::AssetHash originalAssetHash);
 
     AssetUtils::Mappings _fileMappings;
+    std::unique_ptr<AssetMappingLog> _mappingLog;
 
     QDir _resourcesDirectory;
     QDir _filesDirectory;
 
+    /// Chunked storage, only set if enabled or if assets were stored in chunks before
+    std::shared_ptr<AssetChunkStore> _chunkStore;
+    bool _storeUploadsInChunks { false };
+
     /// Task pool for handling uploads and downloads of assets
     QThreadPool _transferTaskPool;
 
-    QHash<AssetUtils::AssetHash, std::shared_ptr<BakeAssetTask>> _pendingBakes;
-    QThreadPool _bakingTaskPool;
+    /// Contents of recently requested assets, shared by the transfer tasks
+    std::shared_ptr<HotAssetCache> _assetCache { std::make_shared<HotAssetCache>() };
+    uint64_t _lastStatsBytesServed { 0 };
+    quint64 _lastStatsTime { usecTimestampNow() };
+
+    BakingService* _bakingService;
+    uint64_t _lastStatsCompletedBakes { 0 };
 
     QMutex _queuedRequestsMutex;
     bool _isQueueingRequests { true };
@@ -0,0 +1,221 @@
+//
+//  BakingService.cpp
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "BakingService.h"
+
+#include <algorithm>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+
+#include <PathUtils.h>
+#include <SharedUtil.h>
+
+#include "AssetServerLogging.h"
+
+BakingService::BakingService(QObject* parent) :
+    QObject(parent)
+{
+}
+
+void BakingService::setMaxConcurrentBakes(BakedAssetType type, int maxConcurrentBakes) {
+    _pools[type].maxWorkers = std::max(maxConcurrentBakes, 1);
+}
+
+void BakingService::queueBake(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath,
+                              const QString& filePath, BakedAssetType type) {
+    if (_bakes.contains(assetHash)) {
+        return;
+    }
+
+    Bake bake;
+    bake.hash = assetHash;
+    bake.path = assetPath;
+    bake.filePath = filePath;
+    bake.type = type;
+    bake.queuedTime = usecTimestampNow();
+    _bakes.insert(assetHash, bake);
+
+    _pools[type].queue.push_back(assetHash);
+    startBakes(type);
+}
+
+bool BakingService::isBaking(const AssetUtils::AssetHash& assetHash) const {
+    auto it = _bakes.find(assetHash);
+    return it != _bakes.end() && it->worker;
+}
+
+void BakingService::startBakes(BakedAssetType type) {
+    auto& pool = _pools[type];
+
+    while (!pool.queue.empty()) {
+        OvenWorker* idleWorker = nullptr;
+        for (auto worker : pool.workers) {
+            if (worker->isIdle()) {
+                idleWorker = worker;
+                break;
+            }
+        }
+
+        if (!idleWorker) {
+            if ((int)pool.workers.size() >= pool.maxWorkers) {
+                return;
+            }
+
+            idleWorker = new OvenWorker(this);
+            connect(idleWorker, &OvenWorker::jobFinished, this, [this, idleWorker](qint64 jobID, int statusCode, QString errors) {
+                handleJobFinished(idleWorker, jobID, statusCode, errors);
+            });
+            pool.workers.push_back(idleWorker);
+        }
+
+        auto hash = pool.queue.front();
+        pool.queue.pop_front();
+
+        auto it = _bakes.find(hash);
+        if (it != _bakes.end()) {
+            startBake(*it, idleWorker);
+        }
+    }
+}
+
+void BakingService::startBake(Bake& bake, OvenWorker* worker) {
+    auto hash = bake.hash;
+    auto path = bake.path;
+
+    // Make a new temporary directory for the Oven to work in
+    QString tempOutputDir = PathUtils::generateTemporaryDir();
+    QString tempOutputDirName = QDir(tempOutputDir).dirName();
+    if (tempOutputDir.isEmpty()) {
+        _bakes.remove(hash);
+        ++_stats.failedBakes;
+        emit bakeFailed(hash, path, "Could not create temporary working directory");
+        return;
+    }
+
+    // the oven picks its baker from the file name, so it needs the asset under its original name. a link does that
+    // without copying the whole asset where links are available.
+    auto assetName = path.split("/").last();
+    auto tempAssetPath = tempOutputDir + "/" + assetName;
+#ifdef Q_OS_WIN
+    bool linked = false;
+#else
+    bool linked = QFile::link(bake.filePath, tempAssetPath);
+#endif
+    if (!linked && !QFile::copy(bake.filePath, tempAssetPath)) {
+        PathUtils::deleteMyTemporaryDir(tempOutputDirName);
+        _bakes.remove(hash);
+        ++_stats.failedBakes;
+        emit bakeFailed(hash, path, "Couldn't copy file to bake to temporary directory");
+        return;
+    }
+
+    bake.jobID = _nextJobID++;
+    bake.startedTime = usecTimestampNow();
+    bake.tempOutputDir = tempOutputDir;
+    bake.worker = worker;
+    _stats.totalQueueUsecs += bake.startedTime - bake.queuedTime;
+
+    qCDebug(asset_server) << "Starting bake of" << path << "as job" << bake.jobID;
+
+    // a worker that can't start fails the bake here rather than through jobFinished, which would start the next bake
+    // from within this one
+    QString extension = path.mid(path.lastIndexOf('.') + 1);
+    if (!worker->startJob(bake.jobID, tempAssetPath, tempOutputDir, extension)) {
+        PathUtils::deleteMyTemporaryDir(tempOutputDirName);
+        _bakes.remove(hash);
+        ++_stats.failedBakes;
+        emit bakeFailed(hash, path, "Oven process failed to start");
+    }
+}
+
+void BakingService::handleJobFinished(OvenWorker* worker, qint64 jobID, int statusCode, QString errors) {
+    auto it = std::find_if(_bakes.begin(), _bakes.end(), [&](const Bake& bake) {
+        return bake.worker == worker && bake.jobID == jobID;
+    });
+
+    if (it != _bakes.end()) {
+        Bake bake = *it;
+        _bakes.erase(it);
+
+        _stats.totalBakeUsecs += usecTimestampNow() - bake.startedTime;
+
+        QString tempOutputDirName = QDir(bake.tempOutputDir).dirName();
+
+        if (statusCode == OVEN_STATUS_CODE_SUCCESS) {
+            ++_stats.completedBakes;
+            emit bakeComplete(bake.hash, bake.path, bake.tempOutputDir);
+        } else if (statusCode == OVEN_STATUS_CODE_ABORT) {
+            ++_stats.abortedBakes;
+            PathUtils::deleteMyTemporaryDir(tempOutputDirName);
+            emit bakeAborted(bake.hash, bake.path);
+        } else {
+            if (errors.isEmpty() && statusCode == OVEN_STATUS_CODE_FAIL) {
+                QFile errorFile { QDir(bake.tempOutputDir).absoluteFilePath("errors.txt") };
+                if (errorFile.open(QIODevice::ReadOnly)) {
+                    errors = errorFile.readAll();
+                } else {
+                    errors = "Unknown error occurred while baking";
+                }
+            }
+
+            ++_stats.failedBakes;
+            PathUtils::deleteMyTemporaryDir(tempOutputDirName);
+            emit bakeFailed(bake.hash, bake.path, errors);
+        }
+    }
+
+    // the worker is free again, whichever type of asset it bakes
+    for (auto& pool : _pools) {
+        if (std::find(pool.second.workers.begin(), pool.second.workers.end(), worker) != pool.second.workers.end()) {
+            startBakes(pool.first);
+            break;
+        }
+    }
+}
+
+QList<AssetUtils::AssetHash> BakingService::abortAll() {
+    QList<AssetUtils::AssetHash> droppedBakes;
+
+    for (auto& pool : _pools) {
+        for (const auto& hash : pool.second.queue) {
+            _bakes.remove(hash);
+            droppedBakes.push_back(hash);
+        }
+        pool.second.queue.clear();
+    }
+
+    for (auto& pool : _pools) {
+        for (auto worker : pool.second.workers) {
+            worker->abort();
+        }
+    }
+
+    return droppedBakes;
+}
+
+BakingService::Stats BakingService::getStats() const {
+    Stats stats = _stats;
+
+    stats.runningBakes = 0;
+    stats.workerRestarts = 0;
+    for (const auto& pool : _pools) {
+        for (auto worker : pool.second.workers) {
+            if (!worker->isIdle()) {
+                ++stats.runningBakes;
+            }
+            stats.workerRestarts += worker->getNumRestarts();
+        }
+    }
+    stats.queuedBakes = _bakes.size() - stats.runningBakes;
+
+    return stats;
+}
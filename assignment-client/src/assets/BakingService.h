@@ -0,0 +1,99 @@
+//
+//  BakingService.h
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Queues asset bakes and runs them on a pool of oven workers per asset type
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_BakingService_h
+#define hifi_BakingService_h
+
+#include <deque>
+#include <map>
+#include <vector>
+
+#include <QtCore/QHash>
+#include <QtCore/QObject>
+
+#include <AssetUtils.h>
+
+#include "OvenWorker.h"
+
+enum class BakedAssetType : int;
+
+/// Bakes queued assets on long-lived oven workers, with a separate queue and a separate limit on concurrent bakes
+/// for each type of asset, so that a backlog of slow model bakes doesn't hold up textures.
+///
+/// A bake is forgotten before any of the signals for it are emitted.
+class BakingService : public QObject {
+    Q_OBJECT
+public:
+    struct Stats {
+        size_t queuedBakes { 0 };
+        size_t runningBakes { 0 };
+        uint64_t completedBakes { 0 };
+        uint64_t failedBakes { 0 };
+        uint64_t abortedBakes { 0 };
+        int workerRestarts { 0 };
+        quint64 totalQueueUsecs { 0 }; // from queueing to starting, over every bake that was started
+        quint64 totalBakeUsecs { 0 }; // from starting to finishing, over every bake that finished
+    };
+
+    BakingService(QObject* parent = nullptr);
+
+    void setMaxConcurrentBakes(BakedAssetType type, int maxConcurrentBakes);
+
+    void queueBake(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath,
+                   const QString& filePath, BakedAssetType type);
+
+    bool hasBake(const AssetUtils::AssetHash& assetHash) const { return _bakes.contains(assetHash); }
+    bool isBaking(const AssetUtils::AssetHash& assetHash) const;
+    bool isEmpty() const { return _bakes.isEmpty(); }
+
+    /// Drops the bakes that haven't started, and returns their hashes. Running bakes are aborted.
+    QList<AssetUtils::AssetHash> abortAll();
+
+    Stats getStats() const;
+
+signals:
+    void bakeComplete(QString assetHash, QString assetPath, QString tempOutputDir);
+    void bakeFailed(QString assetHash, QString assetPath, QString errors);
+    void bakeAborted(QString assetHash, QString assetPath);
+
+private:
+    struct Bake {
+        AssetUtils::AssetHash hash;
+        AssetUtils::AssetPath path;
+        QString filePath;
+        BakedAssetType type;
+        qint64 jobID { 0 };
+        quint64 queuedTime { 0 };
+        quint64 startedTime { 0 };
+        QString tempOutputDir;
+        OvenWorker* worker { nullptr };
+    };
+
+    struct Pool {
+        std::deque<AssetUtils::AssetHash> queue;
+        std::vector<OvenWorker*> workers;
+        int maxWorkers { 1 };
+    };
+
+    void startBakes(BakedAssetType type);
+    void startBake(Bake& bake, OvenWorker* worker);
+    void handleJobFinished(OvenWorker* worker, qint64 jobID, int statusCode, QString errors);
+
+    QHash<AssetUtils::AssetHash, Bake> _bakes;
+    std::map<BakedAssetType, Pool> _pools;
+    qint64 _nextJobID { 1 };
+
+    Stats _stats;
+};
+
+#endif // hifi_BakingService_h
@@ -0,0 +1,120 @@
+//
+//  HotAssetCache.cpp
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "HotAssetCache.h"
+
+QByteArray HotAssetCache::get(const AssetUtils::AssetHash& hash, QFile& file, qint64 rangeSize) {
+    return get(hash, file.size(), rangeSize, [&file] {
+        file.seek(0);
+        return file.readAll();
+    });
+}
+
+QByteArray HotAssetCache::get(const AssetUtils::AssetHash& hash, qint64 assetSize, qint64 rangeSize, const Loader& load) {
+    QMutexLocker locker(&_mutex);
+
+    auto it = _entriesByHash.find(hash);
+    if (it != _entriesByHash.end()) {
+        // move it to the front of the list, the list iterators stay valid
+        _entries.splice(_entries.begin(), _entries, it.value());
+        ++_hits;
+        return _entries.front().data;
+    }
+
+    if (assetSize > MAX_CACHED_ASSET_SIZE || assetSize > _capacity) {
+        ++_bypasses;
+        return QByteArray();
+    }
+
+    // another task is loading it already, wait for that rather than reading it again
+    auto pending = _pendingLoads.value(hash);
+    if (pending) {
+        ++_hits;
+        while (!pending->done) {
+            _loadFinished.wait(&_mutex);
+        }
+        return pending->data;
+    }
+
+    ++_misses;
+
+    if (rangeSize < assetSize && !_partiallyRequested.contains(hash)) {
+        if (_partiallyRequested.size() >= MAX_PARTIALLY_REQUESTED) {
+            _partiallyRequested.clear();
+        }
+        _partiallyRequested.insert(hash);
+        return QByteArray();
+    }
+    _partiallyRequested.remove(hash);
+
+    pending = std::make_shared<PendingLoad>();
+    _pendingLoads.insert(hash, pending);
+
+    // load outside of the lock so other tasks keep being served meanwhile
+    locker.unlock();
+    QByteArray data = load();
+    if (data.size() != assetSize) {
+        data = QByteArray();
+    }
+    locker.relock();
+
+    pending->data = data;
+    pending->done = true;
+    _loadFinished.wakeAll();
+
+    // the asset may have been removed while it was loading
+    if (_pendingLoads.value(hash) != pending) {
+        return data;
+    }
+    _pendingLoads.remove(hash);
+
+    if (data.isNull()) {
+        return data;
+    }
+
+    _entries.push_front({ hash, data });
+    _entriesByHash.insert(hash, _entries.begin());
+    _size += data.size();
+
+    while (_size > _capacity && !_entries.empty()) {
+        auto& leastRecentlyUsed = _entries.back();
+        _size -= leastRecentlyUsed.data.size();
+        _entriesByHash.remove(leastRecentlyUsed.hash);
+        _entries.pop_back();
+    }
+
+    return data;
+}
+
+void HotAssetCache::remove(const AssetUtils::AssetHash& hash) {
+    QMutexLocker locker(&_mutex);
+    _pendingLoads.remove(hash);
+    _partiallyRequested.remove(hash);
+    auto it = _entriesByHash.find(hash);
+    if (it != _entriesByHash.end()) {
+        _size -= it.value()->data.size();
+        _entries.erase(it.value());
+        _entriesByHash.erase(it);
+    }
+}
+
+HotAssetCache::Stats HotAssetCache::getStats() {
+    Stats stats;
+    stats.hits = _hits;
+    stats.misses = _misses;
+    stats.bypasses = _bypasses;
+    stats.bytesServed = _bytesServed;
+
+    QMutexLocker locker(&_mutex);
+    stats.cachedBytes = _size;
+    stats.cachedAssets = _entries.size();
+    return stats;
+}
@@ -0,0 +1,101 @@
+//
+//  HotAssetCache.h
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Keeps the contents of recently requested assets in memory for the asset transfer tasks
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_HotAssetCache_h
+#define hifi_HotAssetCache_h
+
+#include <atomic>
+#include <functional>
+#include <list>
+#include <memory>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QFile>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QSet>
+#include <QtCore/QWaitCondition>
+
+#include "AssetUtils.h"
+
+/// A size bounded, least recently used cache of asset contents, shared by every SendAssetTask.
+///
+/// Assets are content addressed, so a cached asset never goes stale; it only has to be dropped when its file is deleted.
+/// Assets larger than MAX_CACHED_ASSET_SIZE are not cached, SendAssetTask reads the requested range of those instead. So
+/// that one look at part of an asset doesn't read all of it, a request for part of an asset only loads the whole asset
+/// once the asset was requested before. Tasks asking for an asset that another task is loading wait for that load.
+class HotAssetCache {
+public:
+    static const qint64 DEFAULT_CAPACITY { 256 * 1024 * 1024 };
+    static const qint64 MAX_CACHED_ASSET_SIZE { 16 * 1024 * 1024 };
+
+    struct Stats {
+        uint64_t hits { 0 };
+        uint64_t misses { 0 };
+        uint64_t bypasses { 0 }; // requests for assets too large to cache
+        uint64_t bytesServed { 0 };
+        qint64 cachedBytes { 0 };
+        size_t cachedAssets { 0 };
+    };
+
+    /// Reads the whole asset, or returns a null array if it can't
+    using Loader = std::function<QByteArray()>;
+
+    HotAssetCache(qint64 capacity = DEFAULT_CAPACITY) : _capacity(capacity) {}
+
+    /// Returns the contents of the asset for a request of rangeSize bytes of it, loading it into the cache on a miss.
+    /// Returns a null array if the asset isn't cached for this request or could not be loaded, in which case only the
+    /// requested range should be read.
+    QByteArray get(const AssetUtils::AssetHash& hash, qint64 assetSize, qint64 rangeSize, const Loader& load);
+
+    /// Same as above, for an asset stored as a whole in the open file
+    QByteArray get(const AssetUtils::AssetHash& hash, QFile& file, qint64 rangeSize);
+
+    void remove(const AssetUtils::AssetHash& hash);
+
+    void recordBytesServed(qint64 bytes) { _bytesServed += bytes; }
+
+    Stats getStats();
+
+private:
+    struct Entry {
+        AssetUtils::AssetHash hash;
+        QByteArray data;
+    };
+    using Entries = std::list<Entry>;
+
+    struct PendingLoad {
+        QByteArray data;
+        bool done { false };
+    };
+
+    // how many assets that had part of them requested are remembered, until the next request loads them whole
+    static const int MAX_PARTIALLY_REQUESTED { 1024 };
+
+    QMutex _mutex;
+    Entries _entries; // most recently used first
+    QHash<AssetUtils::AssetHash, Entries::iterator> _entriesByHash;
+    qint64 _size { 0 };
+    qint64 _capacity;
+
+    QHash<AssetUtils::AssetHash, std::shared_ptr<PendingLoad>> _pendingLoads;
+    QWaitCondition _loadFinished;
+    QSet<AssetUtils::AssetHash> _partiallyRequested;
+
+    std::atomic<uint64_t> _hits { 0 };
+    std::atomic<uint64_t> _misses { 0 };
+    std::atomic<uint64_t> _bypasses { 0 };
+    std::atomic<uint64_t> _bytesServed { 0 };
+};
+
+#endif // hifi_HotAssetCache_h
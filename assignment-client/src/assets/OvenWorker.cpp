@@ -0,0 +1,148 @@
+//
+//  OvenWorker.cpp
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "OvenWorker.h"
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+
+#include "AssetServerLogging.h"
+
+// must match what the oven prints when it finishes a job in worker mode
+static const QByteArray OVEN_WORKER_RESULT_PREFIX = "oven-job-finished";
+
+static const int OVEN_SHUTDOWN_TIMEOUT_MSECS = 2000;
+
+OvenWorker::OvenWorker(QObject* parent) :
+    QObject(parent)
+{
+}
+
+OvenWorker::~OvenWorker() {
+    if (_process && _process->state() != QProcess::NotRunning) {
+        disconnect(_process.get(), nullptr, this, nullptr);
+
+        // the oven quits once its input is closed
+        _process->closeWriteChannel();
+        if (!_process->waitForFinished(OVEN_SHUTDOWN_TIMEOUT_MSECS)) {
+            _process->kill();
+            _process->waitForFinished();
+        }
+    }
+}
+
+bool OvenWorker::ensureRunning() {
+    if (!_process) {
+        _process.reset(new QProcess());
+
+        // oven logs go to its standard output along with the job results, its standard error goes to ours
+        _process->setProcessChannelMode(QProcess::ForwardedErrorChannel);
+
+        connect(_process.get(), &QProcess::readyReadStandardOutput, this, &OvenWorker::readResults);
+        connect(_process.get(), static_cast<void(QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished),
+                this, &OvenWorker::handleProcessFinished);
+    }
+
+    if (_process->state() != QProcess::NotRunning) {
+        return true;
+    }
+
+    if (_hasStarted) {
+        ++_numRestarts;
+    }
+
+    auto base = QFileInfo(QCoreApplication::applicationFilePath()).absoluteDir();
+    QString path = base.absolutePath() + "/oven";
+
+    qCDebug(asset_server) << "Starting oven worker:" << path;
+    _process->start(path, { "--worker" });
+    if (!_process->waitForStarted()) {
+        return false;
+    }
+
+    _hasStarted = true;
+    return true;
+}
+
+bool OvenWorker::startJob(qint64 jobID, const QString& inputPath, const QString& outputDirectory, const QString& type) {
+    Q_ASSERT(isIdle());
+
+    if (!ensureRunning()) {
+        return false;
+    }
+
+    _jobID = jobID;
+    _wasAborted = false;
+
+    QJsonObject job;
+    job["id"] = (double)jobID;
+    job["input"] = inputPath;
+    job["output"] = outputDirectory;
+    job["type"] = type;
+
+    _process->write(QJsonDocument(job).toJson(QJsonDocument::Compact) + "\n");
+    return true;
+}
+
+void OvenWorker::abort() {
+    if (!isIdle() && _process && _process->state() != QProcess::NotRunning) {
+        qCDebug(asset_server) << "Terminating oven worker to abort job" << _jobID;
+        _wasAborted = true;
+        _process->terminate();
+    }
+}
+
+void OvenWorker::readResults() {
+    while (_process->canReadLine()) {
+        auto line = _process->readLine().trimmed();
+        if (!line.startsWith(OVEN_WORKER_RESULT_PREFIX)) {
+            // the rest is the oven's own log
+            if (!line.isEmpty()) {
+                qCDebug(asset_server).noquote() << "Oven:" << line;
+            }
+            continue;
+        }
+
+        auto fields = line.mid(OVEN_WORKER_RESULT_PREFIX.size()).simplified().split(' ');
+        if (fields.size() != 2 || fields[0].toLongLong() != _jobID) {
+            qCWarning(asset_server) << "Unexpected result from oven worker:" << line;
+            continue;
+        }
+
+        finishJob(fields[1].toInt(), QString());
+    }
+}
+
+void OvenWorker::handleProcessFinished(int exitCode, QProcess::ExitStatus exitStatus) {
+    qCDebug(asset_server) << "Oven worker exited:" << exitCode << exitStatus;
+
+    // a result printed right before the oven exited still counts
+    readResults();
+
+    if (!isIdle()) {
+        if (_wasAborted) {
+            finishJob(OVEN_STATUS_CODE_ABORT, QString());
+        } else {
+            finishJob(OVEN_STATUS_CODE_FAIL, "Fatal error occurred while baking");
+        }
+    }
+}
+
+void OvenWorker::finishJob(int statusCode, const QString& errors) {
+    auto jobID = _jobID;
+    _jobID = 0;
+    _wasAborted = false;
+
+    emit jobFinished(jobID, statusCode, errors);
+}
@@ -0,0 +1,67 @@
+//
+//  OvenWorker.h
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Overte e.V.
+//
+//  A long-lived oven process that bakes one asset at a time for the asset server
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_OvenWorker_h
+#define hifi_OvenWorker_h
+
+#include <memory>
+
+#include <QtCore/QObject>
+#include <QtCore/QProcess>
+
+static const int OVEN_STATUS_CODE_SUCCESS { 0 };
+static const int OVEN_STATUS_CODE_FAIL { 1 };
+static const int OVEN_STATUS_CODE_ABORT { 2 };
+
+/// Runs the oven in worker mode and hands it bake jobs over its standard input, so the cost of starting the oven and
+/// loading the baking library is paid once rather than for every asset.
+///
+/// The bakers stay in their own process, so a crash while baking only fails the job that caused it. The oven is
+/// started again for the next job.
+class OvenWorker : public QObject {
+    Q_OBJECT
+public:
+    OvenWorker(QObject* parent = nullptr);
+    ~OvenWorker();
+
+    bool isIdle() const { return _jobID == 0; }
+
+    /// Number of times the oven had to be started again after exiting
+    int getNumRestarts() const { return _numRestarts; }
+
+    /// Returns false, without finishing the job, when the oven can't be started
+    bool startJob(qint64 jobID, const QString& inputPath, const QString& outputDirectory, const QString& type);
+
+    /// Stops the oven, which finishes the current job as aborted
+    void abort();
+
+signals:
+    /// errors is only set when the job failed because of the oven process itself, rather than the bake
+    void jobFinished(qint64 jobID, int statusCode, QString errors);
+
+private slots:
+    void readResults();
+    void handleProcessFinished(int exitCode, QProcess::ExitStatus exitStatus);
+
+private:
+    bool ensureRunning();
+    void finishJob(int statusCode, const QString& errors);
+
+    std::unique_ptr<QProcess> _process;
+    qint64 _jobID { 0 };
+    bool _wasAborted { false };
+    bool _hasStarted { false };
+    int _numRestarts { 0 };
+};
+
+#endif // hifi_OvenWorker_h
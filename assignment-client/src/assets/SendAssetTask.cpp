@@ -11,6 +11,7 @@
 
 #include "SendAssetTask.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include <QFile>
@@ -26,11 +27,14 @@
 #include "ByteRange.h"
 #include "ClientServerUtils.h"
 
-SendAssetTask::SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir) :
+SendAssetTask::SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir,
+                             std::shared_ptr<HotAssetCache> assetCache, std::shared_ptr<AssetChunkStore> chunkStore) :
     QRunnable(),
     _message(message),
     _senderNode(sendToNode),
-    _resourcesDir(resourcesDir)
+    _resourcesDir(resourcesDir),
+    _assetCache(assetCache),
+    _chunkStore(chunkStore)
 {
     
 }
@@ -66,11 +70,14 @@ void SendAssetTask::run() {
         QString filePath = _resourcesDir.filePath(QString(hexHash));
         
         QFile file { filePath };
+        AssetUtils::AssetChunkManifest manifest;
 
         if (file.open(QIODevice::ReadOnly)) {
 
-            // first fixup the range based on the now known file size
+            // first fixup the range based on the now known file size, a range running past the end of the file gets the
+            // rest of it, and the reply tells how large the whole asset is
             byteRange.fixupRange(file.size());
+            byteRange.toExclusive = std::min(byteRange.toExclusive, (int64_t)file.size());
 
             // check if we're being asked to read data that we just don't have
             // because of the file size
@@ -82,29 +89,85 @@ void SendAssetTask::run() {
                 // we have a valid byte range, handle it and send the asset
                 auto size = byteRange.size();
 
-                if (byteRange.fromInclusive >= 0) {
-
-                    // this range is positive, meaning we just need to seek into the file and then read from there
-                    file.seek(byteRange.fromInclusive);
-                    replyPacketList->writePrimitive(AssetUtils::AssetServerError::NoError);
-                    replyPacketList->writePrimitive(size);
-                    replyPacketList->write(file.read(size));
+                // a positive range starts that far into the file, a negative one that far back from the end of it
+                qint64 offset = byteRange.fromInclusive >= 0 ? byteRange.fromInclusive : file.size() + byteRange.fromInclusive;
+
+                replyPacketList->writePrimitive(AssetUtils::AssetServerError::NoError);
+                replyPacketList->writePrimitive(size);
+                replyPacketList->writePrimitive((AssetUtils::DataOffset)file.size());
+
+                // write straight from the cached asset, or from a mapping of the file for assets that aren't cached,
+                // rather than reading the range into a temporary buffer first
+                QByteArray cachedAsset = _assetCache->get(hexHash, file, size);
+                if (cachedAsset.size() >= offset + size) {
+                    replyPacketList->write(cachedAsset.constData() + offset, size);
+                } else if (uchar* mappedRange = size > 0 ? file.map(offset, size) : nullptr) {
+                    replyPacketList->write(reinterpret_cast<const char*>(mappedRange), size);
+                    file.unmap(mappedRange);
                 } else {
-                    // this range is negative, at least the first part of the read will be back into the end of the file
+                    file.seek(offset);
+                    replyPacketList->write(file.read(size));
+                }
 
-                    // seek to the part of the file where the negative range begins
-                    file.seek(file.size() + byteRange.fromInclusive);
+                _assetCache->recordBytesServed(size);
 
+                qCDebug(networking) << "Sending asset: " << hexHash;
+            }
+            file.close();
+        } else if (_chunkStore && _chunkStore->loadManifest(hexHash, manifest)) {
+            qint64 assetSize = 0;
+            for (const auto& chunk : manifest) {
+                assetSize += chunk.size;
+            }
+
+            byteRange.fixupRange(assetSize);
+            byteRange.toExclusive = std::min(byteRange.toExclusive, (int64_t)assetSize);
+
+            if (assetSize < byteRange.fromInclusive || assetSize < byteRange.toExclusive) {
+                replyPacketList->writePrimitive(AssetUtils::AssetServerError::InvalidByteRange);
+                qCDebug(networking) << "Bad byte range: " << hexHash << " "
+                    << byteRange.fromInclusive << ":" << byteRange.toExclusive;
+            } else {
+                auto size = byteRange.size();
+                qint64 offset = byteRange.fromInclusive >= 0 ? byteRange.fromInclusive : assetSize + byteRange.fromInclusive;
+
+                // the chunks are read before anything is written, so a missing chunk turns into an error reply
+                // rather than a reply cut short
+                auto readChunks = [&](qint64 from, qint64 length) {
+                    QByteArray data;
+                    data.reserve(length);
+                    bool read = _chunkStore->readRange(manifest, from, length, [&](const char* chunkData, qint64 chunkSize) {
+                        data.append(chunkData, (int)chunkSize);
+                    });
+                    return read && data.size() == length ? data : QByteArray();
+                };
+
+                // assets that aren't cached only have the requested range read
+                QByteArray cachedAsset = _assetCache->get(hexHash, assetSize, size, [&] { return readChunks(0, assetSize); });
+                bool fromCache = cachedAsset.size() >= offset + size;
+                QByteArray range;
+                if (!fromCache) {
+                    range = readChunks(offset, size);
+                }
+                bool read = fromCache || range.size() == size;
+
+                if (read) {
                     replyPacketList->writePrimitive(AssetUtils::AssetServerError::NoError);
                     replyPacketList->writePrimitive(size);
+                    replyPacketList->writePrimitive((AssetUtils::DataOffset)assetSize);
+                    if (fromCache) {
+                        replyPacketList->write(cachedAsset.constData() + offset, size);
+                    } else {
+                        replyPacketList->write(range);
+                    }
 
-                    // first write everything from the negative range to the end of the file
-                    replyPacketList->write(file.read(size));
-                }
+                    _assetCache->recordBytesServed(size);
 
-                qCDebug(networking) << "Sending asset: " << hexHash;
+                    qCDebug(networking) << "Sending chunked asset: " << hexHash;
+                } else {
+                    replyPacketList->writePrimitive(AssetUtils::AssetServerError::FileOperationFailed);
+                }
             }
-            file.close();
         } else {
             qCDebug(networking) << "Asset not found: " << filePath << "(" << hexHash << ")";
             replyPacketList->writePrimitive(AssetUtils::AssetServerError::AssetNotFound);
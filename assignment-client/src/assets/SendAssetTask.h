@@ -17,15 +17,18 @@
 #include <QtCore/QString>
 #include <QtCore/QRunnable>
 
+#include "AssetChunkStore.h"
 #include "AssetUtils.h"
 #include "AssetServer.h"
+#include "HotAssetCache.h"
 #include "Node.h"
 
 class NLPacket;
 
 class SendAssetTask : public QRunnable {
 public:
-    SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir);
+    SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir,
+                  std::shared_ptr<HotAssetCache> assetCache, std::shared_ptr<AssetChunkStore> chunkStore = nullptr);
 
     void run() override;
 
@@ -33,6 +36,8 @@ private:
     QSharedPointer<ReceivedMessage> _message;
     SharedNodePointer _senderNode;
     QDir _resourcesDir;
+    std::shared_ptr<HotAssetCache> _assetCache;
+    std::shared_ptr<AssetChunkStore> _chunkStore;
 };
 
 #endif
@@ -11,7 +11,7 @@
 
 #include "UploadAssetTask.h"
 
-#include <QtCore/QBuffer>
+#include <QtCore/QCryptographicHash>
 #include <QtCore/QFile>
 
 #include <AssetUtils.h>
@@ -21,26 +21,36 @@
 #include "ClientServerUtils.h"
 
 UploadAssetTask::UploadAssetTask(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode,
-                                 const QDir& resourcesDir, uint64_t filesizeLimit) :
+                                 const QDir& resourcesDir, uint64_t filesizeLimit,
+                                 std::shared_ptr<AssetChunkStore> chunkStore) :
     _receivedMessage(receivedMessage),
     _senderNode(senderNode),
     _resourcesDir(resourcesDir),
-    _filesizeLimit(filesizeLimit)
+    _filesizeLimit(filesizeLimit),
+    _chunkStore(chunkStore)
 {
     
 }
 
+static qint64 writeSpans(QFile& file, const ReceivedMessage::Spans& spans) {
+    qint64 bytesWritten = 0;
+    for (const auto& span : spans) {
+        if (file.write(span.data, span.size) != span.size) {
+            return -1;
+        }
+        bytesWritten += span.size;
+    }
+    return bytesWritten;
+}
+
 void UploadAssetTask::run() {
-    auto data = _receivedMessage->getMessage();
-    
-    QBuffer buffer { &data };
-    buffer.open(QIODevice::ReadOnly);
-    
+    _receivedMessage->seek(0);
+
     MessageID messageID;
-    buffer.read(reinterpret_cast<char*>(&messageID), sizeof(messageID));
+    _receivedMessage->readPrimitive(&messageID);
     
     uint64_t fileSize;
-    buffer.read(reinterpret_cast<char*>(&fileSize), sizeof(fileSize));
+    _receivedMessage->readPrimitive(&fileSize);
 
     if (_senderNode) {
         qDebug() << "UploadAssetTask reading a file of " << fileSize << "bytes from" << uuidStringWithoutCurlyBraces(_senderNode->getUUID());
@@ -54,9 +64,15 @@ void UploadAssetTask::run() {
     if (fileSize > _filesizeLimit) {
         replyPacket->writePrimitive(AssetUtils::AssetServerError::AssetTooLarge);
     } else {
-        QByteArray fileData = buffer.read(fileSize);
-        
-        auto hash = AssetUtils::hashData(fileData);
+        // hash and write the file straight from the packets it was uploaded in, rather than from a reassembled copy
+        auto fileData = _receivedMessage->readSpans(fileSize);
+
+        QCryptographicHash hasher { QCryptographicHash::Sha256 };
+        for (const auto& span : fileData) {
+            hasher.addData(span.data, (int)span.size);
+        }
+
+        auto hash = hasher.result();
         auto hexHash = hash.toHex();
 
         if (_senderNode) {
@@ -69,7 +85,15 @@ void UploadAssetTask::run() {
 
         bool existingCorrectFile = false;
         
-        if (file.exists()) {
+        if (_chunkStore && _chunkStore->hasAsset(hexHash)) {
+            // manifests are only written once every chunk of the asset is, so there is nothing left to verify
+            qDebug() << "Not overwriting existing chunked asset: " << hexHash;
+
+            existingCorrectFile = true;
+
+            replyPacket->writePrimitive(AssetUtils::AssetServerError::NoError);
+            replyPacket->write(hash);
+        } else if (file.exists()) {
             // check if the local file has the correct contents, otherwise we overwrite
             if (file.open(QIODevice::ReadOnly) && AssetUtils::hashData(file.readAll()) == hash) {
                 qDebug() << "Not overwriting existing verified file: " << hexHash;
@@ -84,8 +108,26 @@ void UploadAssetTask::run() {
             }
         }
 
-        if (!existingCorrectFile) {
-            if (file.open(QIODevice::WriteOnly) && file.write(fileData) == qint64(fileSize)) {
+        if (!existingCorrectFile && _chunkStore) {
+            qint64 bytesReceived = 0;
+            for (const auto& span : fileData) {
+                bytesReceived += span.size;
+            }
+
+            if (bytesReceived == qint64(fileSize) && _chunkStore->storeAsset(hexHash, fileData)) {
+                qDebug() << "Stored file" << hexHash << "in chunks. Upload complete";
+
+                // a stale whole copy that failed verification above would otherwise shadow the chunked one
+                file.remove();
+
+                replyPacket->writePrimitive(AssetUtils::AssetServerError::NoError);
+                replyPacket->write(hash);
+            } else {
+                qWarning() << "Failed to upload or store chunks of" << hexHash << " - upload failed.";
+                replyPacket->writePrimitive(AssetUtils::AssetServerError::FileOperationFailed);
+            }
+        } else if (!existingCorrectFile) {
+            if (file.open(QIODevice::WriteOnly) && writeSpans(file, fileData) == qint64(fileSize)) {
                 qDebug() << "Wrote file" << hexHash << "to disk. Upload complete";
                 file.close();
 
@@ -14,11 +14,14 @@
 #ifndef hifi_UploadAssetTask_h
 #define hifi_UploadAssetTask_h
 
+#include <memory>
+
 #include <QtCore/QDir>
 #include <QtCore/QObject>
 #include <QtCore/QRunnable>
 #include <QtCore/QSharedPointer>
 
+#include "AssetChunkStore.h"
 #include "ReceivedMessage.h"
 
 class NLPacketList;
@@ -27,7 +30,8 @@ class Node;
 class UploadAssetTask : public QRunnable {
 public:
     UploadAssetTask(QSharedPointer<ReceivedMessage> message, QSharedPointer<Node> senderNode, 
-                    const QDir& resourcesDir, uint64_t filesizeLimit);
+                    const QDir& resourcesDir, uint64_t filesizeLimit,
+                    std::shared_ptr<AssetChunkStore> chunkStore = nullptr);
 
     void run() override;
 
@@ -36,6 +40,7 @@ private:
     QSharedPointer<Node> _senderNode;
     QDir _resourcesDir;
     uint64_t _filesizeLimit;
+    std::shared_ptr<AssetChunkStore> _chunkStore; // uploads are stored whole when null
 };
 
 #endif // hifi_UploadAssetTask_h
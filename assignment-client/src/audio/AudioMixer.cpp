@@ -429,6 +429,11 @@ void AudioMixer::start() {
             auto timer = _checkTimeTiming.timer();
             auto frameDuration = timeFrame();
             throttle(frameDuration, frame);
+
+            _frameTimeHistogram.record((double)frameDuration.count() / USECS_PER_SECOND);
+            if (frameDuration.count() > AudioConstants::NETWORK_FRAME_USECS) {
+                ++_frameOverruns;
+            }
         }
 
         auto frameTimer = _frameTiming.timer();
@@ -471,11 +476,16 @@ void AudioMixer::start() {
         // gather stats
         _slavePool.each([&](AudioMixerSlave& slave) {
             _stats.accumulate(slave.stats);
+            _totalStreams += slave.stats.sumStreams;
+            _totalListeners += slave.stats.sumListeners;
+            _totalMixes += slave.stats.totalMixes;
+            _totalHRTFRenders += slave.stats.hrtfRenders;
             slave.stats.reset();
         });
 
         ++frame;
         ++_numStatFrames;
+        ++_totalFrames;
 
 
         if (_isFinished) {
@@ -486,6 +496,24 @@ void AudioMixer::start() {
     }
 }
 
+void AudioMixer::collectMetrics(OpenMetricsWriter& metrics) {
+    ThreadedAssignment::collectMetrics(metrics);
+
+    metrics.addGauge("overte_audio_mixer_threads", "Mixer worker threads", _slavePool.numThreads());
+    metrics.addGauge("overte_audio_mixer_trailing_mix_ratio", "Trailing ratio of mix time to frame time", _trailingMixRatio);
+    metrics.addGauge("overte_audio_mixer_throttling_ratio", "Ratio of streams being throttled", _throttlingRatio);
+
+    metrics.addCounter("overte_audio_mixer_frames", "Mix frames run", _totalFrames);
+    metrics.addCounter("overte_audio_mixer_frame_overruns", "Mix frames that took longer than the network frame",
+                       _frameOverruns);
+    metrics.addHistogram("overte_audio_mixer_frame_seconds", "Time spent mixing each frame", _frameTimeHistogram);
+
+    metrics.addCounter("overte_audio_mixer_streams", "Streams considered for mixing", _totalStreams);
+    metrics.addCounter("overte_audio_mixer_listeners", "Listeners mixed for", _totalListeners);
+    metrics.addCounter("overte_audio_mixer_mixes", "Stream mixes", _totalMixes);
+    metrics.addCounter("overte_audio_mixer_hrtf_renders", "HRTF renders", _totalHRTFRenders);
+}
+
 chrono::microseconds AudioMixer::timeFrame() {
     // advance the next frame
     auto now = p_high_resolution_clock::now();
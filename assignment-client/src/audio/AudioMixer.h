@@ -17,6 +17,7 @@
 #include <AABox.h>
 #include <AudioHRTF.h>
 #include <AudioRingBuffer.h>
+#include <OpenMetrics.h>
 #include <ThreadedAssignment.h>
 #include <UUIDHasher.h>
 
@@ -84,6 +85,9 @@ private slots:
     void removeHRTFsForFinishedInjector(const QUuid& streamID);
     void start();
 
+protected:
+    void collectMetrics(OpenMetricsWriter& metrics) override;
+
 private:
     // mixing helpers
     std::chrono::microseconds timeFrame();
@@ -107,6 +111,15 @@ private:
     int _numStatFrames { 0 };
     AudioMixerStats _stats;
 
+    // cumulative since the mixer started, for metrics scrapes
+    uint64_t _totalStreams { 0 };
+    uint64_t _totalListeners { 0 };
+    uint64_t _totalMixes { 0 };
+    uint64_t _totalHRTFRenders { 0 };
+    uint64_t _totalFrames { 0 };
+    uint64_t _frameOverruns { 0 };
+    MetricsHistogram _frameTimeHistogram;
+
     AudioMixerSlavePool _slavePool { _workerSharedData };
 
     class Timer {
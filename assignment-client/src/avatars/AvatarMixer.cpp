@@ -20,6 +20,7 @@
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDateTime>
+#include <QtCore/QJsonArray>
 #include <QtCore/QJsonObject>
 #include <QtCore/QRegularExpression>
 #include <QtCore/QTimer>
@@ -33,6 +34,7 @@
 #include <NodeList.h>
 #include <udt/PacketHeaders.h>
 #include <SharedUtil.h>
+#include <StreamUtils.h>
 #include <UUID.h>
 #include <TryLocker.h>
 #include "../AssignmentDynamicFactory.h"
@@ -264,6 +266,11 @@ void AvatarMixer::start() {
         auto frameDuration = timeFrame(frameTimestamp); // calculates last frame duration and sleeps remainder of target amount
         throttle(frameDuration, frame); // determines _throttlingRatio for upcoming mix frame
 
+        _frameTimeHistogram.record((double)frameDuration.count() / USECS_PER_SECOND);
+        if (frameDuration.count() > (int64_t)(USECS_PER_SECOND / AVATAR_MIXER_BROADCAST_FRAMES_PER_SECOND)) {
+            ++_frameOverruns;
+        }
+
         int lockWait, nodeTransform, functor;
 
         // Set our query each frame
@@ -347,6 +354,7 @@ void AvatarMixer::start() {
 
         ++frame;
         ++_numTightLoopFrames;
+        ++_totalFrames;
         _loopRate.increment();
 
         // play nice with qt event-looping
@@ -488,6 +496,13 @@ void AvatarMixer::throttle(std::chrono::microseconds duration, int frame) {
 }
 
 
+// whether an agent is replicated to a downstream mixer because it is in or near the region that mixer owns
+static bool isRegionAvatarOf(const Node& avatarNode, const Node& downstreamNode) {
+    auto downstreamNodeData = reinterpret_cast<const AvatarMixerClientData*>(downstreamNode.getLinkedData());
+    return downstreamNode.getType() == NodeType::DownstreamAvatarMixer && downstreamNodeData &&
+        downstreamNodeData->isRegionAvatar(avatarNode.getLocalID());
+}
+
 void AvatarMixer::handleAvatarKilled(SharedNodePointer avatarNode) {
     if (avatarNode->getType() == NodeType::Agent
         && avatarNode->getLinkedData()) {
@@ -522,7 +537,7 @@ void AvatarMixer::handleAvatarKilled(SharedNodePointer avatarNode) {
             // and downstream avatar mixers, if the node that was just killed was being replicatedConnectedAgent
             return node->getActiveSocket() &&
                 (((node->getType() == NodeType::Agent || node->getType() == NodeType::EntityScriptServer) && !node->isUpstream()) ||
-                 (avatarNode->isReplicated() && shouldReplicateTo(*avatarNode, *node)));
+                 ((avatarNode->isReplicated() || isRegionAvatarOf(*avatarNode, *node)) && shouldReplicateTo(*avatarNode, *node)));
         }, [&](const SharedNodePointer& node) {
             if (node->getType() == NodeType::Agent || node->getType() == NodeType::EntityScriptServer) {
                 if (!killPacket) {
@@ -639,6 +654,7 @@ void AvatarMixer::handleRequestsDomainListDataPacket(QSharedPointer<ReceivedMess
                     [&](const SharedNodePointer& node) {
                         nodeData->setLastBroadcastTime(node->getLocalID(), 0);
                         nodeData->resetSentTraitData(node->getLocalID());
+                        nodeData->resetBatchedAvatar(node->getLocalID());
                 }
                 );
             }
@@ -706,6 +722,7 @@ void AvatarMixer::handleNodeIgnoreRequestPacket(QSharedPointer<ReceivedMessage>
                 // to the ignorer if the ignorer unignores.
                 nodeData->setLastBroadcastTime(ignoredNode->getLocalID(), 0);
                 nodeData->resetSentTraitData(ignoredNode->getLocalID());
+                nodeData->resetBatchedAvatar(ignoredNode->getLocalID());
             }
 
 
@@ -716,6 +733,7 @@ void AvatarMixer::handleNodeIgnoreRequestPacket(QSharedPointer<ReceivedMessage>
             if (ignoredNodeData) {
                 ignoredNodeData->setLastBroadcastTime(senderNode->getLocalID(), 0);
                 ignoredNodeData->resetSentTraitData(senderNode->getLocalID());
+                ignoredNodeData->resetBatchedAvatar(senderNode->getLocalID());
             }
         }
 
@@ -751,6 +769,37 @@ void AvatarMixer::handleRadiusIgnoreRequestPacket(QSharedPointer<ReceivedMessage
     _handleRadiusIgnoreRequestPacketElapsedTime += (end - start);
 }
 
+void AvatarMixer::collectMetrics(OpenMetricsWriter& metrics) {
+    ThreadedAssignment::collectMetrics(metrics);
+
+    metrics.addGauge("overte_avatar_mixer_threads", "Mixer worker threads", _slavePool.numThreads());
+    metrics.addGauge("overte_avatar_mixer_trailing_mix_ratio", "Trailing ratio of broadcast time to frame time",
+                     _trailingMixRatio);
+    metrics.addGauge("overte_avatar_mixer_throttling_ratio", "Ratio of avatars being throttled", _throttlingRatio);
+
+    metrics.addCounter("overte_avatar_mixer_frames", "Broadcast frames run", _totalFrames);
+    metrics.addCounter("overte_avatar_mixer_frame_overruns", "Broadcast frames that took longer than the frame interval",
+                       _frameOverruns);
+    metrics.addHistogram("overte_avatar_mixer_frame_seconds", "Time spent in each broadcast frame", _frameTimeHistogram);
+
+    // the slave stats are harvested when the stats packet is sent, so these advance once per stats interval
+    metrics.addCounter("overte_avatar_mixer_listeners_broadcast", "Listeners broadcast to", _totalNodesBroadcastedTo);
+    metrics.addCounter("overte_avatar_mixer_listener_frames_skipped", "Broadcast frames skipped for listeners on a reduced rate",
+                       _totalListenerFramesSkipped);
+    metrics.addCounter("overte_avatar_mixer_avatars_included", "Avatars included in broadcasts", _totalOthersIncluded);
+    metrics.addCounter("overte_avatar_mixer_batched_avatar_positions", "Out-of-view avatars sent as batched positions",
+                       _totalBatchedAvatarPositions);
+    metrics.addCounter("overte_avatar_mixer_over_budget_avatars", "Avatars left out of broadcasts for bandwidth",
+                       _totalOverBudgetAvatars);
+    metrics.addCounter("overte_avatar_mixer_data_bytes", "Avatar data bytes sent", _totalDataBytesSent);
+    metrics.addCounter("overte_avatar_mixer_traits_bytes", "Avatar traits bytes sent", _totalTraitsBytesSent);
+    metrics.addCounter("overte_avatar_mixer_identity_bytes", "Avatar identity bytes sent", _totalIdentityBytesSent);
+    metrics.addCounter("overte_avatar_mixer_joint_data_bytes", "Avatar joint data bytes sent", _totalJointDataBytesSent);
+    metrics.addCounter("overte_avatar_mixer_compressed_joint_sections", "Joint data sections sent compressed",
+                       _totalCompressedJointSections);
+    metrics.addCounter("overte_avatar_mixer_joint_keyframes", "Compressed joint data keyframes sent", _totalJointKeyframesSent);
+}
+
 void AvatarMixer::sendStatsPacket() {
     if (!_numTightLoopFrames) {
         return;
@@ -830,6 +879,18 @@ void AvatarMixer::sendStatsPacket() {
         aggregateStats += stats;
     });
 
+    _totalNodesBroadcastedTo += aggregateStats.nodesBroadcastedTo;
+    _totalListenerFramesSkipped += aggregateStats.listenerFramesSkipped;
+    _totalOthersIncluded += aggregateStats.numOthersIncluded;
+    _totalBatchedAvatarPositions += aggregateStats.numBatchedAvatarPositions;
+    _totalOverBudgetAvatars += aggregateStats.overBudgetAvatars;
+    _totalDataBytesSent += aggregateStats.numDataBytesSent;
+    _totalTraitsBytesSent += aggregateStats.numTraitsBytesSent;
+    _totalIdentityBytesSent += aggregateStats.numIdentityBytesSent;
+    _totalJointDataBytesSent += aggregateStats.numJointDataBytesSent;
+    _totalCompressedJointSections += aggregateStats.numCompressedJointSections;
+    _totalJointKeyframesSent += aggregateStats.numJointKeyframesSent;
+
     QJsonObject slavesAggregatObject;
 
     slavesAggregatObject["received_1_nodesProcessed"] = TIGHT_LOOP_STAT(aggregateStats.nodesProcessed);
@@ -848,6 +909,17 @@ void AvatarMixer::sendStatsPacket() {
     slavesAggregatObject["sent_6_averageIdentityBytes"] = TIGHT_LOOP_STAT(aggregateStats.numIdentityBytesSent);
     slavesAggregatObject["sent_7_averageHeroAvatars"] = TIGHT_LOOP_STAT(aggregateStats.numHeroesIncluded);
 
+    int numOthersIncluded = aggregateStats.numOthersIncluded;
+    slavesAggregatObject["sent_8_averageBytesPerAvatar"] =
+        numOthersIncluded ? (float)aggregateStats.numDataBytesSent / numOthersIncluded : 0.0f;
+    slavesAggregatObject["sent_9_averageJointBytesPerAvatar"] =
+        numOthersIncluded ? (float)aggregateStats.numJointDataBytesSent / numOthersIncluded : 0.0f;
+    slavesAggregatObject["sent_10_compressedJointSections"] = TIGHT_LOOP_STAT(aggregateStats.numCompressedJointSections);
+    slavesAggregatObject["sent_11_jointKeyframes"] = TIGHT_LOOP_STAT(aggregateStats.numJointKeyframesSent);
+    slavesAggregatObject["sent_12_regionAvatarsReplicated"] = TIGHT_LOOP_STAT(aggregateStats.numRegionAvatarsReplicated);
+    slavesAggregatObject["sent_13_listenerFramesSkipped"] = TIGHT_LOOP_STAT(aggregateStats.listenerFramesSkipped);
+    slavesAggregatObject["sent_14_batchedAvatarPositions"] = TIGHT_LOOP_STAT(aggregateStats.numBatchedAvatarPositions);
+
     slavesAggregatObject["timing_1_processIncomingPackets"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.processIncomingPacketsElapsedTime);
     slavesAggregatObject["timing_2_ignoreCalculation"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.ignoreCalculationElapsedTime);
     slavesAggregatObject["timing_3_toByteArray"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.toByteArrayElapsedTime);
@@ -1040,6 +1112,13 @@ void AvatarMixer::parseDomainServerSettings(const QJsonObject& domainSettings) {
         }
     }
 
+    parseDownstreamRegions(domainSettings, avatarMixerGroupObject);
+
+    static const QString COMPRESSED_JOINT_DATA_OPTION = "compressed_joint_data";
+    _slaveSharedData.compressJointData = avatarMixerGroupObject[COMPRESSED_JOINT_DATA_OPTION].toBool(false);
+    qCDebug(avatars) << "Avatar mixer" << (_slaveSharedData.compressJointData ? "compresses" : "does not compress")
+                     << "the joint data it sends";
+
     const QString AVATARS_SETTINGS_KEY = "avatars";
 
     static const QString MIN_HEIGHT_OPTION = "min_avatar_height";
@@ -1078,6 +1157,61 @@ void AvatarMixer::parseDomainServerSettings(const QJsonObject& domainSettings) {
     }
 }
 
+void AvatarMixer::parseDownstreamRegions(const QJsonObject& domainSettings, const QJsonObject& avatarMixerGroupObject) {
+    // the agents in or near the region of a downstream avatar mixer are replicated to it, on top of the broadcasted users,
+    // so that its listeners see the avatars across the boundary. Regions are configured by hand in the broadcasting
+    // settings: the domain server doesn't assign them, and listeners are never handed off between mixers, so this only
+    // splits the encoding work when the listeners themselves are split across the mixers.
+    static const QString REGION_BOUNDARY_MARGIN_OPTION = "region_boundary_margin";
+    const float DEFAULT_REGION_BOUNDARY_MARGIN = 10.0f;
+    float margin = std::max(0.0f, (float)avatarMixerGroupObject[REGION_BOUNDARY_MARGIN_OPTION]
+        .toDouble(DEFAULT_REGION_BOUNDARY_MARGIN));
+
+    static const QString BROADCASTING_SETTINGS_KEY = "broadcasting";
+    static const QString DOWNSTREAM_SERVERS_KEY = "downstream_servers";
+    QJsonArray downstreamServers = domainSettings[BROADCASTING_SETTINGS_KEY].toObject()[DOWNSTREAM_SERVERS_KEY].toArray();
+
+    _slaveSharedData.downstreamRegions.clear();
+    for (const auto& server : downstreamServers) {
+        QJsonObject serverObject = server.toObject();
+        if (NodeType::fromString(serverObject["server_type"].toString()) != NodeType::AvatarMixer) {
+            continue;
+        }
+
+        // min and max corners: "x,y,z,x,y,z"
+        QStringList corners = serverObject["region"].toString().split(',', Qt::SkipEmptyParts);
+        const int NUM_REGION_COMPONENTS = 6;
+        if (corners.size() != NUM_REGION_COMPONENTS) {
+            if (!corners.isEmpty()) {
+                qCWarning(avatars) << "Ignoring malformed region of downstream avatar mixer"
+                                   << serverObject["address"].toString() << "-" << serverObject["region"].toString();
+            }
+            continue;
+        }
+        float values[NUM_REGION_COMPONENTS];
+        bool valid = true;
+        for (int i = 0; i < NUM_REGION_COMPONENTS && valid; i++) {
+            values[i] = corners[i].trimmed().toFloat(&valid);
+        }
+        if (!valid) {
+            qCWarning(avatars) << "Ignoring malformed region of downstream avatar mixer"
+                               << serverObject["address"].toString() << "-" << serverObject["region"].toString();
+            continue;
+        }
+
+        glm::vec3 minimum = glm::min(glm::vec3(values[0], values[1], values[2]), glm::vec3(values[3], values[4], values[5]));
+        glm::vec3 maximum = glm::max(glm::vec3(values[0], values[1], values[2]), glm::vec3(values[3], values[4], values[5]));
+        DownstreamRegion region;
+        region.sockAddr = SockAddr(SocketType::UDP, serverObject["address"].toString(),
+                                   (quint16)serverObject["port"].toString().toInt(), true);
+        region.region = AABox(minimum - glm::vec3(margin), maximum - minimum + glm::vec3(2.0f * margin));
+        _slaveSharedData.downstreamRegions.push_back(region);
+
+        qCDebug(avatars) << "Replicating avatars within" << margin << "m of" << minimum << "-" << maximum
+                         << "to downstream avatar mixer" << region.sockAddr;
+    }
+}
+
 void AvatarMixer::setupEntityQuery() {
     _entityViewer.init();
     EntityTreePointer entityTree = _entityViewer.getTree();
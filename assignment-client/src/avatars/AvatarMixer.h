@@ -20,6 +20,7 @@
 
 #include <set>
 #include <shared/RateCounter.h>
+#include <OpenMetrics.h>
 #include <PortableHighResolutionClock.h>
 
 #include <ThreadedAssignment.h>
@@ -70,12 +71,16 @@ private slots:
     void handleOctreePacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
     void start();
 
+protected:
+    void collectMetrics(OpenMetricsWriter& metrics) override;
+
 private:
     AvatarMixerClientData* getOrCreateClientData(SharedNodePointer node);
     std::chrono::microseconds timeFrame(p_high_resolution_clock::time_point& timestamp);
     void throttle(std::chrono::microseconds duration, int frame);
 
     void parseDomainServerSettings(const QJsonObject& domainSettings);
+    void parseDownstreamRegions(const QJsonObject& domainSettings, const QJsonObject& avatarMixerGroupObject);
     void sendIdentityPacket(AvatarMixerClientData* nodeData, const SharedNodePointer& destinationNode);
 
     void manageIdentityData(const SharedNodePointer& node);
@@ -153,6 +158,22 @@ private:
 
     RateCounter<> _loopRate; // this is the rate that the main thread tight loop runs
 
+    // cumulative since the mixer started, for metrics scrapes
+    uint64_t _totalFrames { 0 };
+    uint64_t _frameOverruns { 0 };
+    MetricsHistogram _frameTimeHistogram;
+    uint64_t _totalNodesBroadcastedTo { 0 };
+    uint64_t _totalListenerFramesSkipped { 0 };
+    uint64_t _totalOthersIncluded { 0 };
+    uint64_t _totalBatchedAvatarPositions { 0 };
+    uint64_t _totalOverBudgetAvatars { 0 };
+    uint64_t _totalDataBytesSent { 0 };
+    uint64_t _totalTraitsBytesSent { 0 };
+    uint64_t _totalIdentityBytesSent { 0 };
+    uint64_t _totalJointDataBytesSent { 0 };
+    uint64_t _totalCompressedJointSections { 0 };
+    uint64_t _totalJointKeyframesSent { 0 };
+
     AvatarMixerSlavePool _slavePool;
     SlaveSharedData _slaveSharedData;
 };
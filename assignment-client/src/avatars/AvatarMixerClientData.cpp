@@ -445,6 +445,7 @@ void AvatarMixerClientData::ignoreOther(const Node* self, const Node* other) {
         setLastBroadcastTime(other->getLocalID(), 0);
 
         resetSentTraitData(other->getLocalID());
+        resetBatchedAvatar(other->getLocalID());
 
         DependencyManager::get<NodeList>()->sendPacket(std::move(killPacket), *self);
     }
@@ -467,6 +468,26 @@ void AvatarMixerClientData::removeFromRadiusIgnoringSet(const QUuid& other) {
     }
 }
 
+// batched positions are sent unreliably, so an avatar is named in the first few batches it is in, and now and then after
+static const int BATCHED_AVATAR_ID_REPEATS = 3;
+static const int BATCHED_AVATAR_ID_REFRESH_INTERVAL = 45;
+
+bool AvatarMixerClientData::addBatchedAvatar(NLPacket::LocalID otherAvatar) {
+    auto& batchedAvatar = _batchedAvatars[otherAvatar];
+    batchedAvatar.batchedSinceLastEncode = true;
+    int batchIndex = batchedAvatar.numBatches++;
+    return batchIndex < BATCHED_AVATAR_ID_REPEATS || batchIndex % BATCHED_AVATAR_ID_REFRESH_INTERVAL == 0;
+}
+
+bool AvatarMixerClientData::takeBatchedSinceLastEncode(NLPacket::LocalID otherAvatar) {
+    auto it = _batchedAvatars.find(otherAvatar);
+    if (it != _batchedAvatars.end() && it->second.batchedSinceLastEncode) {
+        it->second.batchedSinceLastEncode = false;
+        return true;
+    }
+    return false;
+}
+
 void AvatarMixerClientData::resetSentTraitData(Node::LocalID nodeLocalID) {
     _lastSentTraitsTimestamps[nodeLocalID] = TraitsCheckTimestamp();
     _perNodeSentTraitVersions[nodeLocalID].reset();
@@ -491,6 +512,19 @@ void AvatarMixerClientData::readViewFrustumPacket(const QByteArray& message) {
 
         _currentViewFrustums.push_back(frustum);
     }
+
+    // older clients don't send the flags byte
+    uint8_t queryFlags = 0;
+    if (sourceBuffer < reinterpret_cast<const unsigned char*>(message.constData()) + message.size()) {
+        memcpy(&queryFlags, sourceBuffer, sizeof(queryFlags));
+    }
+
+    _broadcastInterval.setLowPowerMode((queryFlags & AvatarQueryFlags::LOW_POWER) != 0);
+}
+
+void AvatarMixerClientData::updateBroadcastInterval(int numChangedAvatars) {
+    _broadcastInterval.update(numChangedAvatars);
+    _broadcastRate.increment();
 }
 
 bool AvatarMixerClientData::otherAvatarInView(const AABox& otherAvatarBox) {
@@ -512,6 +546,9 @@ void AvatarMixerClientData::loadJSONStats(QJsonObject& jsonObject) const {
     jsonObject["av_data_receive_rate"] = _avatar->getReceiveRate();
     jsonObject["recent_other_av_in_view"] = _recentOtherAvatarsInView;
     jsonObject["recent_other_av_out_of_view"] = _recentOtherAvatarsOutOfView;
+    jsonObject["broadcast_rate"] = _broadcastRate.rate();
+    jsonObject["broadcast_interval_frames"] = _broadcastInterval.getInterval();
+    jsonObject["low_power_mode"] = _broadcastInterval.isLowPowerMode();
 }
 
 AvatarMixerClientData::TraitsCheckTimestamp AvatarMixerClientData::getLastOtherAvatarTraitsSendPoint(
@@ -531,6 +568,9 @@ void AvatarMixerClientData::cleanupKilledNode(const QUuid&, Node::LocalID nodeLo
     _lastSentTraitsTimestamps.erase(nodeLocalID);
     _perNodeSentTraitVersions.erase(nodeLocalID);
     _perNodeAckedTraitVersions.erase(nodeLocalID);
+    _lastOtherAvatarJointKeyframes.erase(nodeLocalID);
+    _regionAvatars.erase(nodeLocalID);
+    _batchedAvatars.erase(nodeLocalID);
     for (auto&& pendingTraitVersions : _perNodePendingTraitVersions) {
         pendingTraitVersions.second.erase(nodeLocalID);
     }
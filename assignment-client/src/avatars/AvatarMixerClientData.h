@@ -24,11 +24,14 @@
 
 #include "MixerAvatar.h"
 #include <AssociatedTraitValues.h>
+#include <AvatarBroadcastInterval.h>
+#include <JointDataCodec.h>
 #include <NodeData.h>
 #include <NumericalConstants.h>
 #include <udt/PacketHeaders.h>
 #include <PortableHighResolutionClock.h>
 #include <SimpleMovingAverage.h>
+#include <shared/RateCounter.h>
 #include <UUIDHasher.h>
 #include <shared/ConicalViewFrustum.h>
 
@@ -123,11 +126,29 @@ public:
     void setPrevRequestsDomainListData(bool requesting) { _prevRequestsDomainListData = requesting; }
 
     const ConicalViewFrustums& getViewFrustums() const { return _currentViewFrustums; }
+    bool isLowPowerMode() const { return _broadcastInterval.isLowPowerMode(); }
+
+    // adaptive broadcast rate - a listener with nothing changing around it, or in low power mode,
+    // is only sent avatar data on every Nth broadcast frame
+    bool isBroadcastFrame() { return _broadcastInterval.isBroadcastFrame(); }
+    int getBroadcastInterval() const { return _broadcastInterval.getInterval(); }
+    void updateBroadcastInterval(int numChangedAvatars);
 
     uint64_t getLastOtherAvatarEncodeTime(NLPacket::LocalID otherAvatar) const;
     void setLastOtherAvatarEncodeTime(NLPacket::LocalID otherAvatar, uint64_t time);
 
     QVector<JointData>& getLastOtherAvatarSentJoints(NLPacket::LocalID otherAvatar) { return _lastOtherAvatarSentJoints[otherAvatar]; }
+    JointDataCodec::Keyframe& getLastOtherAvatarJointKeyframe(NLPacket::LocalID otherAvatar) { return _lastOtherAvatarJointKeyframes[otherAvatar]; }
+
+    // out-of-view avatars whose positions are batched for this listener instead of being sent as MinimumData
+    bool addBatchedAvatar(NLPacket::LocalID otherAvatar);  // returns whether the batch should name the avatar
+    bool takeBatchedSinceLastEncode(NLPacket::LocalID otherAvatar);
+    void resetBatchedAvatar(NLPacket::LocalID otherAvatar) { _batchedAvatars.erase(otherAvatar); }
+
+    // for a downstream avatar mixer, the agents replicated to it because they are in or near the region it owns
+    using RegionAvatars = std::unordered_map<NLPacket::LocalID, QUuid>;
+    RegionAvatars& getRegionAvatars() { return _regionAvatars; }
+    bool isRegionAvatar(NLPacket::LocalID avatar) const { return _regionAvatars.find(avatar) != _regionAvatars.end(); }
 
     void queuePacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer node);
     int processPackets(const SlaveSharedData& slaveSharedData); // returns number of packets processed
@@ -176,6 +197,14 @@ private:
     // sending to "this" node
     std::unordered_map<NLPacket::LocalID, uint64_t> _lastOtherAvatarEncodeTime;
     std::unordered_map<NLPacket::LocalID, QVector<JointData>> _lastOtherAvatarSentJoints;
+    std::unordered_map<NLPacket::LocalID, JointDataCodec::Keyframe> _lastOtherAvatarJointKeyframes;
+    RegionAvatars _regionAvatars;
+
+    struct BatchedAvatar {
+        int numBatches { 0 };
+        bool batchedSinceLastEncode { false };
+    };
+    std::unordered_map<NLPacket::LocalID, BatchedAvatar> _batchedAvatars;
 
     uint64_t _identityChangeTimestamp;
     bool _avatarSessionDisplayNameMustChange{ true };
@@ -192,6 +221,8 @@ private:
     SimpleMovingAverage _avgOtherAvatarTraitsRate;
     std::vector<QUuid> _radiusIgnoredOthers;
     ConicalViewFrustums _currentViewFrustums;
+    AvatarBroadcastInterval _broadcastInterval;
+    RateCounter<> _broadcastRate;
 
     int _recentOtherAvatarsInView { 0 };
     int _recentOtherAvatarsOutOfView { 0 };
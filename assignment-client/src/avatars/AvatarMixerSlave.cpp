@@ -266,7 +266,12 @@ void AvatarMixerSlave::broadcastAvatarData(const SharedNodePointer& node) {
     quint64 start = usecTimestampNow();
 
     if ((node->getType() == NodeType::Agent || node->getType() == NodeType::EntityScriptServer) && node->getLinkedData() && node->getActiveSocket() && !node->isUpstream()) {
-        broadcastAvatarDataToAgent(node);
+        auto nodeData = reinterpret_cast<AvatarMixerClientData*>(node->getLinkedData());
+        if (nodeData->isBroadcastFrame()) {
+            broadcastAvatarDataToAgent(node);
+        } else {
+            _stats.listenerFramesSkipped++;
+        }
     } else if (node->getType() == NodeType::DownstreamAvatarMixer) {
         broadcastAvatarDataToDownstreamMixer(node);
     }
@@ -344,8 +349,9 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
     int identityBytesSent = 0;
     int traitBytesSent = 0;
 
-    // max number of avatarBytes per frame (13 900, typical)
-    const int maxAvatarBytesPerFrame = int(_maxKbpsPerNode * BYTES_PER_KILOBIT / AVATAR_MIXER_BROADCAST_FRAMES_PER_SECOND);
+    // max number of avatarBytes per frame (13 900, typical), spread over the frames skipped for a listener on a reduced rate
+    const int maxAvatarBytesPerFrame = int(_maxKbpsPerNode * BYTES_PER_KILOBIT / AVATAR_MIXER_BROADCAST_FRAMES_PER_SECOND)
+        * destinationNodeData->getBroadcastInterval();
     const int maxHeroBytesPerFrame = int(maxAvatarBytesPerFrame * _avatarHeroFraction);  // 5555, typical
 
     // keep track of the number of other avatars held back in this frame
@@ -354,6 +360,12 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
     // keep track of the number of other avatar frames skipped
     int numAvatarsWithSkippedFrames = 0;
 
+    // keep track of the number of other avatars whose joints moved enough to be sent, which sets this listener's rate
+    int numChangedAvatars = 0;
+
+    // out-of-view avatars only need their positions, which are batched rather than encoded one by one
+    std::vector<BatchedAvatar> batchedAvatars;
+
     // When this is true, the AvatarMixer will send Avatar data to a client
     // about avatars they've ignored or that are out of view
     bool PALIsOpen = destinationNodeData->getRequestsDomainListData();
@@ -573,33 +585,66 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
                 }
             }
 
-            QVector<JointData>& lastSentJointsForOther = destinationNodeData->getLastOtherAvatarSentJoints(sourceNode->getLocalID());
+            if (detail == AvatarData::MinimumData) {
+                bool nameAvatar = destinationNodeData->addBatchedAvatar(sourceNode->getLocalID());
+                batchedAvatars.push_back({ sourceNode->getLocalID(), nameAvatar ? sourceNode->getUUID() : QUuid(),
+                                           sourceAvatar->getClientGlobalPosition() });
+                numAvatarDataBytes += (int)AvatarDataPacket::BATCHED_AVATAR_POSITION_SIZE +
+                    (nameAvatar ? (int)AvatarDataPacket::BATCHED_AVATAR_ID_SIZE : 0);
+                _stats.numBatchedAvatarPositions++;
+            } else {
+                QVector<JointData>& lastSentJointsForOther = destinationNodeData->getLastOtherAvatarSentJoints(sourceNode->getLocalID());
+                JointDataCodec::Keyframe* jointKeyframeForOther = _sharedData->compressJointData ?
+                    &destinationNodeData->getLastOtherAvatarJointKeyframe(sourceNode->getLocalID()) : nullptr;
 
-            const bool distanceAdjust = true;
-            const bool dropFaceTracking = false;
-            AvatarDataPacket::SendStatus sendStatus;
-            sendStatus.sendUUID = true;
-
-            do {
-                auto startSerialize = chrono::high_resolution_clock::now();
-                QByteArray bytes = sourceAvatar->toByteArray(detail, lastEncodeForOther, lastSentJointsForOther,
-                    sendStatus, dropFaceTracking, distanceAdjust, destinationPosition,
-                    &lastSentJointsForOther, avatarSpaceAvailable);
-                auto endSerialize = chrono::high_resolution_clock::now();
-                _stats.toByteArrayElapsedTime +=
-                    (quint64)chrono::duration_cast<chrono::microseconds>(endSerialize - startSerialize).count();
-
-                avatarPacket->write(bytes);
-                avatarSpaceAvailable -= bytes.size();
-                numAvatarDataBytes += bytes.size();
-                if (!sendStatus || avatarSpaceAvailable < (int)AvatarDataPacket::MIN_BULK_PACKET_SIZE) {
-                    // Weren't able to fit everything.
-                    nodeList->sendPacket(std::move(avatarPacket), *destinationNode);
-                    ++numPacketsSent;
-                    avatarPacket = NLPacket::create(PacketType::BulkAvatarData);
-                    avatarSpaceAvailable = avatarPacketCapacity;
+                if (destinationNodeData->takeBatchedSinceLastEncode(sourceNode->getLocalID())) {
+                    // batches only carry the position, so send whatever else changed while the avatar was batched
+                    lastEncodeForOther = 0;
                 }
-            } while (!sendStatus);
+
+                const bool distanceAdjust = true;
+                const bool dropFaceTracking = false;
+                AvatarDataPacket::SendStatus sendStatus;
+                sendStatus.sendUUID = true;
+
+                // an avatar that walks or turns with still joints is changing just as much as one that gestures
+                bool avatarChanged = detail == AvatarData::CullSmallData && sourceAvatar->transformChangedSince(lastEncodeForOther);
+
+                do {
+                    auto startSerialize = chrono::high_resolution_clock::now();
+                    QByteArray bytes = sourceAvatar->toByteArray(detail, lastEncodeForOther, lastSentJointsForOther,
+                        sendStatus, dropFaceTracking, distanceAdjust, destinationPosition,
+                        &lastSentJointsForOther, avatarSpaceAvailable, nullptr, jointKeyframeForOther);
+                    auto endSerialize = chrono::high_resolution_clock::now();
+                    _stats.toByteArrayElapsedTime +=
+                        (quint64)chrono::duration_cast<chrono::microseconds>(endSerialize - startSerialize).count();
+                    _stats.numJointDataBytesSent += sendStatus.jointDataBytes;
+                    if (detail == AvatarData::CullSmallData && sendStatus.jointsChanged > 0) {
+                        avatarChanged = true;
+                    }
+                    if (sendStatus.sentCompressedJoints) {
+                        _stats.numCompressedJointSections++;
+                        if (sendStatus.sentJointKeyframe) {
+                            _stats.numJointKeyframesSent++;
+                        }
+                    }
+
+                    avatarPacket->write(bytes);
+                    avatarSpaceAvailable -= bytes.size();
+                    numAvatarDataBytes += bytes.size();
+                    if (!sendStatus || avatarSpaceAvailable < (int)AvatarDataPacket::MIN_BULK_PACKET_SIZE) {
+                        // Weren't able to fit everything.
+                        nodeList->sendPacket(std::move(avatarPacket), *destinationNode);
+                        ++numPacketsSent;
+                        avatarPacket = NLPacket::create(PacketType::BulkAvatarData);
+                        avatarSpaceAvailable = avatarPacketCapacity;
+                    }
+                } while (!sendStatus);
+
+                if (avatarChanged) {
+                    ++numChangedAvatars;
+                }
+            }
 
             if (detail != AvatarData::NoData) {
                 _stats.numOthersIncluded++;
@@ -647,6 +692,10 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
         ++numPacketsSent;
     }
 
+    if (!batchedAvatars.empty()) {
+        numAvatarDataBytes += sendBatchedAvatarPositions(batchedAvatars, destinationPosition, *destinationNode, numPacketsSent);
+    }
+
     _stats.numDataPacketsSent += numPacketsSent;
     _stats.numDataBytesSent += numAvatarDataBytes;
 
@@ -673,13 +722,75 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
     // record the number of avatars held back this frame
     destinationNodeData->recordNumOtherAvatarStarves(numAvatarsHeldBack);
     destinationNodeData->recordNumOtherAvatarSkips(numAvatarsWithSkippedFrames);
+    destinationNodeData->updateBroadcastInterval(numChangedAvatars);
 
     quint64 endPacketSending = usecTimestampNow();
     _stats.packetSendingElapsedTime += (endPacketSending - startPacketSending);
 }
 
+int AvatarMixerSlave::sendBatchedAvatarPositions(const std::vector<BatchedAvatar>& batchedAvatars, const glm::vec3& origin,
+                                                 const Node& destinationNode, int& numPacketsSent) {
+    auto nodeList = DependencyManager::get<NodeList>();
+
+    // the entry bytes were counted as the avatars were batched, this returns the header bytes
+    int headerBytesSent = 0;
+
+    auto packetBegin = batchedAvatars.cbegin();
+    while (packetBegin != batchedAvatars.cend()) {
+        auto packet = NLPacket::create(PacketType::BulkAvatarPositions);
+        int spaceAvailable = (int)packet->getPayloadCapacity() - (int)AvatarDataPacket::BATCHED_POSITIONS_HEADER_SIZE;
+
+        // take as many avatars as fit, each named one also needs room in the ID table
+        int numAvatarIDs = 0;
+        auto packetEnd = packetBegin;
+        for (; packetEnd != batchedAvatars.cend(); ++packetEnd) {
+            bool isNamed = !packetEnd->sessionID.isNull();
+            int entrySize = (int)AvatarDataPacket::BATCHED_AVATAR_POSITION_SIZE +
+                (isNamed ? (int)AvatarDataPacket::BATCHED_AVATAR_ID_SIZE : 0);
+            if (entrySize > spaceAvailable || (isNamed && numAvatarIDs == UINT8_MAX)) {
+                break;
+            }
+            spaceAvailable -= entrySize;
+            numAvatarIDs += isNamed ? 1 : 0;
+        }
+
+        AvatarDataPacket::BatchedPositionsHeader header { { origin.x, origin.y, origin.z }, (uint8_t)numAvatarIDs };
+        packet->writePrimitive(header);
+
+        for (auto it = packetBegin; it != packetEnd; ++it) {
+            if (!it->sessionID.isNull()) {
+                AvatarDataPacket::BatchedAvatarID avatarID;
+                avatarID.localID = it->localID;
+                memcpy(avatarID.sessionID, it->sessionID.toRfc4122().constData(), NUM_BYTES_RFC4122_UUID);
+                packet->writePrimitive(avatarID);
+            }
+        }
+
+        for (auto it = packetBegin; it != packetEnd; ++it) {
+            packet->writePrimitive(AvatarDataPacket::packBatchedAvatarPosition(it->localID, it->position - origin));
+        }
+
+        nodeList->sendPacket(std::move(packet), destinationNode);
+        ++numPacketsSent;
+        headerBytesSent += (int)AvatarDataPacket::BATCHED_POSITIONS_HEADER_SIZE;
+        packetBegin = packetEnd;
+    }
+
+    return headerBytesSent;
+}
+
 uint64_t REBROADCAST_IDENTITY_TO_DOWNSTREAM_EVERY_US = 5 * 1000 * 1000;
 
+// whether a local agent is in or near the region a downstream mixer owns, which makes it a boundary avatar of that mixer
+static bool isInDownstreamRegion(const Node& agentNode, const AABox* region) {
+    if (!region || agentNode.isUpstream()) {
+        // agents replicated to us are replicated further by the mixer they are connected to
+        return false;
+    }
+    auto agentNodeData = reinterpret_cast<const AvatarMixerClientData*>(agentNode.getLinkedData());
+    return region->contains(agentNodeData->getPosition());
+}
+
 void AvatarMixerSlave::broadcastAvatarDataToDownstreamMixer(const SharedNodePointer& node) {
     _stats.downstreamMixersBroadcastedTo++;
 
@@ -696,15 +807,23 @@ void AvatarMixerSlave::broadcastAvatarDataToDownstreamMixer(const SharedNodePoin
     // reset the number of sent avatars
     nodeData->resetNumAvatarsSentLastFrame();
 
+    const AABox* downstreamRegion = _sharedData->findDownstreamRegion(node->getPublicSocket());
+    AvatarMixerClientData::RegionAvatars regionAvatars;
+
     std::for_each(_begin, _end, [&](const SharedNodePointer& agentNode) {
         if (!AvatarMixer::shouldReplicateTo(*agentNode, *node)) {
             return;
         }
         
         // collect agents that we have avatar data for that we are supposed to replicate
-        if (agentNode->getType() == NodeType::Agent && agentNode->getLinkedData() && agentNode->isReplicated()) {
+        if (agentNode->getType() == NodeType::Agent && agentNode->getLinkedData() &&
+            (agentNode->isReplicated() || isInDownstreamRegion(*agentNode, downstreamRegion))) {
             const AvatarMixerClientData* agentNodeData = reinterpret_cast<const AvatarMixerClientData*>(agentNode->getLinkedData());
 
+            if (!agentNode->isReplicated()) {
+                regionAvatars[agentNode->getLocalID()] = agentNode->getUUID();
+            }
+
             AvatarSharedPointer otherAvatar = agentNodeData->getAvatarSharedPointer();
 
             quint64 startAvatarDataPacking = usecTimestampNow();
@@ -809,5 +928,22 @@ void AvatarMixerSlave::broadcastAvatarDataToDownstreamMixer(const SharedNodePoin
         quint64 endPacketSending = usecTimestampNow();
         _stats.packetSendingElapsedTime += (endPacketSending - startPacketSending);
     }
+
+    // the agents that moved away from the region are removed from the downstream mixer
+    auto& lastRegionAvatars = nodeData->getRegionAvatars();
+    for (const auto& regionAvatar : lastRegionAvatars) {
+        if (regionAvatars.find(regionAvatar.first) == regionAvatars.end()) {
+            auto killPacket = NLPacket::create(PacketType::ReplicatedKillAvatar,
+                                               NUM_BYTES_RFC4122_UUID + sizeof(KillAvatarReason));
+            killPacket->write(regionAvatar.second.toRfc4122());
+            killPacket->writePrimitive(KillAvatarReason::NoReason);
+            DependencyManager::get<NodeList>()->sendUnreliablePacket(*killPacket, *node);
+
+            // the identity has to be sent again if the agent comes back
+            nodeData->removeLastBroadcastTime(regionAvatar.first);
+        }
+    }
+    _stats.numRegionAvatarsReplicated += (int)regionAvatars.size();
+    lastRegionAvatars = std::move(regionAvatars);
 }
 
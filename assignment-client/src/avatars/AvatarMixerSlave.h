@@ -12,6 +12,10 @@
 #ifndef hifi_AvatarMixerSlave_h
 #define hifi_AvatarMixerSlave_h
 
+#include <algorithm>
+#include <vector>
+
+#include <AABox.h>
 #include <NodeList.h>
 
 class AvatarMixerClientData;
@@ -23,6 +27,7 @@ public:
     quint64 processIncomingPacketsElapsedTime { 0 };
 
     int nodesBroadcastedTo { 0 };
+    int listenerFramesSkipped { 0 };
     int downstreamMixersBroadcastedTo { 0 };
     int numDataBytesSent { 0 };
     int numTraitsBytesSent { 0 };
@@ -33,6 +38,11 @@ public:
     int numOthersIncluded { 0 };
     int overBudgetAvatars { 0 };
     int numHeroesIncluded { 0 };
+    int numJointDataBytesSent { 0 };
+    int numCompressedJointSections { 0 };
+    int numJointKeyframesSent { 0 };
+    int numRegionAvatarsReplicated { 0 };
+    int numBatchedAvatarPositions { 0 };
 
     quint64 ignoreCalculationElapsedTime { 0 };
     quint64 avatarDataPackingElapsedTime { 0 };
@@ -48,6 +58,7 @@ public:
 
         // sending job stats
         nodesBroadcastedTo = 0;
+        listenerFramesSkipped = 0;
         downstreamMixersBroadcastedTo = 0;
 
         numDataBytesSent = 0;
@@ -59,6 +70,11 @@ public:
         numOthersIncluded = 0;
         overBudgetAvatars = 0;
         numHeroesIncluded = 0;
+        numJointDataBytesSent = 0;
+        numCompressedJointSections = 0;
+        numJointKeyframesSent = 0;
+        numRegionAvatarsReplicated = 0;
+        numBatchedAvatarPositions = 0;
 
         ignoreCalculationElapsedTime = 0;
         avatarDataPackingElapsedTime = 0;
@@ -73,6 +89,7 @@ public:
         processIncomingPacketsElapsedTime += rhs.processIncomingPacketsElapsedTime;
 
         nodesBroadcastedTo += rhs.nodesBroadcastedTo;
+        listenerFramesSkipped += rhs.listenerFramesSkipped;
         downstreamMixersBroadcastedTo += rhs.downstreamMixersBroadcastedTo;
         numDataBytesSent += rhs.numDataBytesSent;
         numTraitsBytesSent += rhs.numTraitsBytesSent;
@@ -83,6 +100,11 @@ public:
         numOthersIncluded += rhs.numOthersIncluded;
         overBudgetAvatars += rhs.overBudgetAvatars;
         numHeroesIncluded += rhs.numHeroesIncluded;
+        numJointDataBytesSent += rhs.numJointDataBytesSent;
+        numCompressedJointSections += rhs.numCompressedJointSections;
+        numJointKeyframesSent += rhs.numJointKeyframesSent;
+        numRegionAvatarsReplicated += rhs.numRegionAvatarsReplicated;
+        numBatchedAvatarPositions += rhs.numBatchedAvatarPositions;
 
         ignoreCalculationElapsedTime += rhs.ignoreCalculationElapsedTime;
         avatarDataPackingElapsedTime += rhs.avatarDataPackingElapsedTime;
@@ -96,10 +118,25 @@ public:
 class EntityTree;
 using EntityTreePointer = std::shared_ptr<EntityTree>;
 
+// a region of the domain owned by a downstream avatar mixer, when the domain is sharded across avatar mixers
+struct DownstreamRegion {
+    SockAddr sockAddr;
+    AABox region; // grown by the boundary margin
+};
+
 struct SlaveSharedData {
     QStringList skeletonURLWhitelist;
     QUrl skeletonReplacementURL;
     EntityTreePointer entityTree;
+    bool compressJointData { false };
+    std::vector<DownstreamRegion> downstreamRegions;
+
+    const AABox* findDownstreamRegion(const SockAddr& sockAddr) const {
+        auto it = std::find_if(downstreamRegions.begin(), downstreamRegions.end(), [&](const DownstreamRegion& region) {
+            return region.sockAddr == sockAddr;
+        });
+        return it != downstreamRegions.end() ? &it->region : nullptr;
+    }
 };
 
 class AvatarMixerSlave {
@@ -131,6 +168,15 @@ private:
                                         const AvatarMixerClientData* sendingNodeData,
                                         NLPacketList& traitsPacketList);
 
+    // an out-of-view avatar whose position goes into the listener's BulkAvatarPositions packets
+    struct BatchedAvatar {
+        NLPacket::LocalID localID;
+        QUuid sessionID;  // null unless this batch names the avatar
+        glm::vec3 position;
+    };
+    int sendBatchedAvatarPositions(const std::vector<BatchedAvatar>& batchedAvatars, const glm::vec3& origin,
+                                   const Node& destinationNode, int& numPacketsSent);
+
     void broadcastAvatarDataToAgent(const SharedNodePointer& node);
     void broadcastAvatarDataToDownstreamMixer(const SharedNodePointer& node);
 
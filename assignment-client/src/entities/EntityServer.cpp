@@ -397,6 +397,29 @@ QString EntityServer::serverSubclassStats() {
     statsString += QString("       EntityItem size... %1 bytes\r\n").arg(sizeof(EntityItem));
     statsString += "\r\n\r\n";
 
+    auto entityEditFilters = DependencyManager::get<EntityEditFilters>();
+    if (entityEditFilters) {
+        auto filterStats = entityEditFilters->getStats();
+        quint64 averageEvaluationTime = filterStats.evaluatedEdits == 0 ? 0 :
+            filterStats.totalEvaluationTime / filterStats.evaluatedEdits;
+        const int FILTER_COLUMN_WIDTH = 10;
+
+        statsString += "<b>Entity Server Edit Filter Statistics</b>\r\n";
+        statsString += QString("               Evaluated Edits: %1 edits\r\n")
+            .arg(locale.toString(filterStats.evaluatedEdits).rightJustified(FILTER_COLUMN_WIDTH, ' '));
+        statsString += QString("                  Script Calls: %1 calls\r\n")
+            .arg(locale.toString(filterStats.scriptCalls).rightJustified(FILTER_COLUMN_WIDTH, ' '));
+        statsString += QString("                   Batch Calls: %1 calls\r\n")
+            .arg(locale.toString(filterStats.batchCalls).rightJustified(FILTER_COLUMN_WIDTH, ' '));
+        statsString += QString("                Cached Results: %1 edits\r\n")
+            .arg(locale.toString(filterStats.cachedResults).rightJustified(FILTER_COLUMN_WIDTH, ' '));
+        statsString += QString("                 Skipped Edits: %1 edits\r\n")
+            .arg(locale.toString(filterStats.skippedEdits).rightJustified(FILTER_COLUMN_WIDTH, ' '));
+        statsString += QString("  Average Evaluation Time/Edit: %1 usecs\r\n")
+            .arg(locale.toString(averageEvaluationTime).rightJustified(FILTER_COLUMN_WIDTH, ' '));
+        statsString += "\r\n\r\n";
+    }
+
     statsString += "<b>Entity Server Sending to Viewer Statistics</b>\r\n";
     statsString += "----- Viewer Node ID -----------------    ----- Entity ID ----------------------    "
                    "---------- Last Sent To ----------    ---------- Last Edited -----------\r\n";
@@ -441,6 +464,31 @@ QString EntityServer::serverSubclassStats() {
     return statsString;
 }
 
+void EntityServer::collectMetrics(OpenMetricsWriter& metrics) {
+    OctreeServer::collectMetrics(metrics);
+
+    auto entityEditFilters = DependencyManager::get<EntityEditFilters>();
+    if (!entityEditFilters) {
+        return;
+    }
+
+    const OpenMetricsWriter::Labels labels { { "server", getMyServerName() } };
+    auto filterStats = entityEditFilters->getStats();
+    metrics.addCounter("overte_entity_server_filter_evaluated_edits", "Edits passed to entity edit filter scripts",
+                       filterStats.evaluatedEdits, labels);
+    metrics.addCounter("overte_entity_server_filter_script_calls", "Calls into entity edit filter scripts",
+                       filterStats.scriptCalls, labels);
+    metrics.addCounter("overte_entity_server_filter_batch_calls", "Calls filtering several edits at once",
+                       filterStats.batchCalls, labels);
+    metrics.addCounter("overte_entity_server_filter_cached_results", "Edits answered from the filter result cache",
+                       filterStats.cachedResults, labels);
+    metrics.addCounter("overte_entity_server_filter_skipped_edits",
+                       "Edits that changed none of the properties a filter reads", filterStats.skippedEdits, labels);
+    metrics.addHistogram("overte_entity_server_filter_evaluation_seconds",
+                         "Time each filtered edit waited for and spent in filter scripts",
+                         entityEditFilters->getEvaluationTimeHistogram(), labels);
+}
+
 void EntityServer::domainSettingsRequestFailed() {
     auto nodeList = DependencyManager::get<NodeList>();
     qCDebug(entities) << "The EntityServer couldn't get the Domain Settings.";
@@ -68,6 +68,8 @@ public slots:
     void entityFilterAdded(EntityItemID id, bool success);
 
 protected:
+    void collectMetrics(OpenMetricsWriter& metrics) override;
+
     virtual OctreePointer createTree() override;
     virtual UniqueSendThread newSendThread(const SharedNodePointer& node) override;
 
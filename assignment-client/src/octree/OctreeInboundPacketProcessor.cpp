@@ -11,9 +11,15 @@
 
 #include "OctreeInboundPacketProcessor.h"
 
+#include <algorithm>
+#include <chrono>
+#include <functional>
 #include <limits>
 
+#include <QtCore/QRunnable>
+
 #include <NumericalConstants.h>
+#include <PortableHighResolutionClock.h>
 #include <udt/PacketHeaders.h>
 #include <PerfStat.h>
 
@@ -23,7 +29,41 @@
 static QUuid DEFAULT_NODE_ID_REF;
 const quint64 TOO_LONG_SINCE_LAST_NACK = 1 * USECS_PER_SECOND;
 
-OctreeInboundPacketProcessor::OctreeInboundPacketProcessor(OctreeServer* myServer) :
+// packets whose edits are prepared together and then committed under one write lock
+const size_t MAX_PACKETS_PER_BATCH = 64;
+
+static const MetricsHistogram::Bounds QUEUE_DEPTH_BOUNDS { 1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000 };
+static const MetricsHistogram::Bounds COMMIT_LATENCY_BOUNDS {
+    0.0001, 0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0, 2.5, 5.0, 10.0
+};
+
+class OctreeInboundPacketProcessor::PendingPacket {
+public:
+    struct Edit {
+        OctreeEditPointer edit;
+        bool followsEarlierEdit { false }; // shares an item with an earlier edit of the batch
+    };
+
+    QSharedPointer<ReceivedMessage> message;
+    SharedNodePointer sendingNode;
+    unsigned short int sequence { 0 };
+    quint64 transitTime { 0 };
+
+    std::vector<Edit> edits;
+    quint64 processTime { 0 };
+    quint64 lockWaitTime { 0 };
+};
+
+class PrepareEditsTask : public QRunnable {
+public:
+    PrepareEditsTask(std::function<void()> work) : _work(work) { }
+    void run() override { _work(); }
+
+private:
+    std::function<void()> _work;
+};
+
+OctreeInboundPacketProcessor::OctreeInboundPacketProcessor(OctreeServer* myServer, int editWorkerThreads) :
     _myServer(myServer),
     _receivedPacketCount(0),
     _totalTransitTime(0),
@@ -32,8 +72,29 @@ OctreeInboundPacketProcessor::OctreeInboundPacketProcessor(OctreeServer* myServe
     _totalElementsInPacket(0),
     _totalPackets(0),
     _lastNackTime(usecTimestampNow()),
-    _shuttingDown(false)
+    _shuttingDown(false),
+    _queueDepthHistogram(QUEUE_DEPTH_BOUNDS),
+    _commitLatencyHistogram(COMMIT_LATENCY_BOUNDS),
+    _editWorkerThreads(std::max(1, editWorkerThreads))
 {
+    // the processing thread prepares edits too, so with a single edit worker thread the pool isn't used at all
+    _editWorkers.setMaxThreadCount(std::max(1, _editWorkerThreads - 1));
+}
+
+float OctreeInboundPacketProcessor::getAverageQueueDepth() const {
+    std::vector<uint64_t> bucketCounts;
+    uint64_t count;
+    double sum;
+    _queueDepthHistogram.sample(bucketCounts, count, sum);
+    return count == 0 ? 0.0f : (float)(sum / count);
+}
+
+quint64 OctreeInboundPacketProcessor::getAverageCommitLatency() const {
+    std::vector<uint64_t> bucketCounts;
+    uint64_t count;
+    double sum;
+    _commitLatencyHistogram.sample(bucketCounts, count, sum);
+    return count == 0 ? 0 : (quint64)(sum / count * USECS_PER_SECOND);
 }
 
 void OctreeInboundPacketProcessor::resetStats() {
@@ -213,6 +274,208 @@ void OctreeInboundPacketProcessor::processPacket(QSharedPointer<ReceivedMessage>
     }
 }
 
+void OctreeInboundPacketProcessor::processPackets(std::list<NodeSharedReceivedMessagePair>& packets) {
+    if (!_myServer->getOctree()->canPrepareEdits()) {
+        ReceivedPacketProcessor::processPackets(packets);
+        return;
+    }
+
+    _queueDepthHistogram.record((double)packets.size());
+
+    std::vector<PendingPacket> batch;
+    batch.reserve(std::min(packets.size(), MAX_PACKETS_PER_BATCH));
+    for (auto& packetPair : packets) {
+        if (_shuttingDown) {
+            qDebug() << "OctreeInboundPacketProcessor::processPackets() while shutting down... ignoring incoming packets";
+            return;
+        }
+
+        PendingPacket packet;
+        packet.message = packetPair.second;
+        packet.sendingNode = packetPair.first;
+        if (!readPacketHeader(packet)) {
+            continue;
+        }
+        batch.push_back(std::move(packet));
+
+        if (batch.size() == MAX_PACKETS_PER_BATCH) {
+            processBatch(batch);
+            batch.clear();
+            midProcess();
+        }
+    }
+
+    if (!batch.empty()) {
+        processBatch(batch);
+        midProcess();
+    }
+}
+
+bool OctreeInboundPacketProcessor::readPacketHeader(PendingPacket& packet) {
+    ReceivedMessage& message = *packet.message;
+    PacketType packetType = message.getType();
+
+    if (!_myServer->getOctree()->handlesEditPacketType(packetType)) {
+        qDebug("unknown packet ignored... packetType=%hhu", (unsigned char)packetType);
+        return false;
+    }
+    _receivedPacketCount++;
+
+    message.readPrimitive(&packet.sequence);
+
+    quint64 sentAt;
+    message.readPrimitive(&sentAt);
+
+    quint64 arrivedAt = usecTimestampNow();
+    if (sentAt > arrivedAt) {
+        if (_myServer->wantsVerboseDebug() || _myServer->wantsDebugReceiving()) {
+            qDebug() << "unreasonable sentAt=" << sentAt << " usecs";
+            qDebug() << "setting sentAt to arrivedAt=" << arrivedAt << " usecs";
+        }
+        sentAt = arrivedAt;
+    }
+    packet.transitTime = arrivedAt - sentAt;
+
+    if (_myServer->wantsVerboseDebug() || _myServer->wantsDebugReceiving()) {
+        qDebug() << "PROCESSING THREAD: got '" << packetType << "' packet - " << _receivedPacketCount << " command from client";
+        qDebug() << "    receivedBytes=" << message.getSize();
+        qDebug() << "         sequence=" << packet.sequence;
+        qDebug() << "           sentAt=" << sentAt << " usecs";
+        qDebug() << "        arrivedAt=" << arrivedAt << " usecs";
+        qDebug() << "      transitTime=" << packet.transitTime << " usecs";
+    }
+    return true;
+}
+
+void OctreeInboundPacketProcessor::forEachPacket(std::vector<PendingPacket>& batch,
+                                                 const std::function<void(PendingPacket&)>& work) {
+    // the processing thread takes packets too while the workers run
+    std::atomic<size_t> nextPacket { 0 };
+    auto takePackets = [&] {
+        for (size_t i = nextPacket++; i < batch.size(); i = nextPacket++) {
+            work(batch[i]);
+        }
+    };
+    int workerCount = std::min((int)batch.size(), _editWorkerThreads) - 1;
+    for (int i = 0; i < workerCount; i++) {
+        _editWorkers.start(new PrepareEditsTask(takePackets));
+    }
+    takePackets();
+    if (workerCount > 0) {
+        _editWorkers.waitForDone();
+    }
+}
+
+void OctreeInboundPacketProcessor::preparePacket(PendingPacket& packet) {
+    auto tree = _myServer->getOctree();
+    ReceivedMessage& message = *packet.message;
+
+    quint64 startProcess, startLock = usecTimestampNow();
+    tree->withReadLock([&] {
+        startProcess = usecTimestampNow();
+        while (message.getBytesLeftToRead() > 0) {
+            qint64 position = message.getPosition();
+            auto editData = reinterpret_cast<const unsigned char*>(message.getRawMessage() + position);
+            int maxSize = message.getBytesLeftToRead();
+
+            PendingPacket::Edit pendingEdit;
+            int editDataBytesRead = tree->prepareEditPacketData(message, editData, maxSize, packet.sendingNode,
+                                                                pendingEdit.edit);
+            packet.edits.push_back(std::move(pendingEdit));
+            if (editDataBytesRead <= 0) {
+                break; // nothing more we can read from this packet
+            }
+
+            // skip to next edit record in the packet
+            message.seek(position + editDataBytesRead);
+        }
+    });
+    quint64 endProcess = usecTimestampNow();
+
+    packet.processTime += endProcess - startProcess;
+    packet.lockWaitTime += startProcess - startLock;
+}
+
+void OctreeInboundPacketProcessor::validatePacket(PendingPacket& packet) {
+    auto tree = _myServer->getOctree();
+
+    quint64 startProcess, startLock = usecTimestampNow();
+    tree->withReadLock([&] {
+        startProcess = usecTimestampNow();
+        for (auto& pendingEdit : packet.edits) {
+            if (pendingEdit.edit && !pendingEdit.followsEarlierEdit) {
+                tree->validateEdit(*pendingEdit.edit);
+            }
+        }
+    });
+    quint64 endProcess = usecTimestampNow();
+
+    packet.processTime += endProcess - startProcess;
+    packet.lockWaitTime += startProcess - startLock;
+}
+
+void OctreeInboundPacketProcessor::processBatch(std::vector<PendingPacket>& batch) {
+    // decode the edits of every packet
+    forEachPacket(batch, [this](PendingPacket& packet) { preparePacket(packet); });
+
+    // an edit of an item that an earlier edit of the batch touches has to be validated against the item as that earlier
+    // edit leaves it, so it waits for the commit, the others are validated right away
+    QSet<QUuid> editedIDs;
+    for (auto& packet : batch) {
+        for (auto& pendingEdit : packet.edits) {
+            if (!pendingEdit.edit) {
+                continue;
+            }
+            for (const auto& id : pendingEdit.edit->itemIDs) {
+                if (editedIDs.contains(id)) {
+                    pendingEdit.followsEarlierEdit = true;
+                    break;
+                }
+            }
+            for (const auto& id : pendingEdit.edit->itemIDs) {
+                editedIDs.insert(id);
+            }
+        }
+    }
+    forEachPacket(batch, [this](PendingPacket& packet) { validatePacket(packet); });
+
+    // then apply them in the order they were received
+    auto tree = _myServer->getOctree();
+    quint64 startLock = usecTimestampNow();
+    tree->withWriteLock([&] {
+        quint64 lockWaitTime = usecTimestampNow() - startLock;
+        for (auto& packet : batch) {
+            quint64 startProcess = usecTimestampNow();
+            for (auto& pendingEdit : packet.edits) {
+                if (!pendingEdit.edit) {
+                    continue;
+                }
+                if (pendingEdit.followsEarlierEdit) {
+                    tree->validateEdit(*pendingEdit.edit);
+                }
+                tree->commitEdit(*pendingEdit.edit);
+            }
+            quint64 endProcess = usecTimestampNow();
+
+            packet.processTime += endProcess - startProcess;
+            packet.lockWaitTime += lockWaitTime;
+
+            using namespace std::chrono;
+            quint64 now = duration_cast<microseconds>(p_high_resolution_clock::now().time_since_epoch()).count();
+            quint64 receivedAt = packet.message->getFirstPacketReceiveTime();
+            if (receivedAt > 0 && now > receivedAt) {
+                _commitLatencyHistogram.record((double)(now - receivedAt) / USECS_PER_SECOND);
+            }
+        }
+    });
+
+    for (auto& packet : batch) {
+        const QUuid& nodeUUID = packet.sendingNode ? packet.sendingNode->getUUID() : DEFAULT_NODE_ID_REF;
+        trackInboundPacket(nodeUUID, packet.sequence, packet.transitTime, (int)packet.edits.size(), packet.processTime,
+                           packet.lockWaitTime);
+    }
+}
+
 void OctreeInboundPacketProcessor::trackInboundPacket(const QUuid& nodeUUID, unsigned short int sequence, quint64 transitTime,
             int editsInPacket, quint64 processTime, quint64 lockWaitTime) {
 
@@ -14,8 +14,12 @@
 #ifndef hifi_OctreeInboundPacketProcessor_h
 #define hifi_OctreeInboundPacketProcessor_h
 
+#include <functional>
+
 #include <QtCore/QSharedPointer>
+#include <QtCore/QThreadPool>
 
+#include <OpenMetrics.h>
 #include <ReceivedPacketProcessor.h>
 
 #include "SequenceNumberStats.h"
@@ -57,10 +61,15 @@ typedef QHash<QUuid, SingleSenderStats>::const_iterator NodeToSenderStatsMapCons
 
 /// Handles processing of incoming network packets for the octee servers. As with other ReceivedPacketProcessor classes
 /// the user is responsible for reading inbound packets and adding them to the processing queue by calling queueReceivedPacket()
+///
+/// When the tree supports it, the queued packets are handled in batches: the edits of every packet in a batch are decoded
+/// and validated in parallel under the tree's read lock, then committed in the order they were received under a single
+/// write lock. An edit that touches an item edited earlier in the same batch is only validated once that earlier edit is
+/// committed, right before it is committed itself.
 class OctreeInboundPacketProcessor : public ReceivedPacketProcessor {
     Q_OBJECT
 public:
-    OctreeInboundPacketProcessor(OctreeServer* myServer);
+    OctreeInboundPacketProcessor(OctreeServer* myServer, int editWorkerThreads = 1);
 
     quint64 getAverageTransitTimePerPacket() const { return _totalPackets == 0 ? 0 : _totalTransitTime / _totalPackets; }
     quint64 getAverageProcessTimePerPacket() const { return _totalPackets == 0 ? 0 : _totalProcessTime / _totalPackets; }
@@ -72,6 +81,15 @@ public:
     quint64 getAverageLockWaitTimePerElement() const
                 { return _totalElementsInPacket == 0 ? 0 : _totalLockWaitTime / _totalElementsInPacket; }
 
+    int getEditWorkerThreads() const { return _editWorkerThreads; }
+
+    /// Packets handled per batch.
+    const MetricsHistogram& getQueueDepthHistogram() const { return _queueDepthHistogram; }
+    /// Time in seconds from the arrival of an edit packet until all its edits are committed.
+    const MetricsHistogram& getCommitLatencyHistogram() const { return _commitLatencyHistogram; }
+    float getAverageQueueDepth() const;
+    quint64 getAverageCommitLatency() const; // usecs
+
     void resetStats();
 
     NodeToSenderStatsMap getSingleSenderStats() { QReadLocker locker(&_senderStatsLock); return _singleSenderStats; }
@@ -81,6 +99,7 @@ public:
 protected:
 
     virtual void processPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode) override;
+    virtual void processPackets(std::list<NodeSharedReceivedMessagePair>& packets) override;
 
     virtual uint32_t getMaxWait() const override;
     virtual void preProcess() override;
@@ -90,6 +109,14 @@ private:
     int sendNackPackets();
 
 private:
+    class PendingPacket;
+
+    bool readPacketHeader(PendingPacket& packet);
+    void processBatch(std::vector<PendingPacket>& batch);
+    void forEachPacket(std::vector<PendingPacket>& batch, const std::function<void(PendingPacket&)>& work);
+    void preparePacket(PendingPacket& packet);
+    void validatePacket(PendingPacket& packet);
+
     void trackInboundPacket(const QUuid& nodeUUID, unsigned short int sequence, quint64 transitTime,
             int elementsInPacket, quint64 processTime, quint64 lockWaitTime);
 
@@ -107,5 +134,10 @@ private:
 
     std::atomic<uint64_t> _lastNackTime;
     bool _shuttingDown;
+
+    QThreadPool _editWorkers;
+    MetricsHistogram _queueDepthHistogram;
+    MetricsHistogram _commitLatencyHistogram;
+    int _editWorkerThreads; // including the processing thread
 };
 #endif // hifi_OctreeInboundPacketProcessor_h
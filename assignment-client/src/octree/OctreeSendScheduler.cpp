@@ -0,0 +1,246 @@
+//
+//  OctreeSendScheduler.cpp
+//  assignment-client/src/octree
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "OctreeSendScheduler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <unordered_map>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QThread>
+
+#include <SharedUtil.h>
+#include <ThreadHelpers.h>
+
+#include "OctreeSendThread.h"
+#include "OctreeServerConsts.h"
+
+class OctreeSendWorker : public QThread {
+public:
+    OctreeSendWorker(OctreeSendScheduler& scheduler, int index) : _scheduler(scheduler) {
+        setObjectName(QString("Octree Send Worker %1").arg(index));
+    }
+
+    int getTaskCount() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _taskCount;
+    }
+
+    void schedule(OctreeSendThread* task) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _taskCount++;
+        _queue.emplace(usecTimestampNow(), task);
+        _condition.notify_all();
+    }
+
+    void release(OctreeSendThread* task, QThread* target) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (_finished) {
+            // nothing can run the task anymore, it stays in this thread like it did with a dedicated send thread
+            eraseFromQueue(task);
+            _taskCount--;
+            return;
+        }
+        // only this worker can move the task out of its thread, and only in between two passes
+        _releases[task] = target;
+        _condition.notify_all();
+        _condition.wait(lock, [&] { return _releases.find(task) == _releases.end(); });
+    }
+
+    void requestStop() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+        _condition.notify_all();
+    }
+
+    void addStats(OctreeSendScheduler::Stats& stats, quint64 now) const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        stats.taskCount += _taskCount;
+        for (const auto& entry : _queue) {
+            if (entry.first > now) {
+                break;
+            }
+            stats.queueDepth++;
+        }
+    }
+
+protected:
+    void run() override {
+        setThreadName(objectName().toStdString());
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true) {
+            releasePendingTasks();
+            if (_stopping) {
+                break;
+            }
+
+            // deliver the queued slot calls of our tasks, they must not run concurrently with a pass
+            lock.unlock();
+            QCoreApplication::processEvents();
+            lock.lock();
+
+            releasePendingTasks();
+            if (_stopping) {
+                break;
+            }
+
+            quint64 now = usecTimestampNow();
+            if (_queue.empty() || _queue.begin()->first > now) {
+                quint64 waitUsecs = OCTREE_SEND_INTERVAL_USECS;
+                if (!_queue.empty()) {
+                    waitUsecs = std::min(waitUsecs, _queue.begin()->first - now);
+                }
+                _condition.wait_for(lock, std::chrono::microseconds(waitUsecs));
+                continue;
+            }
+
+            // earliest deadline first: tasks that fell behind get a worker before the ones that are on time
+            auto next = _queue.begin();
+            quint64 deadline = next->first;
+            OctreeSendThread* task = next->second;
+            _queue.erase(next);
+            lock.unlock();
+
+            _scheduler.trackLatency(now - deadline);
+            bool keepRunning = task->process();
+            if (!keepRunning) {
+                // the server releases and deletes the task when it gets this
+                emit task->finished();
+            }
+
+            lock.lock();
+            if (keepRunning) {
+                _queue.emplace(now + OCTREE_SEND_INTERVAL_USECS, task);
+            }
+        }
+
+        releasePendingTasks();
+        _queue.clear();
+        _finished = true;
+    }
+
+private:
+    void releasePendingTasks() {
+        if (_releases.empty()) {
+            return;
+        }
+        for (const auto& release : _releases) {
+            eraseFromQueue(release.first);
+            release.first->moveToThread(release.second);
+            _taskCount--;
+        }
+        _releases.clear();
+        _condition.notify_all();
+    }
+
+    void eraseFromQueue(OctreeSendThread* task) {
+        for (auto it = _queue.begin(); it != _queue.end(); ++it) {
+            if (it->second == task) {
+                _queue.erase(it);
+                return;
+            }
+        }
+    }
+
+    OctreeSendScheduler& _scheduler;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _condition;
+    std::multimap<quint64, OctreeSendThread*> _queue; // by deadline
+    std::unordered_map<OctreeSendThread*, QThread*> _releases;
+    int _taskCount { 0 };
+    bool _stopping { false };
+    bool _finished { false };
+};
+
+OctreeSendScheduler::OctreeSendScheduler(int workerCount) {
+    workerCount = std::max(1, workerCount);
+    for (int i = 0; i < workerCount; i++) {
+        _workers.emplace_back(new OctreeSendWorker(*this, i));
+        _workers.back()->start();
+    }
+}
+
+OctreeSendScheduler::~OctreeSendScheduler() {
+    stop();
+}
+
+void OctreeSendScheduler::add(OctreeSendThread* task) {
+    std::lock_guard<std::mutex> lock(_workersMutex);
+    if (_workers.empty()) {
+        return;
+    }
+
+    auto worker = std::min_element(_workers.begin(), _workers.end(), [](const auto& a, const auto& b) {
+        return a->getTaskCount() < b->getTaskCount();
+    });
+    task->moveToThread(worker->get());
+    (*worker)->schedule(task);
+}
+
+void OctreeSendScheduler::remove(OctreeSendThread* task) {
+    OctreeSendWorker* owner = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_workersMutex);
+        for (const auto& worker : _workers) {
+            if (task->thread() == worker.get()) {
+                owner = worker.get();
+                break;
+            }
+        }
+    }
+    if (owner) {
+        owner->release(task, QThread::currentThread());
+    }
+}
+
+void OctreeSendScheduler::stop() {
+    std::lock_guard<std::mutex> lock(_workersMutex);
+    for (const auto& worker : _workers) {
+        worker->requestStop();
+    }
+    for (const auto& worker : _workers) {
+        worker->wait();
+    }
+}
+
+OctreeSendScheduler::Stats OctreeSendScheduler::getStats() const {
+    Stats stats;
+    quint64 now = usecTimestampNow();
+    {
+        std::lock_guard<std::mutex> lock(_workersMutex);
+        stats.workerCount = (int)_workers.size();
+        for (const auto& worker : _workers) {
+            worker->addStats(stats, now);
+        }
+    }
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    stats.averageLatencyUsecs = _averageLatency.getAverage();
+    stats.latencySamples = _averageLatency.getSampleCount();
+    stats.maxLatencyUsecs = _maxLatency;
+    return stats;
+}
+
+void OctreeSendScheduler::resetStats() {
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    _averageLatency.reset();
+    _maxLatency = 0;
+}
+
+void OctreeSendScheduler::trackLatency(quint64 latencyUsecs) {
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    _averageLatency.updateAverage((float)latencyUsecs);
+    _maxLatency = std::max(_maxLatency, latencyUsecs);
+}
@@ -0,0 +1,72 @@
+//
+//  OctreeSendScheduler.h
+//  assignment-client/src/octree
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Fixed-size pool of threads running the OctreeSendThreads of all connected clients
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_OctreeSendScheduler_h
+#define hifi_OctreeSendScheduler_h
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <SimpleMovingAverage.h>
+
+class OctreeSendThread;
+class OctreeSendWorker;
+
+/// Runs the send passes of every OctreeSendThread on a fixed number of worker threads, instead of one thread per client.
+///
+/// A send thread is pinned to the least loaded worker when it is added and is moved to that worker's QThread, so its queued
+/// slots are still delivered in between two of its send passes. Each worker runs the task with the earliest deadline first;
+/// once a pass is done the task is due again OCTREE_SEND_INTERVAL_USECS after that pass started, which is the cadence the
+/// dedicated send threads kept by sleeping. A task whose process() returns false is dropped and emits finished().
+class OctreeSendScheduler {
+public:
+    struct Stats {
+        int workerCount { 0 };
+        int taskCount { 0 };
+        int queueDepth { 0 }; // tasks past their deadline that are waiting for a worker
+        float averageLatencyUsecs { 0.0f }; // how late a pass starts compared to its deadline
+        int latencySamples { 0 };
+        quint64 maxLatencyUsecs { 0 };
+    };
+
+    explicit OctreeSendScheduler(int workerCount);
+    ~OctreeSendScheduler();
+
+    /// Schedules a send thread; it must live in the calling thread, and gets its first pass as soon as a worker is free.
+    void add(OctreeSendThread* task);
+
+    /// Unschedules a send thread and gives it back to the calling thread. Blocks while the task is running a pass, so the
+    /// task can be deleted once this returns.
+    void remove(OctreeSendThread* task);
+
+    /// Stops the workers. Tasks that are still scheduled are not run anymore.
+    void stop();
+
+    Stats getStats() const;
+    void resetStats();
+
+    void trackLatency(quint64 latencyUsecs);
+
+private:
+    std::vector<std::unique_ptr<OctreeSendWorker>> _workers;
+    mutable std::mutex _workersMutex;
+
+    // the workers track latency concurrently with the stats being read and reset on the server thread; this is not
+    // _workersMutex, which stop() holds while it waits for the workers
+    mutable std::mutex _statsMutex;
+    SimpleMovingAverage _averageLatency;
+    quint64 _maxLatency { 0 };
+};
+
+#endif // hifi_OctreeSendScheduler_h
@@ -26,7 +26,7 @@ class OctreeServer;
 
 using AtomicUIntStat = std::atomic<uintmax_t>;
 
-/// Threaded processor for sending octree packets to a single client
+/// Processor for sending octree packets to a single client, run by the OctreeSendScheduler's worker threads
 class OctreeSendThread : public GenericThread {
     Q_OBJECT
 public:
@@ -38,6 +38,9 @@ public:
 
     QUuid getNodeUuid() const { return _nodeUuid; }
 
+    /// Runs a single send pass for this client, returns false once there is nothing left to send to.
+    virtual bool process() override;
+
     static AtomicUIntStat _totalBytes;
     static AtomicUIntStat _totalWastedBytes;
     static AtomicUIntStat _totalPackets;
@@ -45,13 +48,7 @@ public:
     static AtomicUIntStat _totalSpecialBytes;
     static AtomicUIntStat _totalSpecialPackets;
 
-    static AtomicUIntStat _usleepTime;
-    static AtomicUIntStat _usleepCalls;
-
 protected:
-    /// Implements generic processing behavior for this thread.
-    virtual bool process() override;
-
     virtual bool traverseTreeAndSendContents(SharedNodePointer node, OctreeQueryNode* nodeData,
             bool viewFrustumChanged, bool isFullScene);
     virtual bool traverseTreeAndBuildNextPacketPayload(EncodeBitstreamParams& params, const QJsonObject& jsonFilters) = 0;
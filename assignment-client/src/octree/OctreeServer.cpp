@@ -44,6 +44,9 @@ const int MOVING_AVERAGE_SAMPLE_COUNTS = 1000;
 float OctreeServer::SKIP_TIME = -1.0f; // use this for trackXXXTime() calls for non-times
 
 SimpleMovingAverage OctreeServer::_averageLoopTime(MOVING_AVERAGE_SAMPLE_COUNTS);
+MetricsHistogram OctreeServer::_loopTimeHistogram;
+MetricsHistogram OctreeServer::_encodeTimeHistogram;
+MetricsHistogram OctreeServer::_packetSendingTimeHistogram;
 SimpleMovingAverage OctreeServer::_averageInsideTime(MOVING_AVERAGE_SAMPLE_COUNTS);
 
 SimpleMovingAverage OctreeServer::_averageEncodeTime(MOVING_AVERAGE_SAMPLE_COUNTS);
@@ -139,6 +142,15 @@ void OctreeServer::resetSendingStats() {
     _longProcessWait = 0;
     _shortProcessWait = 0;
     _noProcessWait = 0;
+
+    if (_sendScheduler) {
+        _sendScheduler->resetStats();
+    }
+}
+
+void OctreeServer::trackLoopTime(float time) {
+    _averageLoopTime.updateAverage(time);
+    _loopTimeHistogram.record(time / MSECS_PER_SECOND);
 }
 
 void OctreeServer::trackEncodeTime(float time) {
@@ -148,6 +160,7 @@ void OctreeServer::trackEncodeTime(float time) {
     if (time == SKIP_TIME) {
         _noEncode++;
     } else {
+        _encodeTimeHistogram.record(time / USECS_PER_SECOND);
         if (time <= MAX_SHORT_TIME) {
             _shortEncode++;
             _averageShortEncodeTime.updateAverage(time);
@@ -206,10 +219,63 @@ void OctreeServer::trackPacketSendingTime(float time) {
     if (time == SKIP_TIME) {
         _noSend++;
     } else {
+        _packetSendingTimeHistogram.record(time / USECS_PER_SECOND);
         _averagePacketSendingTime.updateAverage(time);
     }
 }
 
+void OctreeServer::collectMetrics(OpenMetricsWriter& metrics) {
+    ThreadedAssignment::collectMetrics(metrics);
+
+    const OpenMetricsWriter::Labels labels { { "server", getMyServerName() } };
+
+    metrics.addGauge("overte_octree_server_clients", "Connected octree clients", getCurrentClientCount(), labels);
+    metrics.addGauge("overte_octree_server_uptime_seconds", "Time since the server started", getUptimeSeconds(), labels);
+
+    metrics.addHistogram("overte_octree_server_send_loop_seconds", "Time spent in each send thread loop",
+                         _loopTimeHistogram, labels);
+    metrics.addHistogram("overte_octree_server_encode_seconds", "Time spent encoding octree data for a client",
+                         _encodeTimeHistogram, labels);
+    metrics.addHistogram("overte_octree_server_packet_sending_seconds", "Time spent sending octree packets",
+                         _packetSendingTimeHistogram, labels);
+
+    if (_sendScheduler) {
+        auto schedulerStats = _sendScheduler->getStats();
+        metrics.addGauge("overte_octree_server_send_workers", "Threads sending to octree clients",
+                         schedulerStats.workerCount, labels);
+        metrics.addGauge("overte_octree_server_send_queue_depth", "Clients whose send pass is overdue",
+                         schedulerStats.queueDepth, labels);
+        metrics.addGauge("overte_octree_server_send_schedule_latency_usecs",
+                         "Trailing average delay between a client's send deadline and its send pass",
+                         schedulerStats.averageLatencyUsecs, labels);
+    }
+
+    metrics.addGauge("overte_octree_server_average_tree_wait_usecs", "Trailing average wait for the tree lock",
+                     getAverageTreeWaitTime(), labels);
+    metrics.addGauge("overte_octree_server_average_node_wait_usecs", "Trailing average wait for the node lock",
+                     getAverageNodeWaitTime(), labels);
+
+    if (_octreeInboundPacketProcessor) {
+        metrics.addCounter("overte_octree_server_inbound_packets", "Inbound edit packets processed",
+                           _octreeInboundPacketProcessor->getTotalPacketsProcessed(), labels);
+        metrics.addCounter("overte_octree_server_inbound_elements", "Inbound edit elements processed",
+                           _octreeInboundPacketProcessor->getTotalElementsProcessed(), labels);
+        metrics.addGauge("overte_octree_server_inbound_process_usecs_per_packet",
+                         "Average time spent processing an inbound edit packet",
+                         _octreeInboundPacketProcessor->getAverageProcessTimePerPacket(), labels);
+        metrics.addGauge("overte_octree_server_inbound_lock_wait_usecs_per_packet",
+                         "Average time spent waiting for the tree lock per inbound edit packet",
+                         _octreeInboundPacketProcessor->getAverageLockWaitTimePerPacket(), labels);
+        metrics.addGauge("overte_octree_server_edit_workers", "Threads decoding and validating inbound edits",
+                         _octreeInboundPacketProcessor->getEditWorkerThreads(), labels);
+        metrics.addHistogram("overte_octree_server_inbound_queue_depth", "Inbound edit packets handled per batch",
+                             _octreeInboundPacketProcessor->getQueueDepthHistogram(), labels);
+        metrics.addHistogram("overte_octree_server_edit_commit_latency_seconds",
+                             "Time from the arrival of an edit packet until its edits are committed",
+                             _octreeInboundPacketProcessor->getCommitLatencyHistogram(), labels);
+    }
+}
+
 void OctreeServer::trackProcessWaitTime(float time) {
     const float MAX_SHORT_TIME = 10.0f;
     const float MAX_LONG_TIME = 100.0f;
@@ -250,6 +316,8 @@ OctreeServer::OctreeServer(ReceivedMessage& message) :
     _startedUSecs(usecTimestampNow())
 {
     _averageLoopTime.updateAverage(0);
+    _sendWorkerThreads = std::max(1, QThread::idealThreadCount());
+    _editWorkerThreads = std::max(1, QThread::idealThreadCount() / 2);
     qDebug() << "Octree server starting... [" << this << "]";
 }
 
@@ -440,6 +508,21 @@ bool OctreeServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
         statsString += QString("      writeDatagram() last second: %1 clients\r\n\r\n")
             .arg(locale.toString((uint)howManyThreadsDidCallWriteDatagram(oneSecondAgo)).rightJustified(COLUMN_WIDTH, ' '));
 
+        if (_sendScheduler) {
+            auto schedulerStats = _sendScheduler->getStats();
+            statsString += QString("             Send scheduler workers: %1 threads\r\n")
+                .arg(locale.toString((uint)schedulerStats.workerCount).rightJustified(COLUMN_WIDTH, ' '));
+            statsString += QString("        Send scheduler queue depth: %1 clients overdue of %2\r\n")
+                .arg(locale.toString((uint)schedulerStats.queueDepth).rightJustified(COLUMN_WIDTH, ' '))
+                .arg(schedulerStats.taskCount);
+            statsString += QString("      Average send schedule latency: %1 usecs"
+                                   "                 samples: %2\r\n")
+                                   .arg((double)schedulerStats.averageLatencyUsecs, 9, 'f', 2)
+                                   .arg(schedulerStats.latencySamples, 12);
+            statsString += QString("          Max send schedule latency: %1 usecs\r\n\r\n")
+                .arg(locale.toString((quint64)schedulerStats.maxLatencyUsecs).rightJustified(COLUMN_WIDTH, ' '));
+        }
+
         float averageLoopTime = getAverageLoopTime();
         statsString += QString("           Average packetLoop() time:      %1 msecs"
                                "                 samples: %2\r\n")
@@ -679,6 +762,8 @@ bool OctreeServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
         quint64 averageLockWaitTimePerElement = _octreeInboundPacketProcessor->getAverageLockWaitTimePerElement();
         quint64 totalElementsProcessed = _octreeInboundPacketProcessor->getTotalElementsProcessed();
         quint64 totalPacketsProcessed = _octreeInboundPacketProcessor->getTotalPacketsProcessed();
+        float averageQueueDepth = _octreeInboundPacketProcessor->getAverageQueueDepth();
+        quint64 averageCommitLatency = _octreeInboundPacketProcessor->getAverageCommitLatency();
 
         quint64 averageDecodeTime = _tree->getAverageDecodeTime();
         quint64 averageLookupTime = _tree->getAverageLookupTime();
@@ -697,6 +782,10 @@ bool OctreeServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
             .arg(locale.toString(incomingPPS, 'f', FLOAT_PRECISION).rightJustified(COLUMN_WIDTH, ' '));
         statsString += QString("    Packets Queue Processing OUT: %1 PPS \r\n")
             .arg(locale.toString(processedPPS, 'f', FLOAT_PRECISION).rightJustified(COLUMN_WIDTH, ' '));
+        statsString += QString("             Edit Worker Threads: %1 threads\r\n")
+            .arg(locale.toString(_octreeInboundPacketProcessor->getEditWorkerThreads()).rightJustified(COLUMN_WIDTH, ' '));
+        statsString += QString("           Average Packets/Batch: %1 packets\r\n")
+            .arg(locale.toString(averageQueueDepth, 'f', FLOAT_PRECISION).rightJustified(COLUMN_WIDTH, ' '));
 
         statsString += QString("           Total Inbound Packets: %1 packets\r\n")
             .arg(locale.toString((uint)totalPacketsProcessed).rightJustified(COLUMN_WIDTH, ' '));
@@ -710,6 +799,8 @@ bool OctreeServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
             .arg(locale.toString((uint)averageProcessTimePerPacket).rightJustified(COLUMN_WIDTH, ' '));
         statsString += QString("   Average Wait Lock Time/Packet: %1 usecs\r\n")
             .arg(locale.toString((uint)averageLockWaitTimePerPacket).rightJustified(COLUMN_WIDTH, ' '));
+        statsString += QString("   Average Commit Latency/Packet: %1 usecs\r\n")
+            .arg(locale.toString((uint)averageCommitLatency).rightJustified(COLUMN_WIDTH, ' '));
         statsString += QString("    Average Process Time/Element: %1 usecs\r\n")
             .arg(locale.toString((uint)averageProcessTimePerElement).rightJustified(COLUMN_WIDTH, ' '));
         statsString += QString("  Average Wait Lock Time/Element: %1 usecs\r\n")
@@ -905,17 +996,30 @@ OctreeServer::UniqueSendThread OctreeServer::createSendThread(const SharedNodePo
     auto sendThread = newSendThread(node);
 
     // we want to be notified when the thread finishes
-    connect(sendThread.get(), &GenericThread::finished, this, &OctreeServer::removeSendThread);
-    sendThread->initialize(true);
+    connect(sendThread.get(), &GenericThread::finished, this, &OctreeServer::removeSendThread, Qt::QueuedConnection);
+    if (_sendScheduler) {
+        _sendScheduler->add(sendThread.get());
+    }
 
     return sendThread;
 }
 
+void OctreeServer::eraseSendThread(SendThreads::iterator it) {
+    // take it back from the worker threads before it is destructed
+    if (_sendScheduler) {
+        _sendScheduler->remove(it->second.get());
+    }
+    _sendThreads.erase(it);
+}
+
 void OctreeServer::removeSendThread() {
     // If the object has been deleted since the event was queued, sender() will return nullptr
     if (auto sendThread = qobject_cast<OctreeSendThread*>(sender())) {
-        // This deletes the unique_ptr, so sendThread is destructed after that line
-        _sendThreads.erase(sendThread->getNodeUuid());
+        auto it = _sendThreads.find(sendThread->getNodeUuid());
+        if (it != _sendThreads.end() && it->second.get() == sendThread) {
+            // This deletes the unique_ptr, so sendThread is destructed after that line
+            eraseSendThread(it);
+        }
     }
 }
 
@@ -930,7 +1034,7 @@ void OctreeServer::handleOctreeQueryPacket(QSharedPointer<ReceivedMessage> messa
         if (it == _sendThreads.end()) {
             _sendThreads.emplace(senderNode->getUUID(), createSendThread(senderNode));
         } else if (it->second->isShuttingDown()) {
-            _sendThreads.erase(it); // Remove right away and wait on thread to be
+            eraseSendThread(it); // Remove right away and wait on thread to be
 
             _sendThreads.emplace(senderNode->getUUID(), createSendThread(senderNode));
         }
@@ -1126,6 +1230,20 @@ void OctreeServer::readConfiguration() {
     qDebug("packetsPerSecondTotalMax=%d _packetsTotalPerInterval=%d",
                     packetsPerSecondTotalMax, _packetsTotalPerInterval);
 
+    // Number of threads shared by all clients to traverse the tree and send to them
+    int sendWorkerThreads = -1;
+    if (readOptionInt(QString("sendWorkerThreads"), settingsSectionObject, sendWorkerThreads) && sendWorkerThreads > 0) {
+        _sendWorkerThreads = sendWorkerThreads;
+    }
+    qDebug("sendWorkerThreads=%d", _sendWorkerThreads);
+
+    // Number of threads decoding and validating inbound edits, including the inbound packet processing thread
+    int editWorkerThreads = -1;
+    if (readOptionInt(QString("editWorkerThreads"), settingsSectionObject, editWorkerThreads) && editWorkerThreads > 0) {
+        _editWorkerThreads = editWorkerThreads;
+    }
+    qDebug("editWorkerThreads=%d", _editWorkerThreads);
+
 
     readAdditionalConfiguration(settingsSectionObject);
 }
@@ -1160,6 +1278,12 @@ void OctreeServer::domainSettingsRequestComplete() {
 
     readConfiguration();
 
+    // send threads created before the initial load completes idle until it does. The scheduler is only created once, the
+    // send threads it runs stay registered with it until they are erased.
+    if (!_sendScheduler) {
+        _sendScheduler.reset(new OctreeSendScheduler(_sendWorkerThreads));
+    }
+
     // if we want Persistence, set up the local file and persist thread
     if (_wantPersist) {
         static const QString ENTITY_PERSIST_EXTENSION = ".json.gz";
@@ -1255,7 +1379,7 @@ void OctreeServer::beginRunning() {
     srand((unsigned)time(0));
 
     // set up our OctreeServerPacketProcessor
-    _octreeInboundPacketProcessor = new OctreeInboundPacketProcessor(this);
+    _octreeInboundPacketProcessor = new OctreeInboundPacketProcessor(this, _editWorkerThreads);
     _octreeInboundPacketProcessor->initialize(true);
 
     // Convert now to tm struct for local timezone
@@ -1323,16 +1447,19 @@ void OctreeServer::aboutToFinish() {
         _octreeInboundPacketProcessor->terminating();
     }
 
-    // Shut down all the send threads
+    // Shut down all the send threads, remove() waits on any pass in progress to be done before returning
     for (auto& it : _sendThreads) {
         auto& sendThread = *it.second;
         sendThread.setIsShuttingDown();
-        sendThread.terminate();
+        if (_sendScheduler) {
+            _sendScheduler->remove(&sendThread);
+        }
     }
 
-    // Clear will destruct all the unique_ptr to OctreeSendThreads which will call the GenericThread's dtor
-    // which waits on the thread to be done before returning
     _sendThreads.clear(); // Cleans up all the send threads.
+    if (_sendScheduler) {
+        _sendScheduler->stop();
+    }
 
     if (_persistManager) {
         _persistThread.quit();
@@ -1456,6 +1583,12 @@ void OctreeServer::sendStatsPacket() {
     threadsStats["2. packetDistributor"] = (double)howManyThreadsDidPacketDistributor(oneSecondAgo);
     threadsStats["3. handlePacektSend"] = (double)howManyThreadsDidHandlePacketSend(oneSecondAgo);
     threadsStats["4. writeDatagram"] = (double)howManyThreadsDidCallWriteDatagram(oneSecondAgo);
+    if (_sendScheduler) {
+        auto schedulerStats = _sendScheduler->getStats();
+        threadsStats["5. sendWorkers"] = schedulerStats.workerCount;
+        threadsStats["6. sendQueueDepth"] = schedulerStats.queueDepth;
+        threadsStats["7. avgSendScheduleLatency"] = schedulerStats.averageLatencyUsecs;
+    }
 
     QJsonObject statsArray1;
     statsArray1["1. configuration"] = getConfiguration();
@@ -1503,12 +1636,14 @@ void OctreeServer::sendStatsPacket() {
         dataArray2["1. packetQueue"] = (double)_octreeInboundPacketProcessor->packetsToProcessCount();
         dataArray2["2. totalPackets"] = (double)_octreeInboundPacketProcessor->getTotalPacketsProcessed();
         dataArray2["3. totalElements"] = (double)_octreeInboundPacketProcessor->getTotalElementsProcessed();
+        dataArray2["4. avgQueueDepth"] = (double)_octreeInboundPacketProcessor->getAverageQueueDepth();
 
         timingArray2["1. avgTransitTimePerPacket"] = (double)_octreeInboundPacketProcessor->getAverageTransitTimePerPacket();
         timingArray2["2. avgProcessTimePerPacket"] = (double)_octreeInboundPacketProcessor->getAverageProcessTimePerPacket();
         timingArray2["3. avgLockWaitTimePerPacket"] = (double)_octreeInboundPacketProcessor->getAverageLockWaitTimePerPacket();
         timingArray2["4. avgProcessTimePerElement"] = (double)_octreeInboundPacketProcessor->getAverageProcessTimePerElement();
         timingArray2["5. avgLockWaitTimePerElement"] = (double)_octreeInboundPacketProcessor->getAverageLockWaitTimePerElement();
+        timingArray2["6. avgCommitLatency"] = (double)_octreeInboundPacketProcessor->getAverageCommitLatency();
     }
 
     QJsonObject statsObject3;
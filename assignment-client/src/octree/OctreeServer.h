@@ -21,9 +21,11 @@
 
 #include <HTTPManager.h>
 
+#include <OpenMetrics.h>
 #include <ThreadedAssignment.h>
 
 #include "OctreePersistThread.h"
+#include "OctreeSendScheduler.h"
 #include "OctreeSendThread.h"
 #include "OctreeServerConsts.h"
 #include "OctreeInboundPacketProcessor.h"
@@ -88,7 +90,7 @@ public:
 
     static float SKIP_TIME; // use this for trackXXXTime() calls for non-times
 
-    static void trackLoopTime(float time) { _averageLoopTime.updateAverage(time); }
+    static void trackLoopTime(float time);
     static float getAverageLoopTime() { return _averageLoopTime.getAverage(); }
 
     static void trackEncodeTime(float time);
@@ -148,6 +150,8 @@ protected:
     using UniqueSendThread = std::unique_ptr<OctreeSendThread>;
     using SendThreads = std::unordered_map<QUuid, UniqueSendThread>;
     
+    void collectMetrics(OpenMetricsWriter& metrics) override;
+
     virtual OctreePointer createTree() = 0;
     bool readOptionBool(const QString& optionName, const QJsonObject& settingsSectionObject, bool& result);
     bool readOptionInt(const QString& optionName, const QJsonObject& settingsSectionObject, int& result);
@@ -169,6 +173,7 @@ protected:
     
     UniqueSendThread createSendThread(const SharedNodePointer& node);
     virtual UniqueSendThread newSendThread(const SharedNodePointer& node) = 0;
+    void eraseSendThread(SendThreads::iterator it);
 
     int _argc;
     const char** _argv;
@@ -205,9 +210,15 @@ protected:
     QString _safeServerName;
     
     SendThreads _sendThreads;
+    std::unique_ptr<OctreeSendScheduler> _sendScheduler;
+    int _sendWorkerThreads;
+    int _editWorkerThreads;
 
     static int _clientCount;
     static SimpleMovingAverage _averageLoopTime;
+    static MetricsHistogram _loopTimeHistogram;
+    static MetricsHistogram _encodeTimeHistogram;
+    static MetricsHistogram _packetSendingTimeHistogram;
 
     static SimpleMovingAverage _averageEncodeTime;
     static SimpleMovingAverage _averageShortEncodeTime;
@@ -49,6 +49,7 @@
 #include <PathUtils.h>
 #include <NumericalConstants.h>
 #include <Trace.h>
+#include <OpenMetrics.h>
 #include <StatTracker.h>
 
 #include "AssetsBackupHandler.h"
@@ -2071,6 +2072,7 @@ bool DomainServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
     const QString URI_ID = "/id";
     const QString URI_ASSIGNMENT = "/assignment";
     const QString URI_NODES = "/nodes";
+    const QString URI_METRICS = "/metrics";
     const QString URI_SETTINGS = "/settings";
     const QString URI_CONTENT_UPLOAD = "/content/upload";
     const QString URI_RESTART = "/restart";
@@ -2253,6 +2255,23 @@ bool DomainServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
             // send the response
             connection->respond(HTTPConnection::StatusCode200, nodesDocument.toJson(), qPrintable(JSON_MIME_TYPE));
 
+            return true;
+        } else if (url.path() == URI_METRICS) {
+            OpenMetricsWriter metrics;
+            nodeList->collectMetrics(metrics);
+
+            QHash<QString, int> nodesByType;
+            nodeList->eachNode([&nodesByType](const SharedNodePointer& node) {
+                ++nodesByType[NodeType::getNodeTypeName(node->getType())];
+            });
+            for (auto itr = nodesByType.constBegin(); itr != nodesByType.constEnd(); ++itr) {
+                metrics.addGauge("overte_domain_server_nodes", "Connected nodes by type", itr.value(),
+                                 { { "node_type", itr.key() } });
+            }
+            metrics.addGauge("overte_domain_server_unfulfilled_assignments", "Assignments waiting for an assignment client",
+                             _unfulfilledAssignments.size());
+
+            connection->respond(HTTPConnection::StatusCode200, metrics.getContent(), OpenMetricsWriter::CONTENT_TYPE);
             return true;
         } else if (url.path() == URI_API_BACKUPS) {
             auto deferred = makePromise("getAllBackupsAndStatus");
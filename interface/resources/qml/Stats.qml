@@ -298,6 +298,11 @@ Item {
                         text: "Processing: " + root.processing +
                               ", Pending: " + root.processingPending;
                     }
+                    StatText {
+                        visible: root.expanded;
+                        text: "Load queue: I/O " + root.loadQueueIO +
+                              ", CPU " + root.loadQueueCPU;
+                    }
                     StatText {
                         visible: root.expanded && root.downloadUrls.length > 0;
                         text: "Download URLs:"
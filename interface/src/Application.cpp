@@ -6924,6 +6924,15 @@ void Application::queryAvatars() {
             destinationBuffer += view.serialize(destinationBuffer);
         }
 
+        uint8_t queryFlags = 0;
+        // only a throttled desktop window asks for the low power rate. an HMD keeps rendering at full rate when the
+        // desktop window loses focus, so focus alone says nothing about what the user can see.
+        if (isThrottleRendering()) {
+            queryFlags |= AvatarQueryFlags::LOW_POWER;
+        }
+        memcpy(destinationBuffer, &queryFlags, sizeof(queryFlags));
+        destinationBuffer += sizeof(queryFlags);
+
         avatarPacket->setPayloadSize(destinationBuffer - bufferStart);
 
         DependencyManager::get<NodeList>()->broadcastToNodes(std::move(avatarPacket), NodeSet() << NodeType::AvatarMixer);
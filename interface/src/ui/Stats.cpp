@@ -30,6 +30,8 @@
 
 #include <gl/Context.h>
 
+#include <ResourceLoadScheduler.h>
+
 #include "Menu.h"
 #include "Util.h"
 #include "SequenceNumberStats.h"
@@ -295,6 +297,9 @@ void Stats::updateStats(bool force) {
         STAT_UPDATE(downloadsPending, (int)ResourceCache::getPendingRequestCount());
         STAT_UPDATE(processing, DependencyManager::get<StatTracker>()->getStat("Processing").toInt());
         STAT_UPDATE(processingPending, DependencyManager::get<StatTracker>()->getStat("PendingProcessing").toInt());
+        auto loadStats = ResourceLoadScheduler::getInstance().getStats();
+        STAT_UPDATE(loadQueueIO, (int)loadStats.queued[ResourceLoadScheduler::IO]);
+        STAT_UPDATE(loadQueueCPU, (int)loadStats.queued[ResourceLoadScheduler::CPU]);
 
         // See if the active download urls have changed
         bool shouldUpdateUrls = _downloads != _downloadUrls.size();
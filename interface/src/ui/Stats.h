@@ -216,6 +216,10 @@ private: \
  *     <em>Read-only.</em>
  * @property {number} processingPending - The number of completed downloads waiting to be processed.
  *     <em>Read-only.</em>
+ * @property {number} loadQueueIO - The number of resource loading jobs waiting for an I/O thread.
+ *     <em>Read-only.</em>
+ * @property {number} loadQueueCPU - The number of resource decoding and processing jobs waiting for a CPU thread.
+ *     <em>Read-only.</em>
  * @property {number} triangles - The number of triangles in the rendered scene.
  *     <em>Read-only.</em>
  * @property {number} drawcalls - The number of draw calls made for the rendered scene.
@@ -531,6 +535,8 @@ class Stats : public QQuickItem {
     Q_PROPERTY(QStringList downloadUrls READ downloadUrls NOTIFY downloadUrlsChanged)
     STATS_PROPERTY(int, processing, 0)
     STATS_PROPERTY(int, processingPending, 0)
+    STATS_PROPERTY(int, loadQueueIO, 0)
+    STATS_PROPERTY(int, loadQueueCPU, 0)
     STATS_PROPERTY(int, triangles, 0)
     STATS_PROPERTY(quint32 , drawcalls, 0)
     STATS_PROPERTY(int, materialSwitches, 0)
@@ -1105,6 +1111,20 @@ signals:
      */
     void processingPendingChanged();
 
+    /*@jsdoc
+     * Triggered when the value of the <code>loadQueueIO</code> property changes.
+     * @function Stats.loadQueueIOChanged
+     * @returns {Signal}
+     */
+    void loadQueueIOChanged();
+
+    /*@jsdoc
+     * Triggered when the value of the <code>loadQueueCPU</code> property changes.
+     * @function Stats.loadQueueCPUChanged
+     * @returns {Signal}
+     */
+    void loadQueueCPUChanged();
+
     /*@jsdoc
      * Triggered when the value of the <code>triangles</code> property changes.
      * @function Stats.trianglesChanged
@@ -47,12 +47,15 @@ QSharedPointer<Resource> AnimationCache::createResourceCopy(const QSharedPointer
 AnimationReader::AnimationReader(const QUrl& url, const QByteArray& data) :
     _url(url),
     _data(data) {
-    DependencyManager::get<StatTracker>()->incrementStat("PendingProcessing");
+    auto statTracker = DependencyManager::get<StatTracker>();
+    _pendingProcessing = statTracker->getCounter("PendingProcessing");
+    _processing = statTracker->getCounter("Processing");
+    _pendingProcessing->increment();
 }
 
 void AnimationReader::run() {
-    DependencyManager::get<StatTracker>()->decrementStat("PendingProcessing");
-    CounterStat counter("Processing");
+    _pendingProcessing->decrement();
+    CounterStat counter(_processing);
 
     PROFILE_RANGE_EX(resource_parse, __FUNCTION__, 0xFF00FF00, 0, { { "url", _url.toString() } });
     auto originalPriority = QThread::currentThread()->priority();
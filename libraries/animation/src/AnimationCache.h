@@ -20,6 +20,7 @@
 #include <DependencyManager.h>
 #include <hfm/HFM.h>
 #include <ResourceCache.h>
+#include <StatTracker.h>
 
 class Animation;
 
@@ -94,6 +95,8 @@ signals:
 private:
     QUrl _url;
     QByteArray _data;
+    StatTracker::CounterPointer _pendingProcessing;
+    StatTracker::CounterPointer _processing;
 };
 
 
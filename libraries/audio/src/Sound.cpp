@@ -34,6 +34,7 @@
 #include "AudioRingBuffer.h"
 #include "AudioLogging.h"
 #include "AudioSRC.h"
+#include "SoundCache.h"
 
 #include "flump3dec.h"
 
@@ -67,6 +68,14 @@ AudioDataPointer AudioData::make(uint32_t numSamples, uint32_t numChannels,
 }
 
 
+AudioDataPointer AudioData::make(uint32_t numSamples, uint32_t numChannels,
+                                 const MappedFilePointer& mapping, size_t offset) {
+    auto samples = reinterpret_cast<const AudioSample*>(mapping->data() + offset);
+    return AudioDataPointer(new AudioData(numSamples, numChannels, samples), [mapping](AudioData* ptr) {
+        delete ptr;
+    });
+}
+
 AudioData::AudioData(uint32_t numSamples, uint32_t numChannels, const AudioSample* samples)
     : _numSamples(numSamples),
       _numChannels(numChannels),
@@ -79,8 +88,13 @@ void Sound::downloadFinished(const QByteArray& data) {
         return;
     }
 
+    std::shared_ptr<MappedFileCache> sharedCache;
+    if (auto soundCache = qobject_cast<SoundCache*>(_cache.data())) {
+        sharedCache = soundCache->getSharedCache();
+    }
+
     // this is a QRunnable, will delete itself after it has finished running
-    auto soundProcessor = new SoundProcessor(_self, data);
+    auto soundProcessor = new SoundProcessor(_self, data, sharedCache);
     connect(soundProcessor, &SoundProcessor::onSuccess, this, &Sound::soundProcessSuccess);
     connect(soundProcessor, &SoundProcessor::onError, this, &Sound::soundProcessError);
     QThreadPool::globalInstance()->start(soundProcessor);
@@ -102,12 +116,50 @@ void Sound::soundProcessError(int error, QString str) {
 }
 
 
-SoundProcessor::SoundProcessor(QWeakPointer<Resource> sound, QByteArray data) :
+SoundProcessor::SoundProcessor(QWeakPointer<Resource> sound, QByteArray data,
+                               std::shared_ptr<MappedFileCache> sharedCache) :
     _sound(sound),
-    _data(data)
+    _data(data),
+    _sharedCache(sharedCache)
 {
 }
 
+// Decoded sounds are shared as a header followed by the 24khz samples
+struct SharedAudioHeader {
+    uint32_t numChannels;
+    uint32_t numSamples;
+};
+
+AudioDataPointer SoundProcessor::findSharedAudioData(const QString& key) {
+    auto mapping = _sharedCache->find(key);
+    if (!mapping || mapping->size() < (qint64)sizeof(SharedAudioHeader)) {
+        return nullptr;
+    }
+
+    SharedAudioHeader header;
+    memcpy(&header, mapping->data(), sizeof(SharedAudioHeader));
+    qint64 expectedSize = sizeof(SharedAudioHeader) + (qint64)header.numSamples * sizeof(AudioSample);
+    if (header.numChannels == 0 || mapping->size() != expectedSize) {
+        qCWarning(audio) << "Ignoring invalid shared sound data for" << key;
+        return nullptr;
+    }
+    return AudioData::make(header.numSamples, header.numChannels, mapping, sizeof(SharedAudioHeader));
+}
+
+AudioDataPointer SoundProcessor::insertSharedAudioData(const QString& key, uint32_t numChannels, const QByteArray& samples) {
+    SharedAudioHeader header { numChannels, (uint32_t)(samples.size() / AudioConstants::SAMPLE_SIZE) };
+    QByteArray data;
+    data.reserve(sizeof(SharedAudioHeader) + samples.size());
+    data.append(reinterpret_cast<const char*>(&header), sizeof(SharedAudioHeader));
+    data.append(samples.constData(), header.numSamples * AudioConstants::SAMPLE_SIZE);
+
+    auto mapping = _sharedCache->insert(key, data);
+    if (!mapping) {
+        return nullptr;
+    }
+    return AudioData::make(header.numSamples, header.numChannels, mapping, sizeof(SharedAudioHeader));
+}
+
 void SoundProcessor::run() {
     auto sound = qSharedPointerCast<Sound>(_sound.lock());
     if (!sound) {
@@ -119,6 +171,15 @@ void SoundProcessor::run() {
     QString fileName = url.fileName().toLower();
     qCDebug(audio) << "Processing sound file" << fileName;
 
+    // another process may have decoded this sound already
+    const QString sharedKey = "sound:" + url.toString();
+    if (_sharedCache) {
+        if (auto audioData = findSharedAudioData(sharedKey)) {
+            emit onSuccess(audioData);
+            return;
+        }
+    }
+
     static const QString WAV_EXTENSION = ".wav";
     static const QString MP3_EXTENSION = ".mp3";
     static const QString RAW_EXTENSION = ".raw";
@@ -161,9 +222,15 @@ void SoundProcessor::run() {
 
     auto data = downSample(outputAudioByteArray, properties);
 
-    int numSamples = data.size() / AudioConstants::SAMPLE_SIZE;
-    auto audioData = AudioData::make(numSamples, properties.numChannels,
-                                     (const AudioSample*)data.constData());
+    AudioDataPointer audioData;
+    if (_sharedCache) {
+        audioData = insertSharedAudioData(sharedKey, properties.numChannels, data);
+    }
+    if (!audioData) {
+        int numSamples = data.size() / AudioConstants::SAMPLE_SIZE;
+        audioData = AudioData::make(numSamples, properties.numChannels,
+                                    (const AudioSample*)data.constData());
+    }
     emit onSuccess(audioData);
 }
 
@@ -20,6 +20,7 @@
 #include <QtNetwork/QNetworkReply>
 #include <QtCore/QSharedPointer>
 
+#include <MappedFileCache.h>
 #include <ResourceCache.h>
 #include <ScriptValue.h>
 
@@ -42,6 +43,10 @@ public:
     static AudioDataPointer make(uint32_t numSamples, uint32_t numChannels,
                                  const AudioSample* samples);
 
+    // Uses the samples stored in a shared mapping at the given offset, the mapping is kept alive by the object
+    static AudioDataPointer make(uint32_t numSamples, uint32_t numChannels,
+                                 const MappedFilePointer& mapping, size_t offset);
+
     uint32_t getNumSamples() const { return _numSamples; }
     uint32_t getNumChannels() const { return _numChannels; }
     const AudioSample* data() const { return _data; }
@@ -103,7 +108,8 @@ public:
         uint32_t sampleRate { 0 };
     };
 
-    SoundProcessor(QWeakPointer<Resource> sound, QByteArray data);
+    SoundProcessor(QWeakPointer<Resource> sound, QByteArray data,
+                   std::shared_ptr<MappedFileCache> sharedCache = nullptr);
 
     virtual void run() override;
 
@@ -119,8 +125,12 @@ signals:
     void onError(int error, QString str);
 
 private:
+    AudioDataPointer findSharedAudioData(const QString& key);
+    AudioDataPointer insertSharedAudioData(const QString& key, uint32_t numChannels, const QByteArray& samples);
+
     const QWeakPointer<Resource> _sound;
     const QByteArray _data;
+    const std::shared_ptr<MappedFileCache> _sharedCache;
 };
 
 typedef QSharedPointer<Sound> SharedSoundPointer;
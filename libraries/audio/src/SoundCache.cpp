@@ -29,6 +29,10 @@ SoundCache::SoundCache(QObject* parent) :
     setObjectName("SoundCache");
 }
 
+void SoundCache::setSharedCacheDirectory(const QString& directory) {
+    _sharedCache = directory.isEmpty() ? nullptr : std::make_shared<MappedFileCache>(directory);
+}
+
 SharedSoundPointer SoundCache::getSound(const QUrl& url) {
     return getResource(url).staticCast<Sound>();
 }
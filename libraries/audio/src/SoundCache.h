@@ -12,6 +12,8 @@
 #ifndef hifi_SoundCache_h
 #define hifi_SoundCache_h
 
+#include <memory>
+
 #include <QtCore/QSharedPointer>
 
 #include <ResourceCache.h>
@@ -25,12 +27,19 @@ class SoundCache : public ResourceCache, public Dependency {
 public:
     Q_INVOKABLE SharedSoundPointer getSound(const QUrl& url);
 
+    /// Keeps decoded sounds in a directory shared with the other processes of this machine and plays them from a read-only
+    /// mapping, so agents playing the same sound share one copy of its samples.
+    void setSharedCacheDirectory(const QString& directory);
+    std::shared_ptr<MappedFileCache> getSharedCache() const { return _sharedCache; }
+
 protected:
     virtual QSharedPointer<Resource> createResource(const QUrl& url) override;
     QSharedPointer<Resource> createResourceCopy(const QSharedPointer<Resource>& resource) override;
 
 private:
     SoundCache(QObject* parent = NULL);
+
+    std::shared_ptr<MappedFileCache> _sharedCache;
 };
 
 #endif // hifi_SoundCache_h
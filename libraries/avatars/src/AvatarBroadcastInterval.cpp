@@ -0,0 +1,44 @@
+//
+//  AvatarBroadcastInterval.cpp
+//  libraries/avatars/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "AvatarBroadcastInterval.h"
+
+#include <algorithm>
+
+const int AvatarBroadcastInterval::QUIET_BROADCASTS_PER_STEP;
+const int AvatarBroadcastInterval::MAX_QUIET_INTERVAL;
+const int AvatarBroadcastInterval::LOW_POWER_INTERVAL;
+
+void AvatarBroadcastInterval::setLowPowerMode(bool isLowPowerMode) {
+    if (_isLowPowerMode && !isLowPowerMode) {
+        // back at the full rate on the next frame
+        _interval = 1;
+        _framesUntilBroadcast = 0;
+        _numQuietBroadcasts = 0;
+    }
+    _isLowPowerMode = isLowPowerMode;
+}
+
+void AvatarBroadcastInterval::update(int numChangedAvatars) {
+    if (_isLowPowerMode) {
+        _interval = LOW_POWER_INTERVAL;
+        _numQuietBroadcasts = 0;
+    } else if (numChangedAvatars > 0) {
+        // something is moving, go straight back to the full rate
+        _interval = 1;
+        _numQuietBroadcasts = 0;
+    } else if (++_numQuietBroadcasts >= QUIET_BROADCASTS_PER_STEP) {
+        _interval = std::min(_interval + 1, MAX_QUIET_INTERVAL);
+        _numQuietBroadcasts = 0;
+    }
+
+    _framesUntilBroadcast = _interval;
+}
@@ -0,0 +1,44 @@
+//
+//  AvatarBroadcastInterval.h
+//  libraries/avatars/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_AvatarBroadcastInterval_h
+#define hifi_AvatarBroadcastInterval_h
+
+/// How many avatar mixer broadcast frames pass between the avatar data sent to one listener.
+///
+/// A listener with no avatars changing around it backs off one frame at a time, every QUIET_BROADCASTS_PER_STEP
+/// broadcasts, down to MAX_QUIET_INTERVAL. Any changed avatar puts it straight back at the full rate. A listener in low
+/// power mode is sent data at LOW_POWER_INTERVAL until it leaves low power mode.
+class AvatarBroadcastInterval {
+public:
+    static const int QUIET_BROADCASTS_PER_STEP = 5;
+    static const int MAX_QUIET_INTERVAL = 4;  // ~11Hz
+    static const int LOW_POWER_INTERVAL = 9;  // 5Hz
+
+    bool isLowPowerMode() const { return _isLowPowerMode; }
+    void setLowPowerMode(bool isLowPowerMode);
+
+    int getInterval() const { return _interval; }
+
+    /// Counts down to the next frame this listener is sent data on
+    bool isBroadcastFrame() { return --_framesUntilBroadcast <= 0; }
+
+    /// Sets the interval to the next broadcast, after a broadcast that sent numChangedAvatars avatars that had changed
+    void update(int numChangedAvatars);
+
+private:
+    bool _isLowPowerMode { false };
+    int _interval { 1 };
+    int _framesUntilBroadcast { 0 };
+    int _numQuietBroadcasts { 0 };
+};
+
+#endif // hifi_AvatarBroadcastInterval_h
@@ -101,6 +101,33 @@ size_t AvatarDataPacket::maxJointDataSize(size_t numJoints) {
     return totalSize;
 }
 
+AvatarDataPacket::BatchedAvatarPosition AvatarDataPacket::packBatchedAvatarPosition(uint16_t localID, const glm::vec3& offset) {
+    const float MAX_OFFSET_STEPS = (float)INT16_MAX;
+    float largestComponent = glm::max(glm::abs(offset.x), glm::max(glm::abs(offset.y), glm::abs(offset.z)));
+
+    // use the finest tier the offset fits in, so nearby avatars keep their precision
+    uint8_t tier = 0;
+    float step = BATCHED_POSITION_MIN_STEP;
+    while (tier < BATCHED_POSITION_MAX_TIER && largestComponent / step > MAX_OFFSET_STEPS) {
+        tier++;
+        step *= 2.0f;
+    }
+
+    BatchedAvatarPosition position;
+    position.localID = localID;
+    position.tier = tier;
+    for (int i = 0; i < 3; i++) {
+        position.offset[i] = (int16_t)glm::clamp(glm::round(offset[i] / step), -MAX_OFFSET_STEPS, MAX_OFFSET_STEPS);
+    }
+    return position;
+}
+
+glm::vec3 AvatarDataPacket::unpackBatchedAvatarPosition(const BatchedAvatarPosition& position) {
+    uint8_t tier = position.tier;
+    float step = BATCHED_POSITION_MIN_STEP * (float)(1 << std::min(tier, BATCHED_POSITION_MAX_TIER));
+    return glm::vec3(position.offset[0], position.offset[1], position.offset[2]) * step;
+}
+
 size_t AvatarDataPacket::minJointDataSize(size_t numJoints) {
     const size_t validityBitsSize = calcBitVectorSize((int)numJoints);
 
@@ -308,7 +335,8 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
                                    const QVector<JointData>& lastSentJointData, AvatarDataPacket::SendStatus& sendStatus,
                                    bool dropFaceTracking, bool distanceAdjust, glm::vec3 viewerPosition,
                                    QVector<JointData>* sentJointDataOut,
-                                   int maxDataSize, AvatarDataRate* outboundDataRateOut) const {
+                                   int maxDataSize, AvatarDataRate* outboundDataRateOut,
+                                   JointDataCodec::Keyframe* jointKeyframe) const {
 
     bool cullSmallChanges = (dataDetail == CullSmallData);
     bool sendAll = (dataDetail == SendAllData);
@@ -700,6 +728,11 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
         }
     }
 
+    sendStatus.jointDataBytes = 0;
+    sendStatus.jointsChanged = 0;
+    sendStatus.sentCompressedJoints = false;
+    sendStatus.sentJointKeyframe = false;
+
     QVector<JointData> jointData;
     if (wantedFlags & (AvatarDataPacket::PACKET_HAS_JOINT_DATA | AvatarDataPacket::PACKET_HAS_JOINT_DEFAULT_POSE_FLAGS)) {
         QReadLocker readLock(&_jointDataLock);
@@ -717,30 +750,6 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 
         auto startSection = destinationBuffer;
 
-        // compute maxTranslationDimension before we send any joint data.
-        float maxTranslationDimension = 0.001f;
-        for (int i = sendStatus.translationsSent; i < numJoints; ++i) {
-            const JointData& data = jointData[i];
-            if (!data.translationIsDefaultPose) {
-                maxTranslationDimension = glm::max(fabsf(data.translation.x), maxTranslationDimension);
-                maxTranslationDimension = glm::max(fabsf(data.translation.y), maxTranslationDimension);
-                maxTranslationDimension = glm::max(fabsf(data.translation.z), maxTranslationDimension);
-            }
-        }
-
-        // joint rotation data
-        *destinationBuffer++ = (uint8_t)numJoints;
-
-        unsigned char* validityPosition = destinationBuffer;
-        memset(validityPosition, 0, jointBitVectorSize);
-
-#ifdef WANT_DEBUG
-        int rotationSentCount = 0;
-        unsigned char* beforeRotations = destinationBuffer;
-#endif
-
-        destinationBuffer += jointBitVectorSize; // Move pointer past the validity bytes
-
         // sentJointDataOut and lastSentJointData might be the same vector
         if (sentJointDataOut) {
             sentJointDataOut->resize(numJoints); // Make sure the destination is resized before using it
@@ -750,87 +759,141 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 
         float minRotationDOT = (distanceAdjust && cullSmallChanges) ? getDistanceBasedMinRotationDOT(viewerPosition) : AVATAR_MIN_ROTATION_DOT;
 
-        int i = sendStatus.rotationsSent;
-        for (; i < numJoints; ++i) {
-            const JointData& data = joints[i];
-            const JointData& last = lastSentJointData[i];
+        float minTranslation = (distanceAdjust && cullSmallChanges) ? getDistanceBasedMinTranslationDistance(viewerPosition) : AVATAR_MIN_TRANSLATION;
+
+        // the compressed encoding can only replace a whole joint data section
+        int compressedSize = 0;
+        if (jointKeyframe && sendStatus.rotationsSent == 0 && sendStatus.translationsSent == 0) {
+            compressedSize = packCompressedJointData(destinationBuffer, packetEnd - destinationBuffer, jointData,
+                lastSentJointData, sendAll, cullSmallChanges, minRotationDOT, minTranslation, sentJoints, *jointKeyframe,
+                sendStatus);
+        }
+
+        if (compressedSize > 0) {
+            includedFlags |= AvatarDataPacket::PACKET_HAS_COMPRESSED_JOINT_DATA;
+            destinationBuffer += compressedSize;
+            sendStatus.rotationsSent = numJoints;
+            sendStatus.translationsSent = numJoints;
+        } else {
+            // compute maxTranslationDimension before we send any joint data.
+            float maxTranslationDimension = 0.001f;
+            for (int i = sendStatus.translationsSent; i < numJoints; ++i) {
+                const JointData& data = jointData[i];
+                if (!data.translationIsDefaultPose) {
+                    maxTranslationDimension = glm::max(fabsf(data.translation.x), maxTranslationDimension);
+                    maxTranslationDimension = glm::max(fabsf(data.translation.y), maxTranslationDimension);
+                    maxTranslationDimension = glm::max(fabsf(data.translation.z), maxTranslationDimension);
+                }
+            }
+
+            // joint rotation data
+            *destinationBuffer++ = (uint8_t)numJoints;
+
+            unsigned char* validityPosition = destinationBuffer;
+            memset(validityPosition, 0, jointBitVectorSize);
 
-            if (packetEnd - destinationBuffer >= minSizeForJoint) {
-                if (!data.rotationIsDefaultPose) {
-                    // The dot product for larger rotations is a lower number,
-                    // so if the dot() is less than the value, then the rotation is a larger angle of rotation
-                    if (sendAll || last.rotationIsDefaultPose || (!cullSmallChanges && last.rotation != data.rotation)
-                        || (cullSmallChanges && fabsf(glm::dot(last.rotation, data.rotation)) < minRotationDOT)) {
-                        validityPosition[i / BITS_IN_BYTE] |= 1 << (i % BITS_IN_BYTE);
 #ifdef WANT_DEBUG
-                        rotationSentCount++;
+            int rotationSentCount = 0;
+            unsigned char* beforeRotations = destinationBuffer;
 #endif
-                        destinationBuffer += packOrientationQuatToSixBytes(destinationBuffer, data.rotation);
 
-                        if (sentJoints) {
-                            sentJoints[i].rotation = data.rotation;
+            destinationBuffer += jointBitVectorSize; // Move pointer past the validity bytes
+
+            int i = sendStatus.rotationsSent;
+            for (; i < numJoints; ++i) {
+                const JointData& data = joints[i];
+                const JointData& last = lastSentJointData[i];
+
+                if (packetEnd - destinationBuffer >= minSizeForJoint) {
+                    if (!data.rotationIsDefaultPose) {
+                        // The dot product for larger rotations is a lower number,
+                        // so if the dot() is less than the value, then the rotation is a larger angle of rotation
+                        if (sendAll || last.rotationIsDefaultPose || (!cullSmallChanges && last.rotation != data.rotation)
+                            || (cullSmallChanges && fabsf(glm::dot(last.rotation, data.rotation)) < minRotationDOT)) {
+                            validityPosition[i / BITS_IN_BYTE] |= 1 << (i % BITS_IN_BYTE);
+#ifdef WANT_DEBUG
+                            rotationSentCount++;
+#endif
+                            sendStatus.jointsChanged++;
+                            destinationBuffer += packOrientationQuatToSixBytes(destinationBuffer, data.rotation);
+
+                            if (sentJoints) {
+                                sentJoints[i].rotation = data.rotation;
+                            }
                         }
                     }
+                } else {
+                    break;
                 }
-            } else {
-                break;
-            }
 
-            if (sentJoints) {
-                sentJoints[i].rotationIsDefaultPose = data.rotationIsDefaultPose;
-            }
+                if (sentJoints) {
+                    sentJoints[i].rotationIsDefaultPose = data.rotationIsDefaultPose;
+                }
 
-        }
-        sendStatus.rotationsSent = i;
+            }
+            sendStatus.rotationsSent = i;
 
-        // joint translation data
-        validityPosition = destinationBuffer;
+            // joint translation data
+            validityPosition = destinationBuffer;
 
 #ifdef WANT_DEBUG
-        int translationSentCount = 0;
-        unsigned char* beforeTranslations = destinationBuffer;
+            int translationSentCount = 0;
+            unsigned char* beforeTranslations = destinationBuffer;
 #endif
 
-        memset(destinationBuffer, 0, jointBitVectorSize);
-        destinationBuffer += jointBitVectorSize; // Move pointer past the validity bytes
+            memset(destinationBuffer, 0, jointBitVectorSize);
+            destinationBuffer += jointBitVectorSize; // Move pointer past the validity bytes
 
-        // write maxTranslationDimension
-        AVATAR_MEMCPY(maxTranslationDimension);
-
-        float minTranslation = (distanceAdjust && cullSmallChanges) ? getDistanceBasedMinTranslationDistance(viewerPosition) : AVATAR_MIN_TRANSLATION;
+            // write maxTranslationDimension
+            AVATAR_MEMCPY(maxTranslationDimension);
 
-        i = sendStatus.translationsSent;
-        for (; i < numJoints; ++i) {
-            const JointData& data = joints[i];
-            const JointData& last = lastSentJointData[i];
+            i = sendStatus.translationsSent;
+            for (; i < numJoints; ++i) {
+                const JointData& data = joints[i];
+                const JointData& last = lastSentJointData[i];
 
-            // Note minSizeForJoint is conservative since there isn't a following bit-vector + scale.
-            if (packetEnd - destinationBuffer >= minSizeForJoint) {
-                if (!data.translationIsDefaultPose) {
-                    if (sendAll || last.translationIsDefaultPose || (!cullSmallChanges && last.translation != data.translation)
-                        || (cullSmallChanges && glm::distance(data.translation, lastSentJointData[i].translation) > minTranslation)) {
-                        validityPosition[i / BITS_IN_BYTE] |= 1 << (i % BITS_IN_BYTE);
+                // Note minSizeForJoint is conservative since there isn't a following bit-vector + scale.
+                if (packetEnd - destinationBuffer >= minSizeForJoint) {
+                    if (!data.translationIsDefaultPose) {
+                        if (sendAll || last.translationIsDefaultPose || (!cullSmallChanges && last.translation != data.translation)
+                            || (cullSmallChanges && glm::distance(data.translation, lastSentJointData[i].translation) > minTranslation)) {
+                            validityPosition[i / BITS_IN_BYTE] |= 1 << (i % BITS_IN_BYTE);
 #ifdef WANT_DEBUG
-                        translationSentCount++;
+                            translationSentCount++;
 #endif
-                        destinationBuffer += packFloatVec3ToSignedTwoByteFixed(destinationBuffer, data.translation / maxTranslationDimension,
-                                                                               TRANSLATION_COMPRESSION_RADIX);
+                            sendStatus.jointsChanged++;
+                            destinationBuffer += packFloatVec3ToSignedTwoByteFixed(destinationBuffer, data.translation / maxTranslationDimension,
+                                                                                   TRANSLATION_COMPRESSION_RADIX);
 
-                        if (sentJoints) {
-                            sentJoints[i].translation = data.translation;
+                            if (sentJoints) {
+                                sentJoints[i].translation = data.translation;
+                            }
                         }
                     }
+                } else {
+                    break;
+                }
+
+                if (sentJoints) {
+                    sentJoints[i].translationIsDefaultPose = data.translationIsDefaultPose;
                 }
-            } else {
-                break;
-            }
 
-            if (sentJoints) {
-                sentJoints[i].translationIsDefaultPose = data.translationIsDefaultPose;
             }
+            sendStatus.translationsSent = i;
 
+#ifdef WANT_DEBUG
+            if (sendAll) {
+                qCDebug(avatars) << "AvatarData::toByteArray" << cullSmallChanges << sendAll
+                    << "rotations:" << rotationSentCount << "translations:" << translationSentCount
+                    << "largest:" << maxTranslationDimension
+                    << "size:"
+                    << (beforeRotations - startPosition) << "+"
+                    << (beforeTranslations - beforeRotations) << "+"
+                    << (destinationBuffer - beforeTranslations) << "="
+                    << (destinationBuffer - startPosition);
+            }
+#endif
         }
-        sendStatus.translationsSent = i;
 
         IF_AVATAR_SPACE(PACKET_HAS_GRAB_JOINTS, sizeof (AvatarDataPacket::FarGrabJoints)) {
             // the far-grab joints may range further than 3 meters, so we can't use packFloatVec3ToSignedTwoByteFixed etc
@@ -861,24 +924,12 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
             }
         }
 
-#ifdef WANT_DEBUG
-        if (sendAll) {
-            qCDebug(avatars) << "AvatarData::toByteArray" << cullSmallChanges << sendAll
-                << "rotations:" << rotationSentCount << "translations:" << translationSentCount
-                << "largest:" << maxTranslationDimension
-                << "size:"
-                << (beforeRotations - startPosition) << "+"
-                << (beforeTranslations - beforeRotations) << "+"
-                << (destinationBuffer - beforeTranslations) << "="
-                << (destinationBuffer - startPosition);
-        }
-#endif
-
         if (sendStatus.rotationsSent != numJoints || sendStatus.translationsSent != numJoints) {
             extraReturnedFlags |= AvatarDataPacket::PACKET_HAS_JOINT_DATA;
         }
 
         int numBytes = destinationBuffer - startSection;
+        sendStatus.jointDataBytes = numBytes;
         if (outboundDataRateOut) {
             outboundDataRateOut->jointDataRate.increment(numBytes);
         }
@@ -923,6 +974,79 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 #undef IF_AVATAR_SPACE
 }
 
+int AvatarData::packCompressedJointData(unsigned char* destinationBuffer, ptrdiff_t space,
+                                        const QVector<JointData>& jointData, const QVector<JointData>& lastSentJointData,
+                                        bool sendAll, bool cullSmallChanges, float minRotationDOT, float minTranslation,
+                                        JointData* sentJoints, JointDataCodec::Keyframe& keyframe,
+                                        AvatarDataPacket::SendStatus& sendStatus) const {
+    const int numJoints = jointData.size();
+    bool isKeyframe = sendAll || JointDataCodec::needsKeyframe(keyframe, numJoints);
+
+    // same selection as the uncompressed encoding, so both leave the receiver with the same pose
+    std::vector<bool> sendRotations(numJoints, false);
+    std::vector<bool> sendTranslations(numJoints, false);
+    int numRotations = 0;
+    int numTranslations = 0;
+    for (int i = 0; i < numJoints; i++) {
+        const JointData& data = jointData[i];
+        const JointData& last = lastSentJointData[i];
+        if (!data.rotationIsDefaultPose &&
+            (sendAll || last.rotationIsDefaultPose || (!cullSmallChanges && last.rotation != data.rotation)
+             || (cullSmallChanges && fabsf(glm::dot(last.rotation, data.rotation)) < minRotationDOT))) {
+            sendRotations[i] = true;
+            numRotations++;
+        }
+        if (!data.translationIsDefaultPose &&
+            (sendAll || last.translationIsDefaultPose || (!cullSmallChanges && last.translation != data.translation)
+             || (cullSmallChanges && glm::distance(data.translation, last.translation) > minTranslation))) {
+            sendTranslations[i] = true;
+            numTranslations++;
+        }
+    }
+
+    JointDataCodec::Keyframe newKeyframe;
+    QByteArray section = JointDataCodec::encode(jointData, sendRotations, sendTranslations, keyframe,
+                                                isKeyframe ? &newKeyframe : nullptr);
+    if (section.isEmpty()) {
+        // a joint turned too far from the keyframe to be sent as a delta
+        isKeyframe = true;
+        section = JointDataCodec::encode(jointData, sendRotations, sendTranslations, keyframe, &newKeyframe);
+    }
+
+    // a keyframe carries every joint, so it is only held to the size of the largest uncompressed section
+    const size_t uncompressedSize = isKeyframe ? AvatarDataPacket::maxJointDataSize(numJoints) :
+        AvatarDataPacket::minJointDataSize(numJoints) + (numRotations + numTranslations) * sizeof(AvatarDataPacket::SixByteQuat);
+    if ((size_t)section.size() > uncompressedSize || section.size() > space) {
+        return 0;
+    }
+
+    memcpy(destinationBuffer, section.constData(), section.size());
+
+    if (sentJoints) {
+        for (int i = 0; i < numJoints; i++) {
+            const JointData& data = jointData[i];
+            if (isKeyframe ? !data.rotationIsDefaultPose : sendRotations[i]) {
+                sentJoints[i].rotation = data.rotation;
+            }
+            if (isKeyframe ? !data.translationIsDefaultPose : sendTranslations[i]) {
+                sentJoints[i].translation = data.translation;
+            }
+            sentJoints[i].rotationIsDefaultPose = data.rotationIsDefaultPose;
+            sentJoints[i].translationIsDefaultPose = data.translationIsDefaultPose;
+        }
+    }
+
+    if (isKeyframe) {
+        keyframe = std::move(newKeyframe);
+    } else {
+        keyframe.sectionsSinceKeyframe++;
+    }
+    sendStatus.jointsChanged = numRotations + numTranslations;
+    sendStatus.sentCompressedJoints = true;
+    sendStatus.sentJointKeyframe = isKeyframe;
+    return section.size();
+}
+
 // NOTE: This is never used in a "distanceAdjust" mode, so it's ok that it doesn't use a variable minimum rotation/translation
 void AvatarData::doneEncoding(bool cullSmallChanges) {
     // The server has finished sending this version of the joint-data to other nodes.  Update _lastSentJointData.
@@ -1019,6 +1143,7 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
     bool hasJointData             = HAS_FLAG(packetStateFlags, AvatarDataPacket::PACKET_HAS_JOINT_DATA);
     bool hasJointDefaultPoseFlags = HAS_FLAG(packetStateFlags, AvatarDataPacket::PACKET_HAS_JOINT_DEFAULT_POSE_FLAGS);
     bool hasGrabJoints            = HAS_FLAG(packetStateFlags, AvatarDataPacket::PACKET_HAS_GRAB_JOINTS);
+    bool hasCompressedJointData   = HAS_FLAG(packetStateFlags, AvatarDataPacket::PACKET_HAS_COMPRESSED_JOINT_DATA);
 
     quint64 now = usecTimestampNow();
 
@@ -1345,94 +1470,111 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
     if (hasJointData) {
         auto startSection = sourceBuffer;
 
-        PACKET_READ_CHECK(NumJoints, sizeof(uint8_t));
-        int numJoints = *sourceBuffer++;
-        const int bytesOfValidity = (int)ceil((float)numJoints / (float)BITS_IN_BYTE);
-        PACKET_READ_CHECK(JointRotationValidityBits, bytesOfValidity);
-
-        int numValidJointRotations = 0;
-        QVector<bool> validRotations;
-        validRotations.resize(numJoints);
-        { // rotation validity bits
-            unsigned char validity = 0;
-            int validityBit = 0;
-            for (int i = 0; i < numJoints; i++) {
-                if (validityBit == 0) {
-                    validity = *sourceBuffer++;
+        if (hasCompressedJointData) {
+            QWriteLocker writeLock(&_jointDataLock);
+            bool applied = false;
+            int numBytesRead = JointDataCodec::decode(sourceBuffer, (int)(endPosition - sourceBuffer),
+                _receivedJointKeyframe, _jointData, applied);
+            if (numBytesRead < 0) {
+                if (shouldLogError(now)) {
+                    qCWarning(avatars) << "AvatarData packet has malformed compressed joint data" << getSessionUUID();
                 }
-                bool valid = (bool)(validity & (1 << validityBit));
-                if (valid) {
-                    ++numValidJointRotations;
-                }
-                validRotations[i] = valid;
-                validityBit = (validityBit + 1) % BITS_IN_BYTE;
+                return buffer.size();
             }
-        }
-
-        // each joint rotation is stored in 6 bytes.
-        QWriteLocker writeLock(&_jointDataLock);
-        _jointData.resize(numJoints);
-
-        const int COMPRESSED_QUATERNION_SIZE = 6;
-        PACKET_READ_CHECK(JointRotations, numValidJointRotations * COMPRESSED_QUATERNION_SIZE);
-        for (int i = 0; i < numJoints; i++) {
-            JointData& data = _jointData[i];
-            if (validRotations[i]) {
-                sourceBuffer += unpackOrientationQuatFromSixBytes(sourceBuffer, data.rotation);
+            sourceBuffer += numBytesRead;
+            if (applied) {
                 _hasNewJointData = true;
-                data.rotationIsDefaultPose = false;
             }
-        }
+        } else {
+            PACKET_READ_CHECK(NumJoints, sizeof(uint8_t));
+            int numJoints = *sourceBuffer++;
+            const int bytesOfValidity = (int)ceil((float)numJoints / (float)BITS_IN_BYTE);
+            PACKET_READ_CHECK(JointRotationValidityBits, bytesOfValidity);
+
+            int numValidJointRotations = 0;
+            QVector<bool> validRotations;
+            validRotations.resize(numJoints);
+            { // rotation validity bits
+                unsigned char validity = 0;
+                int validityBit = 0;
+                for (int i = 0; i < numJoints; i++) {
+                    if (validityBit == 0) {
+                        validity = *sourceBuffer++;
+                    }
+                    bool valid = (bool)(validity & (1 << validityBit));
+                    if (valid) {
+                        ++numValidJointRotations;
+                    }
+                    validRotations[i] = valid;
+                    validityBit = (validityBit + 1) % BITS_IN_BYTE;
+                }
+            }
 
-        PACKET_READ_CHECK(JointTranslationValidityBits, bytesOfValidity);
+            // each joint rotation is stored in 6 bytes.
+            QWriteLocker writeLock(&_jointDataLock);
+            _jointData.resize(numJoints);
 
-        // get translation validity bits -- these indicate which translations were packed
-        int numValidJointTranslations = 0;
-        QVector<bool> validTranslations;
-        validTranslations.resize(numJoints);
-        { // translation validity bits
-            unsigned char validity = 0;
-            int validityBit = 0;
+            const int COMPRESSED_QUATERNION_SIZE = 6;
+            PACKET_READ_CHECK(JointRotations, numValidJointRotations * COMPRESSED_QUATERNION_SIZE);
             for (int i = 0; i < numJoints; i++) {
-                if (validityBit == 0) {
-                    validity = *sourceBuffer++;
+                JointData& data = _jointData[i];
+                if (validRotations[i]) {
+                    sourceBuffer += unpackOrientationQuatFromSixBytes(sourceBuffer, data.rotation);
+                    _hasNewJointData = true;
+                    data.rotationIsDefaultPose = false;
                 }
-                bool valid = (bool)(validity & (1 << validityBit));
-                if (valid) {
-                    ++numValidJointTranslations;
-                }
-                validTranslations[i] = valid;
-                validityBit = (validityBit + 1) % BITS_IN_BYTE;
             }
-        } // 1 + bytesOfValidity bytes
 
-        // read maxTranslationDimension
-        float maxTranslationDimension;
-        PACKET_READ_CHECK(JointMaxTranslationDimension, sizeof(float));
-        memcpy(&maxTranslationDimension, sourceBuffer, sizeof(float));
-        sourceBuffer += sizeof(float);
+            PACKET_READ_CHECK(JointTranslationValidityBits, bytesOfValidity);
+
+            // get translation validity bits -- these indicate which translations were packed
+            int numValidJointTranslations = 0;
+            QVector<bool> validTranslations;
+            validTranslations.resize(numJoints);
+            { // translation validity bits
+                unsigned char validity = 0;
+                int validityBit = 0;
+                for (int i = 0; i < numJoints; i++) {
+                    if (validityBit == 0) {
+                        validity = *sourceBuffer++;
+                    }
+                    bool valid = (bool)(validity & (1 << validityBit));
+                    if (valid) {
+                        ++numValidJointTranslations;
+                    }
+                    validTranslations[i] = valid;
+                    validityBit = (validityBit + 1) % BITS_IN_BYTE;
+                }
+            } // 1 + bytesOfValidity bytes
 
-        // each joint translation component is stored in 6 bytes.
-        const int COMPRESSED_TRANSLATION_SIZE = 6;
-        PACKET_READ_CHECK(JointTranslation, numValidJointTranslations * COMPRESSED_TRANSLATION_SIZE);
+            // read maxTranslationDimension
+            float maxTranslationDimension;
+            PACKET_READ_CHECK(JointMaxTranslationDimension, sizeof(float));
+            memcpy(&maxTranslationDimension, sourceBuffer, sizeof(float));
+            sourceBuffer += sizeof(float);
 
-        for (int i = 0; i < numJoints; i++) {
-            JointData& data = _jointData[i];
-            if (validTranslations[i]) {
-                sourceBuffer += unpackFloatVec3FromSignedTwoByteFixed(sourceBuffer, data.translation, TRANSLATION_COMPRESSION_RADIX);
-                data.translation *= maxTranslationDimension;
-                _hasNewJointData = true;
-                data.translationIsDefaultPose = false;
+            // each joint translation component is stored in 6 bytes.
+            const int COMPRESSED_TRANSLATION_SIZE = 6;
+            PACKET_READ_CHECK(JointTranslation, numValidJointTranslations * COMPRESSED_TRANSLATION_SIZE);
+
+            for (int i = 0; i < numJoints; i++) {
+                JointData& data = _jointData[i];
+                if (validTranslations[i]) {
+                    sourceBuffer += unpackFloatVec3FromSignedTwoByteFixed(sourceBuffer, data.translation, TRANSLATION_COMPRESSION_RADIX);
+                    data.translation *= maxTranslationDimension;
+                    _hasNewJointData = true;
+                    data.translationIsDefaultPose = false;
+                }
             }
-        }
 
 #ifdef WANT_DEBUG
-        if (numValidJointRotations > 15) {
-            qCDebug(avatars) << "RECEIVING -- rotations:" << numValidJointRotations
-                << "translations:" << numValidJointTranslations
-                << "size:" << (int)(sourceBuffer - startPosition);
-        }
+            if (numValidJointRotations > 15) {
+                qCDebug(avatars) << "RECEIVING -- rotations:" << numValidJointRotations
+                    << "translations:" << numValidJointTranslations
+                    << "size:" << (int)(sourceBuffer - startPosition);
+            }
 #endif
+        }
         int numBytesRead = sourceBuffer - startSection;
         _jointDataRate.increment(numBytesRead);
         _jointDataUpdateRate.increment();
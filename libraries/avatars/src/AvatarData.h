@@ -38,6 +38,7 @@
 
 #include <AvatarConstants.h>
 #include <JointData.h>
+#include <JointDataCodec.h>
 #include <NLPacket.h>
 #include <Node.h>
 #include <NumericalConstants.h>
@@ -210,6 +211,7 @@ namespace AvatarDataPacket {
     const HasFlags PACKET_HAS_JOINT_DATA               = 1U << 12;
     const HasFlags PACKET_HAS_JOINT_DEFAULT_POSE_FLAGS = 1U << 13;
     const HasFlags PACKET_HAS_GRAB_JOINTS              = 1U << 14;
+    const HasFlags PACKET_HAS_COMPRESSED_JOINT_DATA    = 1U << 15; // set along with PACKET_HAS_JOINT_DATA
     const size_t AVATAR_HAS_FLAGS_SIZE = 2;
 
     using SixByteQuat = uint8_t[6];
@@ -354,6 +356,9 @@ namespace AvatarDataPacket {
         SixByteQuat rightHandControllerRotation;
         SixByteTrans rightHandControllerTranslation;
     };
+
+    When PACKET_HAS_COMPRESSED_JOINT_DATA is set, the rotations and translations are replaced by a JointDataCodec section,
+    which carries joints as quantized deltas against the last keyframe the receiver got. The far-grab joints still follow.
     */
     size_t maxJointDataSize(size_t numJoints);
     size_t minJointDataSize(size_t numJoints);
@@ -380,6 +385,39 @@ namespace AvatarDataPacket {
 
     static const size_t MIN_BULK_PACKET_SIZE = NUM_BYTES_RFC4122_UUID + HEADER_SIZE;
 
+    // BulkAvatarPositions packet: the positions of a listener's out-of-view avatars, batched by the mixer instead of
+    // each being sent as MinimumData. The header is followed by numAvatarIDs BatchedAvatarID entries, binding mixer
+    // local IDs to the session IDs of avatars the listener may not know about yet, then by BatchedAvatarPosition
+    // entries up to the end of the packet.
+    PACKED_BEGIN struct BatchedPositionsHeader {
+        float origin[3];                  // the listener's position, which the offsets are relative to
+        uint8_t numAvatarIDs;
+    } PACKED_END;
+    const size_t BATCHED_POSITIONS_HEADER_SIZE = 13;
+    static_assert(sizeof(BatchedPositionsHeader) == BATCHED_POSITIONS_HEADER_SIZE, "AvatarDataPacket::BatchedPositionsHeader size doesn't match.");
+
+    PACKED_BEGIN struct BatchedAvatarID {
+        uint16_t localID;
+        uint8_t sessionID[NUM_BYTES_RFC4122_UUID];
+    } PACKED_END;
+    const size_t BATCHED_AVATAR_ID_SIZE = 18;
+    static_assert(sizeof(BatchedAvatarID) == BATCHED_AVATAR_ID_SIZE, "AvatarDataPacket::BatchedAvatarID size doesn't match.");
+
+    PACKED_BEGIN struct BatchedAvatarPosition {
+        uint16_t localID;
+        uint8_t tier;                     // the offset is in steps of BATCHED_POSITION_MIN_STEP * 2^tier
+        int16_t offset[3];                // avatar position relative to the origin
+    } PACKED_END;
+    const size_t BATCHED_AVATAR_POSITION_SIZE = 9;
+    static_assert(sizeof(BatchedAvatarPosition) == BATCHED_AVATAR_POSITION_SIZE, "AvatarDataPacket::BatchedAvatarPosition size doesn't match.");
+
+    // tier 0 covers +/-128m at 4mm, each tier up doubles the range and the step
+    const float BATCHED_POSITION_MIN_STEP = 1.0f / 256.0f;
+    const uint8_t BATCHED_POSITION_MAX_TIER = 15;
+
+    BatchedAvatarPosition packBatchedAvatarPosition(uint16_t localID, const glm::vec3& offset);
+    glm::vec3 unpackBatchedAvatarPosition(const BatchedAvatarPosition& position);
+
     // AvatarIdentity packet:
     enum class IdentityFlag: quint32 {none, isReplicated = 0x1, lookAtSnapping = 0x2, verificationFailed = 0x4};
     Q_DECLARE_FLAGS(IdentityFlags, IdentityFlag)
@@ -389,10 +427,19 @@ namespace AvatarDataPacket {
         bool sendUUID { false };
         int rotationsSent { 0 };  // ie: index of next unsent joint
         int translationsSent { 0 };
+        int jointDataBytes { 0 };  // size of the joint data section written by the last call
+        int jointsChanged { 0 };  // joint rotations and translations the last call wrote because they changed
+        bool sentCompressedJoints { false };
+        bool sentJointKeyframe { false };
         operator bool() { return itemFlags == 0; }
     };
 }
 
+// optional flags byte following the view frustums of an AvatarQuery packet
+namespace AvatarQueryFlags {
+    const uint8_t LOW_POWER = 1U << 0;  // the client is idle or throttled, and is content with a reduced avatar update rate
+}
+
 const float MAX_AUDIO_LOUDNESS = 1000.0f; // close enough for mouth animation
 
 // See also static AvatarData::defaultFullAvatarModelUrl().
@@ -630,7 +677,8 @@ public:
 
     virtual QByteArray toByteArray(AvatarDataDetail dataDetail, quint64 lastSentTime, const QVector<JointData>& lastSentJointData,
         AvatarDataPacket::SendStatus& sendStatus, bool dropFaceTracking, bool distanceAdjust, glm::vec3 viewerPosition,
-        QVector<JointData>* sentJointDataOut, int maxDataSize = 0, AvatarDataRate* outboundDataRateOut = nullptr) const;
+        QVector<JointData>* sentJointDataOut, int maxDataSize = 0, AvatarDataRate* outboundDataRateOut = nullptr,
+        JointDataCodec::Keyframe* jointKeyframe = nullptr) const;
 
     virtual void doneEncoding(bool cullSmallChanges);
 
@@ -1386,6 +1434,10 @@ public:
     void fromJson(const QJsonObject& json, bool useFrameSkeleton = true);
 
     glm::vec3 getClientGlobalPosition() const { return _globalPosition; }
+    // whether the avatar moved, turned or changed scale since the given time
+    bool transformChangedSince(quint64 time) const {
+        return _globalPositionChanged >= time || rotationChangedSince(time) || avatarScaleChangedSince(time);
+    }
     AABox getGlobalBoundingBox() const { return AABox(_globalPosition + _globalBoundingBoxOffset - _globalBoundingBoxDimensions, _globalBoundingBoxDimensions); }
     AABox getDefaultBubbleBox() const;
 
@@ -1681,6 +1733,12 @@ protected:
     float getDistanceBasedMinRotationDOT(glm::vec3 viewerPosition) const;
     float getDistanceBasedMinTranslationDistance(glm::vec3 viewerPosition) const;
 
+    // writes the joint data section as a JointDataCodec section, or returns 0 if it would not beat the uncompressed one
+    int packCompressedJointData(unsigned char* destinationBuffer, ptrdiff_t space, const QVector<JointData>& jointData,
+        const QVector<JointData>& lastSentJointData, bool sendAll, bool cullSmallChanges, float minRotationDOT,
+        float minTranslation, JointData* sentJoints, JointDataCodec::Keyframe& keyframe,
+        AvatarDataPacket::SendStatus& sendStatus) const;
+
     bool avatarBoundingBoxChangedSince(quint64 time) const { return _avatarBoundingBoxChanged >= time; }
     bool avatarScaleChangedSince(quint64 time) const { return _avatarScaleChanged >= time; }
     bool lookAtPositionChangedSince(quint64 time) const { return _headData->lookAtPositionChangedSince(time); }
@@ -1721,6 +1779,7 @@ protected:
     QVector<JointData> _jointData; ///< the state of the skeleton joints
     QVector<JointData> _lastSentJointData; ///< the state of the skeleton joints last time we transmitted
     mutable QReadWriteLock _jointDataLock;
+    JointDataCodec::Keyframe _receivedJointKeyframe; ///< keyframe of the compressed joint data we receive, guarded by _jointDataLock
 
     // key state
     KeyState _keyState;
@@ -125,6 +125,8 @@ AvatarHashMap::AvatarHashMap() {
     auto& packetReceiver = nodeList->getPacketReceiver();
     packetReceiver.registerListener(PacketType::BulkAvatarData,
         PacketReceiver::makeSourcedListenerReference<AvatarHashMap>(this, &AvatarHashMap::processAvatarDataPacket));
+    packetReceiver.registerListener(PacketType::BulkAvatarPositions,
+        PacketReceiver::makeSourcedListenerReference<AvatarHashMap>(this, &AvatarHashMap::processBulkAvatarPositions));
     packetReceiver.registerListener(PacketType::KillAvatar,
         PacketReceiver::makeSourcedListenerReference<AvatarHashMap>(this, &AvatarHashMap::processKillAvatar));
     packetReceiver.registerListener(PacketType::AvatarIdentity,
@@ -252,6 +254,85 @@ void AvatarHashMap::processAvatarDataPacket(QSharedPointer<ReceivedMessage> mess
     }
 }
 
+void AvatarHashMap::setupNewAvatar(const QUuid& sessionUUID, const AvatarSharedPointer& avatar,
+                                         const SharedNodePointer& sendingNode) {
+    QWriteLocker locker(&_hashLock);
+    avatar->setIsNewAvatar(true);
+    auto replicaIDs = _replicas.getReplicaIDs(sessionUUID);
+    for (auto replicaID : replicaIDs) {
+        auto replicaAvatar = addAvatar(replicaID, sendingNode);
+        replicaAvatar->setIsNewAvatar(true);
+        _replicas.addReplica(sessionUUID, replicaAvatar);
+    }
+}
+
+void AvatarHashMap::processBulkAvatarPositions(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode) {
+    DETAILED_PROFILE_RANGE(network, __FUNCTION__);
+
+    AvatarDataPacket::BatchedPositionsHeader header;
+    if (message->getBytesLeftToRead() < (qint64)sizeof(header)) {
+        qCWarning(avatars) << "Malformed bulk avatar positions packet, bailing";
+        return;
+    }
+    message->readPrimitive(&header);
+    glm::vec3 origin(header.origin[0], header.origin[1], header.origin[2]);
+
+    if (message->getBytesLeftToRead() < (qint64)(header.numAvatarIDs * sizeof(AvatarDataPacket::BatchedAvatarID))) {
+        qCWarning(avatars) << "Malformed bulk avatar positions packet, bailing";
+        return;
+    }
+
+    {
+        QWriteLocker locker(&_hashLock);
+        for (int i = 0; i < header.numAvatarIDs; i++) {
+            AvatarDataPacket::BatchedAvatarID avatarID;
+            message->readPrimitive(&avatarID);
+            uint16_t localID = avatarID.localID;
+            _batchedAvatarIDs[localID] =
+                QUuid::fromRfc4122(QByteArray::fromRawData((const char*)avatarID.sessionID, NUM_BYTES_RFC4122_UUID));
+        }
+    }
+
+    auto nodeList = DependencyManager::get<NodeList>();
+    while (message->getBytesLeftToRead() >= (qint64)sizeof(AvatarDataPacket::BatchedAvatarPosition)) {
+        AvatarDataPacket::BatchedAvatarPosition batchedPosition;
+        message->readPrimitive(&batchedPosition);
+
+        QUuid sessionUUID;
+        {
+            QReadLocker locker(&_hashLock);
+            uint16_t localID = batchedPosition.localID;
+            auto it = _batchedAvatarIDs.find(localID);
+            if (it == _batchedAvatarIDs.end()) {
+                // the packet that named this avatar was lost, the mixer names it again in its next batches
+                continue;
+            }
+            sessionUUID = it->second;
+        }
+
+        if (sessionUUID == _lastOwnerSessionUUID ||
+            (nodeList->isIgnoringNode(sessionUUID) && !nodeList->getRequestsDomainListData())) {
+            continue;
+        }
+
+        // hand the position over as a position-only avatar data record, so it is applied like any other update
+        glm::vec3 position = origin + AvatarDataPacket::unpackBatchedAvatarPosition(batchedPosition);
+        AvatarDataPacket::HasFlags flags = AvatarDataPacket::PACKET_HAS_AVATAR_GLOBAL_POSITION;
+        AvatarDataPacket::AvatarGlobalPosition globalPosition { { position.x, position.y, position.z } };
+        QByteArray avatarData;
+        avatarData.append((const char*)&flags, sizeof(flags));
+        avatarData.append((const char*)&globalPosition, sizeof(globalPosition));
+
+        bool isNewAvatar;
+        auto avatar = newOrExistingAvatar(sessionUUID, sendingNode, isNewAvatar);
+        if (isNewAvatar) {
+            setupNewAvatar(sessionUUID, avatar, sendingNode);
+        }
+        avatar->parseDataFromBuffer(avatarData);
+        _replicas.parseDataFromBuffer(sessionUUID, avatarData);
+    }
+}
+
 AvatarSharedPointer AvatarHashMap::parseAvatarData(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode) {
     QUuid sessionUUID = QUuid::fromRfc4122(message->readWithoutCopy(NUM_BYTES_RFC4122_UUID));
 
@@ -266,16 +347,9 @@ AvatarSharedPointer AvatarHashMap::parseAvatarData(QSharedPointer<ReceivedMessag
         auto avatar = newOrExistingAvatar(sessionUUID, sendingNode, isNewAvatar);
 
         if (isNewAvatar) {
-            QWriteLocker locker(&_hashLock);
-            avatar->setIsNewAvatar(true);
-            auto replicaIDs = _replicas.getReplicaIDs(sessionUUID);
-            for (auto replicaID : replicaIDs) {
-                auto replicaAvatar = addAvatar(replicaID, sendingNode);
-                replicaAvatar->setIsNewAvatar(true);
-                _replicas.addReplica(sessionUUID, replicaAvatar);
-            }
-        } 
-        
+            setupNewAvatar(sessionUUID, avatar, sendingNode);
+        }
+
         // have the matching (or new) avatar parse the data from the packet
         int bytesRead = avatar->parseDataFromBuffer(byteArray);
         message->seek(positionBeforeRead + bytesRead);
@@ -497,6 +571,14 @@ void AvatarHashMap::removeAvatar(const QUuid& sessionUUID, KillAvatarReason remo
         if (removedAvatar) {
             removedAvatars.push_back(removedAvatar);
         }
+
+        for (auto it = _batchedAvatarIDs.begin(); it != _batchedAvatarIDs.end();) {
+            if (it->second == sessionUUID) {
+                it = _batchedAvatarIDs.erase(it);
+            } else {
+                ++it;
+            }
+        }
     }
 
     for (auto& removedAvatar: removedAvatars) {
@@ -528,6 +610,7 @@ void AvatarHashMap::clearOtherAvatars() {
         removedAvatars = _avatarHash.values();
 
         _avatarHash.clear();
+        _batchedAvatarIDs.clear();
     }
 
     for (auto& av : removedAvatars) {
@@ -199,6 +199,14 @@ protected slots:
      */
     void processAvatarDataPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode);
    
+    /*@jsdoc
+     * @function AvatarList.processBulkAvatarPositions
+     * @param {object} message - Message.
+     * @param {object} sendingNode - Sending node.
+     * @deprecated This function is deprecated and will be removed.
+     */
+    void processBulkAvatarPositions(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode);
+
     /*@jsdoc
      * @function AvatarList.processAvatarIdentityPacket
      * @param {object} message - Message.
@@ -231,6 +239,7 @@ protected:
     virtual AvatarSharedPointer addAvatar(const QUuid& sessionUUID, const QWeakPointer<Node>& mixerWeakPointer);
     AvatarSharedPointer newOrExistingAvatar(const QUuid& sessionUUID, const QWeakPointer<Node>& mixerWeakPointer,
         bool& isNew);
+    void setupNewAvatar(const QUuid& sessionUUID, const AvatarSharedPointer& avatar, const SharedNodePointer& sendingNode);
     virtual AvatarSharedPointer findAvatar(const QUuid& sessionUUID) const; // uses a QReadLocker on the hashLock
     virtual void removeAvatar(const QUuid& sessionUUID, KillAvatarReason removalReason = KillAvatarReason::NoReason);
     
@@ -242,6 +251,9 @@ protected:
     std::unordered_map<QUuid, AvatarTraits::TraitVersions> _processedTraitVersions;
     AvatarReplicas _replicas;
 
+    // avatar mixer local IDs of the avatars we get batched positions for, guarded by _hashLock
+    std::unordered_map<uint16_t, QUuid> _batchedAvatarIDs;
+
 private:
     QUuid _lastOwnerSessionUUID;
 };
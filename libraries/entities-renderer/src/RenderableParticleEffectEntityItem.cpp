@@ -46,7 +46,7 @@ struct GpuParticle {
     glm::vec2 uv; // Lifetime + seed
 };
 
-using GpuParticles = std::vector<GpuParticle>;
+static_assert(sizeof(GpuParticle) == ParticleStore::GPU_PARTICLE_FLOATS * sizeof(float), "GpuParticle doesn't match the particle store output");
 
 ParticleEffectEntityRenderer::ParticleEffectEntityRenderer(const EntityItemPointer& entity) : Parent(entity) {
     ParticleUniforms uniforms;
@@ -395,39 +395,24 @@ void ParticleEffectEntityRenderer::stepSimulation() {
     }
 
     // Kill any particles that have expired or are over the max size
-    while (_cpuParticles.size() > _particleProperties.maxParticles || (!_cpuParticles.empty() && _cpuParticles.front().expiration == 0)) {
+    while (_cpuParticles.size() > _particleProperties.maxParticles || (!_cpuParticles.empty() && _cpuParticles.frontExpiration() == 0)) {
         _cpuParticles.pop_front();
     }
 
-    const float deltaTime = (float)interval / (float)USECS_PER_SECOND;
-    // update the particles
-    for (auto& particle : _cpuParticles) {
-        if (_prevEmitterShouldTrail != _particleProperties.emission.shouldTrail) {
-            if (_prevEmitterShouldTrail) {
-                particle.relativePosition = particle.relativePosition + particle.basePosition - modelTransform.getTranslation();
-            }
-            particle.basePosition = modelTransform.getTranslation();
-        }
-        particle.expiration = particle.expiration >= interval ? particle.expiration - interval : 0;
-        particle.integrate(deltaTime);
+    if (_prevEmitterShouldTrail != _particleProperties.emission.shouldTrail) {
+        _cpuParticles.rebase(modelTransform.getTranslation(), _prevEmitterShouldTrail);
     }
     _prevEmitterShouldTrail = _particleProperties.emission.shouldTrail;
 
-    // Build particle primitives
-    static GpuParticles gpuParticles;
-    gpuParticles.clear();
-    gpuParticles.reserve(_cpuParticles.size()); // Reserve space
-    std::transform(_cpuParticles.begin(), _cpuParticles.end(), std::back_inserter(gpuParticles), [this, &modelTransform] (const CpuParticle& particle) {
-        glm::vec3 position = particle.relativePosition + (_particleProperties.emission.shouldTrail ? particle.basePosition : modelTransform.getTranslation());
-        return GpuParticle(position, glm::vec2(particle.lifetime, particle.seed));
-    });
+    // Update the particles, and lay them out straight into the particle buffer's storage
+    const float deltaTime = (float)interval / (float)USECS_PER_SECOND;
+    _cpuParticles.integrate(deltaTime, interval);
 
-    // Update particle buffer
-    auto& particleBuffer = _particleBuffer;
-    size_t numBytes = sizeof(GpuParticle) * gpuParticles.size();
-    particleBuffer->resize(numBytes);
+    size_t numBytes = sizeof(GpuParticle) * _cpuParticles.size();
+    _particleBuffer->resize(numBytes);
     if (numBytes != 0) {
-        particleBuffer->setData(numBytes, (const gpu::Byte*)gpuParticles.data());
+        auto gpuParticles = reinterpret_cast<float*>(_particleBuffer->editSubData(0, numBytes));
+        _cpuParticles.writeGpuParticles(gpuParticles, _particleProperties.emission.shouldTrail, modelTransform.getTranslation());
     }
 }
 
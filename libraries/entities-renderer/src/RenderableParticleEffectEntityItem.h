@@ -13,6 +13,7 @@
 
 #include "RenderableEntityItem.h"
 #include <ParticleEffectEntityItem.h>
+#include <ParticleStore.h>
 #include <TextureCache.h>
 
 namespace render { namespace entities {
@@ -42,24 +43,8 @@ private:
     using BufferView = gpu::BufferView;
 
     // CPU particles
-    // FIXME either switch to GPU compute particles or switch to simd updating of the particles
-    struct CpuParticle {
-        float seed { 0.0f };
-        uint64_t expiration { 0 };
-        float lifetime { 0.0f };
-        glm::vec3 basePosition;
-        glm::vec3 relativePosition;
-        glm::vec3 velocity;
-        glm::vec3 acceleration;
-
-        void integrate(float deltaTime) {
-            glm::vec3 atSquared = (0.5f * deltaTime * deltaTime) * acceleration;
-            relativePosition += velocity * deltaTime + atSquared;
-            velocity += acceleration * deltaTime;
-            lifetime += deltaTime;
-        }
-    };
-    using CpuParticles = std::deque<CpuParticle>;
+    // FIXME switch to GPU compute particles
+    using CpuParticle = ParticleStore::Particle;
 
 
     template<typename T>
@@ -96,7 +81,7 @@ private:
     particle::Properties _particleProperties;
     bool _prevEmitterShouldTrail;
     bool _prevEmitterShouldTrailInitialized { false };
-    CpuParticles _cpuParticles;
+    ParticleStore _cpuParticles;
     bool _emitting { false };
     uint64_t _timeUntilNextEmit { 0 };
     BufferPointer _particleBuffer { std::make_shared<Buffer>() };
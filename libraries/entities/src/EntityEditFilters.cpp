@@ -13,13 +13,17 @@
 
 #include "EntityEditFilters.h"
 
+#include <QJsonArray>
+#include <QJsonDocument>
 #include <QUrl>
 
+#include <NumericalConstants.h>
 #include <ResourceManager.h>
 #include <shared/ScriptInitializerMixin.h>
 #include <ScriptEngine.h>
 #include <ScriptManager.h>
 #include <ScriptProgram.h>
+#include <SharedUtil.h>
 
 QList<EntityItemID> EntityEditFilters::getZonesByPosition(glm::vec3& position) {
     QList<EntityItemID> zones;
@@ -47,6 +51,37 @@ QList<EntityItemID> EntityEditFilters::getZonesByPosition(glm::vec3& position) {
     return zones;
 }
 
+class EntityEditFilters::FilterRequest {
+public:
+    EntityItemID zoneID;
+    EntityTree::FilterType filterType;
+    EntityItemProperties* propertiesIn;
+    EntityItemProperties* propertiesOut;
+    EntityItemPointer existingEntity;
+
+    // set by the thread that evaluates the request
+    bool done { false };
+    bool accepted { false };
+    bool isObject { false };
+    bool wasChanged { false };
+
+    QJsonValue in;
+    QByteArray cacheKey;
+};
+
+// more results than this are not worth keeping around, the cache starts over
+static const int MAX_CACHED_FILTER_RESULTS = 1000;
+
+static EntityPropertyFlags intersectPropertyFlags(const EntityPropertyFlags& flags, const EntityPropertyFlags& wanted) {
+    EntityPropertyFlags result;
+    for (int flag = (int)wanted.firstFlag(); flag <= (int)wanted.lastFlag(); flag++) {
+        if (wanted.getHasProperty((EntityPropertyList)flag) && flags.getHasProperty((EntityPropertyList)flag)) {
+            result.setHasProperty((EntityPropertyList)flag);
+        }
+    }
+    return result;
+}
+
 bool EntityEditFilters::filter(glm::vec3& position, EntityItemProperties& propertiesIn, EntityItemProperties& propertiesOut,
         bool& wasChanged, EntityTree::FilterType filterType, EntityItemID& itemID, const EntityItemPointer& existingEntity) {
 
@@ -78,95 +113,271 @@ bool EntityEditFilters::filter(glm::vec3& position, EntityItemProperties& proper
                 return true; // accept the message
             }
 
-            auto oldProperties = propertiesIn.getDesiredProperties();
-            auto specifiedProperties = propertiesIn.getChangedProperties();
-            propertiesIn.setDesiredProperties(specifiedProperties);
-            ScriptValue inputValues = propertiesIn.copyToScriptValue(filterData.engine.get(), false, true, true);
-            propertiesIn.setDesiredProperties(oldProperties);
+            // an update that leaves alone everything this filter looks at can't be of interest to it
+            if (filterData.wantsProperties &&
+                (filterType == EntityTree::FilterType::Edit || filterType == EntityTree::FilterType::Physics) &&
+                intersectPropertyFlags(propertiesIn.getChangedProperties(), filterData.includedProperties).isEmpty()) {
+                _skippedEdits++;
+                continue;
+            }
 
-            auto in = QJsonValue::fromVariant(inputValues.toVariant()); // grab json copy now, because the inputValues might be side effected by the filter.
+            FilterRequest request;
+            request.zoneID = id;
+            request.filterType = filterType;
+            request.propertiesIn = &propertiesIn;
+            request.propertiesOut = &propertiesOut;
+            request.existingEntity = existingEntity;
 
-            ScriptValueList args;
-            args << inputValues;
-            args << filterData.engine->newValue(filterType);
+            quint64 startEvaluation = usecTimestampNow();
+            evaluate(filterData, request);
+            _evaluationTimeHistogram.record((double)(usecTimestampNow() - startEvaluation) / USECS_PER_SECOND);
 
-            // get the current properties for then entity and include them for the filter call
-            if (existingEntity && filterData.wantsOriginalProperties) {
-                auto currentProperties = existingEntity->getProperties(filterData.includedOriginalProperties);
-                ScriptValue currentValues = currentProperties.copyToScriptValue(filterData.engine.get(), false, true, true);
-                args << currentValues;
+            if (!request.accepted) {
+                return false;
             }
+            if (request.isObject) {
+                wasChanged |= request.wasChanged;
+            } else {
+                wasChanged = false;
+            }
+        }
+    }
+    // if we made it here,
+    return true;
+}
 
+void EntityEditFilters::evaluate(FilterData& filterData, FilterRequest& request) {
+    auto& evaluator = *filterData.evaluator;
 
-            // get the zone properties
-            if (filterData.wantsZoneProperties) {
-                auto zoneEntity = _tree->findEntityByEntityItemID(id);
-                if (zoneEntity) {
-                    auto zoneProperties = zoneEntity->getProperties(filterData.includedZoneProperties);
-                    ScriptValue zoneValues = zoneProperties.copyToScriptValue(filterData.engine.get(), false, true, true);
-
-                    if (filterData.wantsZoneBoundingBox) {
-                        bool success = true;
-                        AABox aaBox = zoneEntity->getAABox(success);
-                        if (success) {
-                            ScriptValue boundingBox = filterData.engine->newObject();
-                            ScriptValue bottomRightNear = vec3ToScriptValue(filterData.engine.get(), aaBox.getCorner());
-                            ScriptValue topFarLeft = vec3ToScriptValue(filterData.engine.get(), aaBox.calcTopFarLeft());
-                            ScriptValue center = vec3ToScriptValue(filterData.engine.get(), aaBox.calcCenter());
-                            ScriptValue boundingBoxDimensions = vec3ToScriptValue(filterData.engine.get(), aaBox.getDimensions());
-                            boundingBox.setProperty("brn", bottomRightNear);
-                            boundingBox.setProperty("tfl", topFarLeft);
-                            boundingBox.setProperty("center", center);
-                            boundingBox.setProperty("dimensions", boundingBoxDimensions);
-                            zoneValues.setProperty("boundingBox", boundingBox);
-                        }
-                    }
+    std::unique_lock<std::mutex> lock(evaluator.mutex);
+    evaluator.pending.push_back(&request);
+    while (!request.done) {
+        if (evaluator.evaluating) {
+            // whoever is running the filter takes our request along with the next batch
+            evaluator.condition.wait(lock);
+            continue;
+        }
 
-                    // If this is an add or delete, or original properties weren't requested
-                    // there won't be original properties in the args, but zone properties need
-                    // to be the fourth parameter, so we need to pad the args accordingly
-                    int EXPECTED_ARGS = 3;
-                    if (args.length() < EXPECTED_ARGS) {
-                        args << ScriptValue();
-                    }
-                    assert(args.length() == EXPECTED_ARGS); // we MUST have 3 args by now!
-                    args << zoneValues;
+        evaluator.evaluating = true;
+        std::vector<FilterRequest*> batch;
+        batch.swap(evaluator.pending);
+        lock.unlock();
+
+        evaluateBatch(filterData, batch);
+
+        lock.lock();
+        for (auto batchRequest : batch) {
+            batchRequest->done = true;
+        }
+        evaluator.evaluating = false;
+        evaluator.condition.notify_all();
+    }
+}
+
+void EntityEditFilters::evaluateBatch(FilterData& filterData, const std::vector<FilterRequest*>& requests) {
+    quint64 startEvaluation = usecTimestampNow();
+    auto& evaluator = *filterData.evaluator;
+
+    std::vector<FilterRequest*> uncachedRequests;
+    std::vector<ScriptValueList> uncachedArgs;
+    for (auto request : requests) {
+        ScriptValueList args;
+        makeArguments(filterData, *request, args);
+
+        if (filterData.wantsCachedResults) {
+            QJsonArray key;
+            key.append(request->in);
+            for (int i = 1; i < args.length(); i++) {
+                key.append(QJsonValue::fromVariant(args[i].toVariant()));
+            }
+            request->cacheKey = QJsonDocument(key).toJson(QJsonDocument::Compact);
+
+            std::lock_guard<std::mutex> cacheLock(evaluator.cacheMutex);
+            auto cached = evaluator.cache.constFind(request->cacheKey);
+            if (cached != evaluator.cache.constEnd()) {
+                request->accepted = cached->accepted;
+                request->isObject = cached->isObject;
+                request->wasChanged = cached->wasChanged;
+                if (cached->isObject) {
+                    request->propertiesIn->merge(cached->properties);
+                    request->propertiesOut->merge(cached->properties);
+                } else if (cached->accepted) {
+                    *request->propertiesOut = *request->propertiesIn;
                 }
+                _cachedResults++;
+                continue;
             }
+        }
+
+        uncachedRequests.push_back(request);
+        uncachedArgs.push_back(args);
+    }
+
+    if (uncachedRequests.size() > 1 && filterData.batchFn.isFunction()) {
+        auto engine = filterData.engine;
+        ScriptValue edits = engine->newArray((uint)uncachedRequests.size());
+        for (size_t i = 0; i < uncachedRequests.size(); i++) {
+            const ScriptValueList& args = uncachedArgs[i];
+            ScriptValue edit = engine->newObject();
+            edit.setProperty("properties", args[0]);
+            edit.setProperty("type", args[1]);
+            if (args.length() > 2) {
+                edit.setProperty("originalProperties", args[2]);
+            }
+            if (args.length() > 3) {
+                edit.setProperty("zoneProperties", args[3]);
+            }
+            edits.setProperty((quint32)i, edit);
+        }
 
-            ScriptValue result = filterData.filterFn.call(_nullObjectForFilter, args);
+        ScriptValue results = filterData.batchFn.call(_nullObjectForFilter, ScriptValueList { edits });
+        _scriptCalls++;
+        _batchCalls++;
+
+        bool failed = filterData.uncaughtExceptions() || !results.isArray();
+        for (size_t i = 0; i < uncachedRequests.size(); i++) {
+            if (failed) {
+                // a broken batch says nothing about the edits in it, don't remember it
+                uncachedRequests[i]->cacheKey.clear();
+                uncachedRequests[i]->accepted = false;
+            } else {
+                applyResult(filterData, *uncachedRequests[i], results.property((quint32)i));
+            }
+        }
+    } else {
+        for (size_t i = 0; i < uncachedRequests.size(); i++) {
+            ScriptValue result = filterData.filterFn.call(_nullObjectForFilter, uncachedArgs[i]);
+            _scriptCalls++;
 
             if (filterData.uncaughtExceptions()) {
-                return false;
+                uncachedRequests[i]->cacheKey.clear();
+                uncachedRequests[i]->accepted = false;
+            } else {
+                applyResult(filterData, *uncachedRequests[i], result);
             }
+        }
+    }
 
-            if (result.isObject()) {
-                // make propertiesIn reflect the changes, for next filter...
-                propertiesIn.copyFromScriptValue(result, false);
+    _evaluatedEdits += uncachedRequests.size();
+    _totalEvaluationTime += usecTimestampNow() - startEvaluation;
+}
 
-                // and update propertiesOut too.  TODO: this could be more efficient...
-                propertiesOut.copyFromScriptValue(result, false);
-                // Javascript objects are == only if they are the same object. To compare arbitrary values, we need to use JSON.
-                auto out = QJsonValue::fromVariant(result.toVariant());
-                wasChanged |= (in != out);
-            } else if (result.isBool()) {
+void EntityEditFilters::makeArguments(FilterData& filterData, FilterRequest& request, ScriptValueList& args) {
+    EntityItemProperties& propertiesIn = *request.propertiesIn;
 
-                // if the filter returned false, then it's authoritative
-                if (!result.toBool()) {
-                    return false;
-                }
+    // only the properties this edit changes, and of those, only the ones the filter reads
+    auto oldProperties = propertiesIn.getDesiredProperties();
+    auto specifiedProperties = propertiesIn.getChangedProperties();
+    if (filterData.wantsProperties) {
+        specifiedProperties = intersectPropertyFlags(specifiedProperties, filterData.includedProperties);
+    }
+    propertiesIn.setDesiredProperties(specifiedProperties);
+    ScriptValue inputValues = propertiesIn.copyToScriptValue(filterData.engine.get(), false, true, true);
+    propertiesIn.setDesiredProperties(oldProperties);
 
-                // otherwise, assume it wants to pass all properties
-                propertiesOut = propertiesIn;
-                wasChanged = false;
+    request.in = QJsonValue::fromVariant(inputValues.toVariant()); // grab json copy now, because the inputValues might be side effected by the filter.
 
-            } else {
-                return false;
+    args << inputValues;
+    args << filterData.engine->newValue(request.filterType);
+
+    // get the current properties for then entity and include them for the filter call
+    if (request.existingEntity && filterData.wantsOriginalProperties) {
+        auto currentProperties = request.existingEntity->getProperties(filterData.includedOriginalProperties);
+        ScriptValue currentValues = currentProperties.copyToScriptValue(filterData.engine.get(), false, true, true);
+        args << currentValues;
+    }
+
+    // get the zone properties
+    if (filterData.wantsZoneProperties) {
+        auto zoneEntity = _tree->findEntityByEntityItemID(request.zoneID);
+        if (zoneEntity) {
+            auto zoneProperties = zoneEntity->getProperties(filterData.includedZoneProperties);
+            ScriptValue zoneValues = zoneProperties.copyToScriptValue(filterData.engine.get(), false, true, true);
+
+            if (filterData.wantsZoneBoundingBox) {
+                bool success = true;
+                AABox aaBox = zoneEntity->getAABox(success);
+                if (success) {
+                    ScriptValue boundingBox = filterData.engine->newObject();
+                    ScriptValue bottomRightNear = vec3ToScriptValue(filterData.engine.get(), aaBox.getCorner());
+                    ScriptValue topFarLeft = vec3ToScriptValue(filterData.engine.get(), aaBox.calcTopFarLeft());
+                    ScriptValue center = vec3ToScriptValue(filterData.engine.get(), aaBox.calcCenter());
+                    ScriptValue boundingBoxDimensions = vec3ToScriptValue(filterData.engine.get(), aaBox.getDimensions());
+                    boundingBox.setProperty("brn", bottomRightNear);
+                    boundingBox.setProperty("tfl", topFarLeft);
+                    boundingBox.setProperty("center", center);
+                    boundingBox.setProperty("dimensions", boundingBoxDimensions);
+                    zoneValues.setProperty("boundingBox", boundingBox);
+                }
             }
+
+            // If this is an add or delete, or original properties weren't requested
+            // there won't be original properties in the args, but zone properties need
+            // to be the fourth parameter, so we need to pad the args accordingly
+            int EXPECTED_ARGS = 3;
+            if (args.length() < EXPECTED_ARGS) {
+                args << ScriptValue();
+            }
+            assert(args.length() == EXPECTED_ARGS); // we MUST have 3 args by now!
+            args << zoneValues;
         }
     }
-    // if we made it here,
-    return true;
+}
+
+void EntityEditFilters::applyResult(FilterData& filterData, FilterRequest& request, const ScriptValue& result) {
+    FilterEvaluator::CachedResult cachedResult;
+
+    if (result.isObject()) {
+        // make propertiesIn reflect the changes, for next filter...
+        request.propertiesIn->copyFromScriptValue(result, false);
+
+        // and update propertiesOut too.  TODO: this could be more efficient...
+        request.propertiesOut->copyFromScriptValue(result, false);
+        // Javascript objects are == only if they are the same object. To compare arbitrary values, we need to use JSON.
+        auto out = QJsonValue::fromVariant(result.toVariant());
+        request.accepted = true;
+        request.isObject = true;
+        request.wasChanged = (request.in != out);
+
+        if (!request.cacheKey.isEmpty()) {
+            cachedResult.properties.copyFromScriptValue(result, false);
+        }
+    } else if (result.isBool()) {
+
+        // if the filter returned false, then it's authoritative
+        // otherwise, assume it wants to pass all properties
+        request.accepted = result.toBool();
+        if (request.accepted) {
+            *request.propertiesOut = *request.propertiesIn;
+        }
+
+    } else {
+        request.accepted = false;
+    }
+
+    if (!request.cacheKey.isEmpty()) {
+        cachedResult.accepted = request.accepted;
+        cachedResult.isObject = request.isObject;
+        cachedResult.wasChanged = request.wasChanged;
+
+        auto& evaluator = *filterData.evaluator;
+        std::lock_guard<std::mutex> cacheLock(evaluator.cacheMutex);
+        if (evaluator.cache.size() >= MAX_CACHED_FILTER_RESULTS) {
+            evaluator.cache.clear();
+        }
+        evaluator.cache.insert(request.cacheKey, cachedResult);
+    }
+}
+
+EntityEditFilters::Stats EntityEditFilters::getStats() const {
+    Stats stats;
+    stats.evaluatedEdits = _evaluatedEdits;
+    stats.scriptCalls = _scriptCalls;
+    stats.batchCalls = _batchCalls;
+    stats.cachedResults = _cachedResults;
+    stats.skippedEdits = _skippedEdits;
+    stats.totalEvaluationTime = _totalEvaluationTime;
+    return stats;
 }
 
 void EntityEditFilters::removeFilter(EntityItemID entityID) {
@@ -239,139 +450,160 @@ static bool hadUncaughtExceptions(ScriptEngine& engine, const QString& fileName)
     return false;
 }
 
-void EntityEditFilters::scriptRequestFinished(EntityItemID entityID) {
-    qDebug() << "script request completed for entity " << entityID;
-    auto scriptRequest = qobject_cast<ResourceRequest*>(sender());
-    if (scriptRequest && scriptRequest->getResult() == ResourceRequest::Success) {
-        const QString urlString = scriptRequest->getUrl().toString();
-        auto scriptContents = scriptRequest->getData();
-        qInfo() << "Downloaded script:" << scriptContents;
-        // create a ScriptEngine for this script
-        ScriptManagerPointer manager = newScriptManager(ScriptManager::ENTITY_SERVER_SCRIPT, "", urlString);
-        ScriptEnginePointer engine = manager->engine();
-        ScriptProgramPointer program = engine->newProgram(scriptContents, urlString);
-        if (hasCorrectSyntax(program)) {
-            engine->setObjectName("filter:" + entityID.toString());
-            engine->setProperty("type", "edit_filter");
-            engine->setProperty("fileName", urlString);
-            engine->setProperty("entityID", entityID);
-            engine->globalObject().setProperty("Script", engine->newQObject(manager.get()));
-            DependencyManager::get<ScriptInitializers>()->runScriptInitializers(engine.get());
-            engine->evaluate(scriptContents, urlString);
-            if (!hadUncaughtExceptions(*engine, urlString)) {
-                // put the engine in the engine map (so we don't leak them, etc...)
-                FilterData filterData;
-                filterData.engine = engine;
-                filterData.rejectAll = false;
-
-                // define the uncaughtException function
-                ScriptEngine& engineRef = *engine;
-                filterData.uncaughtExceptions = [&engineRef, urlString]() { return hadUncaughtExceptions(engineRef, urlString); };
-
-                // now get the filter function
-                auto global = engine->globalObject();
-                auto entitiesObject = engine->newObject();
-                entitiesObject.setProperty("ADD_FILTER_TYPE", EntityTree::FilterType::Add);
-                entitiesObject.setProperty("EDIT_FILTER_TYPE", EntityTree::FilterType::Edit);
-                entitiesObject.setProperty("PHYSICS_FILTER_TYPE", EntityTree::FilterType::Physics);
-                entitiesObject.setProperty("DELETE_FILTER_TYPE", EntityTree::FilterType::Delete);
-                global.setProperty("Entities", entitiesObject);
-                filterData.filterFn = global.property("filter");
-                if (!filterData.filterFn.isFunction()) {
-                    qDebug() << "Filter function specified but not found. Will reject all edits for those without lock rights.";
-                    engine.reset();
-                    filterData.rejectAll=true;
-                }
+void EntityEditFilters::setFilterScript(EntityItemID entityID, const QString& urlString, const QByteArray& scriptContents) {
+    qInfo() << "Downloaded script:" << scriptContents;
+    // create a ScriptEngine for this script
+    ScriptManagerPointer manager = newScriptManager(ScriptManager::ENTITY_SERVER_SCRIPT, "", urlString);
+    ScriptEnginePointer engine = manager->engine();
+    ScriptProgramPointer program = engine->newProgram(scriptContents, urlString);
+    if (hasCorrectSyntax(program)) {
+        engine->setObjectName("filter:" + entityID.toString());
+        engine->setProperty("type", "edit_filter");
+        engine->setProperty("fileName", urlString);
+        engine->setProperty("entityID", entityID);
+        engine->globalObject().setProperty("Script", engine->newQObject(manager.get()));
+        DependencyManager::get<ScriptInitializers>()->runScriptInitializers(engine.get());
+        engine->evaluate(scriptContents, urlString);
+        if (!hadUncaughtExceptions(*engine, urlString)) {
+            // put the engine in the engine map (so we don't leak them, etc...)
+            FilterData filterData;
+            filterData.engine = engine;
+            filterData.rejectAll = false;
+
+            // define the uncaughtException function
+            ScriptEngine& engineRef = *engine;
+            filterData.uncaughtExceptions = [&engineRef, urlString]() { return hadUncaughtExceptions(engineRef, urlString); };
+
+            // now get the filter function
+            auto global = engine->globalObject();
+            auto entitiesObject = engine->newObject();
+            entitiesObject.setProperty("ADD_FILTER_TYPE", EntityTree::FilterType::Add);
+            entitiesObject.setProperty("EDIT_FILTER_TYPE", EntityTree::FilterType::Edit);
+            entitiesObject.setProperty("PHYSICS_FILTER_TYPE", EntityTree::FilterType::Physics);
+            entitiesObject.setProperty("DELETE_FILTER_TYPE", EntityTree::FilterType::Delete);
+            global.setProperty("Entities", entitiesObject);
+            filterData.filterFn = global.property("filter");
+            if (!filterData.filterFn.isFunction()) {
+                qDebug() << "Filter function specified but not found. Will reject all edits for those without lock rights.";
+                engine.reset();
+                filterData.rejectAll=true;
+            }
 
-                // if the wantsToFilterEdit is a boolean evaluate as a boolean, otherwise assume true
-                ScriptValue wantsToFilterAddValue = filterData.filterFn.property("wantsToFilterAdd");
-                filterData.wantsToFilterAdd = wantsToFilterAddValue.isBool() ? wantsToFilterAddValue.toBool() : true;
-
-                // if the wantsToFilterEdit is a boolean evaluate as a boolean, otherwise assume true
-                ScriptValue wantsToFilterEditValue = filterData.filterFn.property("wantsToFilterEdit");
-                filterData.wantsToFilterEdit = wantsToFilterEditValue.isBool() ? wantsToFilterEditValue.toBool() : true;
-
-                // if the wantsToFilterPhysics is a boolean evaluate as a boolean, otherwise assume true
-                ScriptValue wantsToFilterPhysicsValue = filterData.filterFn.property("wantsToFilterPhysics");
-                filterData.wantsToFilterPhysics = wantsToFilterPhysicsValue.isBool() ? wantsToFilterPhysicsValue.toBool() : true;
-
-                // if the wantsToFilterDelete is a boolean evaluate as a boolean, otherwise assume false
-                ScriptValue wantsToFilterDeleteValue = filterData.filterFn.property("wantsToFilterDelete");
-                filterData.wantsToFilterDelete = wantsToFilterDeleteValue.isBool() ? wantsToFilterDeleteValue.toBool() : false;
-
-                // check to see if the filterFn has properties asking for Original props
-                ScriptValue wantsOriginalPropertiesValue = filterData.filterFn.property("wantsOriginalProperties");
-                // if the wantsOriginalProperties is a boolean, or a string, or list of strings, then evaluate as follows:
-                //   - boolean - true  - include all original properties
-                //               false - no properties at all
-                //   - string  - empty - no properties at all
-                //               any valid property - include just that property in the Original properties
-                //   - list of strings - include only those properties in the Original properties
-                if (wantsOriginalPropertiesValue.isBool()) {
-                    filterData.wantsOriginalProperties = wantsOriginalPropertiesValue.toBool();
-                } else if (wantsOriginalPropertiesValue.isString()) {
-                    auto stringValue = wantsOriginalPropertiesValue.toString();
-                    filterData.wantsOriginalProperties = !stringValue.isEmpty();
-                    if (filterData.wantsOriginalProperties) {
-                        EntityPropertyFlagsFromScriptValue(wantsOriginalPropertiesValue, filterData.includedOriginalProperties);
-                    }
-                } else if (wantsOriginalPropertiesValue.isArray()) {
+            // if the wantsToFilterEdit is a boolean evaluate as a boolean, otherwise assume true
+            ScriptValue wantsToFilterAddValue = filterData.filterFn.property("wantsToFilterAdd");
+            filterData.wantsToFilterAdd = wantsToFilterAddValue.isBool() ? wantsToFilterAddValue.toBool() : true;
+
+            // if the wantsToFilterEdit is a boolean evaluate as a boolean, otherwise assume true
+            ScriptValue wantsToFilterEditValue = filterData.filterFn.property("wantsToFilterEdit");
+            filterData.wantsToFilterEdit = wantsToFilterEditValue.isBool() ? wantsToFilterEditValue.toBool() : true;
+
+            // if the wantsToFilterPhysics is a boolean evaluate as a boolean, otherwise assume true
+            ScriptValue wantsToFilterPhysicsValue = filterData.filterFn.property("wantsToFilterPhysics");
+            filterData.wantsToFilterPhysics = wantsToFilterPhysicsValue.isBool() ? wantsToFilterPhysicsValue.toBool() : true;
+
+            // if the wantsToFilterDelete is a boolean evaluate as a boolean, otherwise assume false
+            ScriptValue wantsToFilterDeleteValue = filterData.filterFn.property("wantsToFilterDelete");
+            filterData.wantsToFilterDelete = wantsToFilterDeleteValue.isBool() ? wantsToFilterDeleteValue.toBool() : false;
+
+            // check to see if the filterFn declares which of the edited properties it reads
+            ScriptValue wantsPropertiesValue = filterData.filterFn.property("wantsProperties");
+            // if the wantsProperties is a string, or list of strings, then only those properties are passed to the
+            // filter, and edits that change none of them are accepted without calling it. Otherwise (or if the
+            // wantsProperties is true) all edited properties are passed, as they always were.
+            if (wantsPropertiesValue.isString() || wantsPropertiesValue.isArray()) {
+                EntityPropertyFlagsFromScriptValue(wantsPropertiesValue, filterData.includedProperties);
+                filterData.wantsProperties = true;
+            }
+
+            // if the wantsCachedResults is a boolean evaluate as a boolean, otherwise assume false
+            ScriptValue wantsCachedResultsValue = filterData.filterFn.property("wantsCachedResults");
+            filterData.wantsCachedResults = wantsCachedResultsValue.isBool() ? wantsCachedResultsValue.toBool() : false;
+
+            // the optional function filtering several edits in one call
+            filterData.batchFn = filterData.filterFn.property("batch");
+
+            // check to see if the filterFn has properties asking for Original props
+            ScriptValue wantsOriginalPropertiesValue = filterData.filterFn.property("wantsOriginalProperties");
+            // if the wantsOriginalProperties is a boolean, or a string, or list of strings, then evaluate as follows:
+            //   - boolean - true  - include all original properties
+            //               false - no properties at all
+            //   - string  - empty - no properties at all
+            //               any valid property - include just that property in the Original properties
+            //   - list of strings - include only those properties in the Original properties
+            if (wantsOriginalPropertiesValue.isBool()) {
+                filterData.wantsOriginalProperties = wantsOriginalPropertiesValue.toBool();
+            } else if (wantsOriginalPropertiesValue.isString()) {
+                auto stringValue = wantsOriginalPropertiesValue.toString();
+                filterData.wantsOriginalProperties = !stringValue.isEmpty();
+                if (filterData.wantsOriginalProperties) {
                     EntityPropertyFlagsFromScriptValue(wantsOriginalPropertiesValue, filterData.includedOriginalProperties);
-                    filterData.wantsOriginalProperties = !filterData.includedOriginalProperties.isEmpty();
                 }
+            } else if (wantsOriginalPropertiesValue.isArray()) {
+                EntityPropertyFlagsFromScriptValue(wantsOriginalPropertiesValue, filterData.includedOriginalProperties);
+                filterData.wantsOriginalProperties = !filterData.includedOriginalProperties.isEmpty();
+            }
 
-                // check to see if the filterFn has properties asking for Zone props
-                ScriptValue wantsZonePropertiesValue = filterData.filterFn.property("wantsZoneProperties");
-                // if the wantsZoneProperties is a boolean, or a string, or list of strings, then evaluate as follows:
-                //   - boolean - true  - include all Zone properties
-                //               false - no properties at all
-                //   - string  - empty - no properties at all
-                //               any valid property - include just that property in the Zone properties
-                //   - list of strings - include only those properties in the Zone properties
-                if (wantsZonePropertiesValue.isBool()) {
-                    filterData.wantsZoneProperties = wantsZonePropertiesValue.toBool();
-                    filterData.wantsZoneBoundingBox = filterData.wantsZoneProperties; // include this too
-                } else if (wantsZonePropertiesValue.isString()) {
-                    auto stringValue = wantsZonePropertiesValue.toString();
-                    filterData.wantsZoneProperties = !stringValue.isEmpty();
-                    if (filterData.wantsZoneProperties) {
+            // check to see if the filterFn has properties asking for Zone props
+            ScriptValue wantsZonePropertiesValue = filterData.filterFn.property("wantsZoneProperties");
+            // if the wantsZoneProperties is a boolean, or a string, or list of strings, then evaluate as follows:
+            //   - boolean - true  - include all Zone properties
+            //               false - no properties at all
+            //   - string  - empty - no properties at all
+            //               any valid property - include just that property in the Zone properties
+            //   - list of strings - include only those properties in the Zone properties
+            if (wantsZonePropertiesValue.isBool()) {
+                filterData.wantsZoneProperties = wantsZonePropertiesValue.toBool();
+                filterData.wantsZoneBoundingBox = filterData.wantsZoneProperties; // include this too
+            } else if (wantsZonePropertiesValue.isString()) {
+                auto stringValue = wantsZonePropertiesValue.toString();
+                filterData.wantsZoneProperties = !stringValue.isEmpty();
+                if (filterData.wantsZoneProperties) {
+                    if (stringValue == "boundingBox") {
+                        filterData.wantsZoneBoundingBox = true;
+                    } else {
+                        EntityPropertyFlagsFromScriptValue(wantsZonePropertiesValue, filterData.includedZoneProperties);
+                    }
+                }
+            } else if (wantsZonePropertiesValue.isArray()) {
+                auto length = wantsZonePropertiesValue.property("length").toInteger();
+                for (int i = 0; i < length; i++) {
+                    auto stringValue = wantsZonePropertiesValue.property(i).toString();
+                    if (!stringValue.isEmpty()) {
+                        filterData.wantsZoneProperties = true;
+
+                        // boundingBox is a special case since it's not a true EntityPropertyFlag, so we
+                        // need to detect it here.
                         if (stringValue == "boundingBox") {
                             filterData.wantsZoneBoundingBox = true;
-                        } else {
-                            EntityPropertyFlagsFromScriptValue(wantsZonePropertiesValue, filterData.includedZoneProperties);
+                            break; // we can break here, since there are no other special cases
                         }
-                    }
-                } else if (wantsZonePropertiesValue.isArray()) {
-                    auto length = wantsZonePropertiesValue.property("length").toInteger();
-                    for (int i = 0; i < length; i++) {
-                        auto stringValue = wantsZonePropertiesValue.property(i).toString();
-                        if (!stringValue.isEmpty()) {
-                            filterData.wantsZoneProperties = true;
-
-                            // boundingBox is a special case since it's not a true EntityPropertyFlag, so we
-                            // need to detect it here.
-                            if (stringValue == "boundingBox") {
-                                filterData.wantsZoneBoundingBox = true;
-                                break; // we can break here, since there are no other special cases
-                            }
 
-                        }
-                    }
-                    if (filterData.wantsZoneProperties) {
-                        EntityPropertyFlagsFromScriptValue(wantsZonePropertiesValue, filterData.includedZoneProperties);
                     }
                 }
+                if (filterData.wantsZoneProperties) {
+                    EntityPropertyFlagsFromScriptValue(wantsZonePropertiesValue, filterData.includedZoneProperties);
+                }
+            }
 
-                _lock.lockForWrite();
-                _filterDataMap.insert(entityID, filterData);
-                _lock.unlock();
+            _lock.lockForWrite();
+            _filterDataMap.insert(entityID, filterData);
+            _lock.unlock();
 
-                qDebug() << "script request filter processed for entity id " << entityID;
+            qDebug() << "script request filter processed for entity id " << entityID;
 
-                emit filterAdded(entityID, true);
-                return;
-            }
+            emit filterAdded(entityID, true);
+            return;
         }
+    }
+    emit filterAdded(entityID, false);
+}
+
+void EntityEditFilters::scriptRequestFinished(EntityItemID entityID) {
+    qDebug() << "script request completed for entity " << entityID;
+    auto scriptRequest = qobject_cast<ResourceRequest*>(sender());
+    if (scriptRequest && scriptRequest->getResult() == ResourceRequest::Success) {
+        setFilterScript(entityID, scriptRequest->getUrl().toString(), scriptRequest->getData());
+        return;
     } else if (scriptRequest) {
         const QString urlString = scriptRequest->getUrl().toString();
         qCritical() << "Failed to download script";
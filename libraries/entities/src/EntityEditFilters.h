@@ -14,11 +14,18 @@
 #define hifi_EntityEditFilters_h
 
 #include <QObject>
+#include <QHash>
 #include <QMap>
 #include <glm/glm.hpp>
 
+#include <atomic>
+#include <condition_variable>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
 
+#include <OpenMetrics.h>
 #include <ScriptValue.h>
 
 #include "EntityItemID.h"
@@ -27,11 +34,57 @@
 
 class ScriptEngine;
 
+/// Runs the JavaScript edit filters of the entity server.
+///
+/// A filter script defines a global filter(properties, type, originalProperties, zoneProperties) function, and can declare
+/// what it needs with properties of that function:
+///   - wantsToFilterAdd, wantsToFilterEdit, wantsToFilterPhysics, wantsToFilterDelete - the edit types it filters
+///   - wantsProperties - the edited properties it reads, as for wantsOriginalProperties. Only those are converted for the
+///     script, and edits or physics updates that change none of them are accepted without running the filter.
+///   - wantsOriginalProperties, wantsZoneProperties - the current properties of the entity and of the zone it passes
+///   - wantsCachedResults - the filter only depends on its arguments, so its result for identical arguments is reused
+///   - batch - a function taking an array of { properties, type, originalProperties, zoneProperties } objects and returning
+///     an array with the result of each, used when several edits are waiting for the filter at once.
+///
+/// A filter's script engine runs one evaluation at a time. Edits that arrive while it is busy are queued, and the thread
+/// that runs the next evaluation filters all queued edits together.
 class EntityEditFilters : public QObject, public Dependency {
     Q_OBJECT
 public:
+    struct Stats {
+        quint64 evaluatedEdits { 0 }; // edits that were passed to a filter script
+        quint64 scriptCalls { 0 };
+        quint64 batchCalls { 0 };
+        quint64 cachedResults { 0 }; // edits answered from the result cache
+        quint64 skippedEdits { 0 }; // edits that changed none of the properties a filter reads
+        quint64 totalEvaluationTime { 0 }; // usecs spent running filter scripts
+    };
+
+    class FilterRequest;
+
+    /// Serializes the evaluations of one filter and batches the edits that wait for it.
+    class FilterEvaluator {
+    public:
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::vector<FilterRequest*> pending;
+        bool evaluating { false };
+
+        struct CachedResult {
+            bool accepted { false };
+            bool isObject { false };
+            bool wasChanged { false };
+            EntityItemProperties properties;
+        };
+        std::mutex cacheMutex;
+        QHash<QByteArray, CachedResult> cache;
+    };
+
     struct FilterData {
         ScriptValue filterFn;
+        ScriptValue batchFn;
+        bool wantsProperties { false };
+        bool wantsCachedResults { false };
         bool wantsOriginalProperties { false };
         bool wantsZoneProperties { false };
 
@@ -40,12 +93,14 @@ public:
         bool wantsToFilterPhysics { true };
         bool wantsToFilterDelete { true };
 
+        EntityPropertyFlags includedProperties;
         EntityPropertyFlags includedOriginalProperties;
         EntityPropertyFlags includedZoneProperties;
         bool wantsZoneBoundingBox { false };
 
         std::function<bool()> uncaughtExceptions;
         ScriptEnginePointer engine;
+        std::shared_ptr<FilterEvaluator> evaluator { std::make_shared<FilterEvaluator>() };
         bool rejectAll;
         
         FilterData(): rejectAll(false) {};
@@ -58,9 +113,18 @@ public:
     void addFilter(EntityItemID entityID, QString filterURL);
     void removeFilter(EntityItemID entityID);
 
+    /// Sets up the filter of the entity from its downloaded script, replacing the previous filter and its cached results.
+    /// Emits filterAdded.
+    void setFilterScript(EntityItemID entityID, const QString& urlString, const QByteArray& scriptContents);
+
     bool filter(glm::vec3& position, EntityItemProperties& propertiesIn, EntityItemProperties& propertiesOut, bool& wasChanged, 
                 EntityTree::FilterType filterType, EntityItemID& entityID, const EntityItemPointer& existingEntity);
 
+    Stats getStats() const;
+
+    /// Time in seconds each filtered edit waited for and spent in filter scripts.
+    const MetricsHistogram& getEvaluationTimeHistogram() const { return _evaluationTimeHistogram; }
+
 signals:
     void filterAdded(EntityItemID id, bool success);
 
@@ -70,12 +134,25 @@ private slots:
 private:
     QList<EntityItemID> getZonesByPosition(glm::vec3& position);
 
+    void evaluate(FilterData& filterData, FilterRequest& request);
+    void evaluateBatch(FilterData& filterData, const std::vector<FilterRequest*>& requests);
+    void makeArguments(FilterData& filterData, FilterRequest& request, ScriptValueList& args);
+    void applyResult(FilterData& filterData, FilterRequest& request, const ScriptValue& result);
+
     EntityTreePointer _tree {};
     bool _rejectAll {false};
     ScriptValue _nullObjectForFilter{};
     
     QReadWriteLock _lock;
     QMap<EntityItemID, FilterData> _filterDataMap;
+
+    std::atomic<quint64> _evaluatedEdits { 0 };
+    std::atomic<quint64> _scriptCalls { 0 };
+    std::atomic<quint64> _batchCalls { 0 };
+    std::atomic<quint64> _cachedResults { 0 };
+    std::atomic<quint64> _skippedEdits { 0 };
+    std::atomic<quint64> _totalEvaluationTime { 0 };
+    MetricsHistogram _evaluationTimeHistogram;
 };
 
 #endif //hifi_EntityEditFilters_h
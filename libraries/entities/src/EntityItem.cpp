@@ -1336,12 +1336,12 @@ EntityItemProperties EntityItem::getProperties(const EntityPropertyFlags& desire
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(parentID, getParentID);
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(parentJointIndex, getParentJointIndex);
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(visible, getVisible);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(name, getName);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_NAME, name, getName);
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(locked, getLocked);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(userData, getUserData);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(privateUserData, getPrivateUserData);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(href, getHref);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(description, getDescription);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_USER_DATA, userData, getUserData);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_PRIVATE_USER_DATA, privateUserData, getPrivateUserData);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_HREF, href, getHref);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_DESCRIPTION, description, getDescription);
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(position, getLocalPosition);
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(dimensions, getScaledDimensions);
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(rotation, getLocalOrientation);
@@ -1356,41 +1356,41 @@ EntityItemProperties EntityItem::getProperties(const EntityPropertyFlags& desire
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(renderLayer, getRenderLayer);
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(primitiveMode, getPrimitiveMode);
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(ignorePickIntersection, getIgnorePickIntersection);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(renderWithZones, getRenderWithZones);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_RENDER_WITH_ZONES, renderWithZones, getRenderWithZones);
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(billboardMode, getBillboardMode);
     withReadLock([&] {
         _grabProperties.getProperties(properties);
     });
 
     // Physics
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(density, getDensity);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_DENSITY, density, getDensity);
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(velocity, getLocalVelocity);
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(angularVelocity, getLocalAngularVelocity);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(gravity, getGravity);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(acceleration, getAcceleration);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(damping, getDamping);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(angularDamping, getAngularDamping);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(restitution, getRestitution);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(friction, getFriction);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_GRAVITY, gravity, getGravity);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_ACCELERATION, acceleration, getAcceleration);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_DAMPING, damping, getDamping);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_ANGULAR_DAMPING, angularDamping, getAngularDamping);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_RESTITUTION, restitution, getRestitution);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_FRICTION, friction, getFriction);
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(lifetime, getLifetime);
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(collisionless, getCollisionless);
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(collisionMask, getCollisionMask);
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(dynamic, getDynamic);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(collisionSoundURL, getCollisionSoundURL);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(actionData, getDynamicData);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_COLLISION_SOUND_URL, collisionSoundURL, getCollisionSoundURL);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_ACTION_DATA, actionData, getDynamicData);
 
     // Cloning
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(cloneable, getCloneable);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(cloneLifetime, getCloneLifetime);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(cloneLimit, getCloneLimit);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(cloneDynamic, getCloneDynamic);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(cloneAvatarEntity, getCloneAvatarEntity);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(cloneOriginID, getCloneOriginID);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_CLONEABLE, cloneable, getCloneable);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_CLONE_LIFETIME, cloneLifetime, getCloneLifetime);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_CLONE_LIMIT, cloneLimit, getCloneLimit);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_CLONE_DYNAMIC, cloneDynamic, getCloneDynamic);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_CLONE_AVATAR_ENTITY, cloneAvatarEntity, getCloneAvatarEntity);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_CLONE_ORIGIN_ID, cloneOriginID, getCloneOriginID);
 
     // Scripts
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(script, getScript);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(scriptTimestamp, getScriptTimestamp);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(serverScripts, getServerScripts);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_SCRIPT, script, getScript);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_SCRIPT_TIMESTAMP, scriptTimestamp, getScriptTimestamp);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_SERVER_SCRIPTS, serverScripts, getServerScripts);
 
     // Script local data
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(localPosition, getLocalPosition);
@@ -1555,7 +1555,9 @@ ScriptValue EntityItemProperties::copyToScriptValue(ScriptEngine* engine, bool s
     // (There may be exceptions, but if so, they are bugs.)
     // In all other cases, you are welcome to inspect the code and try to figure out what was intended. I wish you luck. -HRS 1/18/17
     ScriptValue properties = engine->newObject();
-    EntityItemProperties defaultEntityProperties;
+    // Only compared against; reusing one instance per thread saves constructing every property on each call.
+    // (The property groups take it by non-const reference, so it isn't shared between threads.)
+    static thread_local EntityItemProperties defaultEntityProperties;
 
     const bool pseudoPropertyFlagsActive = pseudoPropertyFlags.test(EntityPseudoPropertyFlag::FlagsActive);
     // Fix to skip the default return all mechanism, when pseudoPropertyFlagsActive
@@ -1931,8 +1933,8 @@ ScriptValue EntityItemProperties::copyToScriptValue(ScriptEngine* engine, bool s
         COPY_PROPERTY_TO_QSCRIPTVALUE_GETTER_NO_SKIP(boundingBox, boundingBox); // gettable, but not settable
     }
 
-    QString textureNamesStr = QJsonDocument::fromVariant(_textureNames).toJson();
     if (!skipDefaults && !strictSemantics && (!pseudoPropertyFlagsActive || pseudoPropertyFlags.test(EntityPseudoPropertyFlag::OriginalTextures))) {
+        QString textureNamesStr = QJsonDocument::fromVariant(_textureNames).toJson();
         COPY_PROPERTY_TO_QSCRIPTVALUE_GETTER_NO_SKIP(originalTextures, textureNamesStr); // gettable, but not settable
     }
 
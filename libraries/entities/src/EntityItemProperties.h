@@ -129,6 +129,9 @@ public:
 
     EntityItemProperties(EntityPropertyFlags desiredProperties = EntityPropertyFlags());
     EntityItemProperties(const EntityItemProperties&) = default;
+    EntityItemProperties(EntityItemProperties&&) = default;
+    EntityItemProperties& operator=(const EntityItemProperties&) = default;
+    EntityItemProperties& operator=(EntityItemProperties&&) = default;
 
     virtual ~EntityItemProperties() = default;
 
@@ -164,7 +167,7 @@ public:
 
     void debugDump() const;
     void setLastEdited(quint64 usecTime);
-    EntityPropertyFlags getDesiredProperties() { return _desiredProperties; }
+    EntityPropertyFlags getDesiredProperties() const { return _desiredProperties; }
     void setDesiredProperties(EntityPropertyFlags properties) {  _desiredProperties = properties; }
 
     bool constructFromBuffer(const unsigned char* data, int dataLength);
@@ -95,6 +95,12 @@
     properties._##P = M();                      \
     properties._##P##Changed = false;
 
+// Skips reading a property that was not asked for; an empty desiredProperties means all of them.
+#define COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(p,P,M)                        \
+    if (desiredProperties.isEmpty() || desiredProperties.getHasProperty(p)) {     \
+        COPY_ENTITY_PROPERTY_TO_PROPERTIES(P,M);                                  \
+    }
+
 #define COPY_ENTITY_GROUP_PROPERTY_TO_PROPERTIES(G,P,M)  \
     properties.get##G().set##P(M());                     \
     properties.get##G().set##P##Changed(false);
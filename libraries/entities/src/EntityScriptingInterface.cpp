@@ -13,6 +13,8 @@
 
 #include "EntityScriptingInterface.h"
 
+#include <limits>
+
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtx/transform.hpp>
 
@@ -45,8 +47,10 @@
 #include <Profile.h>
 #include "GrabPropertyGroup.h"
 #include <ScriptContext.h>
+#include <ScriptEngine.h>
 #include <ScriptEngineCast.h>
 #include <ScriptValue.h>
+#include <ScriptValueUtils.h>
 
 const QString GRABBABLE_USER_DATA = "{\"grabbableKey\":{\"grabbable\":true}}";
 const QString NOT_GRABBABLE_USER_DATA = "{\"grabbableKey\":{\"grabbable\":false}}";
@@ -73,6 +77,9 @@ void staticEntityScriptInitializer(ScriptManager* manager) {
 
     scriptEngine->registerGlobalObject("Entities", entityScriptingInterface.data());
     scriptEngine->registerFunction("Entities", "getMultipleEntityProperties", EntityScriptingInterface::getMultipleEntityProperties);
+    scriptEngine->registerFunction("Entities", "getMultipleEntityPropertiesPacked", EntityScriptingInterface::getMultipleEntityPropertiesPacked);
+    scriptEngine->registerFunction("Entities", "editMultipleEntities", EntityScriptingInterface::editMultipleEntities);
+    scriptEngine->registerFunction("Entities", "editMultipleEntitiesPacked", EntityScriptingInterface::editMultipleEntitiesPacked);
 
     // "The return value of QObject::sender() is not valid when the slot is called via a Qt::DirectConnection from a thread
     // different from this object's thread. Do not use this function in this type of scenario."
@@ -311,53 +318,58 @@ void EntityScriptingInterface::setEntityTree(EntityTreePointer elementTree) {
     }
 }
 
-EntityItemProperties convertPropertiesToScriptSemantics(const EntityItemProperties& entitySideProperties,
-                                                        bool scalesWithParent) {
+// Converts properties read from an entity to script semantics in place. Only the desired properties are converted, the
+// others aren't copied to script values anyway; boundingBoxDesired keeps the transform that getAABox() depends on.
+void convertPropertiesToScriptSemantics(EntityItemProperties& properties, bool scalesWithParent, bool boundingBoxDesired) {
     // In EntityTree code, properties.position and properties.rotation are relative to the parent.  In javascript,
     // they are in world-space.  The local versions are put into localPosition and localRotation and position and
     // rotation are converted from local to world space.
-    EntityItemProperties scriptSideProperties = entitySideProperties;
-    scriptSideProperties.setLocalPosition(entitySideProperties.getPosition());
-    scriptSideProperties.setLocalRotation(entitySideProperties.getRotation());
-    scriptSideProperties.setLocalVelocity(entitySideProperties.getVelocity());
-    scriptSideProperties.setLocalAngularVelocity(entitySideProperties.getAngularVelocity());
-    scriptSideProperties.setLocalDimensions(entitySideProperties.getDimensions());
+    const EntityPropertyFlags desiredProperties = properties.getDesiredProperties();
+    auto isDesired = [&](EntityPropertyList property) {
+        return desiredProperties.isEmpty() || desiredProperties.getHasProperty(property);
+    };
 
-    bool success;
-    glm::vec3 worldPosition = SpatiallyNestable::localToWorld(entitySideProperties.getPosition(),
-                                                              entitySideProperties.getParentID(),
-                                                              entitySideProperties.getParentJointIndex(),
-                                                              scalesWithParent,
-                                                              success);
-    glm::quat worldRotation = SpatiallyNestable::localToWorld(entitySideProperties.getRotation(),
-                                                              entitySideProperties.getParentID(),
-                                                              entitySideProperties.getParentJointIndex(),
-                                                              scalesWithParent,
-                                                              success);
-    glm::vec3 worldVelocity = SpatiallyNestable::localToWorldVelocity(entitySideProperties.getVelocity(),
-                                                                      entitySideProperties.getParentID(),
-                                                                      entitySideProperties.getParentJointIndex(),
-                                                                      scalesWithParent,
-                                                                      success);
-    glm::vec3 worldAngularVelocity = SpatiallyNestable::localToWorldAngularVelocity(entitySideProperties.getAngularVelocity(),
-                                                                                    entitySideProperties.getParentID(),
-                                                                                    entitySideProperties.getParentJointIndex(),
-                                                                                    scalesWithParent,
-                                                                                    success);
-    glm::vec3 worldDimensions = SpatiallyNestable::localToWorldDimensions(entitySideProperties.getDimensions(),
-                                                                          entitySideProperties.getParentID(),
-                                                                          entitySideProperties.getParentJointIndex(),
-                                                                          scalesWithParent,
-                                                                          success);
+    const glm::vec3 localPosition = properties.getPosition();
+    const glm::quat localRotation = properties.getRotation();
+    const glm::vec3 localVelocity = properties.getVelocity();
+    const glm::vec3 localAngularVelocity = properties.getAngularVelocity();
+    const glm::vec3 localDimensions = properties.getDimensions();
+    const QUuid parentID = properties.getParentID();
+    const int parentJointIndex = properties.getParentJointIndex();
 
+    properties.setLocalPosition(localPosition);
+    properties.setLocalRotation(localRotation);
+    properties.setLocalVelocity(localVelocity);
+    properties.setLocalAngularVelocity(localAngularVelocity);
+    properties.setLocalDimensions(localDimensions);
 
-    scriptSideProperties.setPosition(worldPosition);
-    scriptSideProperties.setRotation(worldRotation);
-    scriptSideProperties.setVelocity(worldVelocity);
-    scriptSideProperties.setAngularVelocity(worldAngularVelocity);
-    scriptSideProperties.setDimensions(worldDimensions);
+    bool success;
+    if (boundingBoxDesired || isDesired(PROP_POSITION)) {
+        properties.setPosition(SpatiallyNestable::localToWorld(localPosition, parentID, parentJointIndex,
+                                                               scalesWithParent, success));
+    }
+    if (boundingBoxDesired || isDesired(PROP_ROTATION)) {
+        properties.setRotation(SpatiallyNestable::localToWorld(localRotation, parentID, parentJointIndex,
+                                                               scalesWithParent, success));
+    }
+    if (isDesired(PROP_VELOCITY)) {
+        properties.setVelocity(SpatiallyNestable::localToWorldVelocity(localVelocity, parentID, parentJointIndex,
+                                                                       scalesWithParent, success));
+    }
+    if (isDesired(PROP_ANGULAR_VELOCITY)) {
+        properties.setAngularVelocity(SpatiallyNestable::localToWorldAngularVelocity(localAngularVelocity, parentID,
+                                                                                     parentJointIndex, scalesWithParent,
+                                                                                     success));
+    }
+    if (boundingBoxDesired || isDesired(PROP_DIMENSIONS)) {
+        properties.setDimensions(SpatiallyNestable::localToWorldDimensions(localDimensions, parentID, parentJointIndex,
+                                                                           scalesWithParent, success));
+    }
+}
 
-    return scriptSideProperties;
+static bool isBoundingBoxDesired(const EntityPseudoPropertyFlags& pseudoPropertyFlags) {
+    return !pseudoPropertyFlags.test(EntityPseudoPropertyFlag::FlagsActive) ||
+        pseudoPropertyFlags.test(EntityPseudoPropertyFlag::BoundingBox);
 }
 
 
@@ -810,12 +822,19 @@ ScriptValue EntityScriptingInterface::getEntityProperties(const QUuid& entityID,
         }
     }
 
-    EntityItemProperties properties = getEntityPropertiesInternal(entityID, desiredProperties);
+    EntityItemProperties properties = getScriptSideProperties(entityID, desiredProperties,
+                                                              isBoundingBoxDesired(desiredPseudoPropertyFlags));
 
     return properties.copyToScriptValue(extendedDesiredProperties.engine().get(), false, false, false, desiredPseudoPropertyFlags);
 }
 
 EntityItemProperties EntityScriptingInterface::getEntityPropertiesInternal(const QUuid& entityID, EntityPropertyFlags desiredProperties) {
+    return getScriptSideProperties(entityID, desiredProperties, false);
+}
+
+EntityItemProperties EntityScriptingInterface::getScriptSideProperties(const QUuid& entityID,
+                                                                       EntityPropertyFlags desiredProperties,
+                                                                       bool boundingBoxDesired) {
 
     PROFILE_RANGE(script_entities, __FUNCTION__);
 
@@ -855,13 +874,14 @@ EntityItemProperties EntityScriptingInterface::getEntityPropertiesInternal(const
         });
     }
 
-    return convertPropertiesToScriptSemantics(results, scalesWithParent);
+    convertPropertiesToScriptSemantics(results, scalesWithParent, boundingBoxDesired);
+    return results;
 }
 
 
 struct EntityPropertiesResult {
-    EntityPropertiesResult(const EntityItemProperties& properties, bool scalesWithParent) :
-        properties(properties),
+    EntityPropertiesResult(EntityItemProperties&& properties, bool scalesWithParent) :
+        properties(std::move(properties)),
         scalesWithParent(scalesWithParent) {
     }
     EntityPropertiesResult() = default;
@@ -966,9 +986,8 @@ ScriptValue EntityScriptingInterface::getMultipleEntityPropertiesInternal(Script
                             needsScriptSemantics = true;
                         }
 
-                        auto properties = entity->getProperties(desiredProperties, true);
-                        EntityPropertiesResult result(properties, entity->getScalesWithParent());
-                        resultProperties.append(result);
+                        resultProperties.append(EntityPropertiesResult(entity->getProperties(desiredProperties, true),
+                                                                       entity->getScalesWithParent()));
                     }
                 }
             });
@@ -978,9 +997,10 @@ ScriptValue EntityScriptingInterface::getMultipleEntityPropertiesInternal(Script
     quint32 i = 0;
     if (needsScriptSemantics) {
         PROFILE_RANGE(script_entities, "EntityScriptingInterface::getMultipleEntityProperties>Script Semantics");
-        foreach(const auto& result, resultProperties) {
-            finalResult.setProperty(i++, convertPropertiesToScriptSemantics(result.properties, result.scalesWithParent)
-                .copyToScriptValue(engine, false, false, false, pseudoPropertyFlags));
+        const bool boundingBoxDesired = isBoundingBoxDesired(pseudoPropertyFlags);
+        for (auto& result : resultProperties) {
+            convertPropertiesToScriptSemantics(result.properties, result.scalesWithParent, boundingBoxDesired);
+            finalResult.setProperty(i++, result.properties.copyToScriptValue(engine, false, false, false, pseudoPropertyFlags));
         }
     } else {
         PROFILE_RANGE(script_entities, "EntityScriptingInterface::getMultipleEntityProperties>Skip Script Semantics");
@@ -991,6 +1011,259 @@ ScriptValue EntityScriptingInterface::getMultipleEntityPropertiesInternal(Script
     return finalResult;
 }
 
+// Properties that getMultipleEntityPropertiesPacked and editMultipleEntitiesPacked exchange as flat float arrays.
+enum class PackedEntityProperty {
+    Position,
+    Rotation,
+    Dimensions,
+    Velocity,
+    AngularVelocity,
+    LocalPosition,
+    LocalRotation,
+    LocalVelocity,
+    LocalAngularVelocity,
+    LocalDimensions
+};
+
+struct PackedEntityPropertyInfo {
+    PackedEntityProperty property;
+    const char* name;
+    int components;
+};
+
+static const PackedEntityPropertyInfo PACKED_ENTITY_PROPERTIES[] = {
+    { PackedEntityProperty::Position, "position", 3 },
+    { PackedEntityProperty::Rotation, "rotation", 4 },
+    { PackedEntityProperty::Dimensions, "dimensions", 3 },
+    { PackedEntityProperty::Velocity, "velocity", 3 },
+    { PackedEntityProperty::AngularVelocity, "angularVelocity", 3 },
+    { PackedEntityProperty::LocalPosition, "localPosition", 3 },
+    { PackedEntityProperty::LocalRotation, "localRotation", 4 },
+    { PackedEntityProperty::LocalVelocity, "localVelocity", 3 },
+    { PackedEntityProperty::LocalAngularVelocity, "localAngularVelocity", 3 },
+    { PackedEntityProperty::LocalDimensions, "localDimensions", 3 }
+};
+
+static const PackedEntityPropertyInfo* findPackedEntityProperty(const QString& name) {
+    for (const auto& info : PACKED_ENTITY_PROPERTIES) {
+        if (name == QLatin1String(info.name)) {
+            return &info;
+        }
+    }
+    return nullptr;
+}
+
+static void writePackedVec3(float* destination, const glm::vec3& value) {
+    destination[0] = value.x;
+    destination[1] = value.y;
+    destination[2] = value.z;
+}
+
+static void writePackedQuat(float* destination, const glm::quat& value) {
+    destination[0] = value.x;
+    destination[1] = value.y;
+    destination[2] = value.z;
+    destination[3] = value.w;
+}
+
+// must be called with the tree read lock held
+static void readPackedEntityProperty(const EntityItemPointer& entity, PackedEntityProperty property, float* destination) {
+    bool success;
+    switch (property) {
+        case PackedEntityProperty::Position:
+            writePackedVec3(destination, entity->getWorldPosition());
+            break;
+        case PackedEntityProperty::Rotation:
+            writePackedQuat(destination, entity->getWorldOrientation());
+            break;
+        case PackedEntityProperty::Dimensions:
+            writePackedVec3(destination, SpatiallyNestable::localToWorldDimensions(entity->getScaledDimensions(),
+                entity->getParentID(), entity->getParentJointIndex(), entity->getScalesWithParent(), success));
+            break;
+        case PackedEntityProperty::Velocity:
+            writePackedVec3(destination, entity->getWorldVelocity());
+            break;
+        case PackedEntityProperty::AngularVelocity:
+            writePackedVec3(destination, entity->getWorldAngularVelocity());
+            break;
+        case PackedEntityProperty::LocalPosition:
+            writePackedVec3(destination, entity->getLocalPosition());
+            break;
+        case PackedEntityProperty::LocalRotation:
+            writePackedQuat(destination, entity->getLocalOrientation());
+            break;
+        case PackedEntityProperty::LocalVelocity:
+            writePackedVec3(destination, entity->getLocalVelocity());
+            break;
+        case PackedEntityProperty::LocalAngularVelocity:
+            writePackedVec3(destination, entity->getLocalAngularVelocity());
+            break;
+        case PackedEntityProperty::LocalDimensions:
+            writePackedVec3(destination, entity->getScaledDimensions());
+            break;
+    }
+}
+
+static void setPackedEntityProperty(EntityItemProperties& properties, PackedEntityProperty property, const float* source) {
+    const glm::vec3 vec3Value(source[0], source[1], source[2]);
+    switch (property) {
+        case PackedEntityProperty::Position:
+            properties.setPosition(vec3Value);
+            break;
+        case PackedEntityProperty::Rotation:
+            properties.setRotation(glm::quat(source[3], source[0], source[1], source[2]));
+            break;
+        case PackedEntityProperty::Dimensions:
+            properties.setDimensions(vec3Value);
+            break;
+        case PackedEntityProperty::Velocity:
+            properties.setVelocity(vec3Value);
+            break;
+        case PackedEntityProperty::AngularVelocity:
+            properties.setAngularVelocity(vec3Value);
+            break;
+        case PackedEntityProperty::LocalPosition:
+            properties.setLocalPosition(vec3Value);
+            break;
+        case PackedEntityProperty::LocalRotation:
+            properties.setLocalRotation(glm::quat(source[3], source[0], source[1], source[2]));
+            break;
+        case PackedEntityProperty::LocalVelocity:
+            properties.setLocalVelocity(vec3Value);
+            break;
+        case PackedEntityProperty::LocalAngularVelocity:
+            properties.setLocalAngularVelocity(vec3Value);
+            break;
+        case PackedEntityProperty::LocalDimensions:
+            properties.setLocalDimensions(vec3Value);
+            break;
+    }
+}
+
+ScriptValue EntityScriptingInterface::getMultipleEntityPropertiesPacked(ScriptContext* context, ScriptEngine* engine) {
+    const int ARGUMENT_ENTITY_IDS = 0;
+    const int ARGUMENT_DESIRED_PROPERTIES = 1;
+
+    auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
+    const auto entityIDs = scriptvalue_cast<QVector<QUuid>>(context->argument(ARGUMENT_ENTITY_IDS));
+    return entityScriptingInterface->getMultipleEntityPropertiesPackedInternal(engine, entityIDs,
+                                                                               context->argument(ARGUMENT_DESIRED_PROPERTIES));
+}
+
+ScriptValue EntityScriptingInterface::getMultipleEntityPropertiesPackedInternal(ScriptEngine* engine, const QVector<QUuid>& entityIDs,
+                                                                                const ScriptValue& desiredProperties) {
+    PROFILE_RANGE(script_entities, __FUNCTION__);
+
+    QStringList propertyNames;
+    if (desiredProperties.isString()) {
+        propertyNames.append(desiredProperties.toString());
+    } else if (desiredProperties.isArray()) {
+        const quint32 length = desiredProperties.property("length").toInt32();
+        for (quint32 i = 0; i < length; i++) {
+            propertyNames.append(desiredProperties.property(i).toString());
+        }
+    }
+
+    std::vector<const PackedEntityPropertyInfo*> properties;
+    for (const auto& name : propertyNames) {
+        const PackedEntityPropertyInfo* info = findPackedEntityProperty(name);
+        if (info) {
+            properties.push_back(info);
+        } else {
+            qCWarning(entities) << "getMultipleEntityPropertiesPacked: property can't be packed:" << name;
+        }
+    }
+
+    // entities that can't be found are left as NaN
+    const int count = entityIDs.size();
+    std::vector<QVector<float>> buffers;
+    for (const auto& info : properties) {
+        buffers.emplace_back(count * info->components, std::numeric_limits<float>::quiet_NaN());
+    }
+
+    if (_entityTree && !properties.empty()) {
+        int i = 0;
+        const int lockAmount = 500;
+        while (i < count) {
+            _entityTree->withReadLock([&] {
+                for (int j = 0; j < lockAmount && i < count; ++i, ++j) {
+                    const EntityItemPointer entity = _entityTree->findEntityByEntityItemID(EntityItemID(entityIDs.at(i)));
+                    if (!entity) {
+                        continue;
+                    }
+                    for (size_t k = 0; k < properties.size(); k++) {
+                        readPackedEntityProperty(entity, properties[k]->property,
+                                                 buffers[k].data() + i * properties[k]->components);
+                    }
+                }
+            });
+        }
+    }
+
+    ScriptValue result = engine->newObject();
+    for (size_t k = 0; k < properties.size(); k++) {
+        result.setProperty(properties[k]->name, engine->newFloat32Array(buffers[k]));
+    }
+    return result;
+}
+
+ScriptValue EntityScriptingInterface::editMultipleEntities(ScriptContext* context, ScriptEngine* engine) {
+    const int ARGUMENT_ENTITY_IDS = 0;
+    const int ARGUMENT_PROPERTIES = 1;
+
+    auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
+    const auto entityIDs = scriptvalue_cast<QVector<QUuid>>(context->argument(ARGUMENT_ENTITY_IDS));
+    const ScriptValue scriptProperties = context->argument(ARGUMENT_PROPERTIES);
+
+    // either one set of properties per entity, or one set applied to all of them
+    QVector<EntityItemProperties> propertiesList;
+    if (scriptProperties.isArray()) {
+        const int length = scriptProperties.property("length").toInt32();
+        if (length != entityIDs.size()) {
+            engine->raiseException("editMultipleEntities: expected " + QString::number(entityIDs.size())
+                                   + " sets of properties, got " + QString::number(length));
+            return qVectorQUuidToScriptValue(engine, QVector<QUuid>());
+        }
+        propertiesList.reserve(length);
+        for (int i = 0; i < length; i++) {
+            propertiesList.append(scriptvalue_cast<EntityItemProperties>(scriptProperties.property(i)));
+        }
+    } else {
+        propertiesList.fill(scriptvalue_cast<EntityItemProperties>(scriptProperties), entityIDs.size());
+    }
+
+    return qVectorQUuidToScriptValue(engine, entityScriptingInterface->editEntitiesInternal(entityIDs, propertiesList));
+}
+
+ScriptValue EntityScriptingInterface::editMultipleEntitiesPacked(ScriptContext* context, ScriptEngine* engine) {
+    const int ARGUMENT_ENTITY_IDS = 0;
+    const int ARGUMENT_PACKED_PROPERTIES = 1;
+
+    auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
+    const auto entityIDs = scriptvalue_cast<QVector<QUuid>>(context->argument(ARGUMENT_ENTITY_IDS));
+    const ScriptValue packedProperties = context->argument(ARGUMENT_PACKED_PROPERTIES);
+    const int count = entityIDs.size();
+
+    QVector<EntityItemProperties> propertiesList(count);
+    QVector<float> values;
+    for (const auto& info : PACKED_ENTITY_PROPERTIES) {
+        const ScriptValue packedValues = packedProperties.property(info.name);
+        if (!packedValues.isValid() || packedValues.isUndefined()) {
+            continue;
+        }
+        if (!engine->toFloat32Vector(packedValues, values) || values.size() < count * info.components) {
+            qCWarning(entities) << "editMultipleEntitiesPacked: expected" << count * info.components
+                                << "values for" << info.name;
+            continue;
+        }
+        for (int i = 0; i < count; i++) {
+            setPackedEntityProperty(propertiesList[i], info.property, values.constData() + i * info.components);
+        }
+    }
+
+    return qVectorQUuidToScriptValue(engine, entityScriptingInterface->editEntitiesInternal(entityIDs, propertiesList));
+}
+
 QUuid EntityScriptingInterface::editEntity(const QUuid& id, const EntityItemProperties& scriptSideProperties) {
     PROFILE_RANGE(script_entities, __FUNCTION__);
 
@@ -1011,20 +1284,131 @@ QUuid EntityScriptingInterface::editEntity(const QUuid& id, const EntityItemProp
     SimulationOwner simulationOwner;
     _entityTree->withReadLock([&] {
         // make a copy of entity for local logic outside of tree lock
+        entity = findEntityForEdit(entityID, properties, simulationOwner);
+    });
+
+    if (!prepareEntityEdit(entity, simulationOwner, sessionID, properties)) {
+        return QUuid();
+    }
+
+    // done reading and modifying properties --> start write
+    bool updatedEntity = false;
+    _entityTree->withWriteLock([&] {
+        updatedEntity = _entityTree->updateEntity(entityID, properties);
+    });
+
+    // FIXME: We need to figure out a better way to handle this. Allowing these edits to go through potentially
+    // breaks entities that are parented.
+    //
+    // To handle cases where a script needs to edit an entity with a _known_ entity id but doesn't exist
+    // in the local entity tree, we need to allow those edits to go through to the server.
+    // if (!updatedEntity) {
+    //     return QUuid();
+    // }
+
+    // done writing, send update
+    _entityTree->withReadLock([&] {
+        // find the entity again: maybe it was removed since we last found it
         entity = _entityTree->findEntityByEntityItemID(entityID);
-        if (!entity) {
-            return;
+        if (entity) {
+            broadcastEntityEdit(entity, properties);
         }
+    });
+    if (!entity && !prepareEditOfUnknownEntity(id, properties)) {
+        return QUuid(); // null script value to indicate failure
+    }
+    // we queue edit packets even if we don't know about the entity.  This is to allow AC agents
+    // to edit entities they know only by ID.
+    queueEntityMessage(PacketType::EntityEdit, entityID, properties);
+    return id;
+}
 
-        if (entity->isAvatarEntity() && !entity->isMyAvatarEntity()) {
-            // don't edit other avatar's avatarEntities
-            properties = EntityItemProperties();
-            return;
+QVector<QUuid> EntityScriptingInterface::editEntitiesInternal(const QVector<QUuid>& ids,
+                                                              QVector<EntityItemProperties>& propertiesList) {
+    PROFILE_RANGE(script_entities, __FUNCTION__);
+
+    // Same steps as editEntity(), but every step handles the whole batch under a single tree lock.
+    const int count = std::min(ids.size(), propertiesList.size());
+    _activityTracking.editedEntityCount += count;
+
+    const auto sessionID = DependencyManager::get<NodeList>()->getSessionUUID();
+    QVector<QUuid> results = ids.mid(0, count);
+
+    if (!_entityTree) {
+        for (int i = 0; i < count; i++) {
+            propertiesList[i].setLastEditedBy(sessionID);
+            queueEntityMessage(PacketType::EntityEdit, EntityItemID(ids[i]), propertiesList[i]);
+        }
+        return results;
+    }
+
+    std::vector<EntityItemPointer> entities(count);
+    std::vector<SimulationOwner> simulationOwners(count);
+    _entityTree->withReadLock([&] {
+        for (int i = 0; i < count; i++) {
+            entities[i] = findEntityForEdit(EntityItemID(ids[i]), propertiesList[i], simulationOwners[i]);
+        }
+    });
+
+    for (int i = 0; i < count; i++) {
+        if (!prepareEntityEdit(entities[i], simulationOwners[i], sessionID, propertiesList[i])) {
+            results[i] = QUuid();
+        }
+    }
+
+    _entityTree->withWriteLock([&] {
+        for (int i = 0; i < count; i++) {
+            if (!results[i].isNull()) {
+                _entityTree->updateEntity(EntityItemID(ids[i]), propertiesList[i]);
+            }
         }
-        // make a copy of simulationOwner for local logic outside of tree lock
-        simulationOwner = entity->getSimulationOwner();
     });
 
+    _entityTree->withReadLock([&] {
+        for (int i = 0; i < count; i++) {
+            if (!results[i].isNull()) {
+                entities[i] = _entityTree->findEntityByEntityItemID(EntityItemID(ids[i]));
+                if (entities[i]) {
+                    broadcastEntityEdit(entities[i], propertiesList[i]);
+                }
+            }
+        }
+    });
+
+    // the edit packet sender coalesces these messages into as few packets as will hold them
+    for (int i = 0; i < count; i++) {
+        if (results[i].isNull()) {
+            continue;
+        }
+        if (!entities[i] && !prepareEditOfUnknownEntity(ids[i], propertiesList[i])) {
+            results[i] = QUuid();
+            continue;
+        }
+        queueEntityMessage(PacketType::EntityEdit, EntityItemID(ids[i]), propertiesList[i]);
+    }
+    return results;
+}
+
+EntityItemPointer EntityScriptingInterface::findEntityForEdit(const EntityItemID& entityID, EntityItemProperties& properties,
+                                                              SimulationOwner& simulationOwner) {
+    // must be called with the tree read lock held
+    EntityItemPointer entity = _entityTree->findEntityByEntityItemID(entityID);
+    if (!entity) {
+        return entity;
+    }
+
+    if (entity->isAvatarEntity() && !entity->isMyAvatarEntity()) {
+        // don't edit other avatar's avatarEntities
+        properties = EntityItemProperties();
+        return entity;
+    }
+    // make a copy of simulationOwner for local logic outside of tree lock
+    simulationOwner = entity->getSimulationOwner();
+    return entity;
+}
+
+bool EntityScriptingInterface::prepareEntityEdit(const EntityItemPointer& entity, const SimulationOwner& simulationOwner,
+                                                 const QUuid& sessionID, EntityItemProperties& properties) {
     QString previousUserdata;
     if (entity) {
         if (properties.hasTransformOrVelocityChanges() && entity->hasGrabs()) {
@@ -1076,7 +1460,7 @@ QUuid EntityScriptingInterface::editEntity(const QUuid& id, const EntityItemProp
         previousUserdata = entity->getUserData();
     } else if (_bidOnSimulationOwnership) {
         // bail when simulation participants don't know about entity
-        return QUuid();
+        return false;
     }
     // TODO: it is possible there is no remaining useful changes in properties and we should bail early.
     // How to check for this cheaply?
@@ -1084,96 +1468,75 @@ QUuid EntityScriptingInterface::editEntity(const QUuid& id, const EntityItemProp
     properties = convertPropertiesFromScriptSemantics(properties, properties.getScalesWithParent());
     synchronizeEditedGrabProperties(properties, previousUserdata);
     properties.setLastEditedBy(sessionID);
+    return true;
+}
 
-    // done reading and modifying properties --> start write
-    bool updatedEntity = false;
-    _entityTree->withWriteLock([&] {
-        updatedEntity = _entityTree->updateEntity(entityID, properties);
-    });
-
-    // FIXME: We need to figure out a better way to handle this. Allowing these edits to go through potentially
-    // breaks entities that are parented.
-    //
-    // To handle cases where a script needs to edit an entity with a _known_ entity id but doesn't exist
-    // in the local entity tree, we need to allow those edits to go through to the server.
-    // if (!updatedEntity) {
-    //     return QUuid();
-    // }
-
-    bool hasQueryAACubeRelatedChanges = properties.queryAACubeRelatedPropertyChanged();
-    // done writing, send update
-    _entityTree->withReadLock([&] {
-        // find the entity again: maybe it was removed since we last found it
-        entity = _entityTree->findEntityByEntityItemID(entityID);
-        if (entity) {
-            uint64_t now = usecTimestampNow();
-            entity->setLastBroadcast(now);
-
-            if (hasQueryAACubeRelatedChanges) {
-                properties.setQueryAACube(entity->getQueryAACube());
-
-                // if we've moved an entity with children, check/update the queryAACube of all descendents and tell the server
-                // if they've changed.
-                entity->forEachDescendant([&](SpatiallyNestablePointer descendant) {
-                    if (descendant->getNestableType() == NestableType::Entity) {
-                        if (descendant->updateQueryAACube()) {
-                            EntityItemPointer entityDescendant = std::static_pointer_cast<EntityItem>(descendant);
-                            EntityItemProperties newQueryCubeProperties;
-                            newQueryCubeProperties.setQueryAACube(descendant->getQueryAACube());
-                            newQueryCubeProperties.setLastEdited(properties.getLastEdited());
-                            queueEntityMessage(PacketType::EntityEdit, descendant->getID(), newQueryCubeProperties);
-                            entityDescendant->setLastBroadcast(now);
-                        }
-                    }
-                });
+void EntityScriptingInterface::broadcastEntityEdit(const EntityItemPointer& entity, EntityItemProperties& properties) {
+    // must be called with the tree read lock held
+    uint64_t now = usecTimestampNow();
+    entity->setLastBroadcast(now);
+
+    if (properties.queryAACubeRelatedPropertyChanged()) {
+        properties.setQueryAACube(entity->getQueryAACube());
+
+        // if we've moved an entity with children, check/update the queryAACube of all descendents and tell the server
+        // if they've changed.
+        entity->forEachDescendant([&](SpatiallyNestablePointer descendant) {
+            if (descendant->getNestableType() == NestableType::Entity) {
+                if (descendant->updateQueryAACube()) {
+                    EntityItemPointer entityDescendant = std::static_pointer_cast<EntityItem>(descendant);
+                    EntityItemProperties newQueryCubeProperties;
+                    newQueryCubeProperties.setQueryAACube(descendant->getQueryAACube());
+                    newQueryCubeProperties.setLastEdited(properties.getLastEdited());
+                    queueEntityMessage(PacketType::EntityEdit, descendant->getID(), newQueryCubeProperties);
+                    entityDescendant->setLastBroadcast(now);
+                }
             }
+        });
+    }
+}
+
+bool EntityScriptingInterface::prepareEditOfUnknownEntity(const QUuid& id, EntityItemProperties& properties) {
+    if (properties.queryAACubeRelatedPropertyChanged()) {
+        // Sometimes ESS don't have the entity they are trying to edit in their local tree.  In this case,
+        // convertPropertiesFromScriptSemantics doesn't get called and local* edits will get dropped.
+        // This is because, on the script side, "position" is in world frame, but in the network
+        // protocol and in the internal data-structures, "position" is "relative to parent".
+        // Compensate here.  The local* versions will get ignored during the edit-packet encoding.
+        if (properties.localPositionChanged()) {
+            properties.setPosition(properties.getLocalPosition());
         }
-    });
-    if (!entity) {
-        if (hasQueryAACubeRelatedChanges) {
-            // Sometimes ESS don't have the entity they are trying to edit in their local tree.  In this case,
-            // convertPropertiesFromScriptSemantics doesn't get called and local* edits will get dropped.
-            // This is because, on the script side, "position" is in world frame, but in the network
-            // protocol and in the internal data-structures, "position" is "relative to parent".
-            // Compensate here.  The local* versions will get ignored during the edit-packet encoding.
-            if (properties.localPositionChanged()) {
-                properties.setPosition(properties.getLocalPosition());
-            }
-            if (properties.localRotationChanged()) {
-                properties.setRotation(properties.getLocalRotation());
-            }
-            if (properties.localVelocityChanged()) {
-                properties.setVelocity(properties.getLocalVelocity());
-            }
-            if (properties.localAngularVelocityChanged()) {
-                properties.setAngularVelocity(properties.getLocalAngularVelocity());
-            }
-            if (properties.localDimensionsChanged()) {
-                properties.setDimensions(properties.getLocalDimensions());
-            }
+        if (properties.localRotationChanged()) {
+            properties.setRotation(properties.getLocalRotation());
         }
-        // we've made an edit to an entity we don't know about, or to a non-entity.  If it's a known non-entity,
-        // print a warning and don't send an edit packet to the entity-server.
-        QSharedPointer<SpatialParentFinder> parentFinder = DependencyManager::get<SpatialParentFinder>();
-        if (parentFinder) {
-            bool success;
-            auto nestableWP = parentFinder->find(id, success, static_cast<SpatialParentTree*>(_entityTree.get()));
-            if (success) {
-                auto nestable = nestableWP.lock();
-                if (nestable) {
-                    NestableType nestableType = nestable->getNestableType();
-                    if (nestableType == NestableType::Avatar) {
-                        qCWarning(entities) << "attempted edit on non-entity: " << id << nestable->getName();
-                        return QUuid(); // null script value to indicate failure
-                    }
+        if (properties.localVelocityChanged()) {
+            properties.setVelocity(properties.getLocalVelocity());
+        }
+        if (properties.localAngularVelocityChanged()) {
+            properties.setAngularVelocity(properties.getLocalAngularVelocity());
+        }
+        if (properties.localDimensionsChanged()) {
+            properties.setDimensions(properties.getLocalDimensions());
+        }
+    }
+    // we've made an edit to an entity we don't know about, or to a non-entity.  If it's a known non-entity,
+    // print a warning and don't send an edit packet to the entity-server.
+    QSharedPointer<SpatialParentFinder> parentFinder = DependencyManager::get<SpatialParentFinder>();
+    if (parentFinder) {
+        bool success;
+        auto nestableWP = parentFinder->find(id, success, static_cast<SpatialParentTree*>(_entityTree.get()));
+        if (success) {
+            auto nestable = nestableWP.lock();
+            if (nestable) {
+                NestableType nestableType = nestable->getNestableType();
+                if (nestableType == NestableType::Avatar) {
+                    qCWarning(entities) << "attempted edit on non-entity: " << id << nestable->getName();
+                    return false;
                 }
             }
         }
     }
-    // we queue edit packets even if we don't know about the entity.  This is to allow AC agents
-    // to edit entities they know only by ID.
-    queueEntityMessage(PacketType::EntityEdit, entityID, properties);
-    return id;
+    return true;
 }
 
 void EntityScriptingInterface::deleteEntity(const QUuid& id) {
@@ -219,6 +219,62 @@ public:
     static ScriptValue getMultipleEntityProperties(ScriptContext* context, ScriptEngine* engine);
     ScriptValue getMultipleEntityPropertiesInternal(ScriptEngine* engine, QVector<QUuid> entityIDs, const ScriptValue& extendedDesiredProperties);
 
+    /*@jsdoc
+     * Gets transform properties of multiple entities packed into flat arrays, avoiding the per-entity property objects of
+     * {@link Entities.getMultipleEntityProperties|getMultipleEntityProperties}.
+     * @function Entities.getMultipleEntityPropertiesPacked
+     * @param {Uuid[]} entityIDs - The IDs of the entities to get the properties of.
+     * @param {string[]|string} desiredProperties - The name or names of the properties to get. Supported properties are
+     *     <code>"position"</code>, <code>"rotation"</code>, <code>"dimensions"</code>, <code>"velocity"</code>,
+     *     <code>"angularVelocity"</code>, and their <code>local</code> versions.
+     * @returns {object} An object with a <code>Float32Array</code> per property, holding 3 (<code>x, y, z</code>) or 4
+     *     (<code>x, y, z, w</code>) values per entity in the order of <code>entityIDs</code>. The values of entities that
+     *     can't be found are <code>NaN</code>.
+     * @example <caption>Report the positions of nearby entities.</caption>
+     * var entityIDs = Entities.findEntities(MyAvatar.position, 50);
+     * var packed = Entities.getMultipleEntityPropertiesPacked(entityIDs, ["position"]);
+     * for (var i = 0; i < entityIDs.length; i++) {
+     *     print(entityIDs[i] + ": " + packed.position[3 * i] + ", " + packed.position[3 * i + 1] + ", "
+     *         + packed.position[3 * i + 2]);
+     * }
+     */
+    static ScriptValue getMultipleEntityPropertiesPacked(ScriptContext* context, ScriptEngine* engine);
+    ScriptValue getMultipleEntityPropertiesPackedInternal(ScriptEngine* engine, const QVector<QUuid>& entityIDs,
+                                                          const ScriptValue& desiredProperties);
+
+    /*@jsdoc
+     * Edits multiple entities. The edits are applied under one lock of the entity tree and sent to the server in as few
+     * packets as possible.
+     * @function Entities.editMultipleEntities
+     * @param {Uuid[]} entityIDs - The IDs of the entities to edit.
+     * @param {Entities.EntityProperties[]|Entities.EntityProperties} properties - The new property values for each entity,
+     *     or the new property values to apply to all of the entities.
+     * @returns {Uuid[]} For each entity, its ID if the edit was successful, otherwise {@link Uuid|Uuid.NULL}. Empty if
+     *     <code>properties</code> is an array of a different length than <code>entityIDs</code>.
+     * @throws Throws an error if <code>properties</code> is an array of a different length than <code>entityIDs</code>.
+     */
+    static ScriptValue editMultipleEntities(ScriptContext* context, ScriptEngine* engine);
+
+    /*@jsdoc
+     * Edits transform properties of multiple entities from flat arrays, in the layout returned by
+     * {@link Entities.getMultipleEntityPropertiesPacked|getMultipleEntityPropertiesPacked}.
+     * @function Entities.editMultipleEntitiesPacked
+     * @param {Uuid[]} entityIDs - The IDs of the entities to edit.
+     * @param {object} packedProperties - A <code>Float32Array</code> or array of numbers per property to set, holding 3 or 4
+     *     values per entity.
+     * @returns {Uuid[]} For each entity, its ID if the edit was successful, otherwise {@link Uuid|Uuid.NULL}.
+     * @example <caption>Raise a group of entities by 1m.</caption>
+     * var packed = Entities.getMultipleEntityPropertiesPacked(entityIDs, "position");
+     * for (var i = 0; i < entityIDs.length; i++) {
+     *     packed.position[3 * i + 1] += 1;
+     * }
+     * Entities.editMultipleEntitiesPacked(entityIDs, packed);
+     */
+    static ScriptValue editMultipleEntitiesPacked(ScriptContext* context, ScriptEngine* engine);
+
+    /// Applies an edit to each entity like editEntity() does, taking the tree lock once per step for the whole batch.
+    QVector<QUuid> editEntitiesInternal(const QVector<QUuid>& ids, QVector<EntityItemProperties>& propertiesList);
+
     QUuid addEntityInternal(const EntityItemProperties& properties, entity::HostType entityHostType);
 
 public slots:
@@ -2509,6 +2565,15 @@ private:
     static void readExtendedPropertyStringValue(const ScriptValue& extendedProperty,
                                          EntityPseudoPropertyFlags &pseudoPropertyFlags);
 
+    EntityItemPointer findEntityForEdit(const EntityItemID& entityID, EntityItemProperties& properties,
+                                        SimulationOwner& simulationOwner);
+    bool prepareEntityEdit(const EntityItemPointer& entity, const SimulationOwner& simulationOwner, const QUuid& sessionID,
+                           EntityItemProperties& properties);
+    void broadcastEntityEdit(const EntityItemPointer& entity, EntityItemProperties& properties);
+    bool prepareEditOfUnknownEntity(const QUuid& id, EntityItemProperties& properties);
+    EntityItemProperties getScriptSideProperties(const QUuid& entityID, EntityPropertyFlags desiredProperties,
+                                                 bool boundingBoxDesired);
+
     EntityItemPointer checkForTreeEntityAndTypeMatch(const QUuid& entityID,
                                                      EntityTypes::EntityType entityType = EntityTypes::Unknown);
 
@@ -1429,11 +1429,46 @@ bool EntityTree::isScriptInWhitelist(const QString& scriptProperty) {
     return false;
 }
 
+class EntityTree::PreparedEdit : public OctreeEdit {
+public:
+    PacketType type;
+    SharedNodePointer senderNode;
+
+    // EntityErase
+    std::vector<EntityItemID> idsToErase;
+
+    // EntityAdd, EntityClone, EntityEdit and EntityPhysics
+    bool isAdd { false };
+    bool isClone { false };
+    bool isPhysics { false };
+    bool validEditPacket { false };
+    bool allowed { false };
+    bool suppressDisallowedClientScript { false };
+    bool suppressDisallowedServerScript { false };
+    bool suppressDisallowedPrivateUserData { false };
+    EntityItemID entityItemID;
+    EntityItemID entityIDToClone;
+    EntityItemProperties properties;
+};
+
 // NOTE: Caller must lock the tree before calling this.
 int EntityTree::processEditPacketData(ReceivedMessage& message, const unsigned char* editData, int maxLength,
                                      const SharedNodePointer& senderNode) {
+    OctreeEditPointer edit;
+    int processedBytes = prepareEditPacketData(message, editData, maxLength, senderNode, edit);
+    if (edit) {
+        validateEdit(*edit);
+        commitEdit(*edit);
+    }
+    return processedBytes;
+}
+
+// Only decodes the edit, everything that depends on the state of the tree is left to validateEdit().
+// NOTE: Caller must hold at least a read lock on the tree before calling this.
+int EntityTree::prepareEditPacketData(ReceivedMessage& message, const unsigned char* editData, int maxLength,
+                                      const SharedNodePointer& senderNode, OctreeEditPointer& preparedEdit) {
     if (!getIsServer()) {
-        qCWarning(entities) << "EntityTree::processEditPacketData() should only be called on a server tree.";
+        qCWarning(entities) << "EntityTree::prepareEditPacketData() should only be called on a server tree.";
         return 0;
     }
 
@@ -1444,7 +1479,14 @@ int EntityTree::processEditPacketData(ReceivedMessage& message, const unsigned c
     switch (message.getType()) {
         case PacketType::EntityErase: {
             QByteArray dataByteArray = QByteArray::fromRawData(reinterpret_cast<const char*>(editData), maxLength);
-            processedBytes = processEraseMessageDetails(dataByteArray, senderNode);
+            auto edit = std::make_unique<PreparedEdit>();
+            edit->type = message.getType();
+            edit->senderNode = senderNode;
+            processedBytes = readEraseMessageIDs(dataByteArray, edit->idsToErase);
+            for (const auto& id : edit->idsToErase) {
+                edit->itemIDs.push_back(id);
+            }
+            preparedEdit = std::move(edit);
             break;
         }
 
@@ -1456,110 +1498,102 @@ int EntityTree::processEditPacketData(ReceivedMessage& message, const unsigned c
             // FALLTHRU
         case PacketType::EntityPhysics:
         case PacketType::EntityEdit: {
-            quint64 startDecode = 0, endDecode = 0;
-            quint64 startLookup = 0, endLookup = 0;
-            quint64 startUpdate = 0, endUpdate = 0;
-            quint64 startCreate = 0, endCreate = 0;
-            quint64 startFilter = 0, endFilter = 0;
-            quint64 startLogging = 0, endLogging = 0;
-
-            bool suppressDisallowedClientScript = false;
-            bool suppressDisallowedServerScript = false;
-            bool suppressDisallowedPrivateUserData = false;
-            bool isPhysics = message.getType() == PacketType::EntityPhysics;
+            auto edit = std::make_unique<PreparedEdit>();
+            edit->type = message.getType();
+            edit->senderNode = senderNode;
+            edit->isAdd = isAdd;
+            edit->isClone = isClone;
+            edit->isPhysics = message.getType() == PacketType::EntityPhysics;
 
             _totalEditMessages++;
 
-            EntityItemID entityItemID;
-            EntityItemProperties properties;
-            startDecode = usecTimestampNow();
-
-            bool validEditPacket = false;
-            EntityItemID entityIDToClone;
-            EntityItemPointer entityToClone;
+            EntityItemID& entityItemID = edit->entityItemID;
+            quint64 startDecode = usecTimestampNow();
             if (isClone) {
                 QByteArray buffer = QByteArray::fromRawData(reinterpret_cast<const char*>(editData), maxLength);
-                validEditPacket = EntityItemProperties::decodeCloneEntityMessage(buffer, processedBytes, entityIDToClone, entityItemID);
-                if (validEditPacket) {
-                    entityToClone = findEntityByEntityItemID(entityIDToClone);
-                    if (entityToClone) {
-                        properties = entityToClone->getProperties();
-                    }
-                }
+                edit->validEditPacket = EntityItemProperties::decodeCloneEntityMessage(buffer, processedBytes,
+                                                                                       edit->entityIDToClone, entityItemID);
             } else {
-                validEditPacket = EntityItemProperties::decodeEntityEditPacket(editData, maxLength, processedBytes, entityItemID, properties);
+                edit->validEditPacket = EntityItemProperties::decodeEntityEditPacket(editData, maxLength, processedBytes,
+                                                                                     entityItemID, edit->properties);
             }
+            _totalDecodeTime += usecTimestampNow() - startDecode;
 
-            endDecode = usecTimestampNow();
-
-            EntityItemPointer existingEntity;
-            if (!isAdd) {
-                // search for the entity by EntityItemID
-                startLookup = usecTimestampNow();
-                existingEntity = findEntityByEntityItemID(entityItemID);
-                endLookup = usecTimestampNow();
-                if (!existingEntity) {
-                    // this is not an add-entity operation, and we don't know about the identified entity.
-                    validEditPacket = false;
-                }
+            // an edit that fails its lookup may succeed once an earlier edit of the same entity is committed,
+            // so the edit is kept around to hold its place in line
+            if (!entityItemID.isInvalidID()) {
+                edit->itemIDs.push_back(entityItemID);
             }
+            if (isClone && !edit->entityIDToClone.isInvalidID()) {
+                edit->itemIDs.push_back(edit->entityIDToClone);
+            }
+            preparedEdit = std::move(edit);
+            break;
+        }
 
-            if (validEditPacket && !_entityScriptSourceWhitelist.isEmpty()) {
+        default:
+            processedBytes = 0;
+            break;
+    }
+    return processedBytes;
+}
 
-                bool wasDeletedBecauseOfClientScript = false;
+// Looks up the entities of a decoded edit, checks it against the sender's permissions and runs it through the filters.
+// NOTE: Caller must hold at least a read lock on the tree before calling this.
+void EntityTree::validateEdit(OctreeEdit& octreeEdit) {
+    auto& edit = static_cast<PreparedEdit&>(octreeEdit);
+    if (edit.type != PacketType::EntityErase) {
+        validateEntityEdit(edit);
+    }
+}
 
-                // check the client entity script to make sure its URL is in the whitelist
-                if (!properties.getScript().isEmpty()) {
-                    bool clientScriptPassedWhitelist = isScriptInWhitelist(properties.getScript());
+void EntityTree::validateEntityEdit(PreparedEdit& edit) {
+    if (!edit.validEditPacket) {
+        return;
+    }
 
-                    if (!clientScriptPassedWhitelist) {
-                        if (wantEditLogging()) {
-                            qCDebug(entities) << "User [" << senderNode->getUUID()
-                                << "] attempting to set entity script not on whitelist, edit rejected";
-                        }
+    quint64 startLookup = 0, endLookup = 0;
+    quint64 startFilter = 0, endFilter = 0;
 
-                        // If this was an add, we also want to tell the client that sent this edit that the entity was not added.
-                        if (isAdd) {
-                            QWriteLocker locker(&_recentlyDeletedEntitiesLock);
-                            _recentlyDeletedEntityItemIDs.insert(usecTimestampNow(), entityItemID);
-                            validEditPacket = false;
-                            wasDeletedBecauseOfClientScript = true;
-                        } else {
-                            suppressDisallowedClientScript = true;
-                        }
-                    }
-                }
+    const SharedNodePointer& senderNode = edit.senderNode;
+    const EntityItemID& entityItemID = edit.entityItemID;
+    EntityItemProperties& properties = edit.properties;
+    bool isAdd = edit.isAdd;
+    bool isClone = edit.isClone;
+    bool isPhysics = edit.isPhysics;
+    bool validEditPacket = true;
 
-                // check all server entity scripts to make sure their URLs are in the whitelist
-                if (!properties.getServerScripts().isEmpty()) {
-                    bool serverScriptPassedWhitelist = isScriptInWhitelist(properties.getServerScripts());
+    if (isClone) {
+        EntityItemPointer entityToClone = findEntityByEntityItemID(edit.entityIDToClone);
+        if (entityToClone) {
+            properties = entityToClone->getProperties();
+        }
+    }
 
-                    if (!serverScriptPassedWhitelist) {
-                        if (wantEditLogging()) {
-                            qCDebug(entities) << "User [" << senderNode->getUUID()
-                                << "] attempting to set server entity script not on whitelist, edit rejected";
-                        }
+    EntityItemPointer existingEntity;
+    if (!isAdd) {
+        // search for the entity by EntityItemID
+        startLookup = usecTimestampNow();
+        existingEntity = findEntityByEntityItemID(entityItemID);
+        endLookup = usecTimestampNow();
+        if (!existingEntity) {
+            // this is not an add-entity operation, and we don't know about the identified entity.
+            validEditPacket = false;
+        }
+    }
 
-                        // If this was an add, we also want to tell the client that sent this edit that the entity was not added.
-                        if (isAdd) {
-                            // Make sure we didn't already need to send back a delete because the client script failed
-                            // the whitelist check
-                            if (!wasDeletedBecauseOfClientScript) {
-                                QWriteLocker locker(&_recentlyDeletedEntitiesLock);
-                                _recentlyDeletedEntityItemIDs.insert(usecTimestampNow(), entityItemID);
-                                validEditPacket = false;
-                            }
-                        } else {
-                            suppressDisallowedServerScript = true;
-                        }
-                    }
-                }
-            }
+    if (validEditPacket && !_entityScriptSourceWhitelist.isEmpty()) {
+
+        bool wasDeletedBecauseOfClientScript = false;
+
+        // check the client entity script to make sure its URL is in the whitelist
+        if (!properties.getScript().isEmpty()) {
+            bool clientScriptPassedWhitelist = isScriptInWhitelist(properties.getScript());
 
-            if (!properties.getPrivateUserData().isEmpty() && validEditPacket && !senderNode->getCanGetAndSetPrivateUserData()) {
+            if (!clientScriptPassedWhitelist) {
                 if (wantEditLogging()) {
                     qCDebug(entities) << "User [" << senderNode->getUUID()
-                        << "] is attempting to set private user data but user isn't allowed; edit rejected...";
+                        << "] attempting to set entity script not on whitelist, edit rejected";
                 }
 
                 // If this was an add, we also want to tell the client that sent this edit that the entity was not added.
@@ -1567,175 +1601,253 @@ int EntityTree::processEditPacketData(ReceivedMessage& message, const unsigned c
                     QWriteLocker locker(&_recentlyDeletedEntitiesLock);
                     _recentlyDeletedEntityItemIDs.insert(usecTimestampNow(), entityItemID);
                     validEditPacket = false;
+                    wasDeletedBecauseOfClientScript = true;
                 } else {
-                    suppressDisallowedPrivateUserData = true;
+                    edit.suppressDisallowedClientScript = true;
                 }
             }
+        }
 
-            if (!isClone) {
-                if ((isAdd || properties.lifetimeChanged()) &&
-                    ((!senderNode->getCanRez() && senderNode->getCanRezTmp()))) {
-                    // this node is only allowed to rez temporary entities.  if need be, cap the lifetime.
-                    if (properties.getLifetime() == ENTITY_ITEM_IMMORTAL_LIFETIME ||
-                        properties.getLifetime() > _maxTmpEntityLifetime) {
-                        properties.setLifetime(_maxTmpEntityLifetime);
-                        bumpTimestamp(properties);
-                    }
+        // check all server entity scripts to make sure their URLs are in the whitelist
+        if (!properties.getServerScripts().isEmpty()) {
+            bool serverScriptPassedWhitelist = isScriptInWhitelist(properties.getServerScripts());
+
+            if (!serverScriptPassedWhitelist) {
+                if (wantEditLogging()) {
+                    qCDebug(entities) << "User [" << senderNode->getUUID()
+                        << "] attempting to set server entity script not on whitelist, edit rejected";
                 }
 
-                if (isAdd && properties.getLocked() && !senderNode->isAllowedEditor()) {
-                    // if a node can't change locks, don't allow it to create an already-locked entity -- automatically
-                    // clear the locked property and allow the unlocked entity to be created.
-                    properties.setLocked(false);
-                    bumpTimestamp(properties);
+                // If this was an add, we also want to tell the client that sent this edit that the entity was not added.
+                if (isAdd) {
+                    // Make sure we didn't already need to send back a delete because the client script failed
+                    // the whitelist check
+                    if (!wasDeletedBecauseOfClientScript) {
+                        QWriteLocker locker(&_recentlyDeletedEntitiesLock);
+                        _recentlyDeletedEntityItemIDs.insert(usecTimestampNow(), entityItemID);
+                        validEditPacket = false;
+                    }
+                } else {
+                    edit.suppressDisallowedServerScript = true;
                 }
             }
+        }
+    }
 
-            // If we got a valid edit packet, then it could be a new entity or it could be an update to
-            // an existing entity... handle appropriately
-            if (validEditPacket) {
-                startFilter = usecTimestampNow();
-                bool wasChanged = false;
-                // Having (un)lock rights bypasses the filter, unless it's a physics result.
-                FilterType filterType = isPhysics ? FilterType::Physics : (isAdd ? FilterType::Add : FilterType::Edit);
-                bool allowed = (!isPhysics && senderNode->isAllowedEditor()) || filterProperties(existingEntity, properties, properties, wasChanged, filterType);
-                if (!allowed) {
-                    // the update failed and we need to convey that fact to the sender
-                    // our method is to re-assert the current properties and bump the lastEdited timestamp
-                    auto timestamp = properties.getLastEdited();
-                    properties = EntityItemProperties();
-                    properties.setLastEdited(timestamp);
-                }
-                if (!allowed || wasChanged) {
-                    bumpTimestamp(properties);
-                    // For now, free ownership on any modification.
-                    properties.clearSimulationOwner();
-                }
-                endFilter = usecTimestampNow();
+    if (!properties.getPrivateUserData().isEmpty() && validEditPacket && !senderNode->getCanGetAndSetPrivateUserData()) {
+        if (wantEditLogging()) {
+            qCDebug(entities) << "User [" << senderNode->getUUID()
+                << "] is attempting to set private user data but user isn't allowed; edit rejected...";
+        }
 
-                if (existingEntity && !isAdd) {
+        // If this was an add, we also want to tell the client that sent this edit that the entity was not added.
+        if (isAdd) {
+            QWriteLocker locker(&_recentlyDeletedEntitiesLock);
+            _recentlyDeletedEntityItemIDs.insert(usecTimestampNow(), entityItemID);
+            validEditPacket = false;
+        } else {
+            edit.suppressDisallowedPrivateUserData = true;
+        }
+    }
 
-                    if (suppressDisallowedClientScript) {
-                        bumpTimestamp(properties);
-                        properties.setScript(existingEntity->getScript());
-                    }
+    if (!isClone) {
+        if ((isAdd || properties.lifetimeChanged()) &&
+            ((!senderNode->getCanRez() && senderNode->getCanRezTmp()))) {
+            // this node is only allowed to rez temporary entities.  if need be, cap the lifetime.
+            if (properties.getLifetime() == ENTITY_ITEM_IMMORTAL_LIFETIME ||
+                properties.getLifetime() > _maxTmpEntityLifetime) {
+                properties.setLifetime(_maxTmpEntityLifetime);
+                bumpTimestamp(properties);
+            }
+        }
 
-                    if (suppressDisallowedServerScript) {
-                        bumpTimestamp(properties);
-                        properties.setServerScripts(existingEntity->getServerScripts());
-                    }
+        if (isAdd && properties.getLocked() && !senderNode->isAllowedEditor()) {
+            // if a node can't change locks, don't allow it to create an already-locked entity -- automatically
+            // clear the locked property and allow the unlocked entity to be created.
+            properties.setLocked(false);
+            bumpTimestamp(properties);
+        }
+    }
 
-                    if (suppressDisallowedPrivateUserData) {
-                        bumpTimestamp(properties);
-                        properties.setPrivateUserData(existingEntity->getPrivateUserData());
-                    }
+    // If we got a valid edit packet, then it could be a new entity or it could be an update to
+    // an existing entity... run it through the filters now, it is applied by commitEdit()
+    if (validEditPacket) {
+        startFilter = usecTimestampNow();
+        bool wasChanged = false;
+        // Having (un)lock rights bypasses the filter, unless it's a physics result.
+        FilterType filterType = isPhysics ? FilterType::Physics : (isAdd ? FilterType::Add : FilterType::Edit);
+        bool allowed = (!isPhysics && senderNode->isAllowedEditor()) || filterProperties(existingEntity, properties, properties, wasChanged, filterType);
+        if (!allowed) {
+            // the update failed and we need to convey that fact to the sender
+            // our method is to re-assert the current properties and bump the lastEdited timestamp
+            auto timestamp = properties.getLastEdited();
+            properties = EntityItemProperties();
+            properties.setLastEdited(timestamp);
+        }
+        if (!allowed || wasChanged) {
+            bumpTimestamp(properties);
+            // For now, free ownership on any modification.
+            properties.clearSimulationOwner();
+        }
+        edit.allowed = allowed;
+        endFilter = usecTimestampNow();
+    }
+    edit.validEditPacket = validEditPacket;
 
-                    // if the EntityItem exists, then update it
-                    startLogging = usecTimestampNow();
-                    if (wantEditLogging()) {
-                        qCDebug(entities) << "User [" << senderNode->getUUID() << "] editing entity. ID:" << entityItemID;
-                        qCDebug(entities) << "   properties:" << properties;
-                    }
-                    if (wantTerseEditLogging()) {
-                        QList<QString> changedProperties = properties.listChangedProperties();
-                        fixupTerseEditLogging(properties, changedProperties);
-                        qCDebug(entities) << senderNode->getUUID() << "edit" <<
-                            existingEntity->getDebugName() << changedProperties;
-                    }
-                    endLogging = usecTimestampNow();
+    _totalLookupTime += endLookup - startLookup;
+    _totalFilterTime += endFilter - startFilter;
+}
 
-                    startUpdate = usecTimestampNow();
-                    if (!isPhysics) {
-                        properties.setLastEditedBy(senderNode->getUUID());
-                    }
-                    updateEntity(existingEntity, properties, senderNode);
-                    existingEntity->markAsChangedOnServer();
-                    endUpdate = usecTimestampNow();
-                    _totalUpdates++;
-                } else if (isAdd) {
-                    bool failedAdd = !allowed;
-                    bool isCloneable = properties.getCloneable();
-                    int cloneLimit = properties.getCloneLimit();
-                    if (!allowed) {
-                        qCDebug(entities) << "Filtered entity add. ID:" << entityItemID;
-                    } else if (!isClone && !senderNode->getCanRez() && !senderNode->getCanRezTmp()) {
-                        failedAdd = true;
-                        qCDebug(entities) << "User without 'rez rights' [" << senderNode->getUUID()
-                            << "] attempted to add an entity with ID:" << entityItemID;
-                    } else if (isClone && !isCloneable) {
-                        failedAdd = true;
-                        qCDebug(entities) << "User attempted to clone non-cloneable entity from entity ID:" << entityIDToClone;
-                    } else if (isClone && entityToClone && entityToClone->getCloneIDs().size() >= cloneLimit && cloneLimit != 0) {
-                        failedAdd = true;
-                        qCDebug(entities) << "User attempted to clone entity ID:" << entityIDToClone << " which reached it's cloneable limit.";
-                    } else {
-                        if (isClone) {
-                            properties.convertToCloneProperties(entityIDToClone);
-                        }
+// NOTE: Caller must lock the tree before calling this.
+void EntityTree::commitEdit(OctreeEdit& octreeEdit) {
+    auto& edit = static_cast<PreparedEdit&>(octreeEdit);
+    if (edit.type == PacketType::EntityErase) {
+        commitEraseEdit(edit);
+    } else {
+        commitEntityEdit(edit);
+    }
+}
 
-                        // this is a new entity... assign a new entityID
-                        properties.setLastEditedBy(senderNode->getUUID());
-                        startCreate = usecTimestampNow();
-                        EntityItemPointer newEntity = addEntity(entityItemID, properties);
-                        endCreate = usecTimestampNow();
-                        _totalCreates++;
+void EntityTree::commitEraseEdit(PreparedEdit& edit) {
+    if (!edit.idsToErase.empty()) {
+        bool force = edit.senderNode->isAllowedEditor();
+        bool ignoreWarnings = true;
+        deleteEntitiesByID(edit.idsToErase, force, ignoreWarnings);
+    }
+}
 
-                        if (newEntity && isClone) {
-                            entityToClone->addCloneID(newEntity->getEntityItemID());
-                            newEntity->setCloneOriginID(entityIDToClone);
-                        }
+void EntityTree::commitEntityEdit(PreparedEdit& edit) {
+    if (!edit.validEditPacket) {
+        return;
+    }
 
-                        if (newEntity) {
-                            newEntity->markAsChangedOnServer();
-                            notifyNewlyCreatedEntity(*newEntity, senderNode);
-                            
-                            startLogging = usecTimestampNow();
-                            if (wantEditLogging()) {
-                                qCDebug(entities) << "User [" << senderNode->getUUID() << "] added entity. ID:"
-                                                  << newEntity->getEntityItemID();
-                                qCDebug(entities) << "   properties:" << properties;
-                            }
-                            if (wantTerseEditLogging()) {
-                                QList<QString> changedProperties = properties.listChangedProperties();
-                                fixupTerseEditLogging(properties, changedProperties);
-                                qCDebug(entities) << senderNode->getUUID() << "add" << entityItemID << changedProperties;
-                            }
-                            endLogging = usecTimestampNow();
+    quint64 startUpdate = 0, endUpdate = 0;
+    quint64 startCreate = 0, endCreate = 0;
+    quint64 startLogging = 0, endLogging = 0;
 
-                        } else {
-                            failedAdd = true;
-                            qCDebug(entities) << "Add entity failed ID:" << entityItemID;
-                        }
-                    }
-                    if (failedAdd) { // Let client know it failed, so that they don't have an entity that no one else sees.
-                        QWriteLocker locker(&_recentlyDeletedEntitiesLock);
-                        _recentlyDeletedEntityItemIDs.insert(usecTimestampNow(), entityItemID);
-                    }
-                } else {
-                    HIFI_FCDEBUG(entities(), "Edit failed. [" << message.getType() <<"] " <<
-                            "entity id:" << entityItemID << 
-                            "existingEntity pointer:" << existingEntity.get());
-                }
-            }
+    const SharedNodePointer& senderNode = edit.senderNode;
+    const EntityItemID& entityItemID = edit.entityItemID;
+    const EntityItemID& entityIDToClone = edit.entityIDToClone;
+    EntityItemProperties& properties = edit.properties;
+    bool isAdd = edit.isAdd;
+    bool isClone = edit.isClone;
+    bool allowed = edit.allowed;
 
+    // look the entities up again, they may have been deleted since the edit was prepared
+    EntityItemPointer existingEntity;
+    if (!isAdd) {
+        existingEntity = findEntityByEntityItemID(entityItemID);
+    }
 
-            _totalDecodeTime += endDecode - startDecode;
-            _totalLookupTime += endLookup - startLookup;
-            _totalUpdateTime += endUpdate - startUpdate;
-            _totalCreateTime += endCreate - startCreate;
-            _totalLoggingTime += endLogging - startLogging;
-            _totalFilterTime += endFilter - startFilter;
+    if (existingEntity && !isAdd) {
 
-            break;
+        if (edit.suppressDisallowedClientScript) {
+            bumpTimestamp(properties);
+            properties.setScript(existingEntity->getScript());
         }
 
-        default:
-            processedBytes = 0;
-            break;
+        if (edit.suppressDisallowedServerScript) {
+            bumpTimestamp(properties);
+            properties.setServerScripts(existingEntity->getServerScripts());
+        }
+
+        if (edit.suppressDisallowedPrivateUserData) {
+            bumpTimestamp(properties);
+            properties.setPrivateUserData(existingEntity->getPrivateUserData());
+        }
+
+        // if the EntityItem exists, then update it
+        startLogging = usecTimestampNow();
+        if (wantEditLogging()) {
+            qCDebug(entities) << "User [" << senderNode->getUUID() << "] editing entity. ID:" << entityItemID;
+            qCDebug(entities) << "   properties:" << properties;
+        }
+        if (wantTerseEditLogging()) {
+            QList<QString> changedProperties = properties.listChangedProperties();
+            fixupTerseEditLogging(properties, changedProperties);
+            qCDebug(entities) << senderNode->getUUID() << "edit" <<
+                existingEntity->getDebugName() << changedProperties;
+        }
+        endLogging = usecTimestampNow();
+
+        startUpdate = usecTimestampNow();
+        if (!edit.isPhysics) {
+            properties.setLastEditedBy(senderNode->getUUID());
+        }
+        updateEntity(existingEntity, properties, senderNode);
+        existingEntity->markAsChangedOnServer();
+        endUpdate = usecTimestampNow();
+        _totalUpdates++;
+    } else if (isAdd) {
+        EntityItemPointer entityToClone = isClone ? findEntityByEntityItemID(entityIDToClone) : EntityItemPointer();
+        bool failedAdd = !allowed;
+        bool isCloneable = properties.getCloneable();
+        int cloneLimit = properties.getCloneLimit();
+        if (!allowed) {
+            qCDebug(entities) << "Filtered entity add. ID:" << entityItemID;
+        } else if (!isClone && !senderNode->getCanRez() && !senderNode->getCanRezTmp()) {
+            failedAdd = true;
+            qCDebug(entities) << "User without 'rez rights' [" << senderNode->getUUID()
+                << "] attempted to add an entity with ID:" << entityItemID;
+        } else if (isClone && !isCloneable) {
+            failedAdd = true;
+            qCDebug(entities) << "User attempted to clone non-cloneable entity from entity ID:" << entityIDToClone;
+        } else if (isClone && entityToClone && entityToClone->getCloneIDs().size() >= cloneLimit && cloneLimit != 0) {
+            failedAdd = true;
+            qCDebug(entities) << "User attempted to clone entity ID:" << entityIDToClone << " which reached it's cloneable limit.";
+        } else {
+            if (isClone) {
+                properties.convertToCloneProperties(entityIDToClone);
+            }
+
+            // this is a new entity... assign a new entityID
+            properties.setLastEditedBy(senderNode->getUUID());
+            startCreate = usecTimestampNow();
+            EntityItemPointer newEntity = addEntity(entityItemID, properties);
+            endCreate = usecTimestampNow();
+            _totalCreates++;
+
+            if (newEntity && isClone && entityToClone) {
+                entityToClone->addCloneID(newEntity->getEntityItemID());
+                newEntity->setCloneOriginID(entityIDToClone);
+            }
+
+            if (newEntity) {
+                newEntity->markAsChangedOnServer();
+                notifyNewlyCreatedEntity(*newEntity, senderNode);
+
+                startLogging = usecTimestampNow();
+                if (wantEditLogging()) {
+                    qCDebug(entities) << "User [" << senderNode->getUUID() << "] added entity. ID:"
+                                      << newEntity->getEntityItemID();
+                    qCDebug(entities) << "   properties:" << properties;
+                }
+                if (wantTerseEditLogging()) {
+                    QList<QString> changedProperties = properties.listChangedProperties();
+                    fixupTerseEditLogging(properties, changedProperties);
+                    qCDebug(entities) << senderNode->getUUID() << "add" << entityItemID << changedProperties;
+                }
+                endLogging = usecTimestampNow();
+
+            } else {
+                failedAdd = true;
+                qCDebug(entities) << "Add entity failed ID:" << entityItemID;
+            }
+        }
+        if (failedAdd) { // Let client know it failed, so that they don't have an entity that no one else sees.
+            QWriteLocker locker(&_recentlyDeletedEntitiesLock);
+            _recentlyDeletedEntityItemIDs.insert(usecTimestampNow(), entityItemID);
+        }
+    } else {
+        HIFI_FCDEBUG(entities(), "Edit failed. [" << edit.type <<"] " <<
+                "entity id:" << entityItemID <<
+                "existingEntity pointer:" << existingEntity.get());
     }
-    return processedBytes;
-}
 
+    _totalUpdateTime += endUpdate - startUpdate;
+    _totalCreateTime += endCreate - startCreate;
+    _totalLoggingTime += endLogging - startLogging;
+}
 
 void EntityTree::notifyNewlyCreatedEntity(const EntityItem& newEntity, const SharedNodePointer& senderNode) {
     _newlyCreatedHooksLock.lockForRead();
@@ -2109,6 +2221,18 @@ int EntityTree::processEraseMessageDetails(const QByteArray& dataByteArray, cons
     #ifdef EXTRA_ERASE_DEBUGGING
         qCDebug(entities) << "EntityTree::processEraseMessageDetails()";
     #endif
+    std::vector<EntityItemID> ids;
+    int processedBytes = readEraseMessageIDs(dataByteArray, ids);
+
+    if (!ids.empty()) {
+        bool force = sourceNode->isAllowedEditor();
+        bool ignoreWarnings = true;
+        deleteEntitiesByID(ids, force, ignoreWarnings);
+    }
+    return processedBytes;
+}
+
+int EntityTree::readEraseMessageIDs(const QByteArray& dataByteArray, std::vector<EntityItemID>& ids) {
     size_t packetLength = dataByteArray.size();
     size_t processedBytes = 0;
 
@@ -2116,32 +2240,25 @@ int EntityTree::processEraseMessageDetails(const QByteArray& dataByteArray, cons
     memcpy(&numberOfIds, dataByteArray.constData(), sizeof(numberOfIds));
     processedBytes += sizeof(numberOfIds);
 
-    if (numberOfIds > 0) {
-        std::vector<EntityItemID> ids;
-        ids.reserve(numberOfIds);
+    ids.reserve(numberOfIds);
 
-        // extract ids from packet
-        for (size_t i = 0; i < numberOfIds; i++) {
-            if (processedBytes + NUM_BYTES_RFC4122_UUID > packetLength) {
-                qCDebug(entities) << "EntityTree::processEraseMessageDetails().... bailing because not enough bytes in buffer";
-                break; // bail to prevent buffer overflow
-            }
+    // extract ids from packet
+    for (size_t i = 0; i < numberOfIds; i++) {
+        if (processedBytes + NUM_BYTES_RFC4122_UUID > packetLength) {
+            qCDebug(entities) << "EntityTree::readEraseMessageIDs().... bailing because not enough bytes in buffer";
+            break; // bail to prevent buffer overflow
+        }
 
-            QByteArray encodedID = dataByteArray.mid((int)processedBytes, NUM_BYTES_RFC4122_UUID);
-            QUuid id = QUuid::fromRfc4122(encodedID);
-            processedBytes += encodedID.size();
+        QByteArray encodedID = dataByteArray.mid((int)processedBytes, NUM_BYTES_RFC4122_UUID);
+        QUuid id = QUuid::fromRfc4122(encodedID);
+        processedBytes += encodedID.size();
 
-            #ifdef EXTRA_ERASE_DEBUGGING
-                qCDebug(entities) << "    ---- EntityTree::processEraseMessageDetails() contains id:" << id;
-            #endif
+        #ifdef EXTRA_ERASE_DEBUGGING
+            qCDebug(entities) << "    ---- EntityTree::readEraseMessageIDs() contains id:" << id;
+        #endif
 
-            EntityItemID entityID(id);
-            ids.push_back(entityID);
-        }
-
-        bool force = sourceNode->isAllowedEditor();
-        bool ignoreWarnings = true;
-        deleteEntitiesByID(ids, force, ignoreWarnings);
+        EntityItemID entityID(id);
+        ids.push_back(entityID);
     }
     return (int)processedBytes;
 }
@@ -12,6 +12,8 @@
 #ifndef hifi_EntityTree_h
 #define hifi_EntityTree_h
 
+#include <atomic>
+
 #include <QSet>
 #include <QVector>
 
@@ -90,6 +92,11 @@ public:
     void fixupTerseEditLogging(EntityItemProperties& properties, QList<QString>& changedProperties);
     virtual int processEditPacketData(ReceivedMessage& message, const unsigned char* editData, int maxLength,
                                       const SharedNodePointer& senderNode) override;
+    virtual bool canPrepareEdits() const override { return true; }
+    virtual int prepareEditPacketData(ReceivedMessage& message, const unsigned char* editData, int maxLength,
+                                      const SharedNodePointer& senderNode, OctreeEditPointer& edit) override;
+    virtual void validateEdit(OctreeEdit& edit) override;
+    virtual void commitEdit(OctreeEdit& edit) override;
 
     virtual EntityItemID evalRayIntersection(const glm::vec3& origin, const glm::vec3& direction,
         QVector<EntityItemID> entityIdsToInclude, QVector<EntityItemID> entityIdsToDiscard,
@@ -162,6 +169,7 @@ public:
 
     int processEraseMessage(ReceivedMessage& message, const SharedNodePointer& sourceNode);
     int processEraseMessageDetails(const QByteArray& buffer, const SharedNodePointer& sourceNode);
+    static int readEraseMessageIDs(const QByteArray& buffer, std::vector<EntityItemID>& ids);
     bool shouldEraseEntity(EntityItemID entityID, const SharedNodePointer& sourceNode);
 
 
@@ -330,15 +338,16 @@ protected:
 
 
     // some performance tracking properties - only used in server trees
-    int _totalEditMessages = 0;
-    int _totalUpdates = 0;
-    int _totalCreates = 0;
-    mutable quint64 _totalDecodeTime = 0;
-    mutable quint64 _totalLookupTime = 0;
-    mutable quint64 _totalUpdateTime = 0;
-    mutable quint64 _totalCreateTime = 0;
-    mutable quint64 _totalLoggingTime = 0;
-    mutable quint64 _totalFilterTime = 0;
+    // edits are prepared on several threads at once
+    std::atomic<int> _totalEditMessages { 0 };
+    std::atomic<int> _totalUpdates { 0 };
+    std::atomic<int> _totalCreates { 0 };
+    mutable std::atomic<quint64> _totalDecodeTime { 0 };
+    mutable std::atomic<quint64> _totalLookupTime { 0 };
+    mutable std::atomic<quint64> _totalUpdateTime { 0 };
+    mutable std::atomic<quint64> _totalCreateTime { 0 };
+    mutable std::atomic<quint64> _totalLoggingTime { 0 };
+    mutable std::atomic<quint64> _totalFilterTime { 0 };
 
     // these performance statistics are only used in the client
     void resetClientEditStats();
@@ -361,6 +370,12 @@ protected:
     float _maxTmpEntityLifetime { DEFAULT_MAX_TMP_ENTITY_LIFETIME };
 
     bool filterProperties(const EntityItemPointer& existingEntity, EntityItemProperties& propertiesIn, EntityItemProperties& propertiesOut, bool& wasChanged, FilterType filterType) const;
+
+    class PreparedEdit;
+    void validateEntityEdit(PreparedEdit& edit);
+    void commitEraseEdit(PreparedEdit& edit);
+    void commitEntityEdit(PreparedEdit& edit);
+
     bool _hasEntityEditFilter{ false };
     QStringList _entityScriptSourceWhitelist;
 
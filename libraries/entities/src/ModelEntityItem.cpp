@@ -60,19 +60,19 @@ EntityItemProperties ModelEntityItem::getProperties(const EntityPropertyFlags& d
     EntityItemProperties properties = EntityItem::getProperties(desiredProperties, allowEmptyDesiredProperties); // get the properties from our base class
 
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(shapeType, getShapeType);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(compoundShapeURL, getCompoundShapeURL);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_COMPOUND_SHAPE_URL, compoundShapeURL, getCompoundShapeURL);
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(color, getColor);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(textures, getTextures);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_TEXTURES, textures, getTextures);
 
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(modelURL, getModelURL);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_MODEL_URL, modelURL, getModelURL);
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(modelScale, getModelScale);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(jointRotationsSet, getJointRotationsSet);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(jointRotations, getJointRotations);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(jointTranslationsSet, getJointTranslationsSet);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(jointTranslations, getJointTranslations);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_JOINT_ROTATIONS_SET, jointRotationsSet, getJointRotationsSet);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_JOINT_ROTATIONS, jointRotations, getJointRotations);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_JOINT_TRANSLATIONS_SET, jointTranslationsSet, getJointTranslationsSet);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_JOINT_TRANSLATIONS, jointTranslations, getJointTranslations);
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(relayParentJoints, getRelayParentJoints);
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(groupCulled, getGroupCulled);
-    COPY_ENTITY_PROPERTY_TO_PROPERTIES(blendshapeCoefficients, getBlendshapeCoefficients);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES_IF_DESIRED(PROP_BLENDSHAPE_COEFFICIENTS, blendshapeCoefficients, getBlendshapeCoefficients);
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(useOriginalPivot, getUseOriginalPivot);
     withReadLock([&] {
         _animationProperties.getProperties(properties);
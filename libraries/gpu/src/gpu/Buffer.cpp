@@ -149,6 +149,14 @@ Buffer::Size Buffer::setSubData(Size offset, Size size, const Byte* data) {
     return changedBytes;
 }
 
+Byte* Buffer::editSubData(Size offset, Size size) {
+    if (offset + size > _end) {
+        return nullptr;
+    }
+    markDirty(offset, size);
+    return editData() + offset;
+}
+
 Buffer::Size Buffer::append(Size size, const Byte* data) {
     auto offset = _end;
     resize(_end + size);
@@ -73,6 +73,10 @@ public:
     // \return the number of bytes copied
     Size setSubData(Size offset, Size size, const Byte* data);
 
+    // Mark bytes [offset, offset + size) as changed and hand them out to be written in place
+    // \return the first byte, or nullptr if the range is outside the buffer
+    Byte* editSubData(Size offset, Size size);
+
     template <typename T>
     Size setSubData(Size index, const T& t) {
         Size offset = index * sizeof(T);
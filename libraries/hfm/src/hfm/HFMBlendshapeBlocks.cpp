@@ -0,0 +1,173 @@
+//
+//  HFMBlendshapeBlocks.cpp
+//  libraries/hfm/src/hfm
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "HFMBlendshapeBlocks.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+void accumulateBlendshapeBlocks_ref(BlendshapeOffsetUnpacked* offsets, const float* blocks, const int* blockIndices, int numBlocks, float coefficient) {
+    for (int i = 0; i < numBlocks; ++i) {
+        float* dst = (float*)(offsets + blockIndices[i] * BLENDSHAPE_BLOCK_SIZE);
+        const float* src = blocks + i * BLENDSHAPE_BLOCK_FLOATS;
+        for (int j = 0; j < BLENDSHAPE_BLOCK_FLOATS; ++j) {
+            dst[j] += src[j] * coefficient;
+        }
+    }
+}
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+//
+// Runtime CPU dispatch
+//
+#include <CPUDetect.h>
+
+void accumulateBlendshapeBlocks(BlendshapeOffsetUnpacked* offsets, const float* blocks, const int* blockIndices, int numBlocks, float coefficient) {
+    static bool _cpuSupportsAVX2 = cpuSupportsAVX2();
+    if (_cpuSupportsAVX2) {
+        static_assert(sizeof(BlendshapeOffsetUnpacked) == 9 * sizeof(float), "struct BlendshapeOffsetUnpacked size doesn't match.");
+        static_assert(BLENDSHAPE_BLOCK_FLOATS == 72, "blendshape block size doesn't match.");
+        accumulateBlendshapeBlocks_AVX2((float(*)[72])offsets, (const float(*)[72])blocks, blockIndices, numBlocks, coefficient);
+    } else {
+        accumulateBlendshapeBlocks_ref(offsets, blocks, blockIndices, numBlocks, coefficient);
+    }
+}
+
+#else   // portable reference code
+void accumulateBlendshapeBlocks(BlendshapeOffsetUnpacked* offsets, const float* blocks, const int* blockIndices, int numBlocks, float coefficient) {
+    accumulateBlendshapeBlocks_ref(offsets, blocks, blockIndices, numBlocks, coefficient);
+}
+#endif
+
+namespace hfm {
+
+BlendshapeLayout::BlendshapeLayout(const Model& hfmModel) {
+    const float NORMAL_COEFFICIENT_SCALE = 0.01f;
+
+    _meshes.resize(hfmModel.meshes.size());
+    for (int meshIndex = 0; meshIndex < (int)hfmModel.meshes.size(); ++meshIndex) {
+        const hfm::Mesh& hfmMesh = hfmModel.meshes.at(meshIndex);
+        if (hfmMesh.blendshapes.isEmpty()) {
+            continue;
+        }
+
+        BlendshapeLayout::Mesh& mesh = _meshes[meshIndex];
+        mesh.numVertices = hfmMesh.vertices.size();
+        mesh.numBlocks = (mesh.numVertices + BLENDSHAPE_BLOCK_SIZE - 1) / BLENDSHAPE_BLOCK_SIZE;
+
+        // where each block of the mesh is in the blendshape being laid out, if it has it
+        std::vector<int> blockSlots(mesh.numBlocks, -1);
+
+        mesh.blendshapes.resize(hfmMesh.blendshapes.size());
+        for (int i = 0; i < hfmMesh.blendshapes.size(); ++i) {
+            const hfm::Blendshape& hfmBlendshape = hfmMesh.blendshapes.at(i);
+            Blendshape& blendshape = mesh.blendshapes[i];
+
+            for (int j = 0; j < hfmBlendshape.indices.size(); ++j) {
+                int index = hfmBlendshape.indices.at(j);
+                if (index < 0 || index >= mesh.numVertices) {
+                    continue;
+                }
+
+                int block = index / BLENDSHAPE_BLOCK_SIZE;
+                if (blockSlots[block] < 0) {
+                    blockSlots[block] = (int)blendshape.blockIndices.size();
+                    blendshape.blockIndices.push_back(block);
+                    blendshape.blocks.resize(blendshape.blocks.size() + BLENDSHAPE_BLOCK_FLOATS, 0.0f);
+                }
+
+                // normals and tangents are scaled here rather than on every blend
+                auto& offset = *(BlendshapeOffsetUnpacked*)&blendshape.blocks[blockSlots[block] * BLENDSHAPE_BLOCK_FLOATS
+                                                                                + (index % BLENDSHAPE_BLOCK_SIZE) * 9];
+                offset.positionOffset += hfmBlendshape.vertices.at(j);
+                if (j < hfmBlendshape.normals.size()) {
+                    offset.normalOffset += hfmBlendshape.normals.at(j) * NORMAL_COEFFICIENT_SCALE;
+                }
+                if (j < hfmBlendshape.tangents.size()) {
+                    offset.tangentOffset += hfmBlendshape.tangents.at(j) * NORMAL_COEFFICIENT_SCALE;
+                }
+            }
+
+            for (int block : blendshape.blockIndices) {
+                blockSlots[block] = -1;
+            }
+        }
+    }
+}
+
+const int BlendshapeAccumulator::MAX_INCREMENTAL_BLENDS;
+
+BlendshapeAccumulator::BlendshapeAccumulator(BlendshapeLayout::ConstPointer layout) : _layout(layout) {
+    _offsets.resize(_layout->getMeshes().size());
+    for (size_t i = 0; i < _offsets.size(); ++i) {
+        _offsets[i].resize(_layout->getMeshes()[i].numBlocks * BLENDSHAPE_BLOCK_SIZE);
+        memset(_offsets[i].data(), 0, _offsets[i].size() * sizeof(BlendshapeOffsetUnpacked));
+    }
+}
+
+void BlendshapeAccumulator::blend(const QVector<float>& coefficients) {
+    // coefficients smaller than this don't count, and neither do changes smaller than this
+    const float EPSILON = 0.0001f;
+
+    size_t numCoefficients = std::max((size_t)coefficients.size(), _coefficients.size());
+    std::vector<float> targetCoefficients(numCoefficients, 0.0f);
+    for (int i = 0; i < coefficients.size(); ++i) {
+        float coefficient = coefficients.at(i);
+        targetCoefficients[i] = coefficient < EPSILON ? 0.0f : coefficient;
+    }
+    _coefficients.resize(numCoefficients, 0.0f);
+
+    int numChanged = 0;
+    int numActive = 0;
+    for (size_t i = 0; i < numCoefficients; ++i) {
+        if (fabsf(targetCoefficients[i] - _coefficients[i]) >= EPSILON) {
+            ++numChanged;
+        }
+        if (targetCoefficients[i] != 0.0f) {
+            ++numActive;
+        }
+    }
+
+    // start over when that is less work, and every so often so that rounding errors don't pile up
+    if (numChanged >= numActive || _numIncrementalBlends >= MAX_INCREMENTAL_BLENDS) {
+        for (auto& offsets : _offsets) {
+            memset(offsets.data(), 0, offsets.size() * sizeof(BlendshapeOffsetUnpacked));
+        }
+        std::fill(_coefficients.begin(), _coefficients.end(), 0.0f);
+        _numIncrementalBlends = 0;
+    } else {
+        ++_numIncrementalBlends;
+    }
+
+    const auto& meshes = _layout->getMeshes();
+    for (size_t i = 0; i < numCoefficients; ++i) {
+        float delta = targetCoefficients[i] - _coefficients[i];
+        if (fabsf(delta) < EPSILON) {
+            continue;
+        }
+
+        for (size_t meshIndex = 0; meshIndex < meshes.size(); ++meshIndex) {
+            const auto& mesh = meshes[meshIndex];
+            if (i >= mesh.blendshapes.size()) {
+                continue;
+            }
+            const auto& blendshape = mesh.blendshapes[i];
+            if (!blendshape.blockIndices.empty()) {
+                accumulateBlendshapeBlocks(_offsets[meshIndex].data(), blendshape.blocks.data(), blendshape.blockIndices.data(),
+                                           (int)blendshape.blockIndices.size(), delta);
+            }
+        }
+        _coefficients[i] = targetCoefficients[i];
+    }
+}
+
+};
@@ -0,0 +1,94 @@
+//
+//  HFMBlendshapeBlocks.h
+//  libraries/hfm/src/hfm
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Blendshapes laid out in sparse blocks of vertices, and the blending of them
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_HFMBlendshapeBlocks_h
+#define hifi_HFMBlendshapeBlocks_h
+
+#include <memory>
+#include <vector>
+
+#include <QVector>
+
+#include <BlendshapeConstants.h>
+
+#include "HFM.h"
+
+// blendshapes are accumulated in blocks of 8 consecutive vertices, laid out like BlendshapeOffsetUnpacked
+const int BLENDSHAPE_BLOCK_SIZE = 8;
+const int BLENDSHAPE_BLOCK_FLOATS = BLENDSHAPE_BLOCK_SIZE * 9;
+
+// offsets of block blockIndices[i] += coefficient * blocks[i], for numBlocks blocks of BLENDSHAPE_BLOCK_FLOATS floats
+void accumulateBlendshapeBlocks_ref(BlendshapeOffsetUnpacked* offsets, const float* blocks, const int* blockIndices, int numBlocks, float coefficient);
+void accumulateBlendshapeBlocks(BlendshapeOffsetUnpacked* offsets, const float* blocks, const int* blockIndices, int numBlocks, float coefficient);
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+// in libraries/shared/src/avx2, only to be called when cpuSupportsAVX2()
+void accumulateBlendshapeBlocks_AVX2(float (*offsets)[72], const float (*blocks)[72], const int* blockIndices, int numBlocks, float coefficient);
+#endif
+
+namespace hfm {
+
+/// The blendshapes of a model laid out for blending. Each blendshape keeps only the blocks of vertices it moves, with its
+/// normals and tangents already scaled, so blending one is a multiply-add over contiguous memory. It doesn't change once
+/// built, and is shared by every model blending the same geometry.
+class BlendshapeLayout {
+public:
+    using ConstPointer = std::shared_ptr<const BlendshapeLayout>;
+
+    struct Blendshape {
+        std::vector<int> blockIndices;
+        std::vector<float> blocks; // BLENDSHAPE_BLOCK_FLOATS per block
+    };
+
+    struct Mesh {
+        int numVertices { 0 }; // zero for meshes without blendshapes
+        int numBlocks { 0 };
+        std::vector<Blendshape> blendshapes;
+    };
+
+    explicit BlendshapeLayout(const Model& hfmModel);
+
+    const std::vector<Mesh>& getMeshes() const { return _meshes; }
+
+private:
+    std::vector<Mesh> _meshes;
+};
+
+/// The blendshape offsets of one model. A blend only applies the coefficients that changed since the last one, unless
+/// starting over is less work, and it starts over every so often so that rounding errors don't pile up. Not thread-safe.
+class BlendshapeAccumulator {
+public:
+    static const int MAX_INCREMENTAL_BLENDS { 100 };
+
+    explicit BlendshapeAccumulator(BlendshapeLayout::ConstPointer layout);
+
+    const BlendshapeLayout::ConstPointer& getLayout() const { return _layout; }
+
+    void blend(const QVector<float>& coefficients);
+
+    /// The offsets of each mesh, padded to whole blocks
+    const std::vector<std::vector<BlendshapeOffsetUnpacked>>& getOffsets() const { return _offsets; }
+
+    /// How many blends were applied on top of the last one since it last started over
+    int getNumIncrementalBlends() const { return _numIncrementalBlends; }
+
+private:
+    BlendshapeLayout::ConstPointer _layout;
+    std::vector<std::vector<BlendshapeOffsetUnpacked>> _offsets;
+    std::vector<float> _coefficients; // what the offsets are blended with
+    int _numIncrementalBlends { 0 };
+};
+
+};
+
+#endif // hifi_HFMBlendshapeBlocks_h
@@ -13,12 +13,9 @@
 
 #include <mutex>
 
-#include <QtConcurrent/QtConcurrentRun>
-
 #include <QCryptographicHash>
 #include <QImageReader>
-#include <QRunnable>
-#include <QThreadPool>
+#include <QThread>
 #include <QNetworkReply>
 #include <QPainter>
 #include <QUrlQuery>
@@ -433,6 +430,7 @@ void NetworkTexture::setExtra(void* extra) {
 
     if (!_textureSource || needsNewTextureSource) {
         _textureSource = std::make_shared<gpu::TextureSource>(_url, (int)_type);
+        _ktxMipQueue = std::make_shared<KTXMipQueue>();
     }
     _lowestRequestedMipLevel = 0;
 
@@ -494,23 +492,32 @@ gpu::TexturePointer NetworkTexture::getFallbackTexture() const {
     return getFallbackTextureForType(_type);
 }
 
-class ImageReader : public QRunnable {
+static ResourceLoadScheduler::PriorityFunction loadPriorityOf(const QWeakPointer<Resource>& resource) {
+    return [resource] {
+        auto strongResource = resource.lock();
+        return strongResource ? strongResource->getLastLoadPriority() : 0.0f;
+    };
+}
+
+class ImageReader : public ResourceLoadJobBase {
 public:
     ImageReader(const QWeakPointer<Resource>& resource, const QUrl& url,
                 const QByteArray& data, size_t extraHash, int maxNumPixels,
                 image::ColorChannel sourceChannel);
     void run() override final;
+    void cancelled() override final { _pendingProcessing->decrement(); }
     void read();
 
 private:
     static void listSupportedImageFormats();
 
-    QWeakPointer<Resource> _resource;
     QUrl _url;
     QByteArray _content;
     size_t _extraHash;
     int _maxNumPixels;
     image::ColorChannel _sourceChannel;
+    StatTracker::CounterPointer _pendingProcessing;
+    StatTracker::CounterPointer _processing;
 };
 
 NetworkTexture::~NetworkTexture() {
@@ -538,7 +545,7 @@ void NetworkTexture::makeRequest() {
 
     if (isLocalUrl(_activeUrl)) {
         auto self = _self;
-        QtConcurrent::run(QThreadPool::globalInstance(), [self] {
+        ResourceLoadScheduler::getInstance().schedule(ResourceLoadScheduler::IO, [self] {
             auto resource = self.lock();
             if (!resource) {
                 return;
@@ -546,7 +553,7 @@ void NetworkTexture::makeRequest() {
 
             NetworkTexture* networkTexture = static_cast<NetworkTexture*>(resource.data());
             networkTexture->makeLocalRequest();
-        });
+        }, loadPriorityOf(self), [self] { return self.isNull(); });
         return;
     }
 
@@ -585,14 +592,35 @@ void NetworkTexture::makeRequest() {
 
         startMipRangeRequest(NULL_MIP_LEVEL, NULL_MIP_LEVEL);
     } else if (_ktxResourceState == PENDING_MIP_REQUEST) {
-        if (_lowestKnownPopulatedMip > 0) {
+        // mips that arrived ahead of a request that then failed aren't asked for again
+        uint16_t lowestMipInHand = _lowestKnownPopulatedMip;
+        if (auto texture = _textureSource->getGPUTexture()) {
+            std::lock_guard<std::mutex> lock(_ktxMipQueue->mutex);
+            lowestMipInHand = texture->minAvailableMipLevel();
+            while (lowestMipInHand > 0 && _ktxMipQueue->mips.count(lowestMipInHand - 1) > 0) {
+                --lowestMipInHand;
+            }
+        }
+
+        if (lowestMipInHand > 0) {
             _ktxResourceState = REQUESTING_MIP;
 
+            // Smaller mips are asked for together, up to about what an ATP download has in flight at once, rather than
+            // each waiting for a request of its own
+            static const int64_t MAX_MIP_RANGE_SIZE = 4 * 1024 * 1024;
+            const auto& images = _originalKtxDescriptor->images;
+            uint16_t high = lowestMipInHand - 1;
+            uint16_t low = high;
+            int64_t rangeSize = images[high]._imageSize;
+            while (low > _lowestRequestedMipLevel && rangeSize + images[low - 1]._imageSize <= MAX_MIP_RANGE_SIZE) {
+                --low;
+                rangeSize += images[low]._imageSize;
+            }
+
             // Add a fragment to the base url so we can identify the section of the ktx being requested when debugging
             // The actual requested url is _activeUrl and will not contain the fragment
-            uint16_t nextMip = _lowestKnownPopulatedMip - 1;
-            _url.setFragment(QString::number(nextMip));
-            startMipRangeRequest(nextMip, nextMip);
+            _url.setFragment(QString::number(high));
+            startMipRangeRequest(low, high);
         }
     } else {
         qWarning(networking) << "NetworkTexture::makeRequest() called while not in a valid state: " << _ktxResourceState;
@@ -698,6 +726,14 @@ void NetworkTexture::startRequestForNextMipLevel() {
         return;
     }
 
+    // the job that assigns the mips still queued asks again once it is done
+    {
+        std::lock_guard<std::mutex> lock(_ktxMipQueue->mutex);
+        if (_ktxMipQueue->failed || !_ktxMipQueue->mips.empty()) {
+            return;
+        }
+    }
+
     _lowestKnownPopulatedMip = texture->minAvailableMipLevel();
     if (_lowestRequestedMipLevel < _lowestKnownPopulatedMip) {
         _ktxResourceState = PENDING_MIP_REQUEST;
@@ -743,7 +779,16 @@ void NetworkTexture::startMipRangeRequest(uint16_t low, uint16_t high) {
         range.toExclusive = ktx::KTX_HEADER_SIZE + _originalKtxDescriptor->header.bytesOfKeyValueData
                               + _originalKtxDescriptor->images[high + 1]._imageOffset;
         _ktxMipRequest->setByteRange(range);
+        // the smallest mips, which the GPU texture takes first, are at the end
+        _ktxMipRequest->setFetchBackwards(true);
+
+        _ktxMipRangeData = QByteArray((int)range.size(), Qt::Uninitialized);
+        _ktxMipBytesMissing.clear();
+        for (uint16_t level = low; level <= high; ++level) {
+            _ktxMipBytesMissing.push_back(_originalKtxDescriptor->images[level]._imageSize);
+        }
 
+        connect(_ktxMipRequest, &ResourceRequest::rangeReceived, this, &NetworkTexture::ktxMipRangeReceived);
         connect(_ktxMipRequest, &ResourceRequest::finished, this, &NetworkTexture::ktxMipRequestFinished);
     }
 
@@ -827,51 +872,22 @@ void NetworkTexture::ktxMipRequestFinished() {
 
         if (_ktxResourceState == REQUESTING_MIP) {
             Q_ASSERT(_ktxMipLevelRangeInFlight.first != NULL_MIP_LEVEL);
-            Q_ASSERT(_ktxMipLevelRangeInFlight.second - _ktxMipLevelRangeInFlight.first == 0);
 
             _ktxResourceState = WAITING_FOR_MIP_REQUEST;
 
-            auto self = _self;
-            auto url = _url;
+            // the mips that didn't arrive ahead of the rest, which is all of them when the request doesn't fetch its data
+            // in parts, come with the data as a whole
             auto data = _ktxMipRequest->getData();
-            auto mipLevel = _ktxMipLevelRangeInFlight.first;
-            auto texture = _textureSource->getGPUTexture();
-            DependencyManager::get<StatTracker>()->incrementStat("PendingProcessing");
-            QtConcurrent::run(QThreadPool::globalInstance(), [self, data, mipLevel, url, texture] {
-                PROFILE_RANGE_EX(resource_parse_image, "NetworkTexture - Processing Mip Data", 0xffff0000, 0, { { "url", url.toString() } });
-                DependencyManager::get<StatTracker>()->decrementStat("PendingProcessing");
-                CounterStat counter("Processing");
-
-                auto originalPriority = QThread::currentThread()->priority();
-                if (originalPriority == QThread::InheritPriority) {
-                    originalPriority = QThread::NormalPriority;
+            auto low = _ktxMipLevelRangeInFlight.first;
+            const auto& images = _originalKtxDescriptor->images;
+            for (size_t i = 0; i < _ktxMipBytesMissing.size(); i++) {
+                if (_ktxMipBytesMissing[i] > 0) {
+                    uint16_t mipLevel = low + (uint16_t)i;
+                    int mipOffset = (int)(images[mipLevel]._imageOffset - images[low]._imageOffset);
+                    queueMip(mipLevel, data.mid(mipOffset, images[mipLevel]._imageSize));
                 }
-                QThread::currentThread()->setPriority(QThread::LowPriority);
-                Finally restorePriority([originalPriority] { QThread::currentThread()->setPriority(originalPriority); });
-
-                auto resource = self.lock();
-                if (!resource) {
-                    // Resource no longer exists, bail
-                    return;
-                }
-
-                Q_ASSERT_X(texture, "Async - NetworkTexture::ktxMipRequestFinished", "NetworkTexture should have been assigned a GPU texture by now.");
-
-                texture->assignStoredMip(mipLevel, data.size(), reinterpret_cast<const uint8_t*>(data.data()));
-
-                // If mip level assigned above is still unavailable, then we assume future requests will also fail.
-                auto minMipLevel = texture->minAvailableMipLevel();
-                if (minMipLevel > mipLevel) {
-                    return;
-                }
-
-                QMetaObject::invokeMethod(resource.data(), "setImage",
-                    Q_ARG(gpu::TexturePointer, texture),
-                    Q_ARG(int, texture->getWidth()),
-                    Q_ARG(int, texture->getHeight()));
-
-                QMetaObject::invokeMethod(resource.data(), "startRequestForNextMipLevel");
-            });
+            }
+            scheduleMipAssignment();
         } else {
             qWarning(networking) << "Mip request finished in an unexpected state: " << _ktxResourceState;
             finishedLoading(false);
@@ -887,6 +903,125 @@ void NetworkTexture::ktxMipRequestFinished() {
     _ktxMipRequest->disconnect(this);
     _ktxMipRequest->deleteLater();
     _ktxMipRequest = nullptr;
+    _ktxMipRangeData = QByteArray();
+    _ktxMipBytesMissing.clear();
+}
+
+void NetworkTexture::ktxMipRangeReceived(qint64 offset, const QByteArray& data) {
+    if (!_ktxMipRequest || _ktxMipRequest != sender() || _ktxResourceState != REQUESTING_MIP) {
+        return;
+    }
+
+    int64_t rangeStart = offset;
+    int64_t rangeEnd = rangeStart + data.size();
+    if (rangeStart < 0 || rangeEnd > _ktxMipRangeData.size()) {
+        return;
+    }
+    memcpy(_ktxMipRangeData.data() + rangeStart, data.constData(), data.size());
+
+    // a mip is queued as soon as all of it is in
+    bool hasNewMips = false;
+    auto low = _ktxMipLevelRangeInFlight.first;
+    const auto& images = _originalKtxDescriptor->images;
+    for (size_t i = 0; i < _ktxMipBytesMissing.size(); i++) {
+        auto& bytesMissing = _ktxMipBytesMissing[i];
+        if (bytesMissing <= 0) {
+            continue;
+        }
+
+        uint16_t mipLevel = low + (uint16_t)i;
+        int64_t mipStart = images[mipLevel]._imageOffset - images[low]._imageOffset;
+        int64_t mipEnd = mipStart + images[mipLevel]._imageSize;
+        int64_t overlap = std::min(rangeEnd, mipEnd) - std::max(rangeStart, mipStart);
+        if (overlap > 0) {
+            bytesMissing -= overlap;
+            if (bytesMissing <= 0) {
+                bytesMissing = 0;
+                queueMip(mipLevel, _ktxMipRangeData.mid((int)mipStart, images[mipLevel]._imageSize));
+                hasNewMips = true;
+            }
+        }
+    }
+
+    if (hasNewMips) {
+        scheduleMipAssignment();
+    }
+}
+
+void NetworkTexture::queueMip(uint16_t level, const QByteArray& data) {
+    std::lock_guard<std::mutex> lock(_ktxMipQueue->mutex);
+    _ktxMipQueue->mips[level] = data;
+}
+
+void NetworkTexture::scheduleMipAssignment() {
+    auto self = _self;
+    auto url = _url;
+    auto texture = _textureSource->getGPUTexture();
+    auto mipQueue = _ktxMipQueue;
+    auto statTracker = DependencyManager::get<StatTracker>();
+    auto pendingProcessing = statTracker->getCounter("PendingProcessing");
+    auto processing = statTracker->getCounter("Processing");
+    pendingProcessing->increment();
+    // not dropped when stale, since the job has to balance the stat above either way and checks for the resource itself
+    ResourceLoadScheduler::getInstance().schedule(ResourceLoadScheduler::CPU,
+                                                  [self, url, texture, mipQueue, pendingProcessing, processing] {
+        PROFILE_RANGE_EX(resource_parse_image, "NetworkTexture - Processing Mip Data", 0xffff0000, 0, { { "url", url.toString() } });
+        pendingProcessing->decrement();
+        CounterStat counter(processing);
+
+        auto originalPriority = QThread::currentThread()->priority();
+        if (originalPriority == QThread::InheritPriority) {
+            originalPriority = QThread::NormalPriority;
+        }
+        QThread::currentThread()->setPriority(QThread::LowPriority);
+        Finally restorePriority([originalPriority] { QThread::currentThread()->setPriority(originalPriority); });
+
+        auto resource = self.lock();
+        if (!resource) {
+            // Resource no longer exists, bail
+            return;
+        }
+
+        Q_ASSERT_X(texture, "Async - NetworkTexture::scheduleMipAssignment", "NetworkTexture should have been assigned a GPU texture by now.");
+
+        bool hasAssignedMips = false;
+        bool failed = false;
+        {
+            std::lock_guard<std::mutex> lock(mipQueue->mutex);
+            while (!mipQueue->failed) {
+                auto minMipLevel = texture->minAvailableMipLevel();
+                auto mip = minMipLevel > 0 ? mipQueue->mips.find(minMipLevel - 1) : mipQueue->mips.end();
+                if (mip == mipQueue->mips.end()) {
+                    break;
+                }
+                auto mipLevel = mip->first;
+                auto data = mip->second;
+                mipQueue->mips.erase(mip);
+
+                texture->assignStoredMip(mipLevel, data.size(), reinterpret_cast<const uint8_t*>(data.data()));
+
+                // If mip level assigned above is still unavailable, then we assume future requests will also fail.
+                if (texture->minAvailableMipLevel() > mipLevel) {
+                    mipQueue->failed = true;
+                    mipQueue->mips.clear();
+                } else {
+                    hasAssignedMips = true;
+                }
+            }
+            failed = mipQueue->failed;
+        }
+
+        if (hasAssignedMips) {
+            QMetaObject::invokeMethod(resource.data(), "setImage",
+                Q_ARG(gpu::TexturePointer, texture),
+                Q_ARG(int, texture->getWidth()),
+                Q_ARG(int, texture->getHeight()));
+        }
+
+        if (!failed) {
+            QMetaObject::invokeMethod(resource.data(), "startRequestForNextMipLevel");
+        }
+    }, loadPriorityOf(self));
 }
 
 // This is called when the header and top mips have been loaded
@@ -904,11 +1039,16 @@ void NetworkTexture::handleFinishedInitialLoad() {
 
     auto self = _self;
     auto url = _url;
-    DependencyManager::get<StatTracker>()->incrementStat("PendingProcessing");
-    QtConcurrent::run(QThreadPool::globalInstance(), [self, ktxHeaderData, ktxHighMipData, url] {
+    auto statTracker = DependencyManager::get<StatTracker>();
+    auto pendingProcessing = statTracker->getCounter("PendingProcessing");
+    auto processing = statTracker->getCounter("Processing");
+    pendingProcessing->increment();
+    // not dropped when stale, since the job has to balance the stat above either way and checks for the resource itself
+    ResourceLoadScheduler::getInstance().schedule(ResourceLoadScheduler::CPU,
+                                                  [self, ktxHeaderData, ktxHighMipData, url, pendingProcessing, processing] {
         PROFILE_RANGE_EX(resource_parse_image, "NetworkTexture - Processing Initial Data", 0xffff0000, 0, { { "url", url.toString() } });
-        DependencyManager::get<StatTracker>()->decrementStat("PendingProcessing");
-        CounterStat counter("Processing");
+        pendingProcessing->decrement();
+        CounterStat counter(processing);
 
         auto originalPriority = QThread::currentThread()->priority();
         if (originalPriority == QThread::InheritPriority) {
@@ -1052,7 +1192,7 @@ void NetworkTexture::handleFinishedInitialLoad() {
             Q_ARG(int, textureAndSize.second.y));
 
         QMetaObject::invokeMethod(resource.data(), "startRequestForNextMipLevel");
-    });
+    }, loadPriorityOf(self));
 }
 
 void NetworkTexture::downloadFinished(const QByteArray& data) {
@@ -1140,7 +1280,7 @@ void NetworkTexture::loadTextureContent(const QByteArray& content) {
         return;
     }
 
-    QThreadPool::globalInstance()->start(new ImageReader(_self, _url, content, _extraHash, _maxNumPixels, _sourceChannel));
+    ResourceLoadScheduler::getInstance().schedule(ResourceLoadScheduler::CPU, new ImageReader(_self, _url, content, _extraHash, _maxNumPixels, _sourceChannel));
 }
 
 void NetworkTexture::refresh() {
@@ -1166,14 +1306,17 @@ void NetworkTexture::refresh() {
 }
 
 ImageReader::ImageReader(const QWeakPointer<Resource>& resource, const QUrl& url, const QByteArray& data, size_t extraHash, int maxNumPixels, image::ColorChannel sourceChannel) :
-    _resource(resource),
+    ResourceLoadJobBase(resource),
     _url(url),
     _content(data),
     _extraHash(extraHash),
     _maxNumPixels(maxNumPixels),
     _sourceChannel(sourceChannel)
 {
-    DependencyManager::get<StatTracker>()->incrementStat("PendingProcessing");
+    auto statTracker = DependencyManager::get<StatTracker>();
+    _pendingProcessing = statTracker->getCounter("PendingProcessing");
+    _processing = statTracker->getCounter("Processing");
+    _pendingProcessing->increment();
     listSupportedImageFormats();
 
 #if DEBUG_DUMP_TEXTURE_LOADS
@@ -1206,8 +1349,8 @@ void ImageReader::listSupportedImageFormats() {
 
 void ImageReader::run() {
     PROFILE_RANGE_EX(resource_parse_image, __FUNCTION__, 0xffff0000, 0, { { "url", _url.toString() } });
-    DependencyManager::get<StatTracker>()->decrementStat("PendingProcessing");
-    CounterStat counter("Processing");
+    _pendingProcessing->decrement();
+    CounterStat counter(_processing);
 
     auto originalPriority = QThread::currentThread()->priority();
     if (originalPriority == QThread::InheritPriority) {
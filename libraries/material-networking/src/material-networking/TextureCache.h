@@ -12,6 +12,10 @@
 #ifndef hifi_TextureCache_h
 #define hifi_TextureCache_h
 
+#include <map>
+#include <memory>
+#include <mutex>
+
 #include <gpu/Texture.h>
 
 #include <QImage>
@@ -79,6 +83,7 @@ signals:
 public slots:
     void ktxInitialDataRequestFinished();
     void ktxMipRequestFinished();
+    void ktxMipRangeReceived(qint64 offset, const QByteArray& data);
 
 protected:
     void makeRequest() override;
@@ -98,6 +103,8 @@ protected:
     Q_INVOKABLE void startRequestForNextMipLevel();
 
     void startMipRangeRequest(uint16_t low, uint16_t high);
+    void queueMip(uint16_t level, const QByteArray& data);
+    void scheduleMipAssignment();
     void handleFinishedInitialLoad();
 
 private:
@@ -129,6 +136,18 @@ private:
 
     // The current mips that are currently being requested w/ _ktxMipRequest
     std::pair<uint16_t, uint16_t> _ktxMipLevelRangeInFlight{ NULL_MIP_LEVEL, NULL_MIP_LEVEL };
+    // The data of _ktxMipRequest as it arrives, and how many bytes of each of its mips are still to come
+    QByteArray _ktxMipRangeData;
+    std::vector<int64_t> _ktxMipBytesMissing;
+
+    // Mips that are in but not yet assigned to the GPU texture. The GPU texture takes them smallest first, so each waits
+    // here for the smaller ones, and the jobs that assign them, which may run on any thread, take turns.
+    struct KTXMipQueue {
+        std::mutex mutex;
+        std::map<uint16_t, QByteArray> mips;
+        bool failed { false };
+    };
+    std::shared_ptr<KTXMipQueue> _ktxMipQueue { std::make_shared<KTXMipQueue>() };
 
     ResourceRequest* _ktxHeaderRequest { nullptr };
     ResourceRequest* _ktxMipRequest { nullptr };
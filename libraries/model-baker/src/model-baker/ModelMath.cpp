@@ -39,7 +39,8 @@ namespace baker {
         return vector[i];
     }
 
-    void setTangent(const HFMMesh& mesh, const IndexAccessor& vertexAccessor, int firstIndex, int secondIndex) {
+    template<typename IndexAccessorType>
+    void setTangent(const HFMMesh& mesh, const IndexAccessorType& vertexAccessor, int firstIndex, int secondIndex) {
         glm::vec3 vertex[2];
         glm::vec2 texCoords[2];
         glm::vec3 normal;
@@ -56,7 +57,10 @@ namespace baker {
         }
     }
 
-    void calculateNormals(const hfm::Mesh& mesh, NormalAccessor normalAccessor, VertexSetter vertexSetter) {
+    // The accessors are template parameters so that the loops over the indices of a mesh can inline them,
+    // rather than make a std::function call for every index
+    template<typename NormalAccessorType, typename VertexSetterType>
+    void calculateNormalsImpl(const hfm::Mesh& mesh, const NormalAccessorType& normalAccessor, const VertexSetterType& vertexSetter) {
         static int repeatMessageID = LogHandler::getInstance().newRepeatedMessageID();
         for (const HFMMeshPart& part : mesh.parts) {
             for (int i = 0; i < part.quadIndices.size(); i += 4) {
@@ -96,7 +100,8 @@ namespace baker {
         }
     }
 
-    void calculateTangents(const hfm::Mesh& mesh, IndexAccessor accessor) {
+    template<typename IndexAccessorType>
+    void calculateTangentsImpl(const hfm::Mesh& mesh, const IndexAccessorType& accessor) {
         static int repeatMessageID = LogHandler::getInstance().newRepeatedMessageID();
         for (const HFMMeshPart& part : mesh.parts) {
             for (int i = 0; i < part.quadIndices.size(); i += 4) {
@@ -117,5 +122,40 @@ namespace baker {
             }
         }
     }
+
+    void calculateNormals(const hfm::Mesh& mesh, NormalAccessor normalAccessor, VertexSetter vertexSetter) {
+        calculateNormalsImpl(mesh, normalAccessor, vertexSetter);
+    }
+
+    void calculateTangents(const hfm::Mesh& mesh, IndexAccessor accessor) {
+        calculateTangentsImpl(mesh, accessor);
+    }
+
+    void calculateMeshNormals(const hfm::Mesh& mesh, std::vector<glm::vec3>& normals) {
+        normals.resize(mesh.vertices.size());
+        glm::vec3* normalsData = normals.data();
+        calculateNormalsImpl(mesh,
+            [normalsData](int normalIndex) /* NormalAccessor */ {
+                return &normalsData[normalIndex];
+            },
+            [&mesh](int vertexIndex, glm::vec3& outVertex) /* VertexSetter */ {
+                outVertex = baker::safeGet(mesh.vertices, vertexIndex);
+            }
+        );
+    }
+
+    void calculateMeshTangents(const hfm::Mesh& mesh, const std::vector<glm::vec3>& normals, std::vector<glm::vec3>& tangents) {
+        tangents.resize(normals.size());
+        calculateTangentsImpl(mesh,
+            [&mesh, &normals, &tangents](int firstIndex, int secondIndex, glm::vec3* outVertices, glm::vec2* outTexCoords, glm::vec3& outNormal) {
+                outVertices[0] = mesh.vertices[firstIndex];
+                outVertices[1] = mesh.vertices[secondIndex];
+                outNormal = normals[firstIndex];
+                outTexCoords[0] = mesh.texCoords[firstIndex];
+                outTexCoords[1] = mesh.texCoords[secondIndex];
+                return &(tangents[firstIndex]);
+            }
+        );
+    }
 }
 
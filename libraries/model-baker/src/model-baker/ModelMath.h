@@ -53,4 +53,9 @@ namespace baker {
     using IndexAccessor = std::function<glm::vec3*(int firstIndex, int secondIndex, glm::vec3* outVertices, glm::vec2* outTexCoords, glm::vec3& outNormal)>;
 
     void calculateTangents(const hfm::Mesh& mesh, IndexAccessor accessor);
+
+    // The same as calculateNormals and calculateTangents for the mesh itself, with the lookups inlined.
+    // These are what the bake of a mesh spends most of its time in.
+    void calculateMeshNormals(const hfm::Mesh& mesh, std::vector<glm::vec3>& normals);
+    void calculateMeshTangents(const hfm::Mesh& mesh, const std::vector<glm::vec3>& normals, std::vector<glm::vec3>& tangents);
 };
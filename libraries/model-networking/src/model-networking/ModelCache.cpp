@@ -16,7 +16,7 @@
 #include <gpu/Batch.h>
 #include <gpu/Stream.h>
 
-#include <QThreadPool>
+#include <QThread>
 
 #include <Gzip.h>
 
@@ -85,30 +85,35 @@ namespace std {
     };
 }
 
-class GeometryReader : public QRunnable {
+class GeometryReader : public ResourceLoadJobBase {
 public:
     GeometryReader(const ModelLoader& modelLoader, QWeakPointer<Resource>& resource, const QUrl& url, const GeometryMappingPair& mapping,
                    const QByteArray& data, bool combineParts, const QString& webMediaType) :
-        _modelLoader(modelLoader), _resource(resource), _url(url), _mapping(mapping), _data(data), _combineParts(combineParts), _webMediaType(webMediaType) {
+        ResourceLoadJobBase(resource), _modelLoader(modelLoader), _url(url), _mapping(mapping), _data(data), _combineParts(combineParts), _webMediaType(webMediaType) {
 
-        DependencyManager::get<StatTracker>()->incrementStat("PendingProcessing");
+        auto statTracker = DependencyManager::get<StatTracker>();
+        _pendingProcessing = statTracker->getCounter("PendingProcessing");
+        _processing = statTracker->getCounter("Processing");
+        _pendingProcessing->increment();
     }
 
     virtual void run() override;
+    virtual void cancelled() override { _pendingProcessing->decrement(); }
 
 private:
     ModelLoader _modelLoader;
-    QWeakPointer<Resource> _resource;
     QUrl _url;
     GeometryMappingPair _mapping;
     QByteArray _data;
     bool _combineParts;
     QString _webMediaType;
+    StatTracker::CounterPointer _pendingProcessing;
+    StatTracker::CounterPointer _processing;
 };
 
 void GeometryReader::run() {
-    DependencyManager::get<StatTracker>()->decrementStat("PendingProcessing");
-    CounterStat counter("Processing");
+    _pendingProcessing->decrement();
+    CounterStat counter(_processing);
     PROFILE_RANGE_EX(resource_parse_geometry, "GeometryReader::run", 0xFF00FF00, 0, { { "url", _url.toString() } });
     auto originalPriority = QThread::currentThread()->priority();
     if (originalPriority == QThread::InheritPriority) {
@@ -287,7 +292,7 @@ void GeometryResource::downloadFinished(const QByteArray& data) {
             _url = _effectiveBaseURL;
             _textureBaseURL = _effectiveBaseURL;
         }
-        QThreadPool::globalInstance()->start(new GeometryReader(_modelLoader, _self, _effectiveBaseURL, _mappingPair, data, _combineParts, _request->getWebMediaType()));
+        ResourceLoadScheduler::getInstance().schedule(ResourceLoadScheduler::CPU, new GeometryReader(_modelLoader, _self, _effectiveBaseURL, _mappingPair, data, _combineParts, _request->getWebMediaType()));
     }
 }
 
@@ -297,6 +302,7 @@ void GeometryResource::onGeometryMappingLoaded(bool success) {
         _materialMapping = _geometryResource->_materialMapping;
         _meshParts = _geometryResource->_meshParts;
         _meshes = _geometryResource->_meshes;
+        _blendshapeLayout = _geometryResource->_blendshapeLayout;
         _materials = _geometryResource->_materials;
 
         // Avoid holding onto extra references
@@ -319,6 +325,7 @@ void GeometryResource::setExtra(void* extra) {
 void GeometryResource::setGeometryDefinition(HFMModel::Pointer hfmModel, const MaterialMapping& materialMapping) {
     // Assume ownership of the processed HFMModel
     _hfmModel = hfmModel;
+    _blendshapeLayout = std::make_shared<SharedBlendshapeLayout>();
     _materialMapping = materialMapping;
 
     // Copy materials
@@ -429,6 +436,7 @@ Geometry::Geometry(const Geometry& geometry) {
     _materialMapping = geometry._materialMapping;
     _meshes = geometry._meshes;
     _meshParts = geometry._meshParts;
+    _blendshapeLayout = geometry._blendshapeLayout;
 
     _materials.reserve(geometry._materials.size());
     for (const auto& material : geometry._materials) {
@@ -510,6 +518,15 @@ const std::shared_ptr<NetworkMaterial> Geometry::getShapeMaterial(int partID) co
     return nullptr;
 }
 
+hfm::BlendshapeLayout::ConstPointer Geometry::getBlendshapeLayout() const {
+    auto& shared = *_blendshapeLayout;
+    auto hfmModel = _hfmModel;
+    std::call_once(shared.once, [&shared, hfmModel] {
+        shared.layout = std::make_shared<const hfm::BlendshapeLayout>(*hfmModel);
+    });
+    return shared.layout;
+}
+
 void GeometryResourceWatcher::startWatching() {
     connect(_resource.data(), &Resource::finished, this, &GeometryResourceWatcher::resourceFinished);
     connect(_resource.data(), &Resource::onRefresh, this, &GeometryResourceWatcher::resourceRefreshed);
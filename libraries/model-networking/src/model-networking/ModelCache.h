@@ -12,12 +12,15 @@
 #ifndef hifi_ModelCache_h
 #define hifi_ModelCache_h
 
+#include <mutex>
+
 #include <QtCore/QSharedPointer>
 
 #include <DependencyManager.h>
 #include <ResourceCache.h>
 
 #include <graphics/Asset.h>
+#include <hfm/HFMBlendshapeBlocks.h>
 
 #include "FBXSerializer.h"
 #include <procedural/ProceduralMaterialCache.h>
@@ -53,6 +56,9 @@ public:
     const GeometryMeshes& getMeshes() const { return *_meshes; }
     const std::shared_ptr<NetworkMaterial> getShapeMaterial(int shapeID) const;
 
+    // Laid out on first use, then shared by every model of this geometry. Thread-safe.
+    hfm::BlendshapeLayout::ConstPointer getBlendshapeLayout() const;
+
     const QVariantMap getTextures() const;
     void setTextures(const QVariantMap& textureMap);
 
@@ -67,6 +73,12 @@ protected:
     std::shared_ptr<const GeometryMeshes> _meshes;
     std::shared_ptr<const GeometryMeshParts> _meshParts;
 
+    struct SharedBlendshapeLayout {
+        std::once_flag once;
+        hfm::BlendshapeLayout::ConstPointer layout;
+    };
+    std::shared_ptr<SharedBlendshapeLayout> _blendshapeLayout { std::make_shared<SharedBlendshapeLayout>() };
+
     // Copied to each geometry, mutable throughout lifetime via setTextures
     NetworkMaterials _materials;
 
@@ -22,6 +22,7 @@
 #include <BlendshapeConstants.h>
 
 #include <hfm/ModelFormatLogging.h>
+#include <TBBHelpers.h>
 
 // TOOL: Uncomment the following line to enable the filtering of all the unknown fields of a node so we can break point easily while loading a model with problems...
 //#define DEBUG_FBXSERIALIZER
@@ -394,6 +395,18 @@ hifi::ByteArray fileOnUrl(const hifi::ByteArray& filepath, const QString& url) {
     return filepath.mid(filepath.lastIndexOf('/') + 1);
 }
 
+// Empties the children of a mesh node that extractMesh reads its data from. Only their names are left, which is all
+// that is looked at once the mesh is extracted.
+void releaseMeshData(FBXNode& object) {
+    for (FBXNode& child : object.children) {
+        if (child.name == "Vertices" || child.name == "PolygonVertexIndex" || child.name == "DracoMesh" ||
+                child.name.startsWith("LayerElement")) {
+            child.properties.clear();
+            child.children.clear();
+        }
+    }
+}
+
 HFMModel* FBXSerializer::extractHFMModel(const hifi::VariantHash& mapping, const QString& url) {
     const FBXNode& node = _rootNode;
     bool deduplicateIndices = mapping["deduplicateIndices"].toBool();
@@ -452,7 +465,6 @@ HFMModel* FBXSerializer::extractHFMModel(const hifi::VariantHash& mapping, const
     bool applyUpAxisZRotation = false;
     glm::vec3 ambientColor;
     QString hifiGlobalNodeID;
-    unsigned int meshIndex = 0;
     haveReportedUnhandledRotationOrder = false;
     int fbxVersionNumber = -1;
     bool isBlenderVersionLower280 = false;
@@ -474,6 +486,36 @@ HFMModel* FBXSerializer::extractHFMModel(const hifi::VariantHash& mapping, const
         }
     }
 
+    // The meshes don't depend on anything else in the file, so they are all extracted up front and in parallel,
+    // in the order the loop below comes across them, which is the order that numbers them.
+    // The nodes are taken from _rootNode itself, not from foreach copies, so that each mesh's arrays can be released
+    // from the tree as soon as the mesh has them.
+    QVector<FBXNode*> meshObjects;
+    for (FBXNode& child : _rootNode.children) {
+        if (child.name == "Objects") {
+            for (FBXNode& object : child.children) {
+                if (object.name == "Geometry") {
+                    if (object.properties.at(2) == "Mesh") {
+                        meshObjects.append(&object);
+                    }
+                } else if (object.name == "Model") {
+                    foreach (const FBXNode& subobject, object.children) {
+                        if (subobject.name == "Vertices" || subobject.name == "DracoMesh") {
+                            meshObjects.append(&object);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    std::vector<ExtractedMesh> extractedMeshes(meshObjects.size());
+    tbb::parallel_for(0, meshObjects.size(), [&](int i) {
+        unsigned int meshIndex = i;
+        extractedMeshes[i] = extractMesh(*meshObjects.at(i), meshIndex, deduplicateIndices);
+        releaseMeshData(*meshObjects.at(i));
+    });
+    int nextExtractedMesh = 0;
+
     foreach (const FBXNode& child, node.children) {
 
         if (child.name == "FBXHeaderExtension") {
@@ -534,7 +576,7 @@ HFMModel* FBXSerializer::extractHFMModel(const hifi::VariantHash& mapping, const
             foreach (const FBXNode& object, child.children) {
                 if (object.name == "Geometry") {
                     if (object.properties.at(2) == "Mesh") {
-                        meshes.insert(getID(object.properties), extractMesh(object, meshIndex, deduplicateIndices));
+                        meshes.insert(getID(object.properties), std::move(extractedMeshes[nextExtractedMesh++]));
                     } else { // object.properties.at(2) == "Shape"
                         ExtractedBlendshape extracted = { getID(object.properties), extractBlendshape(object) };
                         blendshapes.append(extracted);
@@ -681,7 +723,7 @@ HFMModel* FBXSerializer::extractHFMModel(const hifi::VariantHash& mapping, const
                         } else if (subobject.name == "Vertices" || subobject.name == "DracoMesh") {
                             // it's a mesh as well as a model
                             mesh = &meshes[getID(object.properties)];
-                            *mesh = extractMesh(object, meshIndex, deduplicateIndices);
+                            *mesh = std::move(extractedMeshes[nextExtractedMesh++]);
 
                         } else if (subobject.name == "Shape") {
                             ExtractedBlendshape blendshape =  { subobject.properties.at(0).toString(),
@@ -1709,6 +1751,7 @@ HFMModel::Pointer FBXSerializer::read(const hifi::ByteArray& data, const hifi::V
     // FBXSerializer's mapping parameter supports the bool "deduplicateIndices," which is passed into FBXSerializer::extractMesh as "deduplicate"
 
     auto hfmModel = extractHFMModel(mapping, url.toString());
+    _rootNode = FBXNode();
 
     //hfmModel->debugDump();
 
@@ -12,8 +12,12 @@
 #include "FBXSerializer.h"
 
 #include <iostream>
+#include <limits>
+#include <vector>
+
+#include <zlib.h>
+
 #include <QtCore/QBuffer>
-#include <QtCore/QDataStream>
 #include <QtCore/QIODevice>
 #include <QtCore/QStringList>
 #include <QtCore/QTextStream>
@@ -23,187 +27,208 @@
 
 #include <shared/NsightHelpers.h>
 #include <hfm/ModelFormatLogging.h>
+#include <TBBHelpers.h>
 
-template<class T>
-int streamSize() {
-    return sizeof(T);
+namespace {
+
+/// Reads the little-endian values of a binary FBX straight out of the file contents
+class BinaryReader {
+public:
+    BinaryReader(const char* data, size_t size) : _data(data), _size(size) { }
+
+    size_t getPosition() const { return _position; }
+    bool atEnd() const { return _position >= _size; }
+
+    /// Returns the next length bytes and moves past them
+    const char* skip(size_t length) {
+        if (length > _size - _position) {
+            throw QString("FBX file most likely corrupt: data runs past the end of the file");
+        }
+        const char* bytes = _data + _position;
+        _position += length;
+        return bytes;
+    }
+
+    template<class T>
+    T read() {
+        T value;
+        memcpy(&value, skip(sizeof(T)), sizeof(T));
+        return qFromLittleEndian(value);
+    }
+
+private:
+    const char* _data;
+    size_t _size;
+    size_t _position { 0 };
+};
+
+template<>
+float BinaryReader::read<float>() {
+    quint32 bits = read<quint32>();
+    float value;
+    memcpy(&value, &bits, sizeof(float));
+    return value;
 }
 
-template<bool>
-int streamSize() {
-    return 1;
+template<>
+double BinaryReader::read<double>() {
+    quint64 bits = read<quint64>();
+    double value;
+    memcpy(&value, &bits, sizeof(double));
+    return value;
 }
 
-template<class T>
-QVariant readBinaryArray(QDataStream& in, int& position) {
-    quint32 arrayLength;
-    quint32 encoding;
-    quint32 compressedLength;
+void fromLittleEndian(void* values, int count, size_t valueSize) {
+#if Q_BYTE_ORDER == Q_BIG_ENDIAN
+    switch (valueSize) {
+        case sizeof(quint16):
+            qFromLittleEndian<quint16>(values, count, values);
+            break;
+        case sizeof(quint32):
+            qFromLittleEndian<quint32>(values, count, values);
+            break;
+        case sizeof(quint64):
+            qFromLittleEndian<quint64>(values, count, values);
+            break;
+        default:
+            break;
+    }
+#else
+    Q_UNUSED(values);
+    Q_UNUSED(count);
+    Q_UNUSED(valueSize);
+#endif
+}
+
+/// A compressed array, to be inflated straight into the storage of the QVector its property already holds.
+/// Inflating is most of the work of parsing a binary FBX, so it is left until the whole file has been read,
+/// and then the arrays are inflated in parallel.
+struct ArrayInflation {
+    const char* source;
+    quint32 sourceLength;
+    char* destination;
+    int count;
+    size_t valueSize;
+    bool succeeded;
+
+    void run() {
+        // FBX arrays are plain zlib streams, without the length that qUncompress expects in front of them
+        z_stream stream;
+        memset(&stream, 0, sizeof(stream));
+        stream.next_in = (Bytef*)source;
+        stream.avail_in = sourceLength;
+        stream.next_out = (Bytef*)destination;
+        stream.avail_out = (uInt)(count * valueSize);
+
+        if (inflateInit(&stream) != Z_OK) {
+            return;
+        }
+        int result = inflate(&stream, Z_FINISH);
+        inflateEnd(&stream);
 
-    in >> arrayLength;
+        // the array has to fill its storage exactly
+        succeeded = result == Z_STREAM_END && stream.avail_out == 0;
+        if (succeeded) {
+            fromLittleEndian(destination, count, valueSize);
+        }
+    }
+};
+
+using ArrayInflations = std::vector<ArrayInflation>;
+
+template<class T>
+QVariant readBinaryArray(BinaryReader& in, ArrayInflations& inflations) {
+    quint32 arrayLength = in.read<quint32>();
     if (arrayLength > std::numeric_limits<int>::max() / sizeof(T)) { // Upcoming byte containers are limited to max signed int
         throw QString("FBX file most likely corrupt: binary data exceeds data limits");
     }
-    in >> encoding;
-    in >> compressedLength;
+    quint32 encoding = in.read<quint32>();
+    quint32 compressedLength = in.read<quint32>();
     if (compressedLength > std::numeric_limits<int>::max() / sizeof(T)) { // Upcoming byte containers are limited to max signed int
         throw QString("FBX file most likely corrupt: compressed binary data exceeds data limits");
     }
-    position += sizeof(quint32) * 3;
 
+    // the values are written in place later on, which is fine as long as nothing detaches the QVector until then
     QVector<T> values;
-    if ((int)QSysInfo::ByteOrder == (int)in.byteOrder()) {
+    if (arrayLength > 0) {
         values.resize(arrayLength);
-        hifi::ByteArray arrayData;
-        if (encoding == FBX_PROPERTY_COMPRESSED_FLAG) {
-            // preface encoded data with uncompressed length
-            hifi::ByteArray compressed(sizeof(quint32) + compressedLength, 0);
-            *((quint32*)compressed.data()) = qToBigEndian<quint32>(arrayLength * sizeof(T));
-            in.readRawData(compressed.data() + sizeof(quint32), compressedLength);
-            position += compressedLength;
-            arrayData = qUncompress(compressed);
-            if (arrayData.isEmpty() ||
-                (unsigned int)arrayData.size() != (sizeof(T) * arrayLength)) { // answers empty byte array if corrupt
-                throw QString("corrupt fbx file");
-            }
-        } else {
-            arrayData.resize(sizeof(T) * arrayLength);
-            position += sizeof(T) * arrayLength;
-            in.readRawData(arrayData.data(), arrayData.size());
-        }
-
-        if (arrayData.size() > 0) {
-            memcpy(&values[0], arrayData.constData(), arrayData.size());
-        }
-    } else {
-        values.reserve(arrayLength);
-        if (encoding == FBX_PROPERTY_COMPRESSED_FLAG) {
-            // preface encoded data with uncompressed length
-            hifi::ByteArray compressed(sizeof(quint32) + compressedLength, 0);
-            *((quint32*)compressed.data()) = qToBigEndian<quint32>(arrayLength * sizeof(T));
-            in.readRawData(compressed.data() + sizeof(quint32), compressedLength);
-            position += compressedLength;
-            hifi::ByteArray uncompressed = qUncompress(compressed);
-            if (uncompressed.isEmpty()) { // answers empty byte array if corrupt
-                throw QString("corrupt fbx file");
-            }
-            QDataStream uncompressedIn(uncompressed);
-            uncompressedIn.setByteOrder(QDataStream::LittleEndian);
-            uncompressedIn.setVersion(QDataStream::Qt_4_5); // for single/double precision switch
-            for (quint32 i = 0; i < arrayLength; i++) {
-                T value;
-                uncompressedIn >> value;
-                values.append(value);
-            }
-        } else {
-            for (quint32 i = 0; i < arrayLength; i++) {
-                T value;
-                in >> value;
-                position += streamSize<T>();
-                values.append(value);
-            }
+    }
+    size_t arrayBytes = sizeof(T) * arrayLength;
+    if (encoding == FBX_PROPERTY_COMPRESSED_FLAG) {
+        const char* compressed = in.skip(compressedLength);
+        if (arrayLength > 0) {
+            inflations.push_back({ compressed, compressedLength, (char*)values.data(), (int)arrayLength, sizeof(T), false });
         }
+    } else if (arrayLength > 0) {
+        memcpy(values.data(), in.skip(arrayBytes), arrayBytes);
+        fromLittleEndian(values.data(), arrayLength, sizeof(T));
     }
     return QVariant::fromValue(values);
 }
 
-QVariant parseBinaryFBXProperty(QDataStream& in, int& position) {
-    char ch;
-    in.device()->getChar(&ch);
-    position++;
+QVariant parseBinaryFBXProperty(BinaryReader& in, ArrayInflations& inflations) {
+    char ch = *in.skip(1);
     switch (ch) {
         case 'Y': {
-            qint16 value;
-            in >> value;
-            position += sizeof(qint16);
-            return QVariant::fromValue(value);
+            return QVariant::fromValue(in.read<qint16>());
         }
         case 'C': {
-            bool value;
-            in >> value;
-            position++;
-            return QVariant::fromValue(value);
+            return QVariant::fromValue(in.read<quint8>() != 0);
         }
         case 'I': {
-            qint32 value;
-            in >> value;
-            position += sizeof(qint32);
-            return QVariant::fromValue(value);
+            return QVariant::fromValue(in.read<qint32>());
         }
         case 'F': {
-            float value;
-            in >> value;
-            position += sizeof(float);
-            return QVariant::fromValue(value);
+            return QVariant::fromValue(in.read<float>());
         }
         case 'D': {
-            double value;
-            in >> value;
-            position += sizeof(double);
-            return QVariant::fromValue(value);
+            return QVariant::fromValue(in.read<double>());
         }
         case 'L': {
-            qint64 value;
-            in >> value;
-            position += sizeof(qint64);
-            return QVariant::fromValue(value);
+            return QVariant::fromValue(in.read<qint64>());
         }
         case 'f': {
-            return readBinaryArray<float>(in, position);
+            return readBinaryArray<float>(in, inflations);
         }
         case 'd': {
-            return readBinaryArray<double>(in, position);
+            return readBinaryArray<double>(in, inflations);
         }
         case 'l': {
-            return readBinaryArray<qint64>(in, position);
+            return readBinaryArray<qint64>(in, inflations);
         }
         case 'i': {
-            return readBinaryArray<qint32>(in, position);
+            return readBinaryArray<qint32>(in, inflations);
         }
         case 'b': {
-            return readBinaryArray<bool>(in, position);
+            return readBinaryArray<bool>(in, inflations);
         }
         case 'S':
         case 'R': {
-            quint32 length;
-            in >> length;
-            position += sizeof(quint32) + length;
-            return QVariant::fromValue(in.device()->read(length));
+            quint32 length = in.read<quint32>();
+            return QVariant::fromValue(hifi::ByteArray(in.skip(length), length));
         }
         default:
             throw QString("Unknown property type: ") + ch;
     }
 }
 
-FBXNode parseBinaryFBXNode(QDataStream& in, int& position, bool has64BitPositions = false) {
+FBXNode parseBinaryFBXNode(BinaryReader& in, ArrayInflations& inflations, bool has64BitPositions) {
     qint64 endOffset;
     quint64 propertyCount;
-    quint64 propertyListLength;
-    quint8 nameLength;
 
     // FBX 2016 and beyond uses 64bit positions in the node headers, pre-2016 used 32bit values
     // our code generally doesn't care about the size that much, so we will use 64bit values
-    // from here on out, but if the file is an older format we read the stream into temp 32bit
-    // values and then assign to our actual 64bit values.
+    // from here on out, but if the file is an older format we read the 32bit values and widen them.
     if (has64BitPositions) {
-        in >> endOffset;
-        in >> propertyCount;
-        in >> propertyListLength;
-        position += sizeof(quint64) * 3;
+        endOffset = in.read<qint64>();
+        propertyCount = in.read<quint64>();
+        in.read<quint64>(); // the length of the property list
     } else {
-        qint32 tempEndOffset;
-        quint32 tempPropertyCount;
-        quint32 tempPropertyListLength;
-        in >> tempEndOffset;
-        in >> tempPropertyCount;
-        in >> tempPropertyListLength;
-        position += sizeof(quint32) * 3;
-        endOffset = tempEndOffset;
-        propertyCount = tempPropertyCount;
-        propertyListLength = tempPropertyListLength;
-    }
-    in >> nameLength;
-    position += sizeof(quint8);
+        endOffset = in.read<qint32>();
+        propertyCount = in.read<quint32>();
+        in.read<quint32>();
+    }
+    quint8 nameLength = in.read<quint8>();
 
     FBXNode node;
     const int MIN_VALID_OFFSET = 40;
@@ -211,15 +236,14 @@ FBXNode parseBinaryFBXNode(QDataStream& in, int& position, bool has64BitPosition
         // use a null name to indicate a null node
         return node;
     }
-    node.name = in.device()->read(nameLength);
-    position += nameLength;
+    node.name = hifi::ByteArray(in.skip(nameLength), nameLength);
 
-    for (quint32 i = 0; i < propertyCount; i++) {
-        node.properties.append(parseBinaryFBXProperty(in, position));
+    for (quint64 i = 0; i < propertyCount; i++) {
+        node.properties.append(parseBinaryFBXProperty(in, inflations));
     }
 
-    while (endOffset > position) {
-        FBXNode child = parseBinaryFBXNode(in, position, has64BitPositions);
+    while (endOffset > (qint64)in.getPosition()) {
+        FBXNode child = parseBinaryFBXNode(in, inflations, has64BitPositions);
         if (!child.name.isNull()) {
             node.children.append(child);
         }
@@ -228,6 +252,8 @@ FBXNode parseBinaryFBXNode(QDataStream& in, int& position, bool has64BitPosition
     return node;
 }
 
+}
+
 class Tokenizer {
 public:
 
@@ -369,9 +395,10 @@ FBXNode FBXSerializer::parseFBX(QIODevice* device) {
         }
         return top;
     }
-    QDataStream in(device);
-    in.setByteOrder(QDataStream::LittleEndian);
-    in.setVersion(QDataStream::Qt_4_5); // for single/double precision switch
+    // read the file in place when it is already in memory, as it is when FBXSerializer::read parses it
+    auto buffer = qobject_cast<QBuffer*>(device);
+    hifi::ByteArray data = buffer ? buffer->data() : device->readAll();
+    BinaryReader in(data.constData(), data.size());
 
     // see http://code.blender.org/index.php/2013/08/fbx-binary-file-format-specification/ for an explanation
     // of the FBX binary format
@@ -380,25 +407,32 @@ FBXNode FBXSerializer::parseFBX(QIODevice* device) {
     //   Bytes 0 - 20: Kaydara FBX Binary  \x00(file - magic, with 2 spaces at the end, then a NULL terminator).
     //   Bytes 21 - 22: [0x1A, 0x00](unknown but all observed files show these bytes).
     //   Bytes 23 - 26 : unsigned int, the version number. 7300 for version 7.3 for example.
-    in.skipRawData(FBX_HEADER_BYTES_BEFORE_VERSION);
-    int position = FBX_HEADER_BYTES_BEFORE_VERSION;
-    quint32 fileVersion;
-    in >> fileVersion;
-    position += sizeof(fileVersion);
+    in.skip(FBX_HEADER_BYTES_BEFORE_VERSION);
+    quint32 fileVersion = in.read<quint32>();
     bool has64BitPositions = (fileVersion >= FBX_VERSION_2016);
 
     // parse the top-level node
     FBXNode top;
-    while (device->bytesAvailable()) {
-        FBXNode next = parseBinaryFBXNode(in, position, has64BitPositions);
+    ArrayInflations inflations;
+    while (!in.atEnd()) {
+        FBXNode next = parseBinaryFBXNode(in, inflations, has64BitPositions);
         if (next.name.isNull()) {
-            return top;
+            break;
 
         } else {
             top.children.append(next);
         }
     }
 
+    tbb::parallel_for(size_t(0), inflations.size(), [&](size_t i) {
+        inflations[i].run();
+    });
+    for (const auto& inflation : inflations) {
+        if (!inflation.succeeded) {
+            throw QString("corrupt fbx file");
+        }
+    }
+
     return top;
 }
 
@@ -409,28 +443,23 @@ glm::vec3 FBXSerializer::getVec3(const QVariantList& properties, int index) {
 }
 
 QVector<glm::vec4> FBXSerializer::createVec4Vector(const QVector<double>& doubleVector) {
-    QVector<glm::vec4> values;
-    for (const double* it = doubleVector.constData(), *end = it + ((doubleVector.size() / 4) * 4); it != end; ) {
-        float x = *it++;
-        float y = *it++;
-        float z = *it++;
-        float w = *it++;
-        values.append(glm::vec4(x, y, z, w));
+    QVector<glm::vec4> values(doubleVector.size() / 4);
+    const double* it = doubleVector.constData();
+    for (glm::vec4& value : values) {
+        value = glm::vec4(it[0], it[1], it[2], it[3]);
+        it += 4;
     }
     return values;
 }
 
 
 QVector<glm::vec4> FBXSerializer::createVec4VectorRGBA(const QVector<double>& doubleVector, glm::vec4& average) {
-    QVector<glm::vec4> values;
-    for (const double* it = doubleVector.constData(), *end = it + ((doubleVector.size() / 4) * 4); it != end; ) {
-        float x = *it++;
-        float y = *it++;
-        float z = *it++;
-        float w = *it++;
-        auto val = glm::vec4(x, y, z, w);
-        values.append(val);
-        average += val;
+    QVector<glm::vec4> values(doubleVector.size() / 4);
+    const double* it = doubleVector.constData();
+    for (glm::vec4& value : values) {
+        value = glm::vec4(it[0], it[1], it[2], it[3]);
+        average += value;
+        it += 4;
     }
     if (!values.isEmpty()) {
         average *= (1.0f / float(values.size()));
@@ -439,22 +468,21 @@ QVector<glm::vec4> FBXSerializer::createVec4VectorRGBA(const QVector<double>& do
 }
 
 QVector<glm::vec3> FBXSerializer::createVec3Vector(const QVector<double>& doubleVector) {
-    QVector<glm::vec3> values;
-    for (const double* it = doubleVector.constData(), *end = it + ((doubleVector.size() / 3) * 3); it != end; ) {
-        float x = *it++;
-        float y = *it++;
-        float z = *it++;
-        values.append(glm::vec3(x, y, z));
+    QVector<glm::vec3> values(doubleVector.size() / 3);
+    const double* it = doubleVector.constData();
+    for (glm::vec3& value : values) {
+        value = glm::vec3(it[0], it[1], it[2]);
+        it += 3;
     }
     return values;
 }
 
 QVector<glm::vec2> FBXSerializer::createVec2Vector(const QVector<double>& doubleVector) {
-    QVector<glm::vec2> values;
-    for (const double* it = doubleVector.constData(), *end = it + ((doubleVector.size() / 2) * 2); it != end; ) {
-        float s = *it++;
-        float t = *it++;
-        values.append(glm::vec2(s, -t));
+    QVector<glm::vec2> values(doubleVector.size() / 2);
+    const double* it = doubleVector.constData();
+    for (glm::vec2& value : values) {
+        value = glm::vec2(it[0], -it[1]);
+        it += 2;
     }
     return values;
 }
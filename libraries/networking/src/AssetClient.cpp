@@ -472,7 +472,7 @@ MessageID AssetClient::getAsset(const QString& hash, AssetUtils::DataOffset star
         }
     }
 
-    callback(false, AssetUtils::AssetServerError::NoError, QByteArray());
+    callback(false, AssetUtils::AssetServerError::NoError, QByteArray(), 0);
     return INVALID_MESSAGE_ID;
 }
 
@@ -516,6 +516,19 @@ void AssetClient::handleAssetGetInfoReply(QSharedPointer<ReceivedMessage> messag
 
     if (error == AssetUtils::AssetServerError::NoError) {
         message->readPrimitive(&info.size);
+
+        // servers from before chunked storage don't send a chunk manifest
+        if (message->getBytesLeftToRead() >= qint64(sizeof(uint32_t))) {
+            uint32_t numChunks;
+            message->readPrimitive(&numChunks);
+
+            for (uint32_t i = 0; i < numChunks && message->getBytesLeftToRead() > 0; ++i) {
+                AssetUtils::AssetChunk chunk;
+                chunk.hash = message->read(AssetUtils::SHA256_HASH_LENGTH).toHex();
+                message->readPrimitive(&chunk.size);
+                info.chunks.push_back(chunk);
+            }
+        }
     }
 
     // Check if we have any pending requests for this node
@@ -551,8 +564,10 @@ void AssetClient::handleAssetGetReply(QSharedPointer<ReceivedMessage> message, S
     message->readHeadPrimitive(&error);
 
     AssetUtils::DataOffset length = 0;
+    AssetUtils::DataOffset assetSize = 0;
     if (!error) {
         message->readHeadPrimitive(&length);
+        message->readHeadPrimitive(&assetSize);
     } else {
         qCWarning(asset_client) << "Failure getting asset: " << error;
     }
@@ -584,17 +599,17 @@ void AssetClient::handleAssetGetReply(QSharedPointer<ReceivedMessage> message, S
     connect(message.data(), &ReceivedMessage::progress, this, [this, weakNode, messageID, length](qint64 size) {
         handleProgressCallback(weakNode, messageID, size, length);
     });
-    connect(message.data(), &ReceivedMessage::completed, this, [this, weakNode, messageID, length]() {
-        handleCompleteCallback(weakNode, messageID, length);
+    connect(message.data(), &ReceivedMessage::completed, this, [this, weakNode, messageID, length, assetSize]() {
+        handleCompleteCallback(weakNode, messageID, length, assetSize);
     });
 
     if (message->isComplete()) {
         disconnect(message.data(), nullptr, this, nullptr);
 
         if (length != message->getBytesLeftToRead()) {
-            callbacks.completeCallback(false, error, QByteArray());
+            callbacks.completeCallback(false, error, QByteArray(), 0);
         } else {
-            callbacks.completeCallback(true, error, message->readAll());
+            callbacks.completeCallback(true, error, message->readAll(), assetSize);
         }
 
 
@@ -629,7 +644,8 @@ void AssetClient::handleProgressCallback(const QWeakPointer<Node>& node, Message
     callbacks.progressCallback(size, length);
 }
 
-void AssetClient::handleCompleteCallback(const QWeakPointer<Node>& node, MessageID messageID, AssetUtils::DataOffset length) {
+void AssetClient::handleCompleteCallback(const QWeakPointer<Node>& node, MessageID messageID, AssetUtils::DataOffset length,
+                                         AssetUtils::DataOffset assetSize) {
     auto senderNode = node.toStrongRef();
 
     if (!senderNode) {
@@ -663,9 +679,9 @@ void AssetClient::handleCompleteCallback(const QWeakPointer<Node>& node, Message
     }
 
     if (message->failed() || length != message->getBytesLeftToRead()) {
-        callbacks.completeCallback(false, AssetUtils::AssetServerError::NoError, QByteArray());
+        callbacks.completeCallback(false, AssetUtils::AssetServerError::NoError, QByteArray(), 0);
     } else {
-        callbacks.completeCallback(true, AssetUtils::AssetServerError::NoError, message->readAll());
+        callbacks.completeCallback(true, AssetUtils::AssetServerError::NoError, message->readAll(), assetSize);
     }
 
     // We should never get to this point without the associated senderNode and messageID
@@ -1012,7 +1028,7 @@ void AssetClient::forceFailureOfPendingRequests(SharedNodePointer node) {
                     disconnect(message.data(), nullptr, this, nullptr);
                 }
 
-                value.second.completeCallback(false, AssetUtils::AssetServerError::NoError, QByteArray());
+                value.second.completeCallback(false, AssetUtils::AssetServerError::NoError, QByteArray(), 0);
             }
             messageMapIt->second.clear();
         }
@@ -41,10 +41,13 @@ class AssetUpload;
 struct AssetInfo {
     QString hash;
     int64_t size;
+    AssetUtils::AssetChunkManifest chunks; // empty unless the server stores the asset in chunks
 };
 
 using MappingOperationCallback = std::function<void(bool responseReceived, AssetUtils::AssetServerError serverError, QSharedPointer<ReceivedMessage> message)>;
-using ReceivedAssetCallback = std::function<void(bool responseReceived, AssetUtils::AssetServerError serverError, const QByteArray& data)>;
+// assetSize is the size of the whole asset, which a ranged request only gets a part of
+using ReceivedAssetCallback = std::function<void(bool responseReceived, AssetUtils::AssetServerError serverError, const QByteArray& data,
+                                                 AssetUtils::DataOffset assetSize)>;
 using GetInfoCallback = std::function<void(bool responseReceived, AssetUtils::AssetServerError serverError, AssetInfo info)>;
 using UploadResultCallback = std::function<void(bool responseReceived, AssetUtils::AssetServerError serverError, const QString& hash)>;
 using ProgressCallback = std::function<void(qint64 totalReceived, qint64 total)>;
@@ -102,7 +105,8 @@ private:
     bool cancelUploadAssetRequest(MessageID id);
 
     void handleProgressCallback(const QWeakPointer<Node>& node, MessageID messageID, qint64 size, AssetUtils::DataOffset length);
-    void handleCompleteCallback(const QWeakPointer<Node>& node, MessageID messageID, AssetUtils::DataOffset length);
+    void handleCompleteCallback(const QWeakPointer<Node>& node, MessageID messageID, AssetUtils::DataOffset length,
+                                AssetUtils::DataOffset assetSize);
 
     void forceFailureOfPendingRequests(SharedNodePointer node);
 
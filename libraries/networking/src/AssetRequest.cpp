@@ -12,6 +12,7 @@
 #include "AssetRequest.h"
 
 #include <algorithm>
+#include <cstring>
 
 #include <QtCore/QThread>
 
@@ -23,6 +24,10 @@
 #include "NodeList.h"
 #include "ResourceCache.h"
 
+const int64_t AssetRequest::DOWNLOAD_RANGE_SIZE;
+const size_t AssetRequest::MAX_PARALLEL_RANGES;
+const int64_t AssetRequest::MAX_DOWNLOAD_SIZE;
+
 static int requestID = 0;
 
 AssetRequest::AssetRequest(const QString& hash, const ByteRange& byteRange) :
@@ -38,6 +43,79 @@ AssetRequest::~AssetRequest() {
     if (_assetRequestID) {
         assetClient->cancelGetAssetRequest(_assetRequestID);
     }
+    cancelAssetInfoRequest();
+    cancelRangeRequests();
+}
+
+AssetRequest::Error AssetRequest::toRequestError(bool responseReceived, AssetUtils::AssetServerError serverError) {
+    if (!responseReceived) {
+        return NetworkError;
+    }
+
+    switch (serverError) {
+        case AssetUtils::AssetServerError::NoError:
+            return NoError;
+        case AssetUtils::AssetServerError::AssetNotFound:
+            return NotFound;
+        case AssetUtils::AssetServerError::InvalidByteRange:
+            return InvalidByteRange;
+        default:
+            return UnknownError;
+    }
+}
+
+std::vector<AssetRequest::Piece> AssetRequest::splitIntoPieces(const ByteRange& range, int64_t assetSize,
+                                                               const AssetUtils::AssetChunkManifest& chunks) {
+    std::vector<Piece> pieces;
+
+    int64_t chunksSize = 0;
+    for (const auto& chunk : chunks) {
+        if (chunk.size <= 0 || !AssetUtils::isValidHash(chunk.hash)) {
+            chunksSize = -1;
+            break;
+        }
+        chunksSize += chunk.size;
+    }
+    if (!chunks.empty() && chunksSize == assetSize) {
+        int64_t offset = 0;
+        for (const auto& chunk : chunks) {
+            Piece piece;
+            piece.range.fromInclusive = std::max(offset, range.fromInclusive);
+            piece.range.toExclusive = std::min(offset + chunk.size, range.toExclusive);
+            offset += chunk.size;
+            if (piece.range.size() <= 0) {
+                continue;
+            }
+
+            // a chunk cut by the ends of the range can't be checked
+            if (piece.range.size() == chunk.size) {
+                piece.hash = chunk.hash.toLower();
+            }
+            pieces.push_back(piece);
+        }
+        return pieces;
+    }
+
+    for (int64_t offset = range.fromInclusive; offset < range.toExclusive; offset += DOWNLOAD_RANGE_SIZE) {
+        Piece piece;
+        piece.range.fromInclusive = offset;
+        piece.range.toExclusive = std::min(offset + DOWNLOAD_RANGE_SIZE, range.toExclusive);
+        pieces.push_back(piece);
+    }
+    return pieces;
+}
+
+std::vector<ByteRange> AssetRequest::groupIntoRanges(const std::vector<Piece>& pieces) {
+    std::vector<ByteRange> ranges;
+    for (const auto& piece : pieces) {
+        if (!ranges.empty() && ranges.back().toExclusive == piece.range.fromInclusive &&
+            ranges.back().size() + piece.range.size() <= DOWNLOAD_RANGE_SIZE) {
+            ranges.back().toExclusive = piece.range.toExclusive;
+        } else {
+            ranges.push_back(piece.range);
+        }
+    }
+    return ranges;
 }
 
 void AssetRequest::start() {
@@ -75,12 +153,30 @@ void AssetRequest::start() {
 
     _state = WaitingForData;
 
+    requestAsset();
+}
+
+void AssetRequest::requestAsset() {
     auto assetClient = DependencyManager::get<AssetClient>();
     auto that = QPointer<AssetRequest>(this); // Used to track the request's lifetime
     auto hash = _hash;
 
-    _assetRequestID = assetClient->getAsset(_hash, _byteRange.fromInclusive, _byteRange.toExclusive,
-        [this, that, hash](bool responseReceived, AssetUtils::AssetServerError serverError, const QByteArray& data) {
+    // a whole asset, or a range of one too large for a single reply, starts with its first range, the reply to which
+    // tells how large the asset is, while its manifest tells how to fetch the rest
+    ByteRange range = _byteRange;
+    bool isSplit = !_byteRange.isSet() || (_byteRange.fromInclusive >= 0 && _byteRange.size() > DOWNLOAD_RANGE_SIZE);
+    if (isSplit) {
+        if (_byteRange.isSet() && _fetchBackwards) {
+            range.fromInclusive = range.toExclusive - DOWNLOAD_RANGE_SIZE;
+        } else {
+            range.toExclusive = range.fromInclusive + DOWNLOAD_RANGE_SIZE;
+        }
+        requestAssetInfo();
+    }
+
+    _assetRequestID = assetClient->getAsset(_hash, range.fromInclusive, range.toExclusive,
+        [this, that, hash, range, isSplit](bool responseReceived, AssetUtils::AssetServerError serverError,
+                                           const QByteArray& data, AssetUtils::DataOffset assetSize) {
 
         if (!that) {
             qCWarning(asset_client) << "Got reply for dead asset request " << hash << "- error code" << _error;
@@ -89,21 +185,26 @@ void AssetRequest::start() {
         }
         _assetRequestID = INVALID_MESSAGE_ID;
 
-        if (!responseReceived) {
-            _error = NetworkError;
-        } else if (serverError != AssetUtils::AssetServerError::NoError) {
-            switch (serverError) {
-                case AssetUtils::AssetServerError::AssetNotFound:
-                    _error = NotFound;
-                    break;
-                case AssetUtils::AssetServerError::InvalidByteRange:
-                    _error = InvalidByteRange;
-                    break;
-                default:
-                    _error = UnknownError;
-                    break;
+        _error = toRequestError(responseReceived, serverError);
+        if (_error == NoError && isSplit) {
+            // the asset server cuts ranges short at the end of the asset
+            int64_t end = _byteRange.isSet() ? std::min(_byteRange.toExclusive, (int64_t)assetSize) : assetSize;
+            int64_t start = _byteRange.isSet() ? _byteRange.fromInclusive : 0;
+            if (data.size() != std::max(std::min(range.toExclusive, end) - range.fromInclusive, (int64_t)0)) {
+                _error = SizeVerificationFailed;
+            } else if (end - start > MAX_DOWNLOAD_SIZE) {
+                qCWarning(asset_client) << "Asset" << _hash << "of" << assetSize << "bytes is too large to download";
+                _error = SizeVerificationFailed;
+            } else if (data.size() < end - start) {
+                _firstRange = data;
+                _assetSize = assetSize;
+                startParallelDownload();
+                return;
             }
-        } else {
+        }
+        cancelAssetInfoRequest();
+
+        if (_error == NoError) {
             if (!_byteRange.isSet() && AssetUtils::hashData(data).toHex() != _hash) {
                 // the hash of the received data does not match what we expect, so we return an error
                 _error = HashVerificationFailed;
@@ -112,6 +213,7 @@ void AssetRequest::start() {
             if (_error == NoError) {
                 _data = data;
                 _totalReceived += data.size();
+                emit rangeReceived(0, data.size());
                 emit progress(_totalReceived, data.size());
 
                 if (!_byteRange.isSet()) {
@@ -135,6 +237,276 @@ void AssetRequest::start() {
     });
 }
 
+void AssetRequest::requestAssetInfo() {
+    auto assetClient = DependencyManager::get<AssetClient>();
+    auto that = QPointer<AssetRequest>(this); // Used to track the request's lifetime
+
+    _assetInfoRequestID = assetClient->getAssetInfo(_hash,
+        [this, that](bool responseReceived, AssetUtils::AssetServerError serverError, AssetInfo info) {
+
+        if (!that || _state != WaitingForData) {
+            return;
+        }
+        _assetInfoRequestID = INVALID_MESSAGE_ID;
+
+        // without a manifest the asset is still downloaded, it just can't be checked before it is all in
+        if (responseReceived && serverError == AssetUtils::AssetServerError::NoError) {
+            _chunks = info.chunks;
+        }
+        _hasAssetInfo = true;
+        startParallelDownload();
+    });
+}
+
+void AssetRequest::cancelAssetInfoRequest() {
+    if (_assetInfoRequestID) {
+        DependencyManager::get<AssetClient>()->cancelGetAssetInfoRequest(_assetInfoRequestID);
+        _assetInfoRequestID = INVALID_MESSAGE_ID;
+    }
+}
+
+void AssetRequest::startParallelDownload() {
+    // waits for both the first range and the manifest
+    if (!_hasAssetInfo || _assetSize < 0 || _state != WaitingForData) {
+        return;
+    }
+
+    ByteRange range;
+    range.toExclusive = _assetSize;
+    if (_byteRange.isSet()) {
+        range.fromInclusive = _byteRange.fromInclusive;
+        range.toExclusive = std::min(_byteRange.toExclusive, _assetSize);
+    }
+    _dataOffset = range.fromInclusive;
+    _pieces = splitIntoPieces(range, _assetSize, _chunks);
+    bool fetchBackwards = _fetchBackwards && _byteRange.isSet();
+
+    // every range is copied straight into place, so the data is never resized or reassembled
+    ByteRange firstRange;
+    firstRange.fromInclusive = fetchBackwards ? range.toExclusive - _firstRange.size() : range.fromInclusive;
+    firstRange.toExclusive = firstRange.fromInclusive + _firstRange.size();
+    _data = QByteArray((int)range.size(), Qt::Uninitialized);
+    memcpy(_data.data() + firstRange.fromInclusive - _dataOffset, _firstRange.constData(), _firstRange.size());
+    _firstRange = QByteArray();
+
+    // a piece the first range only has part of is fetched whole, so that it can be checked, and only the pieces the first
+    // range has all of count as received
+    ByteRange received;
+    std::vector<const Piece*> otherPieces;
+    for (const auto& piece : _pieces) {
+        if (piece.range.fromInclusive >= firstRange.fromInclusive && piece.range.toExclusive <= firstRange.toExclusive) {
+            if (!received.isSet()) {
+                received.fromInclusive = piece.range.fromInclusive;
+            }
+            received.toExclusive = piece.range.toExclusive;
+        } else {
+            otherPieces.push_back(&piece);
+        }
+    }
+    if (!storePieces(received)) {
+        finishParallelDownload(HashVerificationFailed);
+        return;
+    }
+    receiveRange(received);
+
+    std::vector<Piece> missingPieces;
+    for (const auto piece : otherPieces) {
+        if (loadPiece(*piece)) {
+            receiveRange(piece->range);
+        } else {
+            missingPieces.push_back(*piece);
+        }
+    }
+    emit progress(_totalReceived, _data.size());
+
+    auto ranges = groupIntoRanges(missingPieces);
+    if (fetchBackwards) {
+        _pendingRanges.assign(ranges.rbegin(), ranges.rend());
+    } else {
+        _pendingRanges.assign(ranges.begin(), ranges.end());
+    }
+
+    qCDebug(asset_client) << "Downloading" << _data.size() << "bytes of" << _hash << "in" << _pieces.size()
+                          << (_chunks.empty() ? "ranges," : "chunks,") << missingPieces.size() << "of them in"
+                          << ranges.size() << "ranges";
+
+    if (_pendingRanges.empty()) {
+        finishParallelDownload(NoError);
+        return;
+    }
+    while (!_pendingRanges.empty() && _rangeRequests.size() < MAX_PARALLEL_RANGES && _state == WaitingForData) {
+        requestNextRange();
+    }
+}
+
+QUrl AssetRequest::getPieceUrl(const Piece& piece) const {
+    // chunks are cached under their own hash, like whole assets, and the other ranges of a whole asset under the asset's
+    if (!piece.hash.isEmpty()) {
+        return AssetUtils::getATPUrl(piece.hash);
+    }
+    QUrl url = getUrl();
+    url.setQuery(QString("range=%1-%2").arg(piece.range.fromInclusive).arg(piece.range.toExclusive));
+    return url;
+}
+
+bool AssetRequest::loadPiece(const Piece& piece) {
+    // a range of an asset that isn't stored in chunks can only be checked with all of the asset
+    if (piece.hash.isEmpty() && _byteRange.isSet()) {
+        return false;
+    }
+
+    QByteArray data = AssetUtils::loadFromCache(getPieceUrl(piece));
+    if (data.size() != piece.range.size() ||
+        (!piece.hash.isEmpty() && AssetUtils::hashData(data).toHex() != piece.hash)) {
+        return false;
+    }
+    memcpy(_data.data() + piece.range.fromInclusive - _dataOffset, data.constData(), data.size());
+    return true;
+}
+
+bool AssetRequest::storePieces(const ByteRange& range) {
+    auto it = std::lower_bound(_pieces.begin(), _pieces.end(), range.fromInclusive, [](const Piece& piece, int64_t offset) {
+        return piece.range.fromInclusive < offset;
+    });
+    for (; it != _pieces.end() && it->range.toExclusive <= range.toExclusive; ++it) {
+        auto data = QByteArray::fromRawData(_data.constData() + it->range.fromInclusive - _dataOffset,
+                                            (int)it->range.size());
+        if (it->hash.isEmpty()) {
+            if (!_byteRange.isSet()) {
+                AssetUtils::saveToCache(getPieceUrl(*it), data);
+            }
+            continue;
+        }
+
+        if (AssetUtils::hashData(data).toHex() != it->hash) {
+            qCWarning(asset_client) << "Chunk" << it->hash << "of asset" << _hash << "failed hash verification";
+            return false;
+        }
+        AssetUtils::saveToCache(getPieceUrl(*it), data);
+    }
+    return true;
+}
+
+void AssetRequest::receiveRange(const ByteRange& range) {
+    if (range.size() > 0) {
+        _totalReceived += range.size();
+        emit rangeReceived(range.fromInclusive - _dataOffset, range.size());
+    }
+}
+
+void AssetRequest::requestNextRange() {
+    auto range = _pendingRanges.front();
+    _pendingRanges.pop_front();
+
+    auto assetClient = DependencyManager::get<AssetClient>();
+    auto that = QPointer<AssetRequest>(this); // Used to track the request's lifetime
+    auto offset = range.fromInclusive;
+
+    // added before asking, since the callback runs right away when there is no asset server to ask
+    _rangeRequests[offset] = RangeRequest();
+
+    auto messageID = assetClient->getAsset(_hash, range.fromInclusive, range.toExclusive,
+        [this, that, range](bool responseReceived, AssetUtils::AssetServerError serverError, const QByteArray& data,
+                            AssetUtils::DataOffset assetSize) {
+
+        if (!that || _state != WaitingForData) {
+            return;
+        }
+        _rangeRequests.erase(range.fromInclusive);
+
+        auto error = toRequestError(responseReceived, serverError);
+        if (error == NoError && (data.size() != range.size() || assetSize != _assetSize)) {
+            error = SizeVerificationFailed;
+        }
+
+        if (error != NoError) {
+            finishParallelDownload(error);
+            return;
+        }
+
+        memcpy(_data.data() + range.fromInclusive - _dataOffset, data.constData(), data.size());
+
+        if (!storePieces(range)) {
+            finishParallelDownload(HashVerificationFailed);
+            return;
+        }
+        receiveRange(range);
+
+        emit progress(_totalReceived, _data.size());
+
+        if (!_pendingRanges.empty()) {
+            requestNextRange();
+        } else if (_rangeRequests.empty()) {
+            finishParallelDownload(NoError);
+        }
+    }, [this, that, offset](qint64 totalReceived, qint64 total) {
+        if (!that) {
+            return;
+        }
+
+        auto it = _rangeRequests.find(offset);
+        if (it == _rangeRequests.end()) {
+            return;
+        }
+        it->second.received = totalReceived;
+
+        qint64 inFlight = 0;
+        for (const auto& rangeRequest : _rangeRequests) {
+            inFlight += rangeRequest.second.received;
+        }
+        emit progress(_totalReceived + inFlight, _data.size());
+    });
+
+    auto it = _rangeRequests.find(offset);
+    if (it != _rangeRequests.end()) {
+        it->second.messageID = messageID;
+    }
+}
+
+void AssetRequest::cancelRangeRequests() {
+    auto assetClient = DependencyManager::get<AssetClient>();
+    for (const auto& rangeRequest : _rangeRequests) {
+        if (rangeRequest.second.messageID) {
+            assetClient->cancelGetAssetRequest(rangeRequest.second.messageID);
+        }
+    }
+    _rangeRequests.clear();
+    _pendingRanges.clear();
+}
+
+void AssetRequest::finishParallelDownload(Error error) {
+    cancelAssetInfoRequest();
+    cancelRangeRequests();
+
+    bool isWholeAsset = !_byteRange.isSet();
+    _error = error;
+    if (_error == NoError && isWholeAsset && AssetUtils::hashData(_data).toHex() != _hash) {
+        _error = HashVerificationFailed;
+    }
+
+    // the ranges kept so that an interrupted download could pick up where it stopped are done with once the asset
+    // checks out, and can't be trusted once it doesn't
+    if (isWholeAsset && (_error == NoError || _error == HashVerificationFailed)) {
+        for (const auto& piece : _pieces) {
+            if (piece.hash.isEmpty()) {
+                AssetUtils::removeFromCache(getPieceUrl(piece));
+            }
+        }
+    }
+
+    if (_error == NoError) {
+        if (isWholeAsset) {
+            AssetUtils::saveToCache(getUrl(), _data);
+        }
+    } else {
+        qCWarning(asset_client) << "Got error retrieving asset" << _hash << "- error code" << _error;
+        _data.clear();
+    }
+
+    _state = Finished;
+    emit finished(this);
+}
+
 
 const QString AssetRequest::getErrorString() const {
     QString result;
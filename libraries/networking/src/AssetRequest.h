@@ -12,6 +12,10 @@
 #ifndef hifi_AssetRequest_h
 #define hifi_AssetRequest_h
 
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
 #include <QByteArray>
 #include <QObject>
 #include <QString>
@@ -23,9 +27,26 @@
 
 const QString ATP_SCHEME { "atp:" };
 
+/// Fetches an asset from the asset server.
+///
+/// A whole asset, or a byte range of one larger than DOWNLOAD_RANGE_SIZE, is asked for DOWNLOAD_RANGE_SIZE bytes at a
+/// time. The reply to the first range tells how large the asset is, and the rest of it is then fetched as further
+/// ranges, up to MAX_PARALLEL_RANGES of them requested at once, which the asset server reads and sends concurrently.
+/// Each range is copied into place in the data as it arrives, and rangeReceived lets consumers use it right away.
+///
+/// Alongside the first range, the asset's chunk manifest is asked for. When the asset server stores the asset in chunks,
+/// the ranges follow chunk boundaries, every chunk is checked against its hash as it arrives and kept in the cache under
+/// that hash, and chunks already in the cache aren't fetched at all. The ranges of a whole asset that isn't stored in
+/// chunks are kept in the cache until the asset checks out as a whole. So a download that was interrupted picks up
+/// where it stopped, and a new version of an asset only fetches the chunks that changed.
 class AssetRequest : public QObject {
    Q_OBJECT
 public:
+    static const int64_t DOWNLOAD_RANGE_SIZE { 1024 * 1024 };
+    static const size_t MAX_PARALLEL_RANGES { 4 };
+    // a QByteArray holds a little less than 2GB
+    static const int64_t MAX_DOWNLOAD_SIZE { 2047LL * 1024 * 1024 };
+
     enum State {
         NotStarted = 0,
         WaitingForData,
@@ -57,11 +78,54 @@ public:
 
     bool loadedFromCache() const { return _loadedFromCache; }
 
+    /// Asks for the ranges of a byte range from its end backwards, for data such as KTX textures whose end is used first.
+    /// Whole assets are always fetched from the start, since their size is only known from the first range.
+    void setFetchBackwards(bool fetchBackwards) { _fetchBackwards = fetchBackwards; }
+
+    /// A part of an asset that is downloaded whole and checked on its own when it has a hash
+    struct Piece {
+        ByteRange range;
+        AssetUtils::AssetHash hash; // of the piece's own content, empty unless the asset server stores the asset in chunks
+    };
+
+    /// Splits a range of an asset of the given size into the pieces it is downloaded in: the chunks of the asset's
+    /// manifest when it has one that adds up to the size, where chunks cut by the ends of the range lose their hash,
+    /// otherwise ranges of DOWNLOAD_RANGE_SIZE from the start of the range
+    static std::vector<Piece> splitIntoPieces(const ByteRange& range, int64_t assetSize,
+                                              const AssetUtils::AssetChunkManifest& chunks);
+
+    /// Groups pieces into the ranges to ask for. Adjacent pieces share a range up to DOWNLOAD_RANGE_SIZE, a piece is never
+    /// split across ranges.
+    static std::vector<ByteRange> groupIntoRanges(const std::vector<Piece>& pieces);
+
 signals:
     void finished(AssetRequest* thisRequest);
     void progress(qint64 totalReceived, qint64 total);
 
+    /// Part of the data has arrived from the asset server, and is in place in getData() at the given offset. Each byte is
+    /// announced once, and data loaded from the cache as a whole only comes with finished.
+    void rangeReceived(qint64 offset, qint64 size);
+
 private:
+    struct RangeRequest {
+        MessageID messageID { INVALID_MESSAGE_ID };
+        qint64 received { 0 };
+    };
+
+    static Error toRequestError(bool responseReceived, AssetUtils::AssetServerError serverError);
+
+    void requestAsset();
+    void requestAssetInfo();
+    void cancelAssetInfoRequest();
+    void startParallelDownload();
+    QUrl getPieceUrl(const Piece& piece) const;
+    bool loadPiece(const Piece& piece);
+    bool storePieces(const ByteRange& range);
+    void receiveRange(const ByteRange& range);
+    void requestNextRange();
+    void cancelRangeRequests();
+    void finishParallelDownload(Error error);
+
     int _requestID;
     State _state = NotStarted;
     Error _error = NoError;
@@ -70,8 +134,18 @@ private:
     QByteArray _data;
     int _numPendingRequests { 0 };
     MessageID _assetRequestID { INVALID_MESSAGE_ID };
+    MessageID _assetInfoRequestID { INVALID_MESSAGE_ID };
+    bool _hasAssetInfo { false };
+    AssetUtils::AssetChunkManifest _chunks;
+    QByteArray _firstRange;
+    int64_t _assetSize { -1 }; // known once the first range is in
+    int64_t _dataOffset { 0 }; // of the data in the asset
+    std::vector<Piece> _pieces;
+    std::deque<ByteRange> _pendingRanges;
+    std::unordered_map<int64_t, RangeRequest> _rangeRequests; // by offset of the range
     const ByteRange _byteRange;
     bool _loadedFromCache { false };
+    bool _fetchBackwards { false };
 };
 
 #endif
@@ -148,8 +148,14 @@ void AssetResourceRequest::requestHash(const AssetUtils::AssetHash& hash) {
     // Make request to atp
     auto assetClient = DependencyManager::get<AssetClient>();
     _assetRequest = assetClient->createRequest(hash, _byteRange);
+    _assetRequest->setFetchBackwards(_fetchBackwards);
 
     connect(_assetRequest, &AssetRequest::progress, this, &AssetResourceRequest::onDownloadProgress);
+    // the range is copied on the thread of the asset request, while it isn't writing to its data
+    auto assetRequest = _assetRequest;
+    connect(_assetRequest, &AssetRequest::rangeReceived, this, [this, assetRequest](qint64 offset, qint64 size) {
+        emit rangeReceived(offset, assetRequest->getData().mid(offset, size));
+    }, Qt::DirectConnection);
     connect(_assetRequest, &AssetRequest::finished, this, [this](AssetRequest* req) {
         Q_ASSERT(_state == InProgress);
         Q_ASSERT(req == _assetRequest);
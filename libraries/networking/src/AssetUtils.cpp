@@ -97,6 +97,12 @@ bool saveToCache(const QUrl& url, const QByteArray& file) {
     return false;
 }
 
+void removeFromCache(const QUrl& url) {
+    if (auto cache = NetworkAccessManager::getInstance().cache()) {
+        cache->remove(url);
+    }
+}
+
 bool isValidFilePath(const AssetPath& filePath) {
     QRegExp filePathRegex { ASSET_FILE_PATH_REGEX_STRING };
     return filePathRegex.exactMatch(filePath);
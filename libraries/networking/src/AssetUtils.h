@@ -15,6 +15,7 @@
 #include <cstdint>
 
 #include <map>
+#include <vector>
 
 #include <QtCore/QByteArray>
 #include <QtCore/QUrl>
@@ -76,6 +77,15 @@ struct MappingInfo {
 using AssetMappings = std::map<AssetPath, MappingInfo>;
 using Mappings = std::map<AssetPath, AssetHash>;
 
+// A piece of an asset, addressed by the hash of its own content
+struct AssetChunk {
+    AssetHash hash;
+    int64_t size;
+};
+
+// The chunks an asset is made of, in order. Empty for assets that are stored whole.
+using AssetChunkManifest = std::vector<AssetChunk>;
+
 QUrl getATPUrl(const QString& input);
 AssetHash extractAssetHash(const QString& input);
 
@@ -83,6 +93,7 @@ QByteArray hashData(const QByteArray& data);
 
 QByteArray loadFromCache(const QUrl& url);
 bool saveToCache(const QUrl& url, const QByteArray& file);
+void removeFromCache(const QUrl& url);
 
 bool isValidFilePath(const AssetPath& path);
 bool isValidPath(const AssetPath& path);
@@ -27,6 +27,7 @@
 #include <LogHandler.h>
 #include <shared/NetworkUtils.h>
 #include <NumericalConstants.h>
+#include <OpenMetrics.h>
 #include <SettingHandle.h>
 #include <SharedUtil.h>
 #include <UUID.h>
@@ -37,6 +38,7 @@
 #include "SockAddr.h"
 #include "NetworkLogging.h"
 #include "udt/Packet.h"
+#include "udt/SendQueueScheduler.h"
 #include "HMACAuth.h"
 
 #if defined(Q_OS_WIN)
@@ -937,6 +939,44 @@ void LimitedNodeList::removeSilentNodes() {
     }
 }
 
+void LimitedNodeList::collectMetrics(OpenMetricsWriter& metrics) {
+    metrics.addGauge("overte_node_list_inbound_kbps", "Inbound bandwidth", getInboundKbps());
+    metrics.addGauge("overte_node_list_outbound_kbps", "Outbound bandwidth", getOutboundKbps());
+    metrics.addGauge("overte_node_list_inbound_pps", "Inbound packets per second", getInboundPPS());
+    metrics.addGauge("overte_node_list_outbound_pps", "Outbound packets per second", getOutboundPPS());
+    metrics.addGauge("overte_node_list_nodes", "Known nodes", size());
+
+    auto sendQueueStats = udt::SendQueueScheduler::getSharedStats();
+    metrics.addGauge("overte_udt_send_pacing_threads", "Threads pacing the reliable send queues", sendQueueStats.threadCount);
+    metrics.addGauge("overte_udt_send_queues", "Reliable send queues", sendQueueStats.queueCount);
+    metrics.addGauge("overte_udt_send_schedule_lag_usecs", "Average delay between a send queue's deadline and its step",
+                     sendQueueStats.averageLagUsecs);
+    metrics.addGauge("overte_udt_send_schedule_max_lag_usecs", "Longest delay between a send queue's deadline and its step",
+                     sendQueueStats.maxLagUsecs);
+
+    eachNode([&](const SharedNodePointer& node) {
+        const auto& stats = node->getConnectionStats();
+        OpenMetricsWriter::Labels labels {
+            { "node", uuidStringWithoutCurlyBraces(node->getUUID()) },
+            { "node_type", NodeType::getNodeTypeName(node->getType()) }
+        };
+
+        metrics.addGauge("overte_udt_rtt_usecs", "Round trip time of the reliable connection", stats.rtt, labels);
+        metrics.addGauge("overte_udt_congestion_window_packets", "Congestion window of the reliable connection",
+                         stats.congestionWindowSize, labels);
+        metrics.addGauge("overte_udt_packet_send_period_usecs", "Packet send period of the reliable connection",
+                         stats.packetSendPeriod, labels);
+        metrics.addGauge("overte_udt_sent_packets", "Packets sent during the last sample interval",
+                         stats.sentPackets + stats.sentUnreliablePackets, labels);
+        metrics.addGauge("overte_udt_received_packets", "Packets received during the last sample interval",
+                         stats.receivedPackets + stats.receivedUnreliablePackets, labels);
+        metrics.addGauge("overte_udt_retransmitted_packets", "Packets retransmitted during the last sample interval",
+                         stats.retransmittedPackets, labels);
+        metrics.addGauge("overte_udt_duplicate_packets", "Duplicate packets received during the last sample interval",
+                         stats.duplicatePackets, labels);
+    });
+}
+
 void LimitedNodeList::sampleConnectionStats() {
     uint32_t packetsIn { 0 };
     uint32_t packetsOut { 0 };
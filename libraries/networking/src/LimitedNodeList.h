@@ -49,6 +49,8 @@
 #include "udt/Socket.h"
 #include "UUIDHasher.h"
 
+class OpenMetricsWriter;
+
 const int INVALID_PORT = -1;
 
 const quint64 NODE_SILENCE_THRESHOLD_MSECS = 10 * 1000;
@@ -341,6 +343,9 @@ public:
     float getInboundKbps() const { return _inboundKbps; }
     float getOutboundKbps() const { return _outboundKbps; }
 
+    /// Adds our bandwidth and the last sampled UDT stats of every node's connection to a metrics scrape
+    void collectMetrics(OpenMetricsWriter& metrics);
+
     void setDropOutgoingNodeTraffic(bool squelchOutgoingNodeTraffic) { _dropOutgoingNodeTraffic = squelchOutgoingNodeTraffic; }
 
     const std::set<NodeType_t> SOLO_NODE_TYPES = {
@@ -37,8 +37,13 @@ std::unique_ptr<NLPacket> NLPacket::create(PacketType type, qint64 size, bool is
 
 std::unique_ptr<NLPacket> NLPacket::fromReceivedPacket(std::unique_ptr<char[]> data, qint64 size,
                                                        const SockAddr& senderSockAddr) {
+    return fromReceivedPacket(udt::PacketBuffer::adopt(std::move(data), size), size, senderSockAddr);
+}
+
+std::unique_ptr<NLPacket> NLPacket::fromReceivedPacket(udt::PacketBuffer data, qint64 size,
+                                                       const SockAddr& senderSockAddr) {
     // Fail with null data
-    Q_ASSERT(data);
+    Q_ASSERT(!data.isNull());
     
     // Fail with invalid size
     Q_ASSERT(size >= 0);
@@ -90,7 +95,7 @@ NLPacket::NLPacket(const NLPacket& other) : Packet(other) {
     _sourceID = other._sourceID;
 }
 
-NLPacket::NLPacket(std::unique_ptr<char[]> data, qint64 size, const SockAddr& senderSockAddr) :
+NLPacket::NLPacket(udt::PacketBuffer data, qint64 size, const SockAddr& senderSockAddr) :
     Packet(std::move(data), size, senderSockAddr)
 {    
     // sanity check before we decrease the payloadSize with the payloadCapacity
@@ -169,10 +174,10 @@ void NLPacket::writeTypeAndVersion() {
     auto headerOffset = Packet::totalHeaderSize(isPartOfMessage());
     
     // Pack the packet type
-    memcpy(_packet.get() + headerOffset, &_type, sizeof(PacketType));
+    memcpy(_packet.data() + headerOffset, &_type, sizeof(PacketType));
     
     // Pack the packet version
-    memcpy(_packet.get() + headerOffset + sizeof(PacketType), &_version, sizeof(_version));
+    memcpy(_packet.data() + headerOffset + sizeof(PacketType), &_version, sizeof(_version));
 }
 
 void NLPacket::setType(PacketType type) {
@@ -212,7 +217,7 @@ void NLPacket::writeSourceID(LocalID sourceID) const {
     
     auto offset = Packet::totalHeaderSize(isPartOfMessage()) + sizeof(PacketType) + sizeof(PacketVersion);
 
-    memcpy(_packet.get() + offset, &sourceID, sizeof(sourceID));
+    memcpy(_packet.data() + offset, &sourceID, sizeof(sourceID));
     
     _sourceID = sourceID;
 }
@@ -226,5 +231,5 @@ void NLPacket::writeVerificationHash(HMACAuth& hmacAuth) const {
 
     QByteArray verificationHash = hashForPacketAndHMAC(*this, hmacAuth);
     
-    memcpy(_packet.get() + offset, verificationHash.data(), verificationHash.size());
+    memcpy(_packet.data() + offset, verificationHash.data(), verificationHash.size());
 }
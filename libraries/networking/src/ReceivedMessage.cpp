@@ -23,34 +23,43 @@ static const int HEAD_DATA_SIZE = 512;
 using namespace std::chrono;
 
 ReceivedMessage::ReceivedMessage(const NLPacketList& packetList)
-    : _data(packetList.getMessage()),
-      _headData(_data.mid(0, HEAD_DATA_SIZE)),
-      _numPackets(packetList.getNumPackets()),
+    : _numPackets(packetList.getNumPackets()),
       _sourceID(packetList.getSourceID()),
       _packetType(packetList.getType()),
       _packetVersion(packetList.getVersion()),
       _senderSockAddr(packetList.getSenderSockAddr())
 {
+    _spans.reserve(packetList.getPackets().size());
+    _spanOffsets.reserve(packetList.getPackets().size());
+    for (const auto& packet : packetList.getPackets()) {
+        appendSpan({ packet->getBuffer(), QByteArray(), packet->getPayload(), packet->getPayloadSize() });
+    }
+
     _firstPacketReceiveTime = duration_cast<microseconds>(packetList.getFirstPacketReceiveTime().time_since_epoch()).count();
 }
 
 ReceivedMessage::ReceivedMessage(NLPacket& packet)
-    : _data(packet.readAll()),
-      _headData(_data.mid(0, HEAD_DATA_SIZE)),
-      _numPackets(1),
+    : _numPackets(1),
       _sourceID(packet.getSourceID()),
       _packetType(packet.getType()),
       _packetVersion(packet.getVersion()),
       _senderSockAddr(packet.getSenderSockAddr()),
       _isComplete(packet.getPacketPosition() == NLPacket::ONLY)
 {
+    appendSpan({ packet.getBuffer(), QByteArray(), packet.getPayload() + packet.pos(), packet.bytesLeftToRead() });
+
+    if (!_isComplete) {
+        // the head of a message that is still being received can be read from another thread while packets are appended
+        _headData = QByteArray(packet.getPayload() + packet.pos(), (int)std::min(packet.bytesLeftToRead(), (qint64)HEAD_DATA_SIZE));
+        _copiedBytes += _headData.size();
+        _hasHeadData = true;
+    }
+
     _firstPacketReceiveTime = duration_cast<microseconds>(packet.getReceiveTime().time_since_epoch()).count();
 }
 
 ReceivedMessage::ReceivedMessage(QByteArray byteArray, PacketType packetType, PacketVersion packetVersion,
                 const SockAddr& senderSockAddr, NLPacket::LocalID sourceID) :
-    _data(byteArray),
-    _headData(_data.mid(0, HEAD_DATA_SIZE)),
     _numPackets(1),
     _firstPacketReceiveTime(0),
     _sourceID(sourceID),
@@ -59,6 +68,18 @@ ReceivedMessage::ReceivedMessage(QByteArray byteArray, PacketType packetType, Pa
     _senderSockAddr(senderSockAddr),
     _isComplete(true)
 {
+    appendSpan({ udt::PacketBuffer(), byteArray, byteArray.constData(), byteArray.size() });
+}
+
+QByteArray ReceivedMessage::getMessage() const {
+    return coalesce();
+}
+
+const char* ReceivedMessage::getRawMessage() const {
+    if (_spans.size() == 1) {
+        return _spans.front().data;
+    }
+    return coalesce().constData();
 }
 
 void ReceivedMessage::setFailed() {
@@ -76,7 +97,8 @@ void ReceivedMessage::appendPacket(NLPacket& packet) {
 
     ++_numPackets;
 
-    _data.append(packet.getPayload(), packet.getPayloadSize());
+    // keep a reference to the packet storage rather than copying its payload
+    appendSpan({ packet.getBuffer(), QByteArray(), packet.getPayload(), packet.getPayloadSize() });
 
     if (_numPackets % EMIT_PROGRESS_EVERY_X_PACKETS == 0) {
         emit progress(getSize());
@@ -95,21 +117,20 @@ void ReceivedMessage::appendPacket(NLPacket& packet) {
 }
 
 qint64 ReceivedMessage::peek(char* data, qint64 size) {
-    size_t bytesLeft = _data.size() - _position;
-    size_t sizeRead = std::min((size_t)size, bytesLeft);
-    memcpy(data, _data.constData() + _position, sizeRead);
-    return sizeRead;
+    return copyOut(_position, data, size);
 }
 
 qint64 ReceivedMessage::read(char* data, qint64 size) {
-    size_t bytesLeft = _data.size() - _position;
-    size_t sizeRead = std::min((size_t)size, bytesLeft);
-    memcpy(data, _data.constData() + _position, sizeRead);
+    qint64 sizeRead = copyOut(_position, data, size);
     _position += sizeRead;
     return sizeRead;
 }
 
 qint64 ReceivedMessage::readHead(char* data, qint64 size) {
+    if (!_hasHeadData) {
+        return read(data, size);
+    }
+
     size_t bytesLeft = _headData.size() - _position;
     size_t sizeRead = std::min((size_t)size, bytesLeft);
     memcpy(data, _headData.constData() + _position, sizeRead);
@@ -118,16 +139,29 @@ qint64 ReceivedMessage::readHead(char* data, qint64 size) {
 }
 
 QByteArray ReceivedMessage::peek(qint64 size) {
-    return _data.mid(_position, size);
+    qint64 position = _position;
+    size = std::max(std::min(size, _size - position), (qint64)0);
+
+    if (_spans.size() == 1 && !_spans.front().bytes.isNull()) {
+        return _spans.front().bytes.mid(position, size);
+    }
+
+    QByteArray data((int)size, Qt::Uninitialized);
+    copyOut(position, data.data(), size);
+    return data;
 }
 
 QByteArray ReceivedMessage::read(qint64 size) {
-    auto data = _data.mid(_position, size);
+    auto data = peek(size);
     _position += size;
     return data;
 }
 
 QByteArray ReceivedMessage::readHead(qint64 size) {
+    if (!_hasHeadData) {
+        return read(size);
+    }
+
     auto data = _headData.mid(_position, size);
     _position += size;
     return data;
@@ -141,15 +175,103 @@ QString ReceivedMessage::readString() {
     uint32_t size;
     readPrimitive(&size);
     //Q_ASSERT(size <= _size - _position);
-    auto string = QString::fromUtf8(_data.constData() + _position, size);
+    const char* data = contiguousData(_position, size);
+    if (!data) {
+        data = coalesce().constData() + _position;
+    }
+    auto string = QString::fromUtf8(data, size);
     _position += size;
     return string;
 }
 
 QByteArray ReceivedMessage::readWithoutCopy(qint64 size) {
-    QByteArray data { QByteArray::fromRawData(_data.constData() + _position, size) };
+    const char* data = contiguousData(_position, size);
+    if (!data) {
+        data = coalesce().constData() + _position;
+    }
     _position += size;
-    return data;
+    return QByteArray::fromRawData(data, size);
+}
+
+ReceivedMessage::Spans ReceivedMessage::readSpans(qint64 size) {
+    Spans spans;
+
+    qint64 position = _position;
+    size = std::max(std::min(size, _size - position), (qint64)0);
+    _position += size;
+
+    for (size_t i = findSpan(position); size > 0 && i < _spans.size(); ++i) {
+        const auto& span = _spans[i];
+        qint64 offset = position - _spanOffsets[i];
+        qint64 spanSize = std::min(span.size - offset, size);
+
+        spans.push_back({ span.buffer, span.bytes, span.data + offset, spanSize });
+
+        position += spanSize;
+        size -= spanSize;
+    }
+
+    return spans;
+}
+
+void ReceivedMessage::appendSpan(Span span) {
+    if (span.size <= 0) {
+        return;
+    }
+
+    _spanOffsets.push_back(_size);
+    _size += span.size;
+    _spans.push_back(std::move(span));
+}
+
+size_t ReceivedMessage::findSpan(qint64 position) const {
+    auto it = std::upper_bound(_spanOffsets.begin(), _spanOffsets.end(), position);
+    return it == _spanOffsets.begin() ? 0 : (it - _spanOffsets.begin()) - 1;
+}
+
+qint64 ReceivedMessage::copyOut(qint64 position, char* data, qint64 size) const {
+    qint64 sizeRead = std::max(std::min(size, _size - position), (qint64)0);
+
+    qint64 copied = 0;
+    for (size_t i = findSpan(position); copied < sizeRead && i < _spans.size(); ++i) {
+        const auto& span = _spans[i];
+        qint64 offset = position + copied - _spanOffsets[i];
+        qint64 spanSize = std::min(span.size - offset, sizeRead - copied);
+
+        memcpy(data + copied, span.data + offset, spanSize);
+        copied += spanSize;
+    }
+
+    _copiedBytes.fetch_add(copied, std::memory_order_relaxed);
+    return copied;
+}
+
+const char* ReceivedMessage::contiguousData(qint64 position, qint64 size) const {
+    if (_spans.empty() || position < 0) {
+        return nullptr;
+    }
+
+    size_t i = findSpan(position);
+    qint64 offset = position - _spanOffsets[i];
+    if (offset + size > _spans[i].size) {
+        return nullptr;
+    }
+
+    return _spans[i].data + offset;
+}
+
+const QByteArray& ReceivedMessage::coalesce() const {
+    if (_spans.size() == 1 && _spans.front().bytes.size() == _size) {
+        return _spans.front().bytes;
+    }
+
+    if (_data.size() != _size) {
+        // the message was received in more than one packet (or has grown since), so piece it together once
+        _data.resize((int)_size);
+        copyOut(0, _data.data(), _size);
+    }
+
+    return _data;
 }
 
 void ReceivedMessage::onComplete() {
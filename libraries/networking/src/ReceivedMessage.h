@@ -18,19 +18,31 @@
 #include <QtCore/QSharedPointer>
 
 #include <atomic>
+#include <vector>
 
 #include "NLPacketList.h"
 
 class ReceivedMessage : public QObject {
     Q_OBJECT
 public:
+    // A contiguous part of the message. It holds a reference to the packet storage (or byte array) it points into,
+    // so it stays valid after the message is destroyed.
+    struct Span {
+        udt::PacketBuffer buffer;
+        QByteArray bytes;
+        const char* data { nullptr };
+        qint64 size { 0 };
+    };
+    using Spans = std::vector<Span>;
+
     ReceivedMessage(const NLPacketList& packetList);
     ReceivedMessage(NLPacket& packet);
     ReceivedMessage(QByteArray byteArray, PacketType packetType, PacketVersion packetVersion,
                     const SockAddr& senderSockAddr, NLPacket::LocalID sourceID = NLPacket::NULL_LOCAL_ID);
 
-    QByteArray getMessage() const { return _data; }
-    const char* getRawMessage() const { return _data.constData(); }
+    // These coalesce messages that were reassembled from more than one packet, prefer the read methods or readSpans
+    QByteArray getMessage() const;
+    const char* getRawMessage() const;
 
     PacketType getType() const { return _packetType; }
     PacketVersion getVersion() const { return _packetVersion; }
@@ -52,9 +64,9 @@ public:
 
     qint64 getFirstPacketReceiveTime() const { return _firstPacketReceiveTime; }
 
-    qint64 getSize() const { return _data.size(); }
+    qint64 getSize() const { return _size; }
 
-    qint64 getBytesLeftToRead() const { return _data.size() -  _position; }
+    qint64 getBytesLeftToRead() const { return _size -  _position; }
 
     void seek(qint64 position) { _position = position; }
 
@@ -78,11 +90,17 @@ public:
     // exceed that of the ReceivedMessage.
     QByteArray readWithoutCopy(qint64 size);
 
+    // Returns the next size bytes as views into the packets they were received in, without copying them.
+    Spans readSpans(qint64 size);
+
     template<typename T> qint64 peekPrimitive(T* data);
     template<typename T> qint64 readPrimitive(T* data);
 
     template<typename T> qint64 readHeadPrimitive(T* data);
 
+    // Number of bytes copied out of packet storage by this message, for benchmarks and stats
+    qint64 getCopiedBytes() const { return _copiedBytes; }
+
 signals:
     void progress(qint64 size);
     void completed();
@@ -91,8 +109,20 @@ private slots:
     void onComplete();
 
 private:
-    QByteArray _data;
-    QByteArray _headData;
+    void appendSpan(Span span);
+    size_t findSpan(qint64 position) const;
+    qint64 copyOut(qint64 position, char* data, qint64 size) const;
+    const char* contiguousData(qint64 position, qint64 size) const;
+    const QByteArray& coalesce() const;
+
+    Spans _spans;
+    std::vector<qint64> _spanOffsets;
+    std::atomic<qint64> _size { 0 };
+
+    mutable QByteArray _data; // coalesced message, only built on demand for messages of more than one span
+    QByteArray _headData; // only kept for messages still being received, see readHead
+    bool _hasHeadData { false };
+    mutable std::atomic<qint64> _copiedBytes { 0 };
 
     std::atomic<qint64> _position { 0 };
     std::atomic<qint64> _numPackets { 0 };
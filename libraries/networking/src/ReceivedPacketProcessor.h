@@ -67,6 +67,10 @@ protected:
     /// \param QByteArray& the packet to be processed
     virtual void processPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode) = 0;
 
+    /// Processes a batch of received packets, in the order they were received. The default calls processPacket() and then
+    /// midProcess() for each of them; override to handle the batch as a whole.
+    virtual void processPackets(std::list<NodeSharedReceivedMessagePair>& packets);
+
     /// Implements generic processing behavior for this thread.
     virtual bool process() override;
 
@@ -607,6 +607,7 @@ void Resource::ensureLoading() {
 void Resource::setLoadPriority(const QPointer<QObject>& owner, float priority) {
     if (!_failedToLoad) {
         _loadPriorities.insert(owner, priority);
+        getLoadPriority();
     }
 }
 
@@ -618,16 +619,19 @@ void Resource::setLoadPriorities(const QHash<QPointer<QObject>, float>& prioriti
             it != priorities.constEnd(); it++) {
         _loadPriorities.insert(it.key(), it.value());
     }
+    getLoadPriority();
 }
 
 void Resource::clearLoadPriority(const QPointer<QObject>& owner) {
     if (!_failedToLoad) {
         _loadPriorities.remove(owner);
+        getLoadPriority();
     }
 }
 
 float Resource::getLoadPriority() {
     if (_loadPriorities.size() == 0) {
+        _lastLoadPriority = 0.0f;
         return 0;
     }
 
@@ -640,9 +644,15 @@ float Resource::getLoadPriority() {
         highestPriority = qMax(highestPriority, it.value());
         it++;
     }
+    _lastLoadPriority = highestPriority;
     return highestPriority;
 }
 
+float ResourceLoadJobBase::getPriority() const {
+    auto resource = _resource.lock();
+    return resource ? resource->getLastLoadPriority() : 0.0f;
+}
+
 void Resource::refresh() {
     if (_request && !(_loaded || _failedToLoad)) {
         return;
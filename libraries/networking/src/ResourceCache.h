@@ -31,6 +31,7 @@
 #include <QtNetwork/QNetworkRequest>
 
 #include <DependencyManager.h>
+#include <ResourceLoadScheduler.h>
 
 #include "ResourceManager.h"
 
@@ -435,6 +436,9 @@ public:
     /// Returns the highest load priority across all owners.
     float getLoadPriority();
 
+    /// Returns the load priority as of the last time it was set or computed. Safe to call from any thread.
+    float getLastLoadPriority() const { return _lastLoadPriority; }
+
     /// Checks whether the resource has loaded.
     virtual bool isLoaded() const { return _loaded; }
 
@@ -538,6 +542,7 @@ protected:
     bool _loaded = false;
 
     QHash<QPointer<QObject>, float> _loadPriorities;
+    std::atomic<float> _lastLoadPriority { 0.0f };
     QWeakPointer<Resource> _self;
     QPointer<ResourceCache> _cache;
 
@@ -574,6 +579,19 @@ private:
     bool _isInScript{ false };
 };
 
+/// Decoding or processing work for a resource. It is scheduled by the live load priority of the resource, and dropped
+/// if the resource is released before the work starts.
+class ResourceLoadJobBase : public ResourceLoadJob {
+public:
+    ResourceLoadJobBase(const QWeakPointer<Resource>& resource) : _resource(resource) {}
+
+    float getPriority() const override;
+    bool isStale() const override { return _resource.isNull(); }
+
+protected:
+    QWeakPointer<Resource> _resource;
+};
+
 uint qHash(const QPointer<QObject>& value, uint seed = 0);
 
 #endif // hifi_ResourceCache_h
@@ -58,6 +58,10 @@ void ResourceRequest::recordBytesDownloadedInStats(const QString& statName, int6
     auto dBytes = bytesReceived - _lastRecordedBytesDownloaded;
     if (dBytes > 0) {
         _lastRecordedBytesDownloaded = bytesReceived;
-        DependencyManager::get<StatTracker>()->updateStat(statName, dBytes);
+        // progress is reported many times per request, so resolve the counter once and keep it
+        if (!_bytesDownloadedStat) {
+            _bytesDownloadedStat = DependencyManager::get<StatTracker>()->getCounter(statName);
+        }
+        _bytesDownloadedStat->update(dBytes);
     }
 }
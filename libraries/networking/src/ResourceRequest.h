@@ -17,6 +17,8 @@
 
 #include <cstdint>
 
+#include <StatTracker.h>
+
 #include "ByteRange.h"
 
 const QString STAT_ATP_REQUEST_STARTED = "StartedATPRequest";
@@ -89,6 +91,8 @@ public:
 
     void setCacheEnabled(bool value) { _cacheEnabled = value; }
     void setByteRange(ByteRange byteRange) { _byteRange = byteRange; }
+    // Asks for a large byte range from its end backwards, where the request fetches it in parts
+    void setFetchBackwards(bool value) { _fetchBackwards = value; }
 
     static QString toHttpDateString(uint64_t msecsSinceEpoch);
 public slots:
@@ -97,6 +101,9 @@ public slots:
 signals:
     void progress(qint64 bytesReceived, qint64 bytesTotal);
     void finished();
+    // Part of the data, at the given offset in it, has arrived ahead of the rest. Only requests that fetch their data in
+    // parts emit it, once for each part, and the data as a whole still comes with finished.
+    void rangeReceived(qint64 offset, const QByteArray& data);
 
 protected:
     virtual void doSend() = 0;
@@ -111,10 +118,12 @@ protected:
     bool _cacheEnabled { true };
     bool _loadedFromCache { false };
     ByteRange _byteRange;
+    bool _fetchBackwards { false };
     bool _rangeRequestSuccessful { false };
     uint64_t _totalSizeOfResource { 0 };
     QString _webMediaType;
     int64_t _lastRecordedBytesDownloaded { 0 };
+    StatTracker::CounterPointer _bytesDownloadedStat;
     bool _isObservable;
     qint64 _callerId;
     QString _extra;
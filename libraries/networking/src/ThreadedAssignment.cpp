@@ -18,16 +18,19 @@
 #include <QtCore/QTimer>
 
 #include <LogHandler.h>
+#include <OpenMetrics.h>
 #include <shared/QtHelpers.h>
 
 #include <platform/Platform.h>
 #include "NetworkLogging.h"
+#include "udt/SendQueueScheduler.h"
 
 ThreadedAssignment::ThreadedAssignment(ReceivedMessage& message) :
     Assignment(message),
     _isFinished(false),
     _domainServerTimer(this),
-    _statsTimer(this)
+    _statsTimer(this),
+    _metricsTimer(this)
 {
     // use <mixer-type> as a temporary targetName name until commonInit can be called later
     LogHandler::getInstance().setTargetName(QString("<%1>").arg(getTypeName()));
@@ -36,6 +39,10 @@ ThreadedAssignment::ThreadedAssignment(ReceivedMessage& message) :
     _statsTimer.setInterval(STATS_TIMEOUT_MS); // 1s, Qt::CoarseTimer acceptable
     connect(&_statsTimer, &QTimer::timeout, this, &ThreadedAssignment::sendStatsPacket);
 
+    static const int METRICS_TIMEOUT_MS = 1000;
+    _metricsTimer.setInterval(METRICS_TIMEOUT_MS); // 1s, Qt::CoarseTimer acceptable
+    connect(&_metricsTimer, &QTimer::timeout, this, &ThreadedAssignment::updateMetrics);
+
     connect(&_domainServerTimer, &QTimer::timeout, this, &ThreadedAssignment::checkInWithDomainServerOrExit);
     _domainServerTimer.setInterval(DOMAIN_SERVER_CHECK_IN_MSECS); // 1s, Qt::CoarseTimer acceptable
 
@@ -78,6 +85,7 @@ void ThreadedAssignment::setFinished(bool isFinished) {
             // stop our owned timers
             _domainServerTimer.stop();
             _statsTimer.stop();
+            _metricsTimer.stop();
 
             // call our virtual aboutToFinish method - this gives the ThreadedAssignment subclass a chance to cleanup
             aboutToFinish();
@@ -104,6 +112,11 @@ void ThreadedAssignment::commonInit(const QString& targetName, NodeType_t nodeTy
 
     // stop sending stats if we disconnect
     connect(&nodeList->getDomainHandler(), &DomainHandler::disconnectedFromDomain, &_statsTimer, &QTimer::stop);
+
+    // metrics are scraped locally, so they are collected whether or not we are connected to a domain
+    if (_metrics) {
+        _metricsTimer.start();
+    }
 }
 
 void ThreadedAssignment::addPacketStatsAndSendStatsPacket(QJsonObject statsObject) {
@@ -121,6 +134,15 @@ void ThreadedAssignment::addPacketStatsAndSendStatsPacket(QJsonObject statsObjec
 
     statsObject["io_stats"] = ioStats;
 
+    auto sendQueueStats = udt::SendQueueScheduler::getSharedStats();
+    QJsonObject sendQueueSchedulerStats;
+    sendQueueSchedulerStats["pacing_threads"] = sendQueueStats.threadCount;
+    sendQueueSchedulerStats["send_queues"] = sendQueueStats.queueCount;
+    sendQueueSchedulerStats["avg_lag_usecs"] = sendQueueStats.averageLagUsecs;
+    sendQueueSchedulerStats["max_lag_usecs"] = (qint64)sendQueueStats.maxLagUsecs;
+
+    statsObject["send_queue_scheduler"] = sendQueueSchedulerStats;
+
     QJsonObject assignmentStats;
     assignmentStats["numQueuedCheckIns"] = _numQueuedCheckIns;
 
@@ -134,6 +156,31 @@ void ThreadedAssignment::sendStatsPacket() {
     addPacketStatsAndSendStatsPacket(statsObject);
 }
 
+QByteArray AssignmentMetrics::getContent() const {
+    QMutexLocker locker(&_mutex);
+    return _content;
+}
+
+void AssignmentMetrics::setContent(QByteArray content) {
+    QMutexLocker locker(&_mutex);
+    _content.swap(content);
+}
+
+void ThreadedAssignment::updateMetrics() {
+    OpenMetricsWriter metrics;
+    collectMetrics(metrics);
+    _metrics->setContent(metrics.getContent());
+}
+
+void ThreadedAssignment::collectMetrics(OpenMetricsWriter& metrics) {
+    auto nodeList = DependencyManager::get<NodeList>();
+
+    nodeList->collectMetrics(metrics);
+
+    metrics.addGauge("overte_assignment_queued_check_ins", "Domain server check-ins sent without a reply",
+                     _numQueuedCheckIns);
+}
+
 void ThreadedAssignment::checkInWithDomainServerOrExit() {
     // verify that the number of queued check-ins is not >= our max
     // the number of queued check-ins is cleared anytime we get a response from the domain-server
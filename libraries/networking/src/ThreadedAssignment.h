@@ -12,12 +12,35 @@
 #ifndef hifi_ThreadedAssignment_h
 #define hifi_ThreadedAssignment_h
 
+#include <QtCore/QMutex>
 #include <QtCore/QSharedPointer>
 
+#include <memory>
+
 #include "ReceivedMessage.h"
 
 #include "Assignment.h"
 
+class OpenMetricsWriter;
+
+/// The latest metrics snapshot of an assignment, in the Prometheus text format. It is shared between the assignment,
+/// which updates it on its own thread, and whoever serves it, so that serving it never touches the assignment itself.
+class AssignmentMetrics {
+public:
+    AssignmentMetrics(const QString& typeName) : _typeName(typeName) {}
+
+    const QString& getTypeName() const { return _typeName; }
+
+    QByteArray getContent() const;
+    void setContent(QByteArray content);
+
+private:
+    const QString _typeName;
+    mutable QMutex _mutex;
+    QByteArray _content;
+};
+using AssignmentMetricsPointer = std::shared_ptr<AssignmentMetrics>;
+
 class ThreadedAssignment : public Assignment {
     Q_OBJECT
 public:
@@ -27,6 +50,12 @@ public:
     virtual void aboutToFinish() { };
     void addPacketStatsAndSendStatsPacket(QJsonObject statsObject);
 
+    /// When set before the assignment is run, a metrics snapshot is collected into it every second
+    void setMetrics(AssignmentMetricsPointer metrics) { _metrics = metrics; }
+
+    /// Directory shared with the other assignment clients of this machine for data they all load, empty if there is none
+    void setSharedCacheDirectory(const QString& directory) { _sharedCacheDirectory = directory; }
+
 public slots:
     /// threaded run of assignment
     virtual void run() = 0;
@@ -44,16 +73,26 @@ protected:
     void commonInit(const QString& targetName, NodeType_t nodeType);
     void setFinished(bool isFinished);
 
+    /// Called on the assignment thread to add this assignment's metrics to a snapshot.
+    /// Overrides should call the base implementation, which adds the I/O and connection stats.
+    virtual void collectMetrics(OpenMetricsWriter& metrics);
+
     bool _isFinished;
     QTimer _domainServerTimer;
     QTimer _statsTimer;
+    QTimer _metricsTimer;
     int _numQueuedCheckIns { 0 };
+    QString _sharedCacheDirectory;
 
 protected slots:
     void domainSettingsRequestFailed();
 
 private slots:
     void checkInWithDomainServerOrExit();
+    void updateMetrics();
+
+private:
+    AssignmentMetricsPointer _metrics;
 };
 
 typedef QSharedPointer<ThreadedAssignment> SharedAssignmentPointer;
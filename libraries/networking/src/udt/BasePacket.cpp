@@ -38,6 +38,11 @@ std::unique_ptr<BasePacket> BasePacket::create(qint64 size) {
 
 std::unique_ptr<BasePacket> BasePacket::fromReceivedPacket(std::unique_ptr<char[]> data,
                                                            qint64 size, const SockAddr& senderSockAddr) {
+    return fromReceivedPacket(PacketBuffer::adopt(std::move(data), size), size, senderSockAddr);
+}
+
+std::unique_ptr<BasePacket> BasePacket::fromReceivedPacket(PacketBuffer data,
+                                                           qint64 size, const SockAddr& senderSockAddr) {
     // Fail with invalid size
     Q_ASSERT(size >= 0);
     
@@ -61,16 +66,16 @@ BasePacket::BasePacket(qint64 size) {
     Q_ASSERT(size >= 0 && size <= maxPayload);
     
     _packetSize = size;
-    _packet.reset(new char[_packetSize]());
+    _packet = PacketBuffer::allocate(_packetSize, true);
     _payloadCapacity = _packetSize;
     _payloadSize = 0;
-    _payloadStart = _packet.get();
+    _payloadStart = _packet.data();
 }
 
-BasePacket::BasePacket(std::unique_ptr<char[]> data, qint64 size, const SockAddr& senderSockAddr) :
+BasePacket::BasePacket(PacketBuffer data, qint64 size, const SockAddr& senderSockAddr) :
     _packetSize(size),
     _packet(std::move(data)),
-    _payloadStart(_packet.get()),
+    _payloadStart(_packet.data()),
     _payloadCapacity(size),
     _payloadSize(size),
     _senderSockAddr(senderSockAddr)
@@ -80,10 +85,10 @@ BasePacket::BasePacket(std::unique_ptr<char[]> data, qint64 size, const SockAddr
 
 BasePacket& BasePacket::operator=(const BasePacket& other) {
     _packetSize = other._packetSize;
-    _packet = std::unique_ptr<char[]>(new char[_packetSize]);
-    memcpy(_packet.get(), other._packet.get(), _packetSize);
+    _packet = PacketBuffer::allocate(_packetSize);
+    memcpy(_packet.data(), other._packet.data(), _packetSize);
     
-    _payloadStart = _packet.get() + (other._payloadStart - other._packet.get());
+    _payloadStart = _packet.data() + (other._payloadStart - other._packet.data());
     _payloadCapacity = other._payloadCapacity;
     
     _payloadSize = other._payloadSize;
@@ -21,6 +21,7 @@
 
 #include "../SockAddr.h"
 #include "Constants.h"
+#include "PacketBuffer.h"
 #include "../ExtendedIODevice.h"
 
 namespace udt {
@@ -33,6 +34,8 @@ public:
     static std::unique_ptr<BasePacket> create(qint64 size = -1);
     static std::unique_ptr<BasePacket> fromReceivedPacket(std::unique_ptr<char[]> data, qint64 size,
                                                           const SockAddr& senderSockAddr);
+    static std::unique_ptr<BasePacket> fromReceivedPacket(PacketBuffer data, qint64 size,
+                                                          const SockAddr& senderSockAddr);
     
     // Current level's header size
     static int localHeaderSize();
@@ -46,11 +49,14 @@ public:
     const char* getPayload() const { return _payloadStart; }
     
     // Return direct access to the entire packet, use responsibly!
-    char* getData() { return _packet.get(); }
-    const char* getData() const { return _packet.get(); }
+    char* getData() { return _packet.data(); }
+    const char* getData() const { return _packet.data(); }
+
+    // Returns a reference to the storage of this packet, which stays valid after the packet is destroyed
+    PacketBuffer getBuffer() const { return _packet; }
     
     // Returns the size of the packet, including the header
-    qint64 getDataSize() const { return (_payloadStart - _packet.get()) + _payloadSize; }
+    qint64 getDataSize() const { return (_payloadStart - _packet.data()) + _payloadSize; }
     
     // Returns the size of the packet, including the header AND the UDP/IP header
     qint64 getWireSize() const { return getDataSize() + UDP_IPV4_HEADER_SIZE; }
@@ -88,7 +94,7 @@ public:
     
 protected:
     BasePacket(qint64 size);
-    BasePacket(std::unique_ptr<char[]> data, qint64 size, const SockAddr& senderSockAddr);
+    BasePacket(PacketBuffer data, qint64 size, const SockAddr& senderSockAddr);
     BasePacket(const BasePacket& other) : ExtendedIODevice() { *this = other; }
     BasePacket& operator=(const BasePacket& other);
     BasePacket(BasePacket&& other);
@@ -101,7 +107,7 @@ protected:
     void adjustPayloadStartAndCapacity(qint64 headerSize, bool shouldDecreasePayloadSize = false);
     
     qint64 _packetSize = 0;        // Total size of the allocated memory
-    std::unique_ptr<char[]> _packet; // Allocated memory
+    PacketBuffer _packet; // Allocated memory
     
     char* _payloadStart = nullptr; // Start of the payload
     qint64 _payloadCapacity = 0;          // Total capacity of the payload
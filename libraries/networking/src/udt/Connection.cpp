@@ -14,8 +14,6 @@
 
 #include <random>
 
-#include <QtCore/QThread>
-
 #include <NumericalConstants.h>
 
 #include "../SockAddr.h"
@@ -68,21 +66,14 @@ Connection::~Connection() {
 }
 
 void Connection::stopSendQueue() {
-    if (auto sendQueue = _sendQueue.release()) {
-        // grab the send queue thread so we can wait on it
-        QThread* sendQueueThread = sendQueue->thread();
-        
-        // tell the send queue to stop and be deleted
-        
-        sendQueue->stop();
+    if (_sendQueue) {
+        // tell the send queue to stop
+        _sendQueue->stop();
 
-        _lastMessageNumber = sendQueue->getCurrentMessageNumber();
+        _lastMessageNumber = _sendQueue->getCurrentMessageNumber();
 
-        sendQueue->deleteLater();
-        
-        // wait on the send queue thread so we know the send queue is gone
-        sendQueueThread->quit();
-        sendQueueThread->wait();
+        // deleting the send queue takes it off its pacing thread, so we know it's gone once this returns
+        _sendQueue.reset();
     }
 }
 
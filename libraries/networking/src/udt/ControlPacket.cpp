@@ -28,8 +28,13 @@ int ControlPacket::maxPayloadSize() {
 
 std::unique_ptr<ControlPacket> ControlPacket::fromReceivedPacket(std::unique_ptr<char[]> data, qint64 size,
                                                                  const SockAddr &senderSockAddr) {
+    return fromReceivedPacket(PacketBuffer::adopt(std::move(data), size), size, senderSockAddr);
+}
+
+std::unique_ptr<ControlPacket> ControlPacket::fromReceivedPacket(PacketBuffer data, qint64 size,
+                                                                 const SockAddr &senderSockAddr) {
     // Fail with null data
-    Q_ASSERT(data);
+    Q_ASSERT(!data.isNull());
     
     // Fail with invalid size
     Q_ASSERT(size >= 0);
@@ -57,7 +62,7 @@ ControlPacket::ControlPacket(Type type, qint64 size) :
     writeType();
 }
 
-ControlPacket::ControlPacket(std::unique_ptr<char[]> data, qint64 size, const SockAddr& senderSockAddr) :
+ControlPacket::ControlPacket(PacketBuffer data, qint64 size, const SockAddr& senderSockAddr) :
     BasePacket(std::move(data), size, senderSockAddr)
 {
     // sanity check before we decrease the payloadSize with the payloadCapacity
@@ -89,14 +94,14 @@ void ControlPacket::setType(udt::ControlPacket::Type type) {
 }
 
 void ControlPacket::writeType() {
-    ControlBitAndType* bitAndType = reinterpret_cast<ControlBitAndType*>(_packet.get());
+    ControlBitAndType* bitAndType = reinterpret_cast<ControlBitAndType*>(_packet.data());
     
     // We override the control bit here by writing the type but it's okay, it'll always be 1
     *bitAndType = CONTROL_BIT_MASK | (ControlBitAndType(_type) << (8 * sizeof(Type)));
 }
 
 void ControlPacket::readType() {
-    ControlBitAndType bitAndType = *reinterpret_cast<ControlBitAndType*>(_packet.get());
+    ControlBitAndType bitAndType = *reinterpret_cast<ControlBitAndType*>(_packet.data());
     
     Q_ASSERT_X(bitAndType & CONTROL_BIT_MASK, "ControlPacket::readType()", "This should be a control packet");
     
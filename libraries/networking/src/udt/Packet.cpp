@@ -63,6 +63,10 @@ std::unique_ptr<Packet> Packet::create(qint64 size, bool isReliable, bool isPart
 }
 
 std::unique_ptr<Packet> Packet::fromReceivedPacket(std::unique_ptr<char[]> data, qint64 size, const SockAddr& senderSockAddr) {
+    return fromReceivedPacket(PacketBuffer::adopt(std::move(data), size), size, senderSockAddr);
+}
+
+std::unique_ptr<Packet> Packet::fromReceivedPacket(PacketBuffer data, qint64 size, const SockAddr& senderSockAddr) {
     // Fail with invalid size
     Q_ASSERT(size >= 0);
 
@@ -88,7 +92,7 @@ Packet::Packet(qint64 size, bool isReliable, bool isPartOfMessage) :
     writeHeader();
 }
 
-Packet::Packet(std::unique_ptr<char[]> data, qint64 size, const SockAddr& senderSockAddr) :
+Packet::Packet(PacketBuffer data, qint64 size, const SockAddr& senderSockAddr) :
     BasePacket(std::move(data), size, senderSockAddr)
 {
     readHeader();
@@ -176,7 +180,7 @@ void Packet::copyMembers(const Packet& other) {
 }
 
 void Packet::readHeader() const {
-    SequenceNumberAndBitField* seqNumBitField = reinterpret_cast<SequenceNumberAndBitField*>(_packet.get());
+    SequenceNumberAndBitField* seqNumBitField = reinterpret_cast<SequenceNumberAndBitField*>(_packet.data());
     
     Q_ASSERT_X(!(*seqNumBitField & CONTROL_BIT_MASK), "Packet::readHeader()", "This should be a data packet");
     
@@ -198,7 +202,7 @@ void Packet::readHeader() const {
 
 void Packet::writeHeader() const {
     // grab pointer to current SequenceNumberAndBitField
-    SequenceNumberAndBitField* seqNumBitField = reinterpret_cast<SequenceNumberAndBitField*>(_packet.get());
+    SequenceNumberAndBitField* seqNumBitField = reinterpret_cast<SequenceNumberAndBitField*>(_packet.data());
     
     // Write sequence number and reset bit field
     Q_ASSERT_X(!((SequenceNumber::Type)_sequenceNumber & BIT_FIELD_MASK),
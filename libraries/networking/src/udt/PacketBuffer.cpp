@@ -0,0 +1,171 @@
+//
+//  PacketBuffer.cpp
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "PacketBuffer.h"
+
+#include <atomic>
+#include <cstring>
+#include <mutex>
+
+#include "Constants.h"
+
+using namespace udt;
+
+struct PacketBuffer::Block {
+    std::atomic<int> refCount { 1 };
+    bool isPooled { false };
+    qint64 capacity { 0 };
+    std::unique_ptr<char[]> data;
+    Block* nextFree { nullptr };
+};
+
+struct PacketBuffer::Pool {
+    std::mutex mutex;
+    Stats stats;
+    Block* freeList { nullptr };
+};
+
+// enough for a few thousand packets in flight, about 6MB once warm
+static const uint64_t MAX_POOLED_BUFFERS = 4096;
+
+// never destroyed, so that buffers held by statics can still be released at exit
+PacketBuffer::Pool& PacketBuffer::pool() {
+    static Pool* instance = new Pool();
+    return *instance;
+}
+
+PacketBuffer::PacketBuffer(const PacketBuffer& other) : _block(other._block) {
+    if (_block) {
+        _block->refCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+PacketBuffer& PacketBuffer::operator=(const PacketBuffer& other) {
+    if (_block != other._block) {
+        if (other._block) {
+            other._block->refCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        release();
+        _block = other._block;
+    }
+    return *this;
+}
+
+PacketBuffer& PacketBuffer::operator=(PacketBuffer&& other) noexcept {
+    if (this != &other) {
+        release();
+        _block = other._block;
+        other._block = nullptr;
+    }
+    return *this;
+}
+
+PacketBuffer PacketBuffer::allocate(qint64 size, bool zeroed) {
+    Q_ASSERT(size >= 0);
+
+    Block* block = nullptr;
+    if (size <= MAX_PACKET_SIZE) {
+        auto& bufferPool = pool();
+        std::lock_guard<std::mutex> lock(bufferPool.mutex);
+        if (bufferPool.freeList) {
+            block = bufferPool.freeList;
+            bufferPool.freeList = block->nextFree;
+            bufferPool.stats.pooled--;
+            bufferPool.stats.poolReuses++;
+        } else {
+            bufferPool.stats.heapAllocations++;
+        }
+    } else {
+        std::lock_guard<std::mutex> lock(pool().mutex);
+        pool().stats.heapAllocations++;
+    }
+
+    if (block) {
+        block->nextFree = nullptr;
+        block->refCount.store(1, std::memory_order_relaxed);
+    } else {
+        block = new Block();
+        block->isPooled = size <= MAX_PACKET_SIZE;
+        block->capacity = block->isPooled ? MAX_PACKET_SIZE : size;
+        block->data.reset(new char[block->capacity]);
+    }
+
+    if (zeroed) {
+        memset(block->data.get(), 0, size);
+    }
+
+    return PacketBuffer(block);
+}
+
+PacketBuffer PacketBuffer::adopt(std::unique_ptr<char[]> data, qint64 size) {
+    Block* block = new Block();
+    block->capacity = size;
+    block->data = std::move(data);
+
+    {
+        std::lock_guard<std::mutex> lock(pool().mutex);
+        pool().stats.adopted++;
+    }
+
+    return PacketBuffer(block);
+}
+
+char* PacketBuffer::data() const {
+    return _block ? _block->data.get() : nullptr;
+}
+
+qint64 PacketBuffer::capacity() const {
+    return _block ? _block->capacity : 0;
+}
+
+int PacketBuffer::useCount() const {
+    return _block ? _block->refCount.load(std::memory_order_relaxed) : 0;
+}
+
+void PacketBuffer::release() {
+    if (!_block) {
+        return;
+    }
+
+    Block* block = _block;
+    _block = nullptr;
+
+    if (block->refCount.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+    }
+
+    if (block->isPooled) {
+        auto& bufferPool = pool();
+        std::lock_guard<std::mutex> lock(bufferPool.mutex);
+        if (bufferPool.stats.pooled < MAX_POOLED_BUFFERS) {
+            block->nextFree = bufferPool.freeList;
+            bufferPool.freeList = block;
+            bufferPool.stats.pooled++;
+            return;
+        }
+    }
+
+    delete block;
+}
+
+PacketBuffer::Stats PacketBuffer::getStats() {
+    auto& bufferPool = pool();
+    std::lock_guard<std::mutex> lock(bufferPool.mutex);
+    return bufferPool.stats;
+}
+
+void PacketBuffer::resetStats() {
+    auto& bufferPool = pool();
+    std::lock_guard<std::mutex> lock(bufferPool.mutex);
+    uint64_t pooled = bufferPool.stats.pooled;
+    bufferPool.stats = Stats();
+    bufferPool.stats.pooled = pooled;
+}
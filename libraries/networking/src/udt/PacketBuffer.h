@@ -0,0 +1,78 @@
+//
+//  PacketBuffer.h
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Refcounted packet storage recycled through a process-wide pool
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#ifndef hifi_PacketBuffer_h
+#define hifi_PacketBuffer_h
+
+#include <cstdint>
+#include <memory>
+
+#include <QtGlobal>
+
+namespace udt {
+
+/// The storage of a packet, shared by reference count.
+///
+/// Buffers of up to MAX_PACKET_SIZE bytes are taken from a process-wide pool and go back to it when their last reference
+/// is released, so packets and the messages reassembled from them don't go to the heap once the pool is warm. A
+/// ReceivedMessage holds references to the buffers of the packets it was reassembled from instead of copying them.
+class PacketBuffer {
+public:
+    struct Stats {
+        uint64_t heapAllocations { 0 };  // buffers that had to be allocated
+        uint64_t poolReuses { 0 };       // buffers handed out from the pool
+        uint64_t adopted { 0 };          // buffers allocated elsewhere and wrapped
+        uint64_t pooled { 0 };           // buffers currently waiting in the pool
+    };
+
+    PacketBuffer() = default;
+    PacketBuffer(const PacketBuffer& other);
+    PacketBuffer(PacketBuffer&& other) noexcept : _block(other._block) { other._block = nullptr; }
+    ~PacketBuffer() { release(); }
+
+    PacketBuffer& operator=(const PacketBuffer& other);
+    PacketBuffer& operator=(PacketBuffer&& other) noexcept;
+
+    /// Returns a buffer of at least size bytes. When zeroed, the first size bytes are cleared.
+    static PacketBuffer allocate(qint64 size, bool zeroed = false);
+
+    /// Takes ownership of a buffer allocated with new[], which is deleted rather than pooled once released.
+    static PacketBuffer adopt(std::unique_ptr<char[]> data, qint64 size);
+
+    char* data() const;
+    qint64 capacity() const;
+    bool isNull() const { return _block == nullptr; }
+    int useCount() const;
+
+    void reset() { release(); }
+
+    static Stats getStats();
+    static void resetStats();
+
+private:
+    struct Block;
+    struct Pool;
+
+    static Pool& pool();
+
+    explicit PacketBuffer(Block* block) : _block(block) {}
+    void release();
+
+    Block* _block { nullptr };
+};
+
+} // namespace udt
+
+#endif // hifi_PacketBuffer_h
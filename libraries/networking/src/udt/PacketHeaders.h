@@ -140,6 +140,7 @@ public:
         StopInjector,
         AvatarZonePresence,
         WebRTCSignaling,
+        BulkAvatarPositions,
         NUM_PACKET_TYPE
     };
 
@@ -314,7 +315,9 @@ enum class AssetServerPacketVersion: PacketVersion {
     VegasCongestionControl = 19,
     RangeRequestSupport,
     RedirectedMappings,
-    BakingTextureMeta
+    BakingTextureMeta,
+    ChunkManifests,
+    AssetSizeInGetReply
 };
 
 enum class AvatarMixerPacketVersion : PacketVersion {
@@ -355,7 +358,9 @@ enum class AvatarMixerPacketVersion : PacketVersion {
     FBXJointOrderChange,
     HandControllerSection,
     SendVerificationFailed,
-    ARKitBlendshapes
+    ARKitBlendshapes,
+    CompressedJointData,
+    BatchedAvatarPositions
 };
 
 enum class DomainConnectRequestVersion : PacketVersion {
@@ -43,6 +43,9 @@ public:
     size_t getDataSize() const;
     size_t getMessageSize() const;
     QByteArray getMessage() const;
+
+    // Direct access to the packets of a received list, use responsibly!
+    const std::list<std::unique_ptr<Packet>>& getPackets() const { return _packets; }
     
     QByteArray getExtendedHeader() const { return _extendedHeader; }
     
@@ -14,7 +14,6 @@
 #define hifi_SendQueue_h
 
 #include <atomic>
-#include <condition_variable>
 #include <cstdint>
 #include <list>
 #include <memory>
@@ -40,6 +39,8 @@ class ControlPacket;
 class Packet;
 class PacketList;
 class Socket;
+class SendQueuePacer;
+class SendQueueScheduler;
     
 class SendQueue : public QObject {
     Q_OBJECT
@@ -86,14 +87,22 @@ signals:
 
     void timeout();
     
-private slots:
-    void run();
-    
 private:
+    friend class SendQueuePacer;
+
+    struct NextStep {
+        p_high_resolution_clock::time_point time;
+        bool canWakeEarly { false }; // waiting on the other side rather than pacing, wake() runs the step right away
+    };
+
     Q_DISABLE_COPY_MOVE(SendQueue)
     SendQueue(Socket* socket, SockAddr dest, SequenceNumber currentSequenceNumber,
               MessageNumber currentMessageNumber, bool hasReceivedHandshakeACK);
     
+    // Runs one iteration of the send loop on a pacing thread, returns false once the queue has stopped
+    bool step(NextStep& next);
+    void wake(); // asks the scheduler to run a waiting step now
+
     void sendHandshake();
     
     int sendPacket(const Packet& packet);
@@ -102,7 +111,7 @@ private:
     int maybeSendNewPacket(); // Figures out what packet to send next
     bool maybeResendPacket(); // Determines whether to resend a packet and which one
     
-    bool isInactive(bool attemptedToSendPacket);
+    bool waitIfInactive(bool attemptedToSendPacket, NextStep& next);
     void deactivate(); // makes the queue inactive and cleans it up
 
     bool isFlowWindowFull() const;
@@ -134,14 +143,18 @@ private:
     using PacketResendPair = std::pair<uint8_t, std::unique_ptr<Packet>>; // Number of resend + packet ptr
     std::unordered_map<SequenceNumber, PacketResendPair> _sentPackets; // Packets waiting for ACK.
     
-    std::mutex _handshakeMutex; // Protects the handshake ACK condition_variable
     std::atomic<bool> _hasReceivedHandshakeACK { false }; // flag for receipt of handshake ACK from client
-    std::condition_variable _handshakeACKCondition;
-    
-    std::condition_variable_any _emptyCondition;
 
     std::chrono::high_resolution_clock::time_point _lastPacketSentAt;
 
+    // Only touched by step()
+    p_high_resolution_clock::time_point _nextHandshakeAt; // when to re-send the handshake
+    p_high_resolution_clock::time_point _nextPacketTimestamp; // when the next packet should go out, zero until we start
+    p_high_resolution_clock::time_point _emptySince; // start of the wait for new packets, zero when not waiting
+    p_high_resolution_clock::time_point _waitingForACKSince; // start of the wait for ACKs, zero when not waiting
+
+    std::shared_ptr<SendQueueScheduler> _scheduler;
+
     static const std::chrono::microseconds MAXIMUM_ESTIMATED_TIMEOUT;
     static const std::chrono::microseconds MINIMUM_ESTIMATED_TIMEOUT;
 };
@@ -0,0 +1,294 @@
+//
+//  SendQueueScheduler.cpp
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "SendQueueScheduler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QThread>
+
+#include <PortableHighResolutionClock.h>
+#include <ThreadHelpers.h>
+
+#include "SendQueue.h"
+
+using namespace udt;
+using namespace std::chrono;
+
+static const int MAX_PACING_THREADS = 4;
+
+// upper bound for the time a pacing thread goes without delivering the queued slot calls of its queues
+static const microseconds MAX_IDLE_WAIT = milliseconds(100);
+
+namespace udt {
+
+class SendQueuePacer : public QThread {
+public:
+    using Clock = p_high_resolution_clock;
+
+    SendQueuePacer(SendQueueScheduler& scheduler, int index) : _scheduler(scheduler) {
+        setObjectName(QString("Networking: SendQueue Pacer %1").arg(index));
+    }
+
+    int getQueueCount() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _queueCount;
+    }
+
+    void schedule(SendQueue* queue) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _queueCount++;
+        _scheduled[queue] = _deadlines.emplace(Clock::now(), Entry { queue, true });
+        _condition.notify_all();
+    }
+
+    void wake(SendQueue* queue) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_running == queue) {
+            // the step in progress may have missed what woke us, run the next one right away if it ends up waiting
+            _runningWoken = true;
+            return;
+        }
+
+        auto it = _scheduled.find(queue);
+        if (it == _scheduled.end() || !it->second->second.canWakeEarly) {
+            return;
+        }
+
+        auto now = Clock::now();
+        if (it->second->first > now) {
+            _deadlines.erase(it->second);
+            it->second = _deadlines.emplace(now, Entry { queue, true });
+            _condition.notify_all();
+        }
+    }
+
+    void release(SendQueue* queue, QThread* target) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (_finished) {
+            // nothing can run the queue anymore, it stays in this thread like it did with a dedicated send thread
+            unschedule(queue);
+            _queueCount--;
+            return;
+        }
+        // only this thread can move the queue out of it, and only in between two steps
+        _releases[queue] = target;
+        _condition.notify_all();
+        _condition.wait(lock, [&] { return _releases.find(queue) == _releases.end(); });
+    }
+
+    void requestStop() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+        _condition.notify_all();
+    }
+
+protected:
+    void run() override {
+        setThreadName(objectName().toStdString());
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true) {
+            releasePendingQueues();
+            if (_stopping) {
+                break;
+            }
+
+            // deliver the queued slot calls of our queues, they must not run concurrently with a step
+            lock.unlock();
+            QCoreApplication::sendPostedEvents();
+            lock.lock();
+
+            releasePendingQueues();
+            if (_stopping) {
+                break;
+            }
+
+            auto now = Clock::now();
+            if (_deadlines.empty() || _deadlines.begin()->first > now) {
+                auto wait = MAX_IDLE_WAIT;
+                if (!_deadlines.empty()) {
+                    wait = std::min(wait, duration_cast<microseconds>(_deadlines.begin()->first - now));
+                }
+                _condition.wait_for(lock, wait);
+                continue;
+            }
+
+            // earliest deadline first: queues that fell behind get to send before the ones that are on time
+            auto next = _deadlines.begin();
+            auto deadline = next->first;
+            SendQueue* queue = next->second.queue;
+            _scheduled.erase(queue);
+            _deadlines.erase(next);
+            _running = queue;
+            _runningWoken = false;
+            lock.unlock();
+
+            _scheduler.trackLag(duration_cast<microseconds>(now - deadline).count());
+            SendQueue::NextStep nextStep;
+            bool keepRunning = queue->step(nextStep);
+
+            lock.lock();
+            _running = nullptr;
+            if (keepRunning) {
+                auto time = (_runningWoken && nextStep.canWakeEarly) ? Clock::now() : nextStep.time;
+                _scheduled[queue] = _deadlines.emplace(time, Entry { queue, nextStep.canWakeEarly });
+            }
+        }
+
+        releasePendingQueues();
+        _deadlines.clear();
+        _scheduled.clear();
+        _finished = true;
+    }
+
+private:
+    struct Entry {
+        SendQueue* queue;
+        bool canWakeEarly;
+    };
+    using Deadlines = std::multimap<Clock::time_point, Entry>;
+
+    void releasePendingQueues() {
+        if (_releases.empty()) {
+            return;
+        }
+        for (const auto& release : _releases) {
+            unschedule(release.first);
+            release.first->moveToThread(release.second);
+            _queueCount--;
+        }
+        _releases.clear();
+        _condition.notify_all();
+    }
+
+    void unschedule(SendQueue* queue) {
+        auto it = _scheduled.find(queue);
+        if (it != _scheduled.end()) {
+            _deadlines.erase(it->second);
+            _scheduled.erase(it);
+        }
+    }
+
+    SendQueueScheduler& _scheduler;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _condition;
+    Deadlines _deadlines;
+    std::unordered_map<SendQueue*, Deadlines::iterator> _scheduled;
+    std::unordered_map<SendQueue*, QThread*> _releases;
+    SendQueue* _running { nullptr };
+    bool _runningWoken { false };
+    int _queueCount { 0 };
+    bool _stopping { false };
+    bool _finished { false };
+};
+
+}
+
+static std::mutex instanceMutex;
+static std::weak_ptr<SendQueueScheduler> sharedInstance;
+
+std::shared_ptr<SendQueueScheduler> SendQueueScheduler::getInstance() {
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    auto instance = sharedInstance.lock();
+    if (!instance) {
+        instance = std::make_shared<SendQueueScheduler>(std::min(QThread::idealThreadCount() / 2, MAX_PACING_THREADS));
+        sharedInstance = instance;
+    }
+    return instance;
+}
+
+SendQueueScheduler::Stats SendQueueScheduler::getSharedStats() {
+    std::shared_ptr<SendQueueScheduler> instance;
+    {
+        std::lock_guard<std::mutex> lock(instanceMutex);
+        instance = sharedInstance.lock();
+    }
+    return instance ? instance->getStats() : Stats();
+}
+
+SendQueueScheduler::SendQueueScheduler(int threadCount) {
+    threadCount = std::max(1, threadCount);
+    for (int i = 0; i < threadCount; i++) {
+        _pacers.emplace_back(new SendQueuePacer(*this, i));
+        _pacers.back()->start();
+    }
+}
+
+SendQueueScheduler::~SendQueueScheduler() {
+    for (const auto& pacer : _pacers) {
+        pacer->requestStop();
+    }
+    for (const auto& pacer : _pacers) {
+        pacer->wait();
+    }
+}
+
+void SendQueueScheduler::add(SendQueue* queue) {
+    std::lock_guard<std::mutex> lock(_assignmentsMutex);
+    auto pacer = std::min_element(_pacers.begin(), _pacers.end(), [](const auto& a, const auto& b) {
+        return a->getQueueCount() < b->getQueueCount();
+    });
+    queue->moveToThread(pacer->get());
+    _assignments[queue] = pacer->get();
+    (*pacer)->schedule(queue);
+}
+
+void SendQueueScheduler::remove(SendQueue* queue) {
+    SendQueuePacer* pacer = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_assignmentsMutex);
+        auto it = _assignments.find(queue);
+        if (it == _assignments.end()) {
+            return;
+        }
+        pacer = it->second;
+        _assignments.erase(it);
+    }
+    Q_ASSERT_X(QThread::currentThread() != pacer, "SendQueueScheduler::remove", "Cannot be called from a pacing thread");
+    pacer->release(queue, QThread::currentThread());
+}
+
+void SendQueueScheduler::wake(SendQueue* queue) {
+    SendQueuePacer* pacer = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_assignmentsMutex);
+        auto it = _assignments.find(queue);
+        if (it == _assignments.end()) {
+            return;
+        }
+        pacer = it->second;
+    }
+    pacer->wake(queue);
+}
+
+SendQueueScheduler::Stats SendQueueScheduler::getStats() const {
+    Stats stats;
+    stats.threadCount = (int)_pacers.size();
+    for (const auto& pacer : _pacers) {
+        stats.queueCount += pacer->getQueueCount();
+    }
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    stats.averageLagUsecs = _averageLag.getAverage();
+    stats.maxLagUsecs = _maxLag;
+    return stats;
+}
+
+void SendQueueScheduler::trackLag(quint64 lagUsecs) {
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    _averageLag.updateAverage((float)lagUsecs);
+    _maxLag = std::max(_maxLag, lagUsecs);
+}
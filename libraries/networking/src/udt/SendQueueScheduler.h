@@ -0,0 +1,84 @@
+//
+//  SendQueueScheduler.h
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Small pool of pacing threads driving the SendQueues of all reliable connections
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_SendQueueScheduler_h
+#define hifi_SendQueueScheduler_h
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <QtCore/QtGlobal>
+
+#include <SimpleMovingAverage.h>
+
+namespace udt {
+
+class SendQueue;
+class SendQueuePacer;
+
+/// Runs the send loops of every SendQueue on a few pacing threads, instead of one sleeping thread per connection.
+///
+/// A queue is pinned to the least loaded pacing thread when it is added and is moved to that thread, so its queued slots
+/// are still delivered in between two of its steps. Each pacing thread keeps a deadline heap and runs the queue whose next
+/// packet is due first. Deadlines of queues that are waiting for a handshake ACK, an ACK or new packets are brought
+/// forward by wake(); pacing deadlines, which come from the congestion control send period, are never shortened.
+///
+/// The scheduler is shared by all queues and its threads only exist while at least one queue holds on to it.
+class SendQueueScheduler {
+public:
+    struct Stats {
+        int threadCount { 0 };
+        int queueCount { 0 };
+        float averageLagUsecs { 0.0f }; // how late a step runs compared to its deadline
+        quint64 maxLagUsecs { 0 };
+    };
+
+    static std::shared_ptr<SendQueueScheduler> getInstance();
+
+    /// Stats of the shared scheduler, or empty stats if no queue is running.
+    static Stats getSharedStats();
+
+    explicit SendQueueScheduler(int threadCount);
+    ~SendQueueScheduler();
+
+    /// Schedules a queue; it must live in the calling thread, and runs its first step right away.
+    void add(SendQueue* queue);
+
+    /// Unschedules a queue and gives it back to the calling thread. Blocks while the queue is running a step, so the queue
+    /// can be deleted once this returns.
+    void remove(SendQueue* queue);
+
+    /// Runs the next step of a waiting queue now. Thread-safe.
+    void wake(SendQueue* queue);
+
+    Stats getStats() const;
+
+    void trackLag(quint64 lagUsecs);
+
+private:
+    std::vector<std::unique_ptr<SendQueuePacer>> _pacers;
+
+    std::unordered_map<SendQueue*, SendQueuePacer*> _assignments;
+    mutable std::mutex _assignmentsMutex;
+
+    // every pacer tracks its lag concurrently with getStats()
+    mutable std::mutex _statsMutex;
+    SimpleMovingAverage _averageLag;
+    quint64 _maxLag { 0 };
+};
+
+}
+
+#endif // hifi_SendQueueScheduler_h
@@ -405,11 +405,11 @@ void Socket::readPendingDatagrams() {
         // setup a SockAddr to read into
         SockAddr senderSockAddr;
 
-        // setup a buffer to read the packet into
-        auto buffer = std::unique_ptr<char[]>(new char[packetSizeWithHeader]);
+        // setup a buffer to read the packet into, recycled from the packet pool when possible
+        auto buffer = PacketBuffer::allocate(packetSizeWithHeader);
 
         // pull the datagram
-        auto sizeRead = _networkSocket.readDatagram(buffer.get(), packetSizeWithHeader, &senderSockAddr);
+        auto sizeRead = _networkSocket.readDatagram(buffer.data(), packetSizeWithHeader, &senderSockAddr);
 
         // save information for this packet, in case it is the one that sticks readyRead
         _lastPacketSizeRead = sizeRead;
@@ -435,7 +435,7 @@ void Socket::readPendingDatagrams() {
         }
 
         // check if this was a control packet or a data packet
-        bool isControlPacket = *reinterpret_cast<uint32_t*>(buffer.get()) & CONTROL_BIT_MASK;
+        bool isControlPacket = *reinterpret_cast<uint32_t*>(buffer.data()) & CONTROL_BIT_MASK;
 
         if (isControlPacket) {
             // setup a control packet from the data we just read
@@ -19,6 +19,8 @@
 #include <QHash>
 #include <QObject>
 #include <QtCore/QJsonObject>
+#include <QUuid>
+#include <QVector>
 
 #include <shared/ReadWriteLockable.h>
 #include <SimpleMovingAverage.h>
@@ -122,6 +124,16 @@ public:
     {}
 };
 
+/// An inbound edit that was decoded and validated by Octree::prepareEditPacketData(), and is waiting to be committed
+class OctreeEdit {
+public:
+    virtual ~OctreeEdit() = default;
+
+    /// Items this edit reads or writes. Edits that share an item are committed in the order they were received.
+    QVector<QUuid> itemIDs;
+};
+using OctreeEditPointer = std::unique_ptr<OctreeEdit>;
+
 class Octree : public QObject, public std::enable_shared_from_this<Octree>, public ReadWriteLockable {
     Q_OBJECT
 public:
@@ -139,6 +151,17 @@ public:
     virtual int processEditPacketData(ReceivedMessage& message, const unsigned char* editData, int maxLength,
                                       const SharedNodePointer& sourceNode) { return 0; }
 
+    // Implement these as well to let the OctreeServer decode and validate edits on several threads, and only take the
+    // write lock to commit them. Each edit is decoded by prepareEditPacketData(), then checked against the tree by
+    // validateEdit(), then applied by commitEdit(), exactly once each. The first two are called with at least the read
+    // lock held, except that an edit sharing an item with an earlier edit is validated with the write lock held, right
+    // before it is committed. commitEdit() is always called with the write lock.
+    virtual bool canPrepareEdits() const { return false; }
+    virtual int prepareEditPacketData(ReceivedMessage& message, const unsigned char* editData, int maxLength,
+                                      const SharedNodePointer& sourceNode, OctreeEditPointer& edit) { return 0; }
+    virtual void validateEdit(OctreeEdit& edit) { }
+    virtual void commitEdit(OctreeEdit& edit) { }
+
     virtual bool rootElementHasData() const { return false; }
     virtual void releaseSceneEncodeData(OctreeElementExtraEncodeData* extraEncodeData) const { }
 
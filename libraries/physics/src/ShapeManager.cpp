@@ -12,12 +12,16 @@
 #include "ShapeManager.h"
 
 #include <glm/gtx/norm.hpp>
-#include <QThreadPool>
 
 #include <NumericalConstants.h>
+#include <ResourceLoadScheduler.h>
 
 const int MAX_RING_SIZE = 256;
 
+// Objects waiting on a mesh shape stay out of the simulation, which needs the shape by its next step, so the shape is
+// built ahead of every resource load, the skybox and anim graphs at priority 10 included.
+const float MESH_SHAPE_PRIORITY = 11.0f;
+
 ShapeManager::ShapeManager() {
     _garbageRing.reserve(MAX_RING_SIZE);
     _nextOrphanExpiry = std::chrono::steady_clock::now();
@@ -67,9 +71,9 @@ const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
                 _deadWorker = nullptr;
             }
             // we will delete worker manually later
-            worker->setAutoDelete(false);
             QObject::connect(worker, &ShapeFactory::Worker::submitWork, this, &ShapeManager::acceptWork);
-            QThreadPool::globalInstance()->start(worker);
+            ResourceLoadScheduler::getInstance().schedule(ResourceLoadScheduler::CPU, [worker] { worker->run(); },
+                                                          [] { return MESH_SHAPE_PRIORITY; });
         }
         // else we're still waiting for the shape to be created on another thread
     } else {
@@ -16,23 +16,48 @@
 #include "Logging.h"
 
 using namespace recording;
-NetworkClipLoader::NetworkClipLoader(const QUrl& url) :
+NetworkClipLoader::NetworkClipLoader(const QUrl& url, const std::shared_ptr<MappedFileCache>& sharedCache) :
     Resource(url),
-    _clip(std::make_shared<NetworkClip>(url)) {
+    _clip(std::make_shared<NetworkClip>(url)),
+    _sharedCache(sharedCache) {
     if (url.isEmpty()) {
         _loaded = false;
         _startedLoading = false;
         _failedToLoad = true;
+    } else if (_sharedCache) {
+        // another process already downloaded this recording
+        auto mapping = _sharedCache->find(url.toString());
+        if (mapping) {
+            _clip->init(mapping);
+            _startedLoading = true;
+            _loaded = true;
+        }
     }
 }
 
 void NetworkClip::init(const QByteArray& clipData) {
     _clipData = clipData;
     PointerClip::init((uchar*)_clipData.data(), _clipData.size());
+    _mapping.reset();
+}
+
+void NetworkClip::init(const MappedFilePointer& mapping) {
+    // the clip only ever reads from its data
+    PointerClip::init(const_cast<uchar*>(mapping->data()), mapping->size());
+    _mapping = mapping;
+    _clipData.clear();
 }
 
 void NetworkClipLoader::downloadFinished(const QByteArray& data) {
-    _clip->init(data);
+    MappedFilePointer mapping;
+    if (_sharedCache) {
+        mapping = _sharedCache->insert(_url.toString(), data);
+    }
+    if (mapping) {
+        _clip->init(mapping);
+    } else {
+        _clip->init(data);
+    }
     finishedLoading(true);
     emit clipLoaded();
 }
@@ -43,6 +68,10 @@ ClipCache::ClipCache(QObject* parent) :
     
 }
 
+void ClipCache::setSharedCacheDirectory(const QString& directory) {
+    _sharedCache = directory.isEmpty() ? nullptr : std::make_shared<MappedFileCache>(directory);
+}
+
 NetworkClipLoaderPointer ClipCache::getClipLoader(const QUrl& url) {
     if (QThread::currentThread() != thread()) {
         NetworkClipLoaderPointer result;
@@ -56,7 +85,7 @@ NetworkClipLoaderPointer ClipCache::getClipLoader(const QUrl& url) {
 
 QSharedPointer<Resource> ClipCache::createResource(const QUrl& url) {
     qCDebug(recordingLog) << "Loading recording at" << url;
-    return QSharedPointer<NetworkClipLoader>(new NetworkClipLoader(url), &Resource::deleter);
+    return QSharedPointer<NetworkClipLoader>(new NetworkClipLoader(url, _sharedCache), &Resource::deleter);
 }
 
 QSharedPointer<Resource> ClipCache::createResourceCopy(const QSharedPointer<Resource>& resource) {
@@ -9,8 +9,11 @@
 #ifndef hifi_Recording_ClipCache_h
 #define hifi_Recording_ClipCache_h
 
+#include <memory>
+
 #include <QtCore/QSharedPointer>
 
+#include <MappedFileCache.h>
 #include <ResourceCache.h>
 
 #include "Forward.h"
@@ -24,18 +27,21 @@ public:
 
     NetworkClip(const QUrl& url) : _url(url) {}
     virtual void init(const QByteArray& clipData);
+    void init(const MappedFilePointer& mapping);
     virtual QString getName() const override { return _url.toString(); }
 
 private:
     QByteArray _clipData;
+    MappedFilePointer _mapping;
     QUrl _url;
 };
 
 class NetworkClipLoader : public Resource {
     Q_OBJECT
 public:
-    NetworkClipLoader(const QUrl& url);
-    NetworkClipLoader(const NetworkClipLoader& other) : Resource(other), _clip(other._clip) {}
+    NetworkClipLoader(const QUrl& url, const std::shared_ptr<MappedFileCache>& sharedCache = nullptr);
+    NetworkClipLoader(const NetworkClipLoader& other) :
+        Resource(other), _clip(other._clip), _sharedCache(other._sharedCache) {}
 
     virtual void downloadFinished(const QByteArray& data) override;
     ClipPointer getClip() { return _clip; }
@@ -46,6 +52,7 @@ signals:
 
 private:
     const NetworkClip::Pointer _clip;
+    const std::shared_ptr<MappedFileCache> _sharedCache;
 };
 
 using NetworkClipLoaderPointer = QSharedPointer<NetworkClipLoader>;
@@ -54,6 +61,13 @@ class ClipCache : public ResourceCache, public Dependency {
     Q_OBJECT
     SINGLETON_DEPENDENCY
     
+public:
+    /// Keeps downloaded recordings in a directory shared with the other processes of this machine and plays them from a
+    /// read-only mapping, so agents running the same recording share one copy of it. Recordings found there are not
+    /// downloaded again. Must be called before the first clip is loaded.
+    void setSharedCacheDirectory(const QString& directory);
+    std::shared_ptr<MappedFileCache> getSharedCache() const { return _sharedCache; }
+
 public slots:
     NetworkClipLoaderPointer getClipLoader(const QUrl& url);
 
@@ -63,6 +77,8 @@ protected:
 
 private:
     ClipCache(QObject* parent = nullptr);
+
+    std::shared_ptr<MappedFileCache> _sharedCache;
 };
 
 }
@@ -1535,6 +1535,7 @@ void Model::deleteGeometry() {
     _meshStates.clear();
     _rig.destroyAnimGraph();
     _blendedBlendshapeCoefficients.clear();
+    _blendshapes.reset();
     _renderGeometry.reset();
 }
 
@@ -1818,7 +1819,7 @@ static void packBlendshapeOffsetTo_Pos_F32_3xSN10_Nor_3xSN10_Tan_3xSN10(glm::uve
     );
 }
 
-static void packBlendshapeOffsets_ref(BlendshapeOffsetUnpacked* unpacked, BlendshapeOffsetPacked* packed, int size) {
+static void packBlendshapeOffsets_ref(const BlendshapeOffsetUnpacked* unpacked, BlendshapeOffsetPacked* packed, int size) {
     for (int i = 0; i < size; ++i) {
         packBlendshapeOffsetTo_Pos_F32_3xSN10_Nor_3xSN10_Tan_3xSN10((*packed).packedPosNorTan, (*unpacked));
         ++unpacked;
@@ -1834,7 +1835,7 @@ static void packBlendshapeOffsets_ref(BlendshapeOffsetUnpacked* unpacked, Blends
 
 void packBlendshapeOffsets_AVX2(float (*unpacked)[9], uint32_t (*packed)[4], int size);
 
-static void packBlendshapeOffsets(BlendshapeOffsetUnpacked* unpacked, BlendshapeOffsetPacked* packed, int size) {
+static void packBlendshapeOffsets(const BlendshapeOffsetUnpacked* unpacked, BlendshapeOffsetPacked* packed, int size) {
     static bool _cpuSupportsAVX2 = cpuSupportsAVX2();
     if (_cpuSupportsAVX2) {
         static_assert(sizeof(BlendshapeOffsetUnpacked) == 9 * sizeof(float), "struct BlendshapeOffsetUnpacked size doesn't match.");
@@ -1849,95 +1850,79 @@ static void packBlendshapeOffsets(BlendshapeOffsetUnpacked* unpacked, Blendshape
 static auto& packBlendshapeOffsets = packBlendshapeOffsets_ref;
 #endif
 
+// The blendshape offsets of a model, blended from the layout its geometry shares with every other model of it
+class ModelBlendshapes {
+public:
+    ModelBlendshapes(Geometry::Pointer geometry) : _geometry(geometry) {}
+
+    const Geometry::Pointer& getGeometry() const { return _geometry; }
+
+    void blend(const QVector<float>& coefficients, QVector<BlendshapeOffset>& packedOffsets, QVector<int>& blendedMeshSizes);
+
+private:
+    Geometry::Pointer _geometry;
+
+    std::mutex _mutex;
+    std::unique_ptr<hfm::BlendshapeAccumulator> _accumulator;
+};
+
+void ModelBlendshapes::blend(const QVector<float>& coefficients, QVector<BlendshapeOffset>& packedOffsets,
+                             QVector<int>& blendedMeshSizes) {
+    // blends of the same model can overlap, but the offsets can only move from one set of coefficients at a time
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (!_accumulator) {
+        _accumulator.reset(new hfm::BlendshapeAccumulator(_geometry->getBlendshapeLayout()));
+    }
+    _accumulator->blend(coefficients);
+
+    // convert the offsets for the gpu
+    const auto& meshes = _accumulator->getLayout()->getMeshes();
+    int numBlendshapeOffsets = 0;
+    blendedMeshSizes.reserve((int)meshes.size());
+    for (const auto& mesh : meshes) {
+        blendedMeshSizes.push_back(mesh.numVertices);
+        numBlendshapeOffsets += mesh.numVertices;
+    }
+    packedOffsets.resize(numBlendshapeOffsets);
+
+    const auto& offsets = _accumulator->getOffsets();
+    int offset = 0;
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        if (meshes[i].numVertices > 0) {
+            packBlendshapeOffsets(offsets[i].data(), packedOffsets.data() + offset, meshes[i].numVertices);
+            offset += meshes[i].numVertices;
+        }
+    }
+}
+
 class Blender : public QRunnable {
 public:
 
-    Blender(ModelPointer model, HFMModel::ConstPointer hfmModel, int blendNumber, const QVector<float>& blendshapeCoefficients);
+    Blender(ModelPointer model, std::shared_ptr<ModelBlendshapes> blendshapes, int blendNumber, const QVector<float>& blendshapeCoefficients);
 
     virtual void run() override;
 
 private:
     ModelPointer _model;
-    HFMModel::ConstPointer _hfmModel;
+    std::shared_ptr<ModelBlendshapes> _blendshapes;
     int _blendNumber;
     QVector<float> _blendshapeCoefficients;
 };
 
-Blender::Blender(ModelPointer model, HFMModel::ConstPointer hfmModel, int blendNumber, const QVector<float>& blendshapeCoefficients) :
+Blender::Blender(ModelPointer model, std::shared_ptr<ModelBlendshapes> blendshapes, int blendNumber, const QVector<float>& blendshapeCoefficients) :
     _model(model),
-    _hfmModel(hfmModel),
+    _blendshapes(blendshapes),
     _blendNumber(blendNumber),
     _blendshapeCoefficients(blendshapeCoefficients) {
 }
 
 void Blender::run() {
     DETAILED_PROFILE_RANGE_EX(simulation_animation, __FUNCTION__, 0xFFFF0000, 0, { { "url", _model->getURL().toString() } });
-    int numBlendshapeOffsets = 0;  // number of offsets required for all meshes.
-    int maxBlendshapeOffsets = 0;  // number of offsets in the largest mesh.
-    int numMeshes = 0;  // number of meshes in this model.
-    for (auto meshIter = _hfmModel->meshes.cbegin(); meshIter != _hfmModel->meshes.cend(); ++meshIter) {
-        numMeshes++;
-        if (meshIter->blendshapes.isEmpty()) {
-            continue;
-        }
-        int numVertsInMesh = meshIter->vertices.size();
-        numBlendshapeOffsets += numVertsInMesh;
-        maxBlendshapeOffsets = std::max(maxBlendshapeOffsets, numVertsInMesh);
-    }
 
-    // allocate the required sizes
     QVector<int> blendedMeshSizes;
-    blendedMeshSizes.reserve(numMeshes);
-
     QVector<BlendshapeOffset> packedBlendshapeOffsets;
-    packedBlendshapeOffsets.resize(numBlendshapeOffsets);
-
-    QVector<BlendshapeOffsetUnpacked> unpackedBlendshapeOffsets;
-    unpackedBlendshapeOffsets.resize(maxBlendshapeOffsets);    // reuse for all meshes
-
-    int offset = 0;
-    for (auto meshIter = _hfmModel->meshes.cbegin(); meshIter != _hfmModel->meshes.cend(); ++meshIter) {
-        if (meshIter->blendshapes.isEmpty()) {
-            blendedMeshSizes.push_back(0);
-            continue;
-        }
-        int numVertsInMesh = meshIter->vertices.size();
-        blendedMeshSizes.push_back(numVertsInMesh);
-
-        // initialize offsets to zero
-        memset(unpackedBlendshapeOffsets.data(), 0, numVertsInMesh * sizeof(BlendshapeOffsetUnpacked));
-
-        // for each blendshape in this mesh, accumulate the offsets into unpackedBlendshapeOffsets.
-        const float NORMAL_COEFFICIENT_SCALE = 0.01f;
-        for (int i = 0, n = qMin(_blendshapeCoefficients.size(), meshIter->blendshapes.size()); i < n; i++) {
-            float vertexCoefficient = _blendshapeCoefficients.at(i);
-            const float EPSILON = 0.0001f;
-            if (vertexCoefficient < EPSILON) {
-                continue;
-            }
-
-            float normalCoefficient = vertexCoefficient * NORMAL_COEFFICIENT_SCALE;
-            const HFMBlendshape& blendshape = meshIter->blendshapes.at(i);
-            for (int j = 0; j < blendshape.indices.size(); ++j) {
-                int index = blendshape.indices.at(j);
-
-                auto& currentBlendshapeOffset = unpackedBlendshapeOffsets[index];
-                currentBlendshapeOffset.positionOffset += blendshape.vertices.at(j) * vertexCoefficient;
-                currentBlendshapeOffset.normalOffset += blendshape.normals.at(j) * normalCoefficient;
-                if (j < blendshape.tangents.size()) {
-                    currentBlendshapeOffset.tangentOffset += blendshape.tangents.at(j) * normalCoefficient;
-                }
-            }
-        }
-
-        // convert unpackedBlendshapeOffsets into packedBlendshapeOffsets for the gpu.
-        auto unpacked = unpackedBlendshapeOffsets.data();
-        auto packed = packedBlendshapeOffsets.data() + offset;
-        packBlendshapeOffsets(unpacked, packed, numVertsInMesh);
-
-        offset += numVertsInMesh;
-    }
-    Q_ASSERT(offset == numBlendshapeOffsets);
+    _blendshapes->blend(_blendshapeCoefficients, packedBlendshapeOffsets, blendedMeshSizes);
 
     // post the result to the ModelBlender, which will dispatch to the model if still alive
     QMetaObject::invokeMethod(DependencyManager::get<ModelBlender>().data(), "setBlendedVertices",
@@ -1948,8 +1933,11 @@ void Blender::run() {
 
 bool Model::maybeStartBlender() {
     if (isLoaded()) {
-        QThreadPool::globalInstance()->start(new Blender(getThisPointer(), getGeometry()->getConstHFMModelPointer(),
-                                                         ++_blendNumber, _blendshapeCoefficients));
+        if (!_blendshapes || _blendshapes->getGeometry() != getGeometry()) {
+            _blendshapes = std::make_shared<ModelBlendshapes>(getGeometry());
+        }
+        QThreadPool::globalInstance()->start(new Blender(getThisPointer(), _blendshapes, ++_blendNumber,
+                                                         _blendshapeCoefficients));
         return true;
     }
     return false;
@@ -58,6 +58,7 @@ namespace render {
 class MeshPartPayload;
 class ModelMeshPartPayload;
 class ModelRenderLocations;
+class ModelBlendshapes;
 
 inline uint qHash(const std::shared_ptr<MeshPartPayload>& a, uint seed) {
     return qHash(a.get(), seed);
@@ -443,6 +444,7 @@ protected:
     BlendShapeOperator _modelBlendshapeOperator { nullptr };
     QVector<float> _blendshapeCoefficients;
     QVector<float> _blendedBlendshapeCoefficients;
+    std::shared_ptr<ModelBlendshapes> _blendshapes;
     int _blendNumber { 0 };
 
     mutable QRecursiveMutex _mutex;
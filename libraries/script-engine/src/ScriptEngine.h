@@ -22,6 +22,7 @@
 
 #include <QtCore/QFlags>
 #include <QtCore/QObject>
+#include <QtCore/QVector>
 
 #include "ScriptValue.h"
 #include "ScriptException.h"
@@ -295,6 +296,23 @@ public:
 
     virtual ScriptValue newArray(uint length = 0) = 0;
     virtual ScriptValue newArrayBuffer(const QByteArray& message) = 0;
+
+    /**
+     * @brief Creates a Float32Array holding a copy of the given values
+     *
+     * @param values Values to copy
+     * @return ScriptValue Float32Array
+     */
+    virtual ScriptValue newFloat32Array(const QVector<float>& values) = 0;
+
+    /**
+     * @brief Copies the elements of a typed array or of an array of numbers
+     *
+     * @param value Typed array or array to read
+     * @param values Receives the elements converted to float
+     * @return true if value was an array or a typed array
+     */
+    virtual bool toFloat32Vector(const ScriptValue& value, QVector<float>& values) = 0;
     virtual ScriptValue newFunction(FunctionSignature fun, int length = 0) {
         Q_ASSERT(false);
         return ScriptValue();
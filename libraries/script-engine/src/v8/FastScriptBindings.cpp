@@ -0,0 +1,380 @@
+//
+//  FastScriptBindings.cpp
+//  libraries/script-engine/src/v8
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "FastScriptBindings.h"
+
+#include <atomic>
+#include <cfloat>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <QtCore/QHash>
+#include <QtCore/QPointer>
+#include <QtCore/QReadWriteLock>
+
+#include "../Quat.h"
+#include "../Vec3.h"
+
+#include "FastScriptValueUtils.h"
+#include "ScriptEngineV8.h"
+
+// Value of internal field with index 0 of the data object of a fast method; internal field 1 points to FastScriptMethodV8.
+// See ScriptObjectV8Proxy.cpp for the other values of this kind.
+static const void *internalPointsToFastMethod = (void *)0x13375000;
+
+namespace {
+
+struct PropertyBinding {
+    FastScriptBindings::PropertyGetter getter { nullptr };
+    FastScriptBindings::PropertySetter setter { nullptr };
+};
+
+// Bindings are registered at startup and looked up once per wrapped object, never on the call path itself.
+struct BindingRegistry {
+    QReadWriteLock lock;
+    QHash<QByteArray, FastScriptBindings::MethodCallback> methods;
+    QHash<QByteArray, PropertyBinding> properties;
+};
+
+BindingRegistry& registry() {
+    static BindingRegistry instance;
+    return instance;
+}
+
+std::atomic<bool> fastBindingsEnabled { true };
+
+QByteArray bindingKey(const char* className, const QByteArray& memberName) {
+    return QByteArray(className) + "::" + memberName;
+}
+
+}  // namespace
+
+/// [V8] Native state of a fast method function, deleted when V8 collects the function.
+class FastScriptMethodV8 {
+public:
+    FastScriptMethodV8(ScriptEngineV8* engine, QObject* object, FastScriptBindings::MethodCallback callback) :
+        _engine(engine), _object(object), _callback(callback) {}
+
+    static void callback(const v8::FunctionCallbackInfo<v8::Value>& arguments);
+    static void weakHandleCallback(const v8::WeakCallbackInfo<FastScriptMethodV8>& info);
+
+    ScriptEngineV8* _engine;
+    QPointer<QObject> _object;
+    FastScriptBindings::MethodCallback _callback;
+    v8::Persistent<v8::Function> _genericMethod;
+    v8::Persistent<v8::Function> _function;
+};
+
+void FastScriptMethodV8::callback(const v8::FunctionCallbackInfo<v8::Value>& arguments) {
+    v8::Isolate* isolate = arguments.GetIsolate();
+    v8::HandleScope handleScope(isolate);
+    if (!arguments.Data()->IsObject()) {
+        isolate->ThrowError("Method value is not an object");
+        return;
+    }
+    v8::Local<v8::Object> data = v8::Local<v8::Object>::Cast(arguments.Data());
+    if (data->InternalFieldCount() != 2 || data->GetAlignedPointerFromInternalField(0) != internalPointsToFastMethod) {
+        isolate->ThrowError("Internal fields of fast method data object have wrong values");
+        return;
+    }
+    FastScriptMethodV8* method = reinterpret_cast<FastScriptMethodV8*>(data->GetAlignedPointerFromInternalField(1));
+
+    QObject* object = method->_object;
+    if (object && method->_callback(method->_engine, object, arguments)) {
+        return;
+    }
+
+    // Not handled here: the generic implementation does overload resolution, conversions and error reporting
+    std::vector<v8::Local<v8::Value>> args;
+    args.reserve(arguments.Length());
+    for (int i = 0; i < arguments.Length(); i++) {
+        args.push_back(arguments[i]);
+    }
+    v8::Local<v8::Function> genericMethod = method->_genericMethod.Get(isolate);
+    v8::Local<v8::Value> result;
+    if (genericMethod->Call(isolate->GetCurrentContext(), arguments.This(), static_cast<int>(args.size()), args.data())
+            .ToLocal(&result)) {
+        arguments.GetReturnValue().Set(result);
+    }
+}
+
+void FastScriptMethodV8::weakHandleCallback(const v8::WeakCallbackInfo<FastScriptMethodV8>& info) {
+    FastScriptMethodV8* method = info.GetParameter();
+    method->_function.Reset();
+    method->_genericMethod.Reset();
+    delete method;
+}
+
+void FastScriptBindings::registerMethod(const QByteArray& className, const QByteArray& methodName, MethodCallback callback) {
+    QWriteLocker locker(&registry().lock);
+    registry().methods.insert(bindingKey(className.constData(), methodName), callback);
+}
+
+void FastScriptBindings::registerProperty(const QByteArray& className, const QByteArray& propertyName,
+                                          PropertyGetter getter, PropertySetter setter) {
+    QWriteLocker locker(&registry().lock);
+    PropertyBinding binding;
+    binding.getter = getter;
+    binding.setter = setter;
+    registry().properties.insert(bindingKey(className.constData(), propertyName), binding);
+}
+
+FastScriptBindings::MethodCallback FastScriptBindings::findMethod(const QMetaObject* metaObject, const QByteArray& methodName) {
+    if (!isEnabled()) {
+        return nullptr;
+    }
+    QReadLocker locker(&registry().lock);
+    for (const QMetaObject* current = metaObject; current; current = current->superClass()) {
+        auto lookup = registry().methods.constFind(bindingKey(current->className(), methodName));
+        if (lookup != registry().methods.cend()) {
+            return lookup.value();
+        }
+    }
+    return nullptr;
+}
+
+bool FastScriptBindings::findProperty(const QMetaObject* metaObject, const QByteArray& propertyName,
+                                      PropertyGetter& getter, PropertySetter& setter) {
+    if (!isEnabled()) {
+        return false;
+    }
+    QReadLocker locker(&registry().lock);
+    for (const QMetaObject* current = metaObject; current; current = current->superClass()) {
+        auto lookup = registry().properties.constFind(bindingKey(current->className(), propertyName));
+        if (lookup != registry().properties.cend()) {
+            getter = lookup.value().getter;
+            setter = lookup.value().setter;
+            return true;
+        }
+    }
+    return false;
+}
+
+V8ScriptValue FastScriptBindings::newMethod(ScriptEngineV8* engine, QObject* object, MethodCallback callback,
+                                            const V8ScriptValue& genericMethod, int numMaxParams) {
+    auto isolate = engine->getIsolate();
+    v8::Locker locker(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope handleScope(isolate);
+    v8::Context::Scope contextScope(engine->getContext());
+    Q_ASSERT(genericMethod.constGet()->IsFunction());
+
+    FastScriptMethodV8* method = new FastScriptMethodV8(engine, object, callback);
+    auto methodData = engine->getMethodDataTemplate()->NewInstance(engine->getContext()).ToLocalChecked();
+    methodData->SetAlignedPointerInInternalField(0, const_cast<void*>(internalPointsToFastMethod));
+    methodData->SetAlignedPointerInInternalField(1, reinterpret_cast<void*>(method));
+    auto v8Function = v8::Function::New(engine->getContext(), FastScriptMethodV8::callback, methodData, numMaxParams).ToLocalChecked();
+
+    method->_genericMethod.Reset(isolate, v8::Local<v8::Function>::Cast(genericMethod.constGet()));
+    method->_function.Reset(isolate, v8Function);
+    method->_function.SetWeak(method, FastScriptMethodV8::weakHandleCallback, v8::WeakCallbackType::kParameter);
+    return V8ScriptValue(engine, v8Function);
+}
+
+void FastScriptBindings::setEnabled(bool enabled) {
+    fastBindingsEnabled.store(enabled);
+}
+
+bool FastScriptBindings::isEnabled() {
+    return fastBindingsEnabled.load();
+}
+
+v8::Local<v8::Object> FastScriptBindings::quatToV8Object(ScriptEngineV8* engine, const glm::quat& quat) {
+    auto isolate = engine->getIsolate();
+    v8::EscapableHandleScope handleScope(isolate);
+    auto context = engine->getContext();
+    v8::Local<v8::Object> object = v8::Object::New(isolate);
+    if (quat.x != quat.x || quat.y != quat.y || quat.z != quat.z || quat.w != quat.w) {
+        // if quat contains a NaN don't try to convert it, same as quatToScriptValue
+        return handleScope.Escape(object);
+    }
+    static const char* const COMPONENT_NAMES[] = { "x", "y", "z", "w" };
+    const float components[] = { quat.x, quat.y, quat.z, quat.w };
+    for (int i = 0; i < 4; i++) {
+        auto name = v8::String::NewFromUtf8(isolate, COMPONENT_NAMES[i], v8::NewStringType::kInternalized).ToLocalChecked();
+        if (!object->Set(context, name, v8::Number::New(isolate, components[i])).FromMaybe(false)) {
+            Q_ASSERT(false);
+        }
+    }
+    return handleScope.Escape(object);
+}
+
+bool FastScriptBindings::quatFromV8Value(ScriptEngineV8* engine, v8::Local<v8::Value> value, glm::quat& quat) {
+    if (!value->IsObject()) {
+        return false;
+    }
+    auto isolate = engine->getIsolate();
+    auto context = engine->getContext();
+    v8::Local<v8::Object> object = v8::Local<v8::Object>::Cast(value);
+    static const char* const COMPONENT_NAMES[] = { "x", "y", "z", "w" };
+    float components[4];
+    for (int i = 0; i < 4; i++) {
+        auto name = v8::String::NewFromUtf8(isolate, COMPONENT_NAMES[i], v8::NewStringType::kInternalized).ToLocalChecked();
+        v8::Local<v8::Value> component;
+        // Anything but plain numbers is left to quatFromScriptValue
+        if (!object->Get(context, name).ToLocal(&component) || !component->IsNumber()) {
+            return false;
+        }
+        components[i] = static_cast<float>(v8::Local<v8::Number>::Cast(component)->Value());
+    }
+    quat.x = components[0];
+    quat.y = components[1];
+    quat.z = components[2];
+    quat.w = components[3];
+
+    // enforce normalized quaternion, same as quatFromScriptValue
+    float length = glm::length(quat);
+    if (length > FLT_EPSILON) {
+        quat /= length;
+    } else {
+        quat = glm::quat();
+    }
+    return true;
+}
+
+namespace {
+
+bool fastFromV8Value(ScriptEngineV8* engine, v8::Local<v8::Value> value, glm::vec3& result) {
+    return vec3FromV8Value(engine, value, result);
+}
+
+bool fastFromV8Value(ScriptEngineV8* engine, v8::Local<v8::Value> value, glm::quat& result) {
+    return FastScriptBindings::quatFromV8Value(engine, value, result);
+}
+
+bool fastFromV8Value(ScriptEngineV8* engine, v8::Local<v8::Value> value, float& result) {
+    if (!value->IsNumber()) {
+        return false;
+    }
+    result = static_cast<float>(v8::Local<v8::Number>::Cast(value)->Value());
+    return true;
+}
+
+v8::Local<v8::Value> fastToV8Value(ScriptEngineV8* engine, const glm::vec3& value) {
+    return vec3ToV8Object(engine, value);
+}
+
+v8::Local<v8::Value> fastToV8Value(ScriptEngineV8* engine, const glm::quat& value) {
+    return FastScriptBindings::quatToV8Object(engine, value);
+}
+
+v8::Local<v8::Value> fastToV8Value(ScriptEngineV8* engine, float value) {
+    return v8::Number::New(engine->getIsolate(), value);
+}
+
+v8::Local<v8::Value> fastToV8Value(ScriptEngineV8* engine, bool value) {
+    return v8::Boolean::New(engine->getIsolate(), value);
+}
+
+template <typename Class, typename Result, typename... Args, std::size_t... Index>
+bool invokeFastMethod(Result (Class::*method)(Args...), ScriptEngineV8* engine, QObject* object,
+                      const v8::FunctionCallbackInfo<v8::Value>& arguments, std::index_sequence<Index...>) {
+    // Extra arguments are ignored, like in ScriptMethodV8Proxy::call
+    if (arguments.Length() < static_cast<int>(sizeof...(Args))) {
+        return false;
+    }
+    std::tuple<std::decay_t<Args>...> values;
+    const bool converted[] = { true, fastFromV8Value(engine, arguments[Index], std::get<Index>(values))... };
+    for (bool isConverted : converted) {
+        if (!isConverted) {
+            return false;
+        }
+    }
+    Class* instance = static_cast<Class*>(object);
+    arguments.GetReturnValue().Set(fastToV8Value(engine, (instance->*method)(std::get<Index>(values)...)));
+    return true;
+}
+
+// Adapts a typed member function to FastScriptBindings::MethodCallback, e.g. FastMethod<decltype(&Vec3::sum), &Vec3::sum>::call
+template <typename MethodType, MethodType Method>
+struct FastMethod;
+
+template <typename Class, typename Result, typename... Args, Result (Class::*Method)(Args...)>
+struct FastMethod<Result (Class::*)(Args...), Method> {
+    static bool call(ScriptEngineV8* engine, QObject* object, const v8::FunctionCallbackInfo<v8::Value>& arguments) {
+        return invokeFastMethod(Method, engine, object, arguments, std::index_sequence_for<Args...>());
+    }
+};
+
+// Getter of a constant property, e.g. FastConstant<glm::vec3, &Vectors::UP>::get
+template <typename Type, const Type* Value>
+struct FastConstant {
+    static v8::Local<v8::Value> get(ScriptEngineV8* engine, QObject* object) {
+        return fastToV8Value(engine, *Value);
+    }
+};
+
+#define FAST_METHOD(method) (&FastMethod<decltype(method), method>::call)
+
+// Vec3.multiply is overloaded as (vec3, float) and (float, vec3)
+bool vec3Multiply(ScriptEngineV8* engine, QObject* object, const v8::FunctionCallbackInfo<v8::Value>& arguments) {
+    using FloatFirst = glm::vec3 (Vec3::*)(float, const glm::vec3&);
+    using Vec3First = glm::vec3 (Vec3::*)(const glm::vec3&, float);
+    if (arguments.Length() > 0 && arguments[0]->IsNumber()) {
+        return FastMethod<FloatFirst, &Vec3::multiply>::call(engine, object, arguments);
+    }
+    return FastMethod<Vec3First, &Vec3::multiply>::call(engine, object, arguments);
+}
+
+}  // namespace
+
+void FastScriptBindings::registerBuiltins() {
+    // Vec3: only the pure math functions; print() and the like need a script context and stay on the generic path
+    registerMethod("Vec3", "reflect", FAST_METHOD(&Vec3::reflect));
+    registerMethod("Vec3", "cross", FAST_METHOD(&Vec3::cross));
+    registerMethod("Vec3", "dot", FAST_METHOD(&Vec3::dot));
+    registerMethod("Vec3", "multiply", &vec3Multiply);
+    registerMethod("Vec3", "multiplyVbyV", FAST_METHOD(&Vec3::multiplyVbyV));
+    registerMethod("Vec3", "multiplyQbyV", FAST_METHOD(&Vec3::multiplyQbyV));
+    registerMethod("Vec3", "sum", FAST_METHOD(&Vec3::sum));
+    registerMethod("Vec3", "subtract", FAST_METHOD(&Vec3::subtract));
+    registerMethod("Vec3", "length", FAST_METHOD(&Vec3::length));
+    registerMethod("Vec3", "distance", FAST_METHOD(&Vec3::distance));
+    registerMethod("Vec3", "normalize", FAST_METHOD(&Vec3::normalize));
+    registerMethod("Vec3", "mix", FAST_METHOD(&Vec3::mix));
+    registerMethod("Vec3", "equal", FAST_METHOD(&Vec3::equal));
+    registerMethod("Vec3", "withinEpsilon", FAST_METHOD(&Vec3::withinEpsilon));
+    registerMethod("Vec3", "getAngle", FAST_METHOD(&Vec3::getAngle));
+    registerMethod("Vec3", "orientedAngle", FAST_METHOD(&Vec3::orientedAngle));
+
+    registerProperty("Vec3", "UNIT_X", &FastConstant<glm::vec3, &Vectors::UNIT_X>::get);
+    registerProperty("Vec3", "UNIT_Y", &FastConstant<glm::vec3, &Vectors::UNIT_Y>::get);
+    registerProperty("Vec3", "UNIT_Z", &FastConstant<glm::vec3, &Vectors::UNIT_Z>::get);
+    registerProperty("Vec3", "UNIT_NEG_X", &FastConstant<glm::vec3, &Vectors::UNIT_NEG_X>::get);
+    registerProperty("Vec3", "UNIT_NEG_Y", &FastConstant<glm::vec3, &Vectors::UNIT_NEG_Y>::get);
+    registerProperty("Vec3", "UNIT_NEG_Z", &FastConstant<glm::vec3, &Vectors::UNIT_NEG_Z>::get);
+    registerProperty("Vec3", "ZERO", &FastConstant<glm::vec3, &Vectors::ZERO>::get);
+    registerProperty("Vec3", "ONE", &FastConstant<glm::vec3, &Vectors::ONE>::get);
+    registerProperty("Vec3", "RIGHT", &FastConstant<glm::vec3, &Vectors::RIGHT>::get);
+    registerProperty("Vec3", "UP", &FastConstant<glm::vec3, &Vectors::UP>::get);
+    registerProperty("Vec3", "FRONT", &FastConstant<glm::vec3, &Vectors::FRONT>::get);
+
+    registerMethod("Quat", "multiply", FAST_METHOD(&Quat::multiply));
+    registerMethod("Quat", "normalize", FAST_METHOD(&Quat::normalize));
+    registerMethod("Quat", "conjugate", FAST_METHOD(&Quat::conjugate));
+    registerMethod("Quat", "inverse", FAST_METHOD(&Quat::inverse));
+    registerMethod("Quat", "getFront", FAST_METHOD(&Quat::getFront));
+    registerMethod("Quat", "getForward", FAST_METHOD(&Quat::getForward));
+    registerMethod("Quat", "getRight", FAST_METHOD(&Quat::getRight));
+    registerMethod("Quat", "getUp", FAST_METHOD(&Quat::getUp));
+    registerMethod("Quat", "angleAxis", FAST_METHOD(&Quat::angleAxis));
+    registerMethod("Quat", "fromVec3Degrees", FAST_METHOD(&Quat::fromVec3Degrees));
+    registerMethod("Quat", "fromVec3Radians", FAST_METHOD(&Quat::fromVec3Radians));
+    registerMethod("Quat", "fromPitchYawRollDegrees", FAST_METHOD(&Quat::fromPitchYawRollDegrees));
+    registerMethod("Quat", "fromPitchYawRollRadians", FAST_METHOD(&Quat::fromPitchYawRollRadians));
+    registerMethod("Quat", "safeEulerAngles", FAST_METHOD(&Quat::safeEulerAngles));
+    registerMethod("Quat", "mix", FAST_METHOD(&Quat::mix));
+    registerMethod("Quat", "slerp", FAST_METHOD(&Quat::slerp));
+    registerMethod("Quat", "dot", FAST_METHOD(&Quat::dot));
+
+    registerProperty("Quat", "IDENTITY", &FastConstant<glm::quat, &Quaternions::IDENTITY>::get);
+}
@@ -0,0 +1,72 @@
+//
+//  FastScriptBindings.h
+//  libraries/script-engine/src/v8
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+/// @addtogroup ScriptEngine
+/// @{
+
+#ifndef overte_FastScriptBindings_h
+#define overte_FastScriptBindings_h
+
+#include <QtCore/QByteArray>
+#include <QtCore/QMetaObject>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include "v8.h"
+
+#include "V8Types.h"
+
+class QObject;
+class ScriptEngineV8;
+
+/// [V8] Registry of typed native callbacks that bypass QMetaMethod/QVariant marshalling for hot scripting interfaces.
+///
+/// ScriptObjectV8Proxy consults this registry when it first investigates a QObject. Methods with a registered callback
+/// are exposed as V8 functions that call straight into C++; properties with a registered getter/setter skip
+/// QMetaProperty::read/write. A method callback returns false when it does not handle the given arguments (for example
+/// an overload it does not know about, or a value that needs the generic conversion rules), in which case the call is
+/// forwarded to the generic method implementation, so error reporting stays identical.
+class FastScriptBindings {
+public:
+    using MethodCallback = bool (*)(ScriptEngineV8* engine, QObject* object, const v8::FunctionCallbackInfo<v8::Value>& arguments);
+    using PropertyGetter = v8::Local<v8::Value> (*)(ScriptEngineV8* engine, QObject* object);
+    using PropertySetter = bool (*)(ScriptEngineV8* engine, QObject* object, v8::Local<v8::Value> value);
+
+    /// Registers a callback for a method of QObjects whose class (or one of its base classes) is className.
+    static void registerMethod(const QByteArray& className, const QByteArray& methodName, MethodCallback callback);
+    /// Registers an accessor for a property; a null setter leaves writes to the generic path.
+    static void registerProperty(const QByteArray& className, const QByteArray& propertyName, PropertyGetter getter,
+                                 PropertySetter setter = nullptr);
+
+    /// Lookups walk up the class hierarchy and always fail while fast paths are disabled.
+    static MethodCallback findMethod(const QMetaObject* metaObject, const QByteArray& methodName);
+    static bool findProperty(const QMetaObject* metaObject, const QByteArray& propertyName, PropertyGetter& getter,
+                             PropertySetter& setter);
+
+    /// Wraps a fast method callback into a V8 function; genericMethod is called when the callback declines the arguments.
+    static V8ScriptValue newMethod(ScriptEngineV8* engine, QObject* object, MethodCallback callback,
+                                   const V8ScriptValue& genericMethod, int numMaxParams);
+
+    /// Fast paths are only bound to objects wrapped while they are enabled. Used for benchmarking and debugging.
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    /// Registers the built-in bindings (Vec3, Quat). Called once when the first V8 engine is created.
+    static void registerBuiltins();
+
+    static v8::Local<v8::Object> quatToV8Object(ScriptEngineV8* engine, const glm::quat& quat);
+    static bool quatFromV8Value(ScriptEngineV8* engine, v8::Local<v8::Value> value, glm::quat& quat);
+};
+
+#endif  // overte_FastScriptBindings_h
+
+/// @}
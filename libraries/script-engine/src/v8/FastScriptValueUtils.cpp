@@ -19,21 +19,10 @@
 
 #ifdef CONVERSIONS_OPTIMIZED_FOR_V8
 
-ScriptValue vec3ToScriptValue(ScriptEngine* engine, const glm::vec3& vec3) {
-    ScriptValue value = engine->newObject();
-
-    ScriptValueV8Wrapper *proxy = ScriptValueV8Wrapper::unwrap(value);
-
-    auto engineV8 = proxy->getV8Engine();
-
+// Sets x, y, z and the shared Vec3 prototype (which provides the 0/1/2, r/g/b and red/green/blue aliases) on an object.
+static void setVec3ObjectValue(ScriptEngineV8* engineV8, v8::Local<v8::Object> v8Object, const glm::vec3& vec3) {
     auto isolate = engineV8->getIsolate();
-    v8::Locker locker(isolate);
-    v8::Isolate::Scope isolateScope(isolate);
-    v8::HandleScope handleScope(isolate);
     auto context = engineV8->getContext();
-    v8::Context::Scope contextScope(engineV8->getContext());
-    V8ScriptValue v8ScriptValue = proxy->toV8Value();
-    v8::Local<v8::Object> v8Object = v8::Local<v8::Object>::Cast(v8ScriptValue.get());
 
     v8::Local<v8::Value> prototype;
     bool hasPrototype = false;
@@ -93,9 +82,35 @@ ScriptValue vec3ToScriptValue(ScriptEngine* engine, const glm::vec3& vec3) {
     if (!v8Object->SetPrototype(context, prototype).FromMaybe(false)) {
         Q_ASSERT(false);
     }
+}
+
+ScriptValue vec3ToScriptValue(ScriptEngine* engine, const glm::vec3& vec3) {
+    ScriptValue value = engine->newObject();
+
+    ScriptValueV8Wrapper *proxy = ScriptValueV8Wrapper::unwrap(value);
+
+    auto engineV8 = proxy->getV8Engine();
+
+    auto isolate = engineV8->getIsolate();
+    v8::Locker locker(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope handleScope(isolate);
+    v8::Context::Scope contextScope(engineV8->getContext());
+    V8ScriptValue v8ScriptValue = proxy->toV8Value();
+    v8::Local<v8::Object> v8Object = v8::Local<v8::Object>::Cast(v8ScriptValue.get());
+
+    setVec3ObjectValue(engineV8, v8Object, vec3);
     return value;
 }
 
+v8::Local<v8::Object> vec3ToV8Object(ScriptEngineV8* engineV8, const glm::vec3& vec3) {
+    auto isolate = engineV8->getIsolate();
+    v8::EscapableHandleScope handleScope(isolate);
+    v8::Local<v8::Object> v8Object = v8::Object::New(isolate);
+    setVec3ObjectValue(engineV8, v8Object, vec3);
+    return handleScope.Escape(v8Object);
+}
+
 bool vec3FromScriptValue(const ScriptValue& object, glm::vec3& vec3) {
     ScriptValueV8Wrapper *proxy = ScriptValueV8Wrapper::unwrap(object);
 
@@ -105,12 +120,15 @@ bool vec3FromScriptValue(const ScriptValue& object, glm::vec3& vec3) {
     v8::Locker locker(isolate);
     v8::Isolate::Scope isolateScope(isolate);
     v8::HandleScope handleScope(isolate);
-    auto context = engineV8->getContext();
     v8::Context::Scope contextScope(engineV8->getContext());
     V8ScriptValue v8ScriptValue = proxy->toV8Value();
 
-    v8::Local<v8::Value> v8Value = v8ScriptValue.get();
+    return vec3FromV8Value(engineV8, v8ScriptValue.get(), vec3);
+}
 
+bool vec3FromV8Value(ScriptEngineV8* engineV8, v8::Local<v8::Value> v8Value, glm::vec3& vec3) {
+    auto isolate = engineV8->getIsolate();
+    auto context = engineV8->getContext();
 
     if (v8Value->IsNumber()) {
         vec3 = glm::vec3(v8Value->NumberValue(context).ToChecked());
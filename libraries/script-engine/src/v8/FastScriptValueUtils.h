@@ -19,14 +19,23 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 
+#include <v8.h>
+
 #include "../ScriptValue.h"
 
+class ScriptEngineV8;
+
 #define CONVERSIONS_OPTIMIZED_FOR_V8
 
 #ifdef CONVERSIONS_OPTIMIZED_FOR_V8
 ScriptValue vec3ToScriptValue(ScriptEngine* engine, const glm::vec3& vec3);
 
 bool vec3FromScriptValue(const ScriptValue& object, glm::vec3& vec3);
+
+// Variants working directly on V8 values, for callers that already hold the isolate lock and handle scope.
+v8::Local<v8::Object> vec3ToV8Object(ScriptEngineV8* engine, const glm::vec3& vec3);
+
+bool vec3FromV8Value(ScriptEngineV8* engine, v8::Local<v8::Value> value, glm::vec3& vec3);
 #endif
 
 #endif  // overte_FastScriptValueUtils_h
@@ -50,6 +50,7 @@
 #include "../ScriptValue.h"
 #include "../ScriptManagerScriptingInterface.h"
 
+#include "FastScriptBindings.h"
 #include "ScriptContextV8Wrapper.h"
 #include "ScriptObjectV8Proxy.h"
 #include "ScriptProgramV8Wrapper.h"
@@ -202,6 +203,7 @@ ScriptEngineV8::ScriptEngineV8(ScriptManager *manager) : ScriptEngine(manager),
         v8::Platform* platform = getV8Platform();
         v8::V8::InitializePlatform(platform);
         v8::V8::Initialize(); qCDebug(scriptengine_v8) << "V8 platform initialized";
+        FastScriptBindings::registerBuiltins();
     } );
     _v8InitMutex.unlock();
     qCDebug(scriptengine_v8) << "Creating new script engine";
@@ -1010,6 +1012,58 @@ ScriptValue ScriptEngineV8::newArrayBuffer(const QByteArray& message) {
     return ScriptValue(new ScriptValueV8Wrapper(this, std::move(result)));
 }
 
+ScriptValue ScriptEngineV8::newFloat32Array(const QVector<float>& values) {
+    v8::Locker locker(_v8Isolate);
+    v8::Isolate::Scope isolateScope(_v8Isolate);
+    v8::HandleScope handleScope(_v8Isolate);
+    v8::Context::Scope contextScope(getContext());
+    const size_t byteLength = values.size() * sizeof(float);
+    std::shared_ptr<v8::BackingStore> backingStore(v8::ArrayBuffer::NewBackingStore(_v8Isolate, byteLength));
+    if (byteLength > 0) {
+        std::memcpy(backingStore->Data(), values.constData(), byteLength);
+    }
+    auto arrayBuffer = v8::ArrayBuffer::New(_v8Isolate, backingStore);
+    V8ScriptValue result(this, v8::Float32Array::New(arrayBuffer, 0, values.size()));
+    return ScriptValue(new ScriptValueV8Wrapper(this, std::move(result)));
+}
+
+bool ScriptEngineV8::toFloat32Vector(const ScriptValue& value, QVector<float>& values) {
+    v8::Locker locker(_v8Isolate);
+    v8::Isolate::Scope isolateScope(_v8Isolate);
+    v8::HandleScope handleScope(_v8Isolate);
+    auto context = getContext();
+    v8::Context::Scope contextScope(context);
+    V8ScriptValue v8Value = ScriptValueV8Wrapper::fullUnwrap(this, value);
+    v8::Local<v8::Value> localValue = v8Value.constGet();
+
+    if (localValue->IsFloat32Array()) {
+        // fast path: the elements already have the right layout
+        auto array = v8::Local<v8::Float32Array>::Cast(localValue);
+        values.resize(static_cast<int>(array->Length()));
+        if (!values.isEmpty()) {
+            array->CopyContents(values.data(), values.size() * sizeof(float));
+        }
+        return true;
+    }
+
+    if (!localValue->IsArray() && !localValue->IsTypedArray()) {
+        return false;
+    }
+    auto object = v8::Local<v8::Object>::Cast(localValue);
+    uint32_t length = localValue->IsArray() ? v8::Local<v8::Array>::Cast(localValue)->Length()
+                                            : static_cast<uint32_t>(v8::Local<v8::TypedArray>::Cast(localValue)->Length());
+    values.resize(static_cast<int>(length));
+    for (uint32_t i = 0; i < length; i++) {
+        v8::Local<v8::Value> element;
+        double number = 0.0;
+        if (object->Get(context, i).ToLocal(&element)) {
+            number = element->NumberValue(context).FromMaybe(0.0);
+        }
+        values[static_cast<int>(i)] = static_cast<float>(number);
+    }
+    return true;
+}
+
 ScriptValue ScriptEngineV8::newObject() {
     ScriptValue result;
     {
@@ -86,6 +86,8 @@ public:  // ScriptEngine implementation
 
     virtual ScriptValue newArray(uint length = 0) override;
     virtual ScriptValue newArrayBuffer(const QByteArray& message) override;
+    virtual ScriptValue newFloat32Array(const QVector<float>& values) override;
+    virtual bool toFloat32Vector(const ScriptValue& value, QVector<float>& values) override;
     virtual ScriptValue newFunction(ScriptEngine::FunctionSignature fun, int length = 0) override;
     virtual ScriptValue newObject() override;
     virtual ScriptValue newMethod(QObject* object, V8ScriptValue lifetime,
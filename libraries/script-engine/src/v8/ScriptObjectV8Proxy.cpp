@@ -261,6 +261,7 @@ void ScriptObjectV8Proxy::investigate() {
         propDef.flags = ScriptValue::Undeletable | ScriptValue::PropertyGetter | ScriptValue::PropertySetter |
                         ScriptValue::QObjectMember;
         if (prop.isConstant()) propDef.flags |= ScriptValue::ReadOnly;
+        FastScriptBindings::findProperty(metaObject, prop.name(), propDef.fastGetter, propDef.fastSetter);
     }
 
     // discover methods
@@ -366,6 +367,11 @@ void ScriptObjectV8Proxy::investigate() {
     for (auto i = _methods.begin(); i != _methods.end(); i++) {
         V8ScriptValue method = ScriptMethodV8Proxy::newMethod(_engine, qobject, V8ScriptValue(_engine, v8Object),
                                                               i.value().methods, i.value().numMaxParams);
+        // Methods with a typed native binding skip QVariant marshalling, falling back to the generic method when needed
+        auto fastCallback = FastScriptBindings::findMethod(metaObject, i.value().name.toUtf8());
+        if (fastCallback) {
+            method = FastScriptBindings::newMethod(_engine, qobject, fastCallback, method, i.value().numMaxParams);
+        }
         if(!propertiesObject->Set(_engine->getContext(), v8::String::NewFromUtf8(isolate, i.value().name.toStdString().c_str()).ToLocalChecked(), method.get()).FromMaybe(false)) {
             Q_ASSERT(false);
         }
@@ -601,6 +607,10 @@ V8ScriptValue ScriptObjectV8Proxy::property(const V8ScriptValue& object, const V
             int propId = id & ~TYPE_MASK;
             PropertyDefMap::const_iterator lookup = _props.find(propId);
             if (lookup == _props.cend()) return V8ScriptValue(_engine, v8::Null(isolate));
+            const PropertyDef& propDef = lookup.value();
+            if (propDef.fastGetter) {
+                return V8ScriptValue(_engine, propDef.fastGetter(_engine, qobject));
+            }
 
             QMetaProperty prop = metaObject->property(propId);
             ScriptValue scriptThis = ScriptValue(new ScriptValueV8Wrapper(_engine, object));
@@ -672,6 +682,7 @@ void ScriptObjectV8Proxy::setProperty(V8ScriptValue& object, const V8ScriptStrin
     if (lookup == _props.cend()) return;
     const PropertyDef& propDef = lookup.value();
     if (propDef.flags & ScriptValue::ReadOnly) return;
+    if (propDef.fastSetter && propDef.fastSetter(_engine, qobject, value.constGet())) return;
 
     const QMetaObject* metaObject = qobject->metaObject();
     QMetaProperty prop = metaObject->property(propId);
@@ -25,6 +25,7 @@
 
 #include "../ScriptEngine.h"
 #include "../Scriptable.h"
+#include "FastScriptBindings.h"
 #include "ScriptEngineV8.h"
 #include "V8Types.h"
 
@@ -48,6 +49,9 @@ private:  // implementation
         QString name;
         ScriptValue::PropertyFlags flags;
         uint _id;
+        // Typed accessors registered in FastScriptBindings, used instead of QMetaProperty when set
+        FastScriptBindings::PropertyGetter fastGetter { nullptr };
+        FastScriptBindings::PropertySetter fastSetter { nullptr };
     };
     class MethodDef {
     public:
@@ -0,0 +1,438 @@
+//
+//  JointDataCodec.cpp
+//  libraries/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "JointDataCodec.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+#include "GLMHelpers.h"
+#include "NumericalConstants.h"
+
+using namespace JointDataCodec;
+
+// a rotation delta component of 1 / ROTATION_DELTA_SCALE is about 0.007 degrees
+static const float ROTATION_DELTA_SCALE = 16384.0f;
+
+// below this w, the w rebuilt from the quantized vector part loses too much precision: about 150 degrees
+static const float MIN_ROTATION_DELTA_W = 0.25f;
+
+// translations keep the precision of the uncompressed joint data: the largest one over 2^14
+static const float TRANSLATION_STEPS_PER_MAX_DIMENSION = 16384.0f;
+static const float MIN_MAX_TRANSLATION_DIMENSION = 0.001f;
+static const int32_t MAX_QUANTIZED_TRANSLATION = 1 << 29;
+
+static const int ORDER_BITS = 4;
+static const int MAX_ORDER = (1 << ORDER_BITS) - 1;
+static const int MAX_EXP_GOLOMB_PREFIX = 32;
+static const int SIX_BYTE_QUAT_SIZE = 6;
+
+namespace {
+
+class BitWriter {
+public:
+    void write(uint32_t value, int numBits) {
+        for (int i = numBits - 1; i >= 0; i--) {
+            if (_bitOffset == 0) {
+                _bytes.append('\0');
+            }
+            if (value & (1u << i)) {
+                _bytes.data()[_bytes.size() - 1] |= (char)(0x80 >> _bitOffset);
+            }
+            _bitOffset = (_bitOffset + 1) % BITS_IN_BYTE;
+        }
+    }
+
+    void writeExpGolomb(uint32_t value, int order) {
+        uint64_t shifted = (uint64_t)value + (1ull << order);
+        int numBits = 0;
+        while ((shifted >> numBits) > 1) {
+            numBits++;
+        }
+        // numBits is the index of the highest set bit, the prefix says how many bits follow the order bits
+        write(0, numBits - order);
+        if (numBits + 1 > 32) {
+            write((uint32_t)(shifted >> 32), numBits + 1 - 32);
+            write((uint32_t)shifted, 32);
+        } else {
+            write((uint32_t)shifted, numBits + 1);
+        }
+    }
+
+    const QByteArray& getBytes() const { return _bytes; }
+
+private:
+    QByteArray _bytes;
+    int _bitOffset { 0 };
+};
+
+class BitReader {
+public:
+    BitReader(const uint8_t* data, int size) : _data(data), _numBits(size * BITS_IN_BYTE) {}
+
+    bool read(int numBits, uint32_t& value) {
+        if (numBits > 32 || _position + numBits > _numBits) {
+            return false;
+        }
+        value = 0;
+        for (int i = 0; i < numBits; i++, _position++) {
+            bool bit = _data[_position / BITS_IN_BYTE] & (0x80 >> (_position % BITS_IN_BYTE));
+            value = (value << 1) | (bit ? 1 : 0);
+        }
+        return true;
+    }
+
+    bool readExpGolomb(int order, uint32_t& value) {
+        int prefix = 0;
+        uint32_t bit = 0;
+        while (true) {
+            if (!read(1, bit)) {
+                return false;
+            }
+            if (bit) {
+                break;
+            }
+            if (++prefix > MAX_EXP_GOLOMB_PREFIX) {
+                return false;
+            }
+        }
+        // the leading 1 was consumed, read the remaining bits of (value + 2^order)
+        int numBits = prefix + order;
+        uint64_t shifted = 1;
+        while (numBits > 0) {
+            int chunk = std::min(numBits, 16);
+            uint32_t bits = 0;
+            if (!read(chunk, bits)) {
+                return false;
+            }
+            shifted = (shifted << chunk) | bits;
+            numBits -= chunk;
+        }
+        uint64_t result = shifted - (1ull << order);
+        if (result > UINT32_MAX) {
+            return false;
+        }
+        value = (uint32_t)result;
+        return true;
+    }
+
+private:
+    const uint8_t* _data;
+    int _numBits;
+    int _position { 0 };
+};
+
+uint32_t zigZag(int32_t value) {
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+int32_t unZigZag(uint32_t value) {
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+int expGolombSize(uint32_t value, int order) {
+    uint64_t shifted = (uint64_t)value + (1ull << order);
+    int numBits = 0;
+    while ((shifted >> numBits) > 1) {
+        numBits++;
+    }
+    return 2 * numBits - order + 1;
+}
+
+// the order that codes a set of values in the fewest bits
+int pickOrder(const std::vector<uint32_t>& values) {
+    int bestOrder = 0;
+    int64_t bestSize = INT64_MAX;
+    for (int order = 0; order <= MAX_ORDER; order++) {
+        int64_t size = 0;
+        for (uint32_t value : values) {
+            size += expGolombSize(value, order);
+        }
+        if (size < bestSize) {
+            bestSize = size;
+            bestOrder = order;
+        }
+    }
+    return bestOrder;
+}
+
+int32_t quantize(float value, float scale, int32_t limit) {
+    return (int32_t)glm::clamp(roundf(value * scale), (float)-limit, (float)limit);
+}
+
+glm::quat rotationDelta(const glm::quat& keyframeRotation, const glm::quat& rotation) {
+    glm::quat delta = glm::inverse(keyframeRotation) * rotation;
+    // q and -q are the same rotation, keep w positive so that it is the implied component
+    return delta.w < 0.0f ? -delta : delta;
+}
+
+glm::quat applyRotationDelta(const glm::quat& keyframeRotation, const glm::vec3& vector) {
+    float w = sqrtf(std::max(0.0f, 1.0f - glm::dot(vector, vector)));
+    return glm::normalize(keyframeRotation * glm::quat(w, vector.x, vector.y, vector.z));
+}
+
+}
+
+bool JointDataCodec::needsKeyframe(const Keyframe& keyframe, int numJoints) {
+    return !keyframe.isValid || (int)keyframe.rotations.size() != numJoints ||
+        keyframe.sectionsSinceKeyframe >= MAX_SECTIONS_PER_KEYFRAME;
+}
+
+QByteArray JointDataCodec::encode(const QVector<JointData>& joints, const std::vector<bool>& sendRotations,
+                                  const std::vector<bool>& sendTranslations, const Keyframe& keyframe,
+                                  Keyframe* newKeyframe) {
+    const int numJoints = joints.size();
+    const bool isKeyframe = newKeyframe != nullptr;
+    assert(numJoints <= UINT8_MAX);
+    assert(isKeyframe || (int)keyframe.rotations.size() == numJoints);
+
+    std::vector<bool> hasRotation(numJoints);
+    std::vector<bool> hasTranslation(numJoints);
+    for (int i = 0; i < numJoints; i++) {
+        if (isKeyframe) {
+            hasRotation[i] = !joints[i].rotationIsDefaultPose;
+            hasTranslation[i] = !joints[i].translationIsDefaultPose;
+        } else {
+            hasRotation[i] = i < (int)sendRotations.size() && sendRotations[i];
+            hasTranslation[i] = i < (int)sendTranslations.size() && sendTranslations[i];
+        }
+    }
+
+    float translationStep = keyframe.translationStep;
+    if (isKeyframe) {
+        float maxTranslationDimension = MIN_MAX_TRANSLATION_DIMENSION;
+        for (int i = 0; i < numJoints; i++) {
+            if (hasTranslation[i]) {
+                const glm::vec3& translation = joints[i].translation;
+                maxTranslationDimension = std::max(maxTranslationDimension,
+                    std::max(fabsf(translation.x), std::max(fabsf(translation.y), fabsf(translation.z))));
+            }
+        }
+        translationStep = maxTranslationDimension / TRANSLATION_STEPS_PER_MAX_DIMENSION;
+
+        newKeyframe->isValid = true;
+        newKeyframe->id = keyframe.id + 1;
+        newKeyframe->sectionsSinceKeyframe = 0;
+        newKeyframe->translationStep = translationStep;
+        newKeyframe->rotations.assign(numJoints, glm::quat());
+        newKeyframe->translations.assign(numJoints, glm::vec3(0.0f));
+    }
+
+    // quantize everything first, the Exp-Golomb orders depend on all the values
+    std::vector<uint8_t> packedRotations;
+    std::vector<uint32_t> rotationValues;
+    std::vector<uint32_t> translationValues;
+    for (int i = 0; i < numJoints; i++) {
+        if (!hasRotation[i]) {
+            continue;
+        }
+        if (isKeyframe) {
+            uint8_t packed[SIX_BYTE_QUAT_SIZE];
+            packOrientationQuatToSixBytes(packed, joints[i].rotation);
+            packedRotations.insert(packedRotations.end(), packed, packed + SIX_BYTE_QUAT_SIZE);
+            unpackOrientationQuatFromSixBytes(packed, newKeyframe->rotations[i]);
+        } else {
+            glm::quat delta = rotationDelta(keyframe.rotations[i], joints[i].rotation);
+            if (delta.w < MIN_ROTATION_DELTA_W) {
+                return QByteArray();
+            }
+            rotationValues.push_back(zigZag(quantize(delta.x, ROTATION_DELTA_SCALE, (int32_t)ROTATION_DELTA_SCALE)));
+            rotationValues.push_back(zigZag(quantize(delta.y, ROTATION_DELTA_SCALE, (int32_t)ROTATION_DELTA_SCALE)));
+            rotationValues.push_back(zigZag(quantize(delta.z, ROTATION_DELTA_SCALE, (int32_t)ROTATION_DELTA_SCALE)));
+        }
+    }
+    for (int i = 0; i < numJoints; i++) {
+        if (!hasTranslation[i]) {
+            continue;
+        }
+        glm::vec3 base = isKeyframe ? glm::vec3(0.0f) : keyframe.translations[i];
+        glm::vec3 offset = joints[i].translation - base;
+        glm::ivec3 quantized(quantize(offset.x, 1.0f / translationStep, MAX_QUANTIZED_TRANSLATION),
+                             quantize(offset.y, 1.0f / translationStep, MAX_QUANTIZED_TRANSLATION),
+                             quantize(offset.z, 1.0f / translationStep, MAX_QUANTIZED_TRANSLATION));
+        translationValues.push_back(zigZag(quantized.x));
+        translationValues.push_back(zigZag(quantized.y));
+        translationValues.push_back(zigZag(quantized.z));
+        if (isKeyframe) {
+            newKeyframe->translations[i] = glm::vec3(quantized) * translationStep;
+        }
+    }
+
+    int rotationOrder = pickOrder(rotationValues);
+    int translationOrder = pickOrder(translationValues);
+
+    BitWriter writer;
+    for (int i = 0; i < numJoints; i++) {
+        writer.write(hasRotation[i] ? 1 : 0, 1);
+    }
+    for (int i = 0; i < numJoints; i++) {
+        writer.write(hasTranslation[i] ? 1 : 0, 1);
+    }
+    writer.write(rotationOrder, ORDER_BITS);
+    writer.write(translationOrder, ORDER_BITS);
+    for (uint8_t byte : packedRotations) {
+        writer.write(byte, BITS_IN_BYTE);
+    }
+    for (uint32_t value : rotationValues) {
+        writer.writeExpGolomb(value, rotationOrder);
+    }
+    for (uint32_t value : translationValues) {
+        writer.writeExpGolomb(value, translationOrder);
+    }
+
+    const QByteArray& bitStream = writer.getBytes();
+    uint16_t bitStreamSize = (uint16_t)bitStream.size();
+    uint8_t header[HEADER_SIZE];
+    header[0] = (uint8_t)numJoints;
+    header[1] = isKeyframe ? newKeyframe->id : keyframe.id;
+    header[2] = isKeyframe ? KEYFRAME_FLAG : 0;
+    memcpy(header + 3, &bitStreamSize, sizeof(bitStreamSize));
+
+    QByteArray section;
+    section.reserve(HEADER_SIZE + (int)sizeof(float) + bitStream.size());
+    section.append(reinterpret_cast<const char*>(header), HEADER_SIZE);
+    if (isKeyframe) {
+        section.append(reinterpret_cast<const char*>(&translationStep), sizeof(translationStep));
+    }
+    section.append(bitStream);
+    return section;
+}
+
+int JointDataCodec::decode(const uint8_t* source, int size, Keyframe& keyframe, QVector<JointData>& joints,
+                           bool& applied) {
+    applied = false;
+    if (size < HEADER_SIZE) {
+        return -1;
+    }
+
+    const int numJoints = source[0];
+    const uint8_t keyframeID = source[1];
+    const bool isKeyframe = (source[2] & KEYFRAME_FLAG) != 0;
+    uint16_t bitStreamSize;
+    memcpy(&bitStreamSize, source + 3, sizeof(bitStreamSize));
+
+    int headerSize = HEADER_SIZE + (isKeyframe ? (int)sizeof(float) : 0);
+    int sectionSize = headerSize + bitStreamSize;
+    if (size < sectionSize) {
+        return -1;
+    }
+
+    if (!isKeyframe && (!keyframe.isValid || keyframe.id != keyframeID || (int)keyframe.rotations.size() != numJoints)) {
+        // we missed the keyframe these deltas are relative to
+        return sectionSize;
+    }
+
+    float translationStep = keyframe.translationStep;
+    if (isKeyframe) {
+        memcpy(&translationStep, source + HEADER_SIZE, sizeof(translationStep));
+        if (!(translationStep > 0.0f)) {
+            return -1;
+        }
+    }
+
+    BitReader reader(source + headerSize, bitStreamSize);
+    std::vector<bool> hasRotation(numJoints);
+    std::vector<bool> hasTranslation(numJoints);
+    uint32_t bit = 0;
+    for (int i = 0; i < numJoints; i++) {
+        if (!reader.read(1, bit)) {
+            return -1;
+        }
+        hasRotation[i] = bit != 0;
+    }
+    for (int i = 0; i < numJoints; i++) {
+        if (!reader.read(1, bit)) {
+            return -1;
+        }
+        hasTranslation[i] = bit != 0;
+    }
+    uint32_t rotationOrder = 0;
+    uint32_t translationOrder = 0;
+    if (!reader.read(ORDER_BITS, rotationOrder) || !reader.read(ORDER_BITS, translationOrder)) {
+        return -1;
+    }
+
+    // decode into a copy, so that a malformed section leaves the joints and the keyframe as they were
+    Keyframe decodedKeyframe;
+    if (isKeyframe) {
+        decodedKeyframe.isValid = true;
+        decodedKeyframe.id = keyframeID;
+        decodedKeyframe.translationStep = translationStep;
+        decodedKeyframe.rotations.assign(numJoints, glm::quat());
+        decodedKeyframe.translations.assign(numJoints, glm::vec3(0.0f));
+    }
+    const Keyframe& base = isKeyframe ? decodedKeyframe : keyframe;
+
+    std::vector<glm::quat> rotations(numJoints);
+    std::vector<glm::vec3> translations(numJoints);
+    for (int i = 0; i < numJoints; i++) {
+        if (!hasRotation[i]) {
+            continue;
+        }
+        if (isKeyframe) {
+            uint8_t packed[SIX_BYTE_QUAT_SIZE];
+            for (int j = 0; j < SIX_BYTE_QUAT_SIZE; j++) {
+                uint32_t byte = 0;
+                if (!reader.read(BITS_IN_BYTE, byte)) {
+                    return -1;
+                }
+                packed[j] = (uint8_t)byte;
+            }
+            unpackOrientationQuatFromSixBytes(packed, rotations[i]);
+            decodedKeyframe.rotations[i] = rotations[i];
+        } else {
+            uint32_t values[3];
+            for (int j = 0; j < 3; j++) {
+                if (!reader.readExpGolomb(rotationOrder, values[j])) {
+                    return -1;
+                }
+            }
+            glm::vec3 vector((float)unZigZag(values[0]), (float)unZigZag(values[1]), (float)unZigZag(values[2]));
+            rotations[i] = applyRotationDelta(base.rotations[i], vector / ROTATION_DELTA_SCALE);
+        }
+    }
+    for (int i = 0; i < numJoints; i++) {
+        if (!hasTranslation[i]) {
+            continue;
+        }
+        uint32_t values[3];
+        for (int j = 0; j < 3; j++) {
+            if (!reader.readExpGolomb(translationOrder, values[j])) {
+                return -1;
+            }
+        }
+        glm::vec3 offset = glm::vec3(unZigZag(values[0]), unZigZag(values[1]), unZigZag(values[2])) * translationStep;
+        translations[i] = isKeyframe ? offset : base.translations[i] + offset;
+        if (isKeyframe) {
+            decodedKeyframe.translations[i] = offset;
+        }
+    }
+
+    if (isKeyframe) {
+        keyframe = std::move(decodedKeyframe);
+    }
+
+    joints.resize(numJoints);
+    for (int i = 0; i < numJoints; i++) {
+        if (hasRotation[i]) {
+            joints[i].rotation = rotations[i];
+            joints[i].rotationIsDefaultPose = false;
+        }
+        if (hasTranslation[i]) {
+            joints[i].translation = translations[i];
+            joints[i].translationIsDefaultPose = false;
+        }
+    }
+    applied = true;
+    return sectionSize;
+}
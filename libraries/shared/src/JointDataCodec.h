@@ -0,0 +1,79 @@
+//
+//  JointDataCodec.h
+//  libraries/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Compact encoding of joint poses as quantized deltas against a keyframe pose
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_JointDataCodec_h
+#define hifi_JointDataCodec_h
+
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QVector>
+
+#include "JointData.h"
+
+/// Encodes the joints of a pose as quantized deltas against a keyframe pose held by both ends of a stream.
+///
+/// A keyframe section carries every joint that is not in its default pose: rotations are packed with the smallest three
+/// components, like packOrientationQuatToSixBytes() does, and translations are quantized to a step derived from the
+/// largest translation. The sections that follow only carry the joints that changed. A rotation is sent as the vector part
+/// of the rotation from the keyframe rotation, whose largest component is the implied w for any small change, and a
+/// translation as its offset from the keyframe translation. The quantized deltas are Exp-Golomb coded with an order picked
+/// per section, so the small changes of a joint at rest take a few bits.
+///
+/// Deltas are relative to the keyframe and not to the previous section, so a section that gets lost does not affect the
+/// next one. A receiver that missed a keyframe skips the sections that refer to it until it gets the next keyframe.
+namespace JointDataCodec {
+
+    /*
+    struct Section {
+        uint8_t numJoints;
+        uint8_t keyframeID;                 // ID of the keyframe the deltas are relative to, or of the keyframe itself
+        uint8_t flags;                      // KEYFRAME_FLAG if the section is a keyframe
+        uint16_t bitStreamSize;
+        float translationStep;              // only present in keyframes
+        uint8_t bitStream[bitStreamSize];   // rotation and translation presence bits, Exp-Golomb orders and joints
+    };
+    */
+    const int HEADER_SIZE = 5;
+    const uint8_t KEYFRAME_FLAG = 0x01;
+
+    // the sender sends a new keyframe after this many sections, which bounds how long a receiver that lost one waits
+    const int MAX_SECTIONS_PER_KEYFRAME = 45;
+
+    /// The pose deltas are relative to, as the receiver decoded it.
+    struct Keyframe {
+        bool isValid { false };
+        uint8_t id { 0 };
+        int sectionsSinceKeyframe { 0 }; // only tracked by the sender
+        float translationStep { 0.0f };
+        std::vector<glm::quat> rotations; // identity for the joints that were in their default pose
+        std::vector<glm::vec3> translations;
+    };
+
+    /// Whether the next section of a pose of numJoints joints has to be a keyframe.
+    bool needsKeyframe(const Keyframe& keyframe, int numJoints);
+
+    /// Encodes a section. If newKeyframe is set, the section is a keyframe that carries every non-default joint and
+    /// newKeyframe receives the pose the receiver will decode, which the caller makes its keyframe once the section is
+    /// sent. Otherwise only the joints flagged in sendRotations and sendTranslations are encoded, relative to keyframe, and
+    /// an empty array is returned if a joint turned too far from its keyframe rotation, in which case a keyframe is needed.
+    QByteArray encode(const QVector<JointData>& joints, const std::vector<bool>& sendRotations,
+                      const std::vector<bool>& sendTranslations, const Keyframe& keyframe, Keyframe* newKeyframe);
+
+    /// Decodes a section into joints and updates the keyframe when the section is one. Sets applied to false when the
+    /// section refers to a keyframe that was not received, in which case the joints are left untouched.
+    /// Returns the number of bytes read, or -1 if the section is truncated or malformed.
+    int decode(const uint8_t* source, int size, Keyframe& keyframe, QVector<JointData>& joints, bool& applied);
+}
+
+#endif // hifi_JointDataCodec_h
@@ -0,0 +1,136 @@
+//
+//  MappedFileCache.cpp
+//  libraries/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "MappedFileCache.h"
+
+#include <cctype>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QSaveFile>
+#include <QtCore/QTemporaryFile>
+
+#include "SharedLogging.h"
+
+MappedFile::~MappedFile() {
+    if (_file && _data) {
+        _file->unmap(const_cast<uchar*>(_data));
+        *_mappedBytes -= _size;
+    }
+}
+
+MappedFileCache::MappedFileCache(const QString& directory) :
+    _directory(directory)
+{
+    if (!QDir().mkpath(_directory)) {
+        qCWarning(shared) << "Could not create shared file cache directory" << _directory;
+    }
+}
+
+static const int CONTENTS_NAME_LENGTH = 64; // hex SHA-256
+
+QString MappedFileCache::getKeyPath(const QString& key) const {
+    auto hash = QCryptographicHash::hash(key.toUtf8(), QCryptographicHash::Sha1).toHex();
+    return _directory + "/" + QString::fromLatin1(hash) + ".key";
+}
+
+QString MappedFileCache::getContentsPath(const QByteArray& contentsName) const {
+    return _directory + "/" + QString::fromLatin1(contentsName) + ".data";
+}
+
+QByteArray MappedFileCache::readContentsName(const QString& key) const {
+    QFile file(getKeyPath(key));
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QByteArray();
+    }
+    QByteArray contentsName = file.read(CONTENTS_NAME_LENGTH + 1);
+    if (contentsName.size() != CONTENTS_NAME_LENGTH) {
+        return QByteArray();
+    }
+    for (char c : contentsName) {
+        if (!isxdigit((unsigned char)c)) {
+            return QByteArray();
+        }
+    }
+    return contentsName;
+}
+
+bool MappedFileCache::writeContents(const QString& contentsPath, const QByteArray& data) {
+    if (QFile::exists(contentsPath)) {
+        return true;
+    }
+
+    // written to a temporary file and renamed, which fails rather than replace a file another process published meanwhile
+    QTemporaryFile file(_directory + "/XXXXXX.tmp");
+    if (!file.open() || file.write(data) != data.size() || !file.flush()) {
+        qCDebug(shared) << "Could not write shared file" << contentsPath << file.errorString();
+        return false;
+    }
+    return file.rename(contentsPath) || QFile::exists(contentsPath);
+}
+
+MappedFilePointer MappedFileCache::find(const QString& key) {
+    QByteArray contentsName = readContentsName(key);
+    auto mapping = contentsName.isEmpty() ? MappedFilePointer() : map(getContentsPath(contentsName));
+    if (mapping) {
+        _hits++;
+    } else {
+        _misses++;
+    }
+    return mapping;
+}
+
+MappedFilePointer MappedFileCache::insert(const QString& key, const QByteArray& data) {
+    if (data.isEmpty()) {
+        return MappedFilePointer();
+    }
+
+    QByteArray contentsName = QCryptographicHash::hash(data, QCryptographicHash::Sha256).toHex();
+    QString contentsPath = getContentsPath(contentsName);
+    if (!writeContents(contentsPath, data)) {
+        return MappedFilePointer();
+    }
+
+    QByteArray previousContentsName = readContentsName(key);
+    if (previousContentsName != contentsName) {
+        if (!previousContentsName.isEmpty()) {
+            _staleReplacements++;
+        }
+
+        // the reference is never mapped, so it can be replaced; if another process replaces it at the same time, the
+        // one that wins is as good as this one
+        QSaveFile keyFile(getKeyPath(key));
+        if (!keyFile.open(QIODevice::WriteOnly) || keyFile.write(contentsName) != contentsName.size() || !keyFile.commit()) {
+            qCDebug(shared) << "Could not write shared file reference for" << key << keyFile.errorString();
+        }
+    }
+    return map(contentsPath);
+}
+
+MappedFilePointer MappedFileCache::map(const QString& filePath) {
+    auto file = std::make_unique<QFile>(filePath);
+    if (!file->open(QIODevice::ReadOnly) || file->size() == 0) {
+        return MappedFilePointer();
+    }
+
+    auto mapping = std::make_shared<MappedFile>();
+    mapping->_size = file->size();
+    mapping->_data = file->map(0, mapping->_size);
+    if (!mapping->_data) {
+        qCWarning(shared) << "Could not map shared file" << filePath << file->errorString();
+        return MappedFilePointer();
+    }
+    mapping->_file = std::move(file);
+    mapping->_mappedBytes = _mappedBytes;
+    *_mappedBytes += mapping->_size;
+    return mapping;
+}
@@ -0,0 +1,84 @@
+//
+//  MappedFileCache.h
+//  libraries/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_MappedFileCache_h
+#define hifi_MappedFileCache_h
+
+#include <atomic>
+#include <memory>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+
+class QFile;
+
+/// A read-only file mapped into memory. The mapping stays valid as long as the pointer is held.
+class MappedFile {
+public:
+    ~MappedFile();
+
+    const uchar* data() const { return _data; }
+    qint64 size() const { return _size; }
+
+private:
+    friend class MappedFileCache;
+
+    std::unique_ptr<QFile> _file;
+    const uchar* _data { nullptr };
+    qint64 _size { 0 };
+    std::shared_ptr<std::atomic<qint64>> _mappedBytes;
+};
+
+using MappedFilePointer = std::shared_ptr<const MappedFile>;
+
+/// Directory of immutable files shared by the processes of this machine.
+///
+/// Every process maps the files read-only, so the page cache holds a single copy of each no matter how many processes use
+/// it. This lets a fleet of agents running the same recordings and sounds pay for them once.
+///
+/// Contents are stored under the name of their hash and are never replaced or modified, so mapping a file is safe on every
+/// platform however other processes use the cache. Each key has a small reference file naming the contents published for
+/// it. When different data is inserted for a key, e.g. because its source changed since an earlier run, the reference
+/// moves to the new contents, while processes that still map the old ones keep reading them.
+class MappedFileCache {
+public:
+    explicit MappedFileCache(const QString& directory);
+
+    const QString& getDirectory() const { return _directory; }
+
+    /// Maps the file published for a key, or returns null if there is none.
+    MappedFilePointer find(const QString& key);
+
+    /// Publishes the data for a key, unless the same data was published already, and maps it.
+    /// Returns null if the file could not be written or mapped.
+    MappedFilePointer insert(const QString& key, const QByteArray& data);
+
+    qint64 getMappedBytes() const { return *_mappedBytes; }
+    quint64 getHits() const { return _hits; }
+    quint64 getMisses() const { return _misses; }
+    quint64 getStaleReplacements() const { return _staleReplacements; }
+
+private:
+    QString getKeyPath(const QString& key) const;
+    QString getContentsPath(const QByteArray& contentsName) const;
+    QByteArray readContentsName(const QString& key) const;
+    bool writeContents(const QString& contentsPath, const QByteArray& data);
+    MappedFilePointer map(const QString& filePath);
+
+    QString _directory;
+    // shared with the mappings, which can outlive the cache
+    std::shared_ptr<std::atomic<qint64>> _mappedBytes { std::make_shared<std::atomic<qint64>>(0) };
+    std::atomic<quint64> _hits { 0 };
+    std::atomic<quint64> _misses { 0 };
+    std::atomic<quint64> _staleReplacements { 0 };
+};
+
+#endif // hifi_MappedFileCache_h
@@ -0,0 +1,145 @@
+//
+//  OpenMetrics.cpp
+//  libraries/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "OpenMetrics.h"
+
+#include <algorithm>
+#include <cmath>
+
+const char* OpenMetricsWriter::CONTENT_TYPE = "text/plain; version=0.0.4; charset=utf-8";
+
+const MetricsHistogram::Bounds& MetricsHistogram::frameTimeBounds() {
+    static const Bounds FRAME_TIME_BOUNDS {
+        0.0001, 0.00025, 0.0005, 0.001, 0.0025, 0.005, 0.0075, 0.01, 0.015, 0.02, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0
+    };
+    return FRAME_TIME_BOUNDS;
+}
+
+MetricsHistogram::MetricsHistogram(const Bounds& upperBounds) :
+    _upperBounds(upperBounds),
+    _bucketCounts(new std::atomic<uint64_t>[upperBounds.size() + 1])
+{
+    std::sort(_upperBounds.begin(), _upperBounds.end());
+    for (size_t i = 0; i <= _upperBounds.size(); ++i) {
+        _bucketCounts[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+void MetricsHistogram::record(double value) {
+    auto bucket = std::lower_bound(_upperBounds.begin(), _upperBounds.end(), value) - _upperBounds.begin();
+    _bucketCounts[bucket].fetch_add(1, std::memory_order_relaxed);
+    _count.fetch_add(1, std::memory_order_relaxed);
+
+    // there is no fetch_add for atomic<double> before C++20
+    double sum = _sum.load(std::memory_order_relaxed);
+    while (!_sum.compare_exchange_weak(sum, sum + value, std::memory_order_relaxed)) {
+    }
+}
+
+void MetricsHistogram::sample(std::vector<uint64_t>& bucketCounts, uint64_t& count, double& sum) const {
+    bucketCounts.resize(_upperBounds.size() + 1);
+    for (size_t i = 0; i < bucketCounts.size(); ++i) {
+        bucketCounts[i] = _bucketCounts[i].load(std::memory_order_relaxed);
+    }
+    count = _count.load(std::memory_order_relaxed);
+    sum = _sum.load(std::memory_order_relaxed);
+}
+
+static QByteArray formatValue(double value) {
+    if (std::isnan(value)) {
+        return "NaN";
+    } else if (std::isinf(value)) {
+        return value > 0.0 ? "+Inf" : "-Inf";
+    }
+    return QByteArray::number(value, 'g', 16);
+}
+
+static QByteArray escapeLabelValue(const QString& value) {
+    QByteArray escaped = value.toUtf8();
+    escaped.replace('\\', "\\\\");
+    escaped.replace('"', "\\\"");
+    escaped.replace('\n', "\\n");
+    return escaped;
+}
+
+OpenMetricsWriter::Family& OpenMetricsWriter::getFamily(const QString& name, const QString& help, const char* type) {
+    auto itr = _familyIndices.find(name);
+    if (itr != _familyIndices.end()) {
+        return _families[itr.value()];
+    }
+
+    Family family;
+    QByteArray escapedHelp = help.toUtf8();
+    escapedHelp.replace('\\', "\\\\");
+    escapedHelp.replace('\n', "\\n");
+    family.header = "# HELP " + name.toUtf8() + " " + escapedHelp + "\n# TYPE " + name.toUtf8() + " " + type + "\n";
+
+    _familyIndices.insert(name, _families.size());
+    _families.push_back(family);
+    return _families.last();
+}
+
+void OpenMetricsWriter::writeSample(QByteArray& out, const QString& name, const Labels& labels, double value) {
+    out += name.toUtf8();
+    if (!labels.empty()) {
+        out += '{';
+        bool first = true;
+        for (const auto& label : labels) {
+            if (!first) {
+                out += ',';
+            }
+            first = false;
+            out += label.first.toUtf8() + "=\"" + escapeLabelValue(label.second) + '"';
+        }
+        out += '}';
+    }
+    out += ' ' + formatValue(value) + '\n';
+}
+
+void OpenMetricsWriter::addGauge(const QString& name, const QString& help, double value, const Labels& labels) {
+    writeSample(getFamily(name, help, "gauge").samples, name, labels, value);
+}
+
+void OpenMetricsWriter::addCounter(const QString& name, const QString& help, double value, const Labels& labels) {
+    writeSample(getFamily(name, help, "counter").samples, name + "_total", labels, value);
+}
+
+void OpenMetricsWriter::addHistogram(const QString& name, const QString& help, const MetricsHistogram& histogram,
+                                     const Labels& labels) {
+    std::vector<uint64_t> bucketCounts;
+    uint64_t count;
+    double sum;
+    histogram.sample(bucketCounts, count, sum);
+
+    auto& samples = getFamily(name, help, "histogram").samples;
+    const auto& bounds = histogram.getUpperBounds();
+    const QString bucketName = name + "_bucket";
+
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < bucketCounts.size(); ++i) {
+        cumulative += bucketCounts[i];
+        Labels bucketLabels = labels;
+        double bound = i < bounds.size() ? bounds[i] : INFINITY;
+        bucketLabels.emplace_back("le", QString::fromUtf8(formatValue(bound)));
+        writeSample(samples, bucketName, bucketLabels, (double)cumulative);
+    }
+    writeSample(samples, name + "_sum", labels, sum);
+    // the buckets are sampled one by one while recording continues, so report the count they add up to
+    writeSample(samples, name + "_count", labels, (double)cumulative);
+}
+
+QByteArray OpenMetricsWriter::getContent() const {
+    QByteArray content;
+    for (const auto& family : _families) {
+        content += family.header;
+        content += family.samples;
+    }
+    return content;
+}
@@ -0,0 +1,80 @@
+//
+//  OpenMetrics.h
+//  libraries/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef overte_OpenMetrics_h
+#define overte_OpenMetrics_h
+
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/// A fixed-bucket histogram that can be recorded into from any thread without locking.
+/// Bucket bounds are inclusive upper bounds; values above the last bound land in the implicit +Inf bucket.
+class MetricsHistogram {
+public:
+    using Bounds = std::vector<double>;
+
+    /// Bucket bounds in seconds suited to timing server frames (0.1ms to 1s).
+    static const Bounds& frameTimeBounds();
+
+    MetricsHistogram(const Bounds& upperBounds = frameTimeBounds());
+    MetricsHistogram(const MetricsHistogram& other) = delete;
+    MetricsHistogram& operator=(const MetricsHistogram& other) = delete;
+
+    void record(double value);
+
+    const Bounds& getUpperBounds() const { return _upperBounds; }
+
+    /// Copies the per-bucket (non-cumulative) counts, the total count and the sum of all recorded values.
+    void sample(std::vector<uint64_t>& bucketCounts, uint64_t& count, double& sum) const;
+
+private:
+    Bounds _upperBounds;
+    std::unique_ptr<std::atomic<uint64_t>[]> _bucketCounts;
+    std::atomic<uint64_t> _count { 0 };
+    std::atomic<double> _sum { 0.0 };
+};
+
+/// Builds a scrape response in the Prometheus text exposition format.
+/// Samples may be added in any order; they are grouped by metric family when the content is generated.
+class OpenMetricsWriter {
+public:
+    using Labels = std::vector<std::pair<QString, QString>>;
+
+    static const char* CONTENT_TYPE;
+
+    void addGauge(const QString& name, const QString& help, double value, const Labels& labels = Labels());
+    /// name should not include the "_total" suffix, it is appended for you
+    void addCounter(const QString& name, const QString& help, double value, const Labels& labels = Labels());
+    void addHistogram(const QString& name, const QString& help, const MetricsHistogram& histogram,
+                      const Labels& labels = Labels());
+
+    QByteArray getContent() const;
+
+private:
+    struct Family {
+        QByteArray header;
+        QByteArray samples;
+    };
+
+    Family& getFamily(const QString& name, const QString& help, const char* type);
+    static void writeSample(QByteArray& out, const QString& name, const Labels& labels, double value);
+
+    QVector<Family> _families;
+    QHash<QString, int> _familyIndices;
+};
+
+#endif // overte_OpenMetrics_h
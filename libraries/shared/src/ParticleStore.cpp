@@ -0,0 +1,160 @@
+//
+//  ParticleStore.cpp
+//  libraries/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ParticleStore.h"
+
+void ParticleStore::clear() {
+    _front = 0;
+    _size = 0;
+}
+
+void ParticleStore::grow() {
+    static const size_t MIN_CAPACITY = 64;
+    size_t capacity = std::max(_capacity * 2, MIN_CAPACITY);
+
+    // unwrap the ring while copying, so the oldest particle ends up first
+    for (auto& component : _components) {
+        std::vector<float> grown(capacity);
+        size_t j = 0;
+        forEachSpan([&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                grown[j++] = component[i];
+            }
+        });
+        component.swap(grown);
+    }
+
+    std::vector<uint64_t> grownExpirations(capacity);
+    size_t j = 0;
+    forEachSpan([&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            grownExpirations[j++] = _expirations[i];
+        }
+    });
+    _expirations.swap(grownExpirations);
+
+    _capacity = capacity;
+    _front = 0;
+}
+
+void ParticleStore::push_back(const Particle& particle) {
+    if (_size == _capacity) {
+        grow();
+    }
+
+    size_t i = indexOf(_size);
+    _components[SEED][i] = particle.seed;
+    _components[LIFETIME][i] = particle.lifetime;
+    for (int axis = 0; axis < 3; ++axis) {
+        _components[BASE_POSITION_X + axis][i] = particle.basePosition[axis];
+        _components[RELATIVE_POSITION_X + axis][i] = particle.relativePosition[axis];
+        _components[VELOCITY_X + axis][i] = particle.velocity[axis];
+        _components[ACCELERATION_X + axis][i] = particle.acceleration[axis];
+    }
+    _expirations[i] = particle.expiration;
+    ++_size;
+}
+
+void ParticleStore::pop_front() {
+    if (_size > 0) {
+        _front = indexOf(1);
+        --_size;
+    }
+}
+
+ParticleStore::Particle ParticleStore::at(size_t index) const {
+    size_t i = indexOf(index);
+
+    Particle particle;
+    particle.seed = _components[SEED][i];
+    particle.lifetime = _components[LIFETIME][i];
+    for (int axis = 0; axis < 3; ++axis) {
+        particle.basePosition[axis] = _components[BASE_POSITION_X + axis][i];
+        particle.relativePosition[axis] = _components[RELATIVE_POSITION_X + axis][i];
+        particle.velocity[axis] = _components[VELOCITY_X + axis][i];
+        particle.acceleration[axis] = _components[ACCELERATION_X + axis][i];
+    }
+    particle.expiration = _expirations[i];
+    return particle;
+}
+
+void ParticleStore::rebase(const glm::vec3& basePosition, bool wasTrailing) {
+    forEachSpan([&](size_t begin, size_t end) {
+        for (int axis = 0; axis < 3; ++axis) {
+            float* base = _components[BASE_POSITION_X + axis].data();
+            float* position = _components[RELATIVE_POSITION_X + axis].data();
+            float newBase = basePosition[axis];
+            if (wasTrailing) {
+                for (size_t i = begin; i < end; ++i) {
+                    position[i] += base[i] - newBase;
+                }
+            }
+            for (size_t i = begin; i < end; ++i) {
+                base[i] = newBase;
+            }
+        }
+    });
+}
+
+void ParticleStore::integrate(float deltaTime, uint64_t interval) {
+    const float halfDeltaTimeSquared = 0.5f * deltaTime * deltaTime;
+
+    forEachSpan([&](size_t begin, size_t end) {
+        for (int axis = 0; axis < 3; ++axis) {
+            float* position = _components[RELATIVE_POSITION_X + axis].data();
+            float* velocity = _components[VELOCITY_X + axis].data();
+            const float* acceleration = _components[ACCELERATION_X + axis].data();
+            for (size_t i = begin; i < end; ++i) {
+                position[i] += velocity[i] * deltaTime + halfDeltaTimeSquared * acceleration[i];
+                velocity[i] += acceleration[i] * deltaTime;
+            }
+        }
+
+        float* lifetime = _components[LIFETIME].data();
+        for (size_t i = begin; i < end; ++i) {
+            lifetime[i] += deltaTime;
+        }
+
+        uint64_t* expiration = _expirations.data();
+        for (size_t i = begin; i < end; ++i) {
+            expiration[i] = expiration[i] >= interval ? expiration[i] - interval : 0;
+        }
+    });
+}
+
+void ParticleStore::writeGpuParticles(float* output, bool shouldTrail, const glm::vec3& emitterPosition) const {
+    forEachSpan([&](size_t begin, size_t end) {
+        float* out = output;
+        for (int axis = 0; axis < 3; ++axis) {
+            const float* position = _components[RELATIVE_POSITION_X + axis].data();
+            if (shouldTrail) {
+                const float* base = _components[BASE_POSITION_X + axis].data();
+                for (size_t i = begin; i < end; ++i) {
+                    out[(i - begin) * GPU_PARTICLE_FLOATS + axis] = position[i] + base[i];
+                }
+            } else {
+                float offset = emitterPosition[axis];
+                for (size_t i = begin; i < end; ++i) {
+                    out[(i - begin) * GPU_PARTICLE_FLOATS + axis] = position[i] + offset;
+                }
+            }
+        }
+
+        const float* lifetime = _components[LIFETIME].data();
+        const float* seed = _components[SEED].data();
+        for (size_t i = begin; i < end; ++i) {
+            out[(i - begin) * GPU_PARTICLE_FLOATS + 3] = lifetime[i];
+            out[(i - begin) * GPU_PARTICLE_FLOATS + 4] = seed[i];
+        }
+
+        output += (end - begin) * GPU_PARTICLE_FLOATS;
+    });
+}
@@ -0,0 +1,103 @@
+//
+//  ParticleStore.h
+//  libraries/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_ParticleStore_h
+#define hifi_ParticleStore_h
+
+#include <algorithm>
+#include <array>
+#include <stdint.h>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+/// The particles of one emitter, oldest first. They are kept in a ring buffer with a separate array for each component,
+/// so that stepping them is a few straight loops over contiguous floats rather than a walk over whole particles.
+class ParticleStore {
+public:
+    struct Particle {
+        float seed { 0.0f };
+        uint64_t expiration { 0 };
+        float lifetime { 0.0f };
+        glm::vec3 basePosition;
+        glm::vec3 relativePosition;
+        glm::vec3 velocity;
+        glm::vec3 acceleration;
+    };
+
+    /// What the GPU reads for each particle: its position, then its lifetime and seed
+    static const size_t GPU_PARTICLE_FLOATS = 5;
+
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+    void clear();
+
+    void push_back(const Particle& particle);
+    void pop_front();
+
+    Particle at(size_t index) const;
+    uint64_t frontExpiration() const { return _expirations[_front]; }
+
+    /// Moves every particle onto a new base position. Particles that were trailing stay where they are.
+    void rebase(const glm::vec3& basePosition, bool wasTrailing);
+
+    /// Advances every particle by deltaTime seconds, and counts interval usecs off its expiration
+    void integrate(float deltaTime, uint64_t interval);
+
+    /// Writes every particle, oldest first, as GPU_PARTICLE_FLOATS floats. Trailing particles move relative to their
+    /// own base position, the others follow the emitter.
+    void writeGpuParticles(float* output, bool shouldTrail, const glm::vec3& emitterPosition) const;
+
+private:
+    enum Component {
+        SEED = 0,
+        LIFETIME,
+        BASE_POSITION_X,
+        BASE_POSITION_Y,
+        BASE_POSITION_Z,
+        RELATIVE_POSITION_X,
+        RELATIVE_POSITION_Y,
+        RELATIVE_POSITION_Z,
+        VELOCITY_X,
+        VELOCITY_Y,
+        VELOCITY_Z,
+        ACCELERATION_X,
+        ACCELERATION_Y,
+        ACCELERATION_Z,
+
+        NUM_COMPONENTS
+    };
+
+    size_t indexOf(size_t index) const { return (_front + index) & (_capacity - 1); }
+
+    /// Calls spanOperator(begin, end) for the one or two contiguous runs of array indices the particles are in
+    template <typename F>
+    void forEachSpan(F spanOperator) const {
+        size_t firstEnd = std::min(_front + _size, _capacity);
+        if (_front < firstEnd) {
+            spanOperator(_front, firstEnd);
+        }
+        size_t wrapped = _size - (firstEnd - _front);
+        if (wrapped > 0) {
+            spanOperator((size_t)0, wrapped);
+        }
+    }
+
+    void grow();
+
+    std::array<std::vector<float>, NUM_COMPONENTS> _components;
+    std::vector<uint64_t> _expirations;
+    size_t _capacity { 0 }; // always a power of two
+    size_t _front { 0 };
+    size_t _size { 0 };
+};
+
+#endif // hifi_ParticleStore_h
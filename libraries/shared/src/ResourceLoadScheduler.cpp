@@ -0,0 +1,275 @@
+//
+//  ResourceLoadScheduler.cpp
+//  libraries/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ResourceLoadScheduler.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+#include <QtCore/QThread>
+
+namespace {
+
+class FunctionJob : public ResourceLoadJob {
+public:
+    FunctionJob(ResourceLoadScheduler::Function function, ResourceLoadScheduler::PriorityFunction priority,
+                ResourceLoadScheduler::StaleFunction isStale) :
+        _function(function), _priority(priority), _isStale(isStale) {}
+
+    void run() override { _function(); }
+    float getPriority() const override { return _priority ? _priority() : 0.0f; }
+    bool isStale() const override { return _isStale && _isStale(); }
+
+private:
+    ResourceLoadScheduler::Function _function;
+    ResourceLoadScheduler::PriorityFunction _priority;
+    ResourceLoadScheduler::StaleFunction _isStale;
+};
+
+}
+
+// load priorities follow the camera, so they are kept about as current as a few frames
+const std::chrono::milliseconds ResourceLoadScheduler::PRIORITY_REFRESH_INTERVAL { 100 };
+
+ResourceLoadScheduler& ResourceLoadScheduler::getInstance() {
+    // most of the waiting is on disk, so a couple of I/O threads are enough to keep it busy
+    static const int NUM_IO_THREADS = 2;
+    static ResourceLoadScheduler scheduler(NUM_IO_THREADS, std::max(QThread::idealThreadCount() - 1, 1));
+    return scheduler;
+}
+
+ResourceLoadScheduler::ResourceLoadScheduler(int numIOThreads, int numCPUThreads) {
+    std::array<int, NUM_LANES> numThreads {{ std::max(numIOThreads, 1), std::max(numCPUThreads, 1) }};
+    std::array<const char*, NUM_LANES> laneNames {{ "Resource I/O", "Resource CPU" }};
+
+    for (int lane = 0; lane < NUM_LANES; ++lane) {
+        for (int i = 0; i < numThreads[lane]; ++i) {
+            auto thread = QThread::create([this, lane] { runWorker((Lane)lane); });
+            thread->setObjectName(laneNames[lane]);
+            thread->start(QThread::LowPriority);
+            _threads.push_back(thread);
+        }
+    }
+}
+
+ResourceLoadScheduler::~ResourceLoadScheduler() {
+    {
+        // this runs at exit, after what the cancelled() of the jobs would clean up is gone, so they are just deleted
+        std::unique_lock<std::mutex> lock(_mutex);
+        _isStopping = true;
+        for (auto& queue : _queues) {
+            queue.clear();
+        }
+    }
+    _jobQueued.notify_all();
+
+    for (auto thread : _threads) {
+        thread->wait();
+        delete thread;
+    }
+}
+
+ResourceLoadScheduler::JobID ResourceLoadScheduler::schedule(Lane lane, ResourceLoadJob* job) {
+    std::shared_ptr<ResourceLoadJob> sharedJob(job);
+    float priority = job->getPriority();
+
+    JobID jobID;
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        jobID = _nextJobID++;
+        auto& queue = _queues[lane];
+        queue.push_back({ jobID, priority, std::move(sharedJob) });
+        std::push_heap(queue.begin(), queue.end(), &ResourceLoadScheduler::runsAfter);
+    }
+    _jobQueued.notify_one();
+    return jobID;
+}
+
+ResourceLoadScheduler::JobID ResourceLoadScheduler::schedule(Lane lane, Function function, PriorityFunction priority,
+                                                             StaleFunction isStale) {
+    return schedule(lane, new FunctionJob(function, priority, isStale));
+}
+
+bool ResourceLoadScheduler::cancel(JobID jobID) {
+    std::shared_ptr<ResourceLoadJob> job;
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        for (auto& queue : _queues) {
+            auto it = std::find_if(queue.begin(), queue.end(), [&](const QueuedJob& queuedJob) {
+                return queuedJob.id == jobID;
+            });
+            if (it != queue.end()) {
+                job = std::move(it->job);
+                queue.erase(it);
+                std::make_heap(queue.begin(), queue.end(), &ResourceLoadScheduler::runsAfter);
+                ++_stats.cancelled;
+                break;
+            }
+        }
+    }
+
+    if (!job) {
+        return false;
+    }
+
+    job->cancelled();
+    return true;
+}
+
+void ResourceLoadScheduler::updatePriorities() {
+    std::vector<QueuedJob> droppedJobs;
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        for (int lane = 0; lane < NUM_LANES && !_isStopping; ++lane) {
+            refreshPriorities(lock, (Lane)lane, droppedJobs);
+        }
+    }
+
+    for (auto& droppedJob : droppedJobs) {
+        droppedJob.job->cancelled();
+    }
+}
+
+bool ResourceLoadScheduler::runsAfter(const QueuedJob& a, const QueuedJob& b) {
+    // the earliest of equal priority jobs runs first, so jobs of the same priority keep their order
+    return a.priority < b.priority || (a.priority == b.priority && a.id > b.id);
+}
+
+void ResourceLoadScheduler::refreshPriorities(std::unique_lock<std::mutex>& lock, Lane lane,
+                                              std::vector<QueuedJob>& droppedJobs) {
+    _nextRefreshTimes[lane] = Clock::now() + PRIORITY_REFRESH_INTERVAL;
+
+    struct Refresh {
+        std::shared_ptr<ResourceLoadJob> job;
+        float priority;
+        bool isStale;
+    };
+    std::unordered_map<JobID, Refresh> refreshes;
+    for (const auto& queuedJob : _queues[lane]) {
+        refreshes[queuedJob.id] = { queuedJob.job, 0.0f, false };
+    }
+    if (refreshes.empty()) {
+        return;
+    }
+
+    // the jobs may be taken or cancelled meanwhile, but are kept alive by the refresh
+    lock.unlock();
+    for (auto& refresh : refreshes) {
+        refresh.second.isStale = refresh.second.job->isStale();
+        if (!refresh.second.isStale) {
+            refresh.second.priority = refresh.second.job->getPriority();
+        }
+    }
+    lock.lock();
+
+    // jobs scheduled meanwhile keep the priority they were scheduled with
+    auto& queue = _queues[lane];
+    for (auto it = queue.begin(); it != queue.end();) {
+        auto refresh = refreshes.find(it->id);
+        if (refresh != refreshes.end() && refresh->second.isStale) {
+            droppedJobs.push_back(std::move(*it));
+            it = queue.erase(it);
+            ++_stats.cancelled;
+            continue;
+        }
+        if (refresh != refreshes.end()) {
+            it->priority = refresh->second.priority;
+        }
+        ++it;
+    }
+    std::make_heap(queue.begin(), queue.end(), &ResourceLoadScheduler::runsAfter);
+}
+
+void ResourceLoadScheduler::runWorker(Lane lane) {
+    while (true) {
+        QueuedJob job;
+        std::vector<QueuedJob> droppedJobs;
+        Lane jobLane = lane;
+
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _jobQueued.wait(lock, [&] {
+                return _isStopping || std::any_of(_queues.begin(), _queues.end(), [](const Queue& queue) {
+                    return !queue.empty();
+                });
+            });
+
+            auto now = Clock::now();
+            for (int refreshLane = 0; refreshLane < NUM_LANES && !_isStopping; ++refreshLane) {
+                if (now >= _nextRefreshTimes[refreshLane] && !_queues[refreshLane].empty()) {
+                    refreshPriorities(lock, (Lane)refreshLane, droppedJobs);
+                }
+            }
+
+            if (_isStopping) {
+                return;
+            }
+
+            // a thread out of work in its own lane takes the next job of another
+            for (int i = 0; i < NUM_LANES && !job.job; ++i) {
+                auto takeLane = (Lane)((lane + i) % NUM_LANES);
+                auto& queue = _queues[takeLane];
+                if (!queue.empty()) {
+                    std::pop_heap(queue.begin(), queue.end(), &ResourceLoadScheduler::runsAfter);
+                    job = std::move(queue.back());
+                    queue.pop_back();
+                    jobLane = takeLane;
+                }
+            }
+
+            if (job.job) {
+                ++_stats.running[jobLane];
+                if (jobLane != lane) {
+                    ++_stats.stolen;
+                }
+            }
+        }
+
+        for (auto& droppedJob : droppedJobs) {
+            droppedJob.job->cancelled();
+        }
+        droppedJobs.clear();
+
+        if (!job.job) {
+            continue;
+        }
+
+        // the job may have gone stale since its priority was last asked for
+        bool isStale = job.job->isStale();
+        if (isStale) {
+            job.job->cancelled();
+        } else {
+            job.job->run();
+        }
+        job.job.reset();
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        --_stats.running[jobLane];
+        if (isStale) {
+            ++_stats.cancelled;
+            if (jobLane != lane) {
+                --_stats.stolen;
+            }
+        } else {
+            ++_stats.completed;
+        }
+    }
+}
+
+ResourceLoadScheduler::Stats ResourceLoadScheduler::getStats() const {
+    std::unique_lock<std::mutex> lock(_mutex);
+    Stats stats = _stats;
+    for (int lane = 0; lane < NUM_LANES; ++lane) {
+        stats.queued[lane] = _queues[lane].size();
+    }
+    return stats;
+}
@@ -0,0 +1,129 @@
+//
+//  ResourceLoadScheduler.h
+//  libraries/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_ResourceLoadScheduler_h
+#define hifi_ResourceLoadScheduler_h
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class QThread;
+
+/// Work for the ResourceLoadScheduler. Like a QRunnable with autoDelete set, the scheduler deletes a job once it has run,
+/// or once it has been dropped without running.
+class ResourceLoadJob {
+public:
+    virtual ~ResourceLoadJob() {}
+
+    virtual void run() = 0;
+
+    /// Jobs with a higher priority run first. The priority is asked for when the job is scheduled, and again while it
+    /// waits, so it can follow the live load priority of whatever the job loads. Called from any thread.
+    virtual float getPriority() const { return 0.0f; }
+
+    /// Stale jobs are dropped without running, e.g. once nothing needs the resource they would load. Asked for along with
+    /// the priority, and once more before the job runs. Called from any thread.
+    virtual bool isStale() const { return false; }
+
+    /// Called instead of run when the job is dropped
+    virtual void cancelled() {}
+};
+
+/// Runs the decoding and processing work of resource loading, ordered by load priority rather than in submission order.
+///
+/// Jobs go to one of two lanes, each with its own threads: I/O for work that mostly waits on disk, and CPU for decoding
+/// and processing. A thread that runs out of work in its own lane takes the highest priority job of the other lane,
+/// so neither lane idles while the other has a backlog.
+///
+/// Each lane keeps its jobs in a heap ordered by their last known priority, so picking a job doesn't ask every waiting
+/// job for its priority. Those are asked for again at most every PRIORITY_REFRESH_INTERVAL by the next thread to pick a
+/// job, or right away with updatePriorities, outside of the lock the threads share.
+class ResourceLoadScheduler {
+public:
+    enum Lane {
+        IO = 0,
+        CPU,
+
+        NUM_LANES
+    };
+
+    using JobID = uint64_t;
+    static const JobID INVALID_JOB_ID { 0 };
+
+    static const std::chrono::milliseconds PRIORITY_REFRESH_INTERVAL;
+
+    using Function = std::function<void()>;
+    using PriorityFunction = std::function<float()>;
+    using StaleFunction = std::function<bool()>;
+
+    struct Stats {
+        std::array<size_t, NUM_LANES> queued {{ 0, 0 }};
+        std::array<size_t, NUM_LANES> running {{ 0, 0 }};
+        uint64_t completed { 0 };
+        uint64_t cancelled { 0 };
+        uint64_t stolen { 0 }; // jobs run by a thread of the other lane
+    };
+
+    static ResourceLoadScheduler& getInstance();
+
+    ResourceLoadScheduler(int numIOThreads, int numCPUThreads);
+    ~ResourceLoadScheduler();
+
+    /// Takes ownership of the job
+    JobID schedule(Lane lane, ResourceLoadJob* job);
+    JobID schedule(Lane lane, Function function, PriorityFunction priority = PriorityFunction(),
+                   StaleFunction isStale = StaleFunction());
+
+    /// Drops a job that hasn't started yet. Returns false if it already started or finished.
+    bool cancel(JobID jobID);
+
+    /// Asks every waiting job for its priority now, for when load priorities have just changed
+    void updatePriorities();
+
+    Stats getStats() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct QueuedJob {
+        JobID id;
+        float priority; // as of when it was last asked for
+        std::shared_ptr<ResourceLoadJob> job; // shared with a refresh of the priorities, which runs without the lock
+    };
+    using Queue = std::vector<QueuedJob>; // a heap, with the job to run next in front
+
+    /// Whether a runs after b
+    static bool runsAfter(const QueuedJob& a, const QueuedJob& b);
+
+    void runWorker(Lane lane);
+
+    /// Asks the jobs of the lane for their priority, with the lock released meanwhile, and moves the stale ones to
+    /// droppedJobs
+    void refreshPriorities(std::unique_lock<std::mutex>& lock, Lane lane, std::vector<QueuedJob>& droppedJobs);
+
+    mutable std::mutex _mutex;
+    std::condition_variable _jobQueued;
+    std::array<Queue, NUM_LANES> _queues;
+    std::array<Clock::time_point, NUM_LANES> _nextRefreshTimes;
+    JobID _nextJobID { INVALID_JOB_ID + 1 };
+    bool _isStopping { false };
+
+    Stats _stats;
+
+    std::vector<QThread*> _threads;
+};
+
+#endif // hifi_ResourceLoadScheduler_h
@@ -43,12 +43,15 @@ extern "C" FILE * __cdecl __iob_func(void) {
 
 #ifdef __APPLE__
 #include <CoreFoundation/CoreFoundation.h>
+#include <mach/mach.h>
 #endif
 
 
 #if defined(Q_OS_LINUX) || defined(Q_OS_MAC)
 #include <signal.h>
 #include <cerrno>
+#include <sys/resource.h>
+#include <unistd.h>
 #endif
 
 #include <QtCore/QDebug>
@@ -891,6 +894,65 @@ bool getMemoryInfo(MemoryInfo& info) {
     return false;
 }
 
+bool getProcessUsageInfo(ProcessUsageInfo& info) {
+#if defined(Q_OS_WIN)
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime)) {
+        return false;
+    }
+    auto toUsecs = [](const FILETIME& time) {
+        // FILETIME counts 100ns intervals
+        return ((uint64_t)time.dwHighDateTime << 32 | time.dwLowDateTime) / 10;
+    };
+    info.cpuTimeUsecs = toUsecs(kernelTime) + toUsecs(userTime);
+
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) {
+        return false;
+    }
+    info.residentMemoryBytes = pmc.WorkingSetSize;
+    info.peakResidentMemoryBytes = pmc.PeakWorkingSetSize;
+    return true;
+#elif defined(Q_OS_LINUX) || defined(Q_OS_MAC)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return false;
+    }
+    info.cpuTimeUsecs = (uint64_t)(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * USECS_PER_SECOND +
+        usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+
+#if defined(Q_OS_MAC)
+    mach_task_basic_info_data_t taskInfo;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&taskInfo, &count) != KERN_SUCCESS) {
+        return false;
+    }
+    info.residentMemoryBytes = taskInfo.resident_size;
+    // ru_maxrss is in bytes on macOS
+    info.peakResidentMemoryBytes = usage.ru_maxrss;
+#else
+    // the second field of statm is the resident set size, in pages
+    FILE* statm = fopen("/proc/self/statm", "r");
+    if (!statm) {
+        return false;
+    }
+    unsigned long totalPages = 0;
+    unsigned long residentPages = 0;
+    bool parsed = fscanf(statm, "%lu %lu", &totalPages, &residentPages) == 2;
+    fclose(statm);
+    if (!parsed) {
+        return false;
+    }
+    info.residentMemoryBytes = (uint64_t)residentPages * sysconf(_SC_PAGESIZE);
+    // and in kilobytes on Linux
+    info.peakResidentMemoryBytes = (uint64_t)usage.ru_maxrss * 1024;
+#endif
+    return true;
+#else
+    return false;
+#endif
+}
+
 // Largely taken from: https://msdn.microsoft.com/en-us/library/windows/desktop/ms683194(v=vs.85).aspx
 
 #ifdef Q_OS_WIN
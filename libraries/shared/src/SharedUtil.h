@@ -207,6 +207,14 @@ struct MemoryInfo {
 
 bool getMemoryInfo(MemoryInfo& info);
 
+struct ProcessUsageInfo {
+    uint64_t cpuTimeUsecs; // user and system time of all threads since the process started
+    uint64_t residentMemoryBytes;
+    uint64_t peakResidentMemoryBytes; // the most the resident memory has been since the process started
+};
+
+bool getProcessUsageInfo(ProcessUsageInfo& info);
+
 struct ProcessorInfo {
     int32_t numPhysicalProcessorPackages;
     int32_t numProcessorCores;
@@ -8,28 +8,69 @@
 
 #include "StatTracker.h"
 
+const size_t StatTracker::Counter::CACHE_LINE_SIZE;
+
+int StatTracker::Counter::getShardIndex() {
+    static std::atomic<int> nextShard { 0 };
+    thread_local int shard = nextShard++ % NUM_SHARDS;
+    return shard;
+}
+
+void StatTracker::Counter::set(int64_t value) {
+    for (int i = 1; i < NUM_SHARDS; ++i) {
+        _shards[i].value.store(0, std::memory_order_relaxed);
+    }
+    _shards[0].value.store(value, std::memory_order_relaxed);
+}
+
+int64_t StatTracker::Counter::get() const {
+    int64_t total = 0;
+    for (const auto& shard : _shards) {
+        total += shard.value.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
 StatTracker::StatTracker() {
     
 }
 
+StatTracker::CounterPointer StatTracker::getCounter(const QString& name) {
+    {
+        QReadLocker readLock(&_countersLock);
+        auto itr = _counters.constFind(name);
+        if (itr != _counters.constEnd()) {
+            return itr.value();
+        }
+    }
+
+    QWriteLocker writeLock(&_countersLock);
+    auto& counter = _counters[name];
+    if (!counter) {
+        counter = CounterPointer(new Counter());
+    }
+    return counter;
+}
+
 QVariant StatTracker::getStat(const QString& name) {
-    std::lock_guard<std::mutex> lock(_statsLock);
-    return QVariant::fromValue<int64_t>(_stats[name]);
+    return QVariant::fromValue<int64_t>(getCounter(name)->get());
+}
+
+QVariantMap StatTracker::getStats() {
+    QVariantMap stats;
+    QReadLocker readLock(&_countersLock);
+    for (auto itr = _counters.constBegin(); itr != _counters.constEnd(); ++itr) {
+        stats[itr.key()] = QVariant::fromValue<int64_t>(itr.value()->get());
+    }
+    return stats;
 }
 
 void StatTracker::setStat(const QString& name, int64_t value) {
-    Lock lock(_statsLock);
-    _stats[name] = value;
+    getCounter(name)->set(value);
 }
 
 void StatTracker::updateStat(const QString& name, int64_t value) {
-    Lock lock(_statsLock);
-    auto itr = _stats.find(name);
-    if (_stats.end() == itr) {
-        _stats[name] = value;
-    } else {
-        *itr = *itr + value;
-    }
+    getCounter(name)->update(value);
 }
 
 void StatTracker::incrementStat(const QString& name) {
@@ -38,4 +79,4 @@ void StatTracker::incrementStat(const QString& name) {
 
 void StatTracker::decrementStat(const QString& name) {
     updateStat(name, -1);
-}
\ No newline at end of file
+}
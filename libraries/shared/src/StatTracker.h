@@ -12,8 +12,11 @@
 #include <QtCore/QVariant>
 #include <QtCore/QSet>
 #include <QtCore/QVariantMap>
+#include <QtCore/QReadWriteLock>
 
-#include <mutex>
+#include <array>
+#include <atomic>
+#include <memory>
 
 #include "DependencyManager.h"
 #include "Trace.h"
@@ -22,27 +25,63 @@ using EditStatFunction = std::function<QVariant(QVariant currentValue)>;
 
 class StatTracker : public Dependency {
 public:
+    // A single named counter.  Writers only touch the shard owned by their thread, so counters that are
+    // bumped from many threads at once do not bounce one cache line around; readers sum all the shards.
+    class Counter {
+    public:
+        static const int NUM_SHARDS = 16;
+        static const size_t CACHE_LINE_SIZE = 64;
+
+        // operator new does not honour over-aligned types before C++17, so counters align their own storage
+        static void* operator new(size_t size) { return qMallocAligned(size, CACHE_LINE_SIZE); }
+        static void operator delete(void* pointer) { qFreeAligned(pointer); }
+
+        void update(int64_t value) { _shards[getShardIndex()].value.fetch_add(value, std::memory_order_relaxed); }
+        void increment() { update(1); }
+        void decrement() { update(-1); }
+
+        // Not atomic with respect to concurrent updates: an update racing with set() may be lost.
+        void set(int64_t value);
+        int64_t get() const;
+
+    private:
+        static int getShardIndex();
+
+        // aligned so that neighbouring shards never share a cache line
+        struct alignas(CACHE_LINE_SIZE) Shard {
+            std::atomic<int64_t> value { 0 };
+        };
+        static_assert(sizeof(Shard) == CACHE_LINE_SIZE, "StatTracker::Counter::Shard size doesn't match.");
+        std::array<Shard, NUM_SHARDS> _shards;
+    };
+    using CounterPointer = std::shared_ptr<Counter>;
+
     StatTracker();
+
+    // Returns the counter registered under name, registering it on first use.  Hot paths should hold on to
+    // the returned handle instead of going through the name based calls below.
+    CounterPointer getCounter(const QString& name);
+
     QVariant getStat(const QString& name);
+    QVariantMap getStats();
     void setStat(const QString& name, int64_t value);
     void updateStat(const QString& name, int64_t mod);
     void incrementStat(const QString& name);
     void decrementStat(const QString& name);
 private:
-    using Mutex = std::mutex;
-    using Lock = std::lock_guard<Mutex>;
-    Mutex _statsLock;
-    QHash<QString, int64_t> _stats;
+    QReadWriteLock _countersLock;
+    QHash<QString, CounterPointer> _counters;
 };
 
 class CounterStat {
 public:
-    CounterStat(QString name) : _name(name) {
-        DependencyManager::get<StatTracker>()->incrementStat(_name);
-    }    
+    CounterStat(QString name) : CounterStat(DependencyManager::get<StatTracker>()->getCounter(name)) {}
+    CounterStat(StatTracker::CounterPointer counter) : _counter(counter) {
+        _counter->increment();
+    }
     ~CounterStat() {
-        DependencyManager::get<StatTracker>()->decrementStat(_name);
-    }    
+        _counter->decrement();
+    }
 private:
-    QString _name;
+    StatTracker::CounterPointer _counter;
 };
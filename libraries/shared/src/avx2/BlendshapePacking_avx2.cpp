@@ -282,4 +282,23 @@ void packBlendshapeOffsets_AVX2(float (*unpacked)[9], uint32_t (*packed)[4], int
     _mm256_zeroupper();
 }
 
+// offsets += coefficient * blocks, for blocks of 8 consecutive vertices of 9 floats each
+void accumulateBlendshapeBlocks_AVX2(float (*offsets)[72], const float (*blocks)[72], const int* blockIndices, int numBlocks, float coefficient) {
+
+    __m256 c = _mm256_set1_ps(coefficient);
+
+    for (int i = 0; i < numBlocks; i++) {
+        float* dst = offsets[blockIndices[i]];
+        const float* src = blocks[i];
+
+        for (int j = 0; j < 72; j += 8) {
+            __m256 d = _mm256_loadu_ps(&dst[j]);
+            __m256 s = _mm256_loadu_ps(&src[j]);
+            _mm256_storeu_ps(&dst[j], _mm256_add_ps(d, _mm256_mul_ps(s, c)));
+        }
+    }
+
+    _mm256_zeroupper();
+}
+
 #endif
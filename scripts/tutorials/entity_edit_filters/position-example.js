@@ -42,4 +42,6 @@ function filter(properties, type, originalProperties) {
     return properties;
 }
 filter.wantsOriginalProperties = "position";
+/* Edits that don't move the entity are accepted without calling the filter. */
+filter.wantsProperties = "position";
 filter;
\ No newline at end of file
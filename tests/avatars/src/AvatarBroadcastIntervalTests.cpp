@@ -0,0 +1,108 @@
+//
+//  AvatarBroadcastIntervalTests.cpp
+//  tests/avatars/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AvatarBroadcastIntervalTests.h"
+
+#include <algorithm>
+
+#include <QtTest/QtTest>
+
+#include <AvatarBroadcastInterval.h>
+
+QTEST_MAIN(AvatarBroadcastIntervalTests)
+
+// Runs broadcast frames until the next one that sends to the listener, and returns how many frames that took
+static int framesToNextBroadcast(AvatarBroadcastInterval& interval) {
+    int frames = 1;
+    while (!interval.isBroadcastFrame()) {
+        ++frames;
+    }
+    return frames;
+}
+
+void AvatarBroadcastIntervalTests::testQuietBackOff() {
+    AvatarBroadcastInterval interval;
+    QCOMPARE(interval.getInterval(), 1);
+    QVERIFY(interval.isBroadcastFrame());
+
+    // one more frame between broadcasts for every few quiet broadcasts, up to the limit
+    for (int expected = 1; expected <= AvatarBroadcastInterval::MAX_QUIET_INTERVAL; ++expected) {
+        for (int i = 0; i < AvatarBroadcastInterval::QUIET_BROADCASTS_PER_STEP - 1; ++i) {
+            interval.update(0);
+            QCOMPARE(interval.getInterval(), expected);
+            QCOMPARE(framesToNextBroadcast(interval), expected);
+        }
+        interval.update(0);
+        QCOMPARE(interval.getInterval(), std::min(expected + 1, (int)AvatarBroadcastInterval::MAX_QUIET_INTERVAL));
+        QCOMPARE(framesToNextBroadcast(interval), interval.getInterval());
+    }
+
+    for (int i = 0; i < 10 * AvatarBroadcastInterval::QUIET_BROADCASTS_PER_STEP; ++i) {
+        interval.update(0);
+    }
+    QCOMPARE(interval.getInterval(), (int)AvatarBroadcastInterval::MAX_QUIET_INTERVAL);
+}
+
+void AvatarBroadcastIntervalTests::testChangeResetsToFullRate() {
+    AvatarBroadcastInterval interval;
+    for (int i = 0; i < 10 * AvatarBroadcastInterval::QUIET_BROADCASTS_PER_STEP; ++i) {
+        interval.update(0);
+    }
+    QCOMPARE(interval.getInterval(), (int)AvatarBroadcastInterval::MAX_QUIET_INTERVAL);
+
+    // a single changed avatar puts the listener straight back at the full rate
+    interval.update(1);
+    QCOMPARE(interval.getInterval(), 1);
+    QCOMPARE(framesToNextBroadcast(interval), 1);
+
+    // and the back off starts over
+    for (int i = 0; i < AvatarBroadcastInterval::QUIET_BROADCASTS_PER_STEP - 1; ++i) {
+        interval.update(0);
+        QCOMPARE(interval.getInterval(), 1);
+    }
+    interval.update(0);
+    QCOMPARE(interval.getInterval(), 2);
+
+    // quiet broadcasts in between changes don't add up
+    for (int i = 0; i < AvatarBroadcastInterval::QUIET_BROADCASTS_PER_STEP - 1; ++i) {
+        interval.update(0);
+    }
+    interval.update(3);
+    QCOMPARE(interval.getInterval(), 1);
+    for (int i = 0; i < AvatarBroadcastInterval::QUIET_BROADCASTS_PER_STEP - 1; ++i) {
+        interval.update(0);
+        QCOMPARE(interval.getInterval(), 1);
+    }
+}
+
+void AvatarBroadcastIntervalTests::testLowPowerMode() {
+    AvatarBroadcastInterval interval;
+    interval.setLowPowerMode(true);
+    QVERIFY(interval.isLowPowerMode());
+
+    // changing avatars don't bring a low power listener back to the full rate
+    interval.update(5);
+    QCOMPARE(interval.getInterval(), (int)AvatarBroadcastInterval::LOW_POWER_INTERVAL);
+    QCOMPARE(framesToNextBroadcast(interval), (int)AvatarBroadcastInterval::LOW_POWER_INTERVAL);
+    interval.update(0);
+    QCOMPARE(interval.getInterval(), (int)AvatarBroadcastInterval::LOW_POWER_INTERVAL);
+
+    // leaving low power mode broadcasts on the very next frame
+    interval.setLowPowerMode(false);
+    QVERIFY(!interval.isLowPowerMode());
+    QCOMPARE(interval.getInterval(), 1);
+    QVERIFY(interval.isBroadcastFrame());
+
+    // staying in low power mode doesn't reset anything
+    interval.setLowPowerMode(true);
+    interval.update(0);
+    interval.setLowPowerMode(true);
+    QCOMPARE(interval.getInterval(), (int)AvatarBroadcastInterval::LOW_POWER_INTERVAL);
+}
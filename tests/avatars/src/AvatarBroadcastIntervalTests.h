@@ -0,0 +1,24 @@
+//
+//  AvatarBroadcastIntervalTests.h
+//  tests/avatars/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef overte_AvatarBroadcastIntervalTests_h
+#define overte_AvatarBroadcastIntervalTests_h
+
+#include <QtCore/QObject>
+
+class AvatarBroadcastIntervalTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testQuietBackOff();
+    void testChangeResetsToFullRate();
+    void testLowPowerMode();
+};
+
+#endif // overte_AvatarBroadcastIntervalTests_h
@@ -0,0 +1,125 @@
+//
+//  BatchedAvatarPositionTests.cpp
+//  tests/avatars/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BatchedAvatarPositionTests.h"
+
+#include <cfloat>
+#include <random>
+
+#include <QtTest/QtTest>
+
+#include <AvatarData.h>
+
+#include <test-utils/GLMTestUtils.h>
+
+QTEST_MAIN(BatchedAvatarPositionTests)
+
+using namespace AvatarDataPacket;
+
+static float stepOfTier(int tier) {
+    return BATCHED_POSITION_MIN_STEP * (float)(1 << tier);
+}
+
+// the largest offset each component can hold at the coarsest tier
+static const float MAX_BATCHED_OFFSET = (float)INT16_MAX * stepOfTier(BATCHED_POSITION_MAX_TIER);
+
+// Packs and unpacks the offset, checking that each component comes back within half a step of the tier it was packed at,
+// and that no finer tier could have held it
+static void verifyRoundTrip(const glm::vec3& offset) {
+    const uint16_t LOCAL_ID = 1234;
+    auto packed = packBatchedAvatarPosition(LOCAL_ID, offset);
+    QCOMPARE(packed.localID, LOCAL_ID);
+    QVERIFY(packed.tier <= BATCHED_POSITION_MAX_TIER);
+
+    float step = stepOfTier(packed.tier);
+    glm::vec3 unpacked = unpackBatchedAvatarPosition(packed);
+    for (int i = 0; i < 3; i++) {
+        // allow for the float rounding of offsets many steps from the origin
+        float bound = 0.5f * step + glm::abs(offset[i]) * FLT_EPSILON;
+        if (glm::abs(unpacked[i] - offset[i]) > bound) {
+            QFAIL(qPrintable(QString("component %1 of (%2, %3, %4) came back as %5, more than %6 off")
+                                 .arg(i).arg(offset.x).arg(offset.y).arg(offset.z).arg(unpacked[i]).arg(bound)));
+        }
+    }
+
+    if (packed.tier > 0) {
+        float largestComponent = glm::max(glm::abs(offset.x), glm::max(glm::abs(offset.y), glm::abs(offset.z)));
+        QVERIFY(largestComponent / stepOfTier(packed.tier - 1) > (float)INT16_MAX);
+    }
+}
+
+void BatchedAvatarPositionTests::testRoundTripErrorBound() {
+    std::mt19937 generator(1);
+
+    // from a few millimeters up to the edge of the coarsest tier, on both sides of the origin
+    for (float range = 0.01f; range < MAX_BATCHED_OFFSET; range *= 2.0f) {
+        std::uniform_real_distribution<float> distribution(-range, range);
+        for (int i = 0; i < 100; i++) {
+            verifyRoundTrip(glm::vec3(distribution(generator), distribution(generator), distribution(generator)));
+        }
+    }
+
+    verifyRoundTrip(glm::vec3(0.0f));
+    QCOMPARE(unpackBatchedAvatarPosition(packBatchedAvatarPosition(0, glm::vec3(0.0f))), glm::vec3(0.0f));
+}
+
+void BatchedAvatarPositionTests::testTierBoundary() {
+    // tier 0 reaches just short of 128m
+    float tierZeroRange = (float)INT16_MAX * BATCHED_POSITION_MIN_STEP;
+    QCOMPARE(packBatchedAvatarPosition(0, glm::vec3(tierZeroRange, 0.0f, 0.0f)).tier, (uint8_t)0);
+    QCOMPARE(packBatchedAvatarPosition(0, glm::vec3(0.0f, 0.0f, -tierZeroRange)).tier, (uint8_t)0);
+    QCOMPARE(packBatchedAvatarPosition(0, glm::vec3(128.0f, 0.0f, 0.0f)).tier, (uint8_t)1);
+    QCOMPARE(packBatchedAvatarPosition(0, glm::vec3(0.0f, -128.0f, 0.0f)).tier, (uint8_t)1);
+
+    // the largest component picks the tier for all of them, so the small ones lose precision alongside it
+    auto packed = packBatchedAvatarPosition(0, glm::vec3(1000.0f, 0.01f, 0.0f));
+    QCOMPARE(packed.tier, (uint8_t)3);
+    QCOMPARE(packed.offset[1], (int16_t)0);
+    verifyRoundTrip(glm::vec3(1000.0f, 0.01f, 0.0f));
+}
+
+void BatchedAvatarPositionTests::testNegativeOffsets() {
+    std::mt19937 generator(2);
+    std::uniform_real_distribution<float> distribution(0.0f, 10000.0f);
+
+    // negative offsets pack as the mirror image of positive ones
+    for (int i = 0; i < 1000; i++) {
+        glm::vec3 offset(distribution(generator), distribution(generator), distribution(generator));
+        auto positive = packBatchedAvatarPosition(0, offset);
+        auto negative = packBatchedAvatarPosition(0, -offset);
+        QCOMPARE(negative.tier, positive.tier);
+        for (int j = 0; j < 3; j++) {
+            QCOMPARE(negative.offset[j], (int16_t)-positive.offset[j]);
+        }
+        QCOMPARE(unpackBatchedAvatarPosition(negative), -unpackBatchedAvatarPosition(positive));
+    }
+
+    // and mixed signs keep each component's own
+    glm::vec3 offset(-3.5f, 12.25f, -0.5f);
+    QCOMPARE(unpackBatchedAvatarPosition(packBatchedAvatarPosition(0, offset)), offset);
+}
+
+void BatchedAvatarPositionTests::testOutOfRangeOffsets() {
+    // beyond the coarsest tier, components stop at the edge of the range rather than wrapping around
+    auto packed = packBatchedAvatarPosition(0, glm::vec3(1.0e7f, -1.0e7f, 1.0f));
+    QCOMPARE(packed.tier, BATCHED_POSITION_MAX_TIER);
+    QCOMPARE(packed.offset[0], (int16_t)INT16_MAX);
+    QCOMPARE(packed.offset[1], (int16_t)-INT16_MAX);
+    QCOMPARE(packed.offset[2], (int16_t)0);
+    QCOMPARE(unpackBatchedAvatarPosition(packed), glm::vec3(MAX_BATCHED_OFFSET, -MAX_BATCHED_OFFSET, 0.0f));
+
+    packed = packBatchedAvatarPosition(0, glm::vec3(-FLT_MAX));
+    QCOMPARE(packed.tier, BATCHED_POSITION_MAX_TIER);
+    QCOMPARE(unpackBatchedAvatarPosition(packed), glm::vec3(-MAX_BATCHED_OFFSET));
+
+    // a tier past the last one, as a bad packet would have, reads as the last one
+    packed.tier = 255;
+    QCOMPARE(unpackBatchedAvatarPosition(packed), glm::vec3(-MAX_BATCHED_OFFSET));
+}
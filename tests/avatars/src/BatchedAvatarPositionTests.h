@@ -0,0 +1,25 @@
+//
+//  BatchedAvatarPositionTests.h
+//  tests/avatars/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef overte_BatchedAvatarPositionTests_h
+#define overte_BatchedAvatarPositionTests_h
+
+#include <QtCore/QObject>
+
+class BatchedAvatarPositionTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testRoundTripErrorBound();
+    void testTierBoundary();
+    void testNegativeOffsets();
+    void testOutOfRangeOffsets();
+};
+
+#endif // overte_BatchedAvatarPositionTests_h
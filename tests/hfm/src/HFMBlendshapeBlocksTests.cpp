@@ -0,0 +1,168 @@
+//
+//  HFMBlendshapeBlocksTests.cpp
+//  tests/hfm/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "HFMBlendshapeBlocksTests.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#include <QtTest/QtTest>
+
+#include <CPUDetect.h>
+#include <hfm/HFMBlendshapeBlocks.h>
+
+#include <test-utils/GLMTestUtils.h>
+#include <test-utils/QTestExtensions.h>
+
+QTEST_MAIN(HFMBlendshapeBlocksTests)
+
+const float EPSILON = 1.0e-4f;
+
+static glm::vec3 randomVec3(std::mt19937& generator) {
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    return glm::vec3(distribution(generator), distribution(generator), distribution(generator));
+}
+
+// a model with a mesh whose blendshapes each move a random few of its vertices
+static HFMModel makeModel(int numVertices, int numBlendshapes, int verticesPerBlendshape) {
+    std::mt19937 generator(1);
+    std::uniform_int_distribution<int> vertexDistribution(0, numVertices - 1);
+
+    HFMMesh mesh;
+    for (int i = 0; i < numVertices; ++i) {
+        mesh.vertices.push_back(randomVec3(generator));
+    }
+    for (int i = 0; i < numBlendshapes; ++i) {
+        HFMBlendshape blendshape;
+        for (int j = 0; j < verticesPerBlendshape; ++j) {
+            blendshape.indices.push_back(vertexDistribution(generator));
+            blendshape.vertices.push_back(randomVec3(generator));
+            blendshape.normals.push_back(randomVec3(generator));
+            blendshape.tangents.push_back(randomVec3(generator));
+        }
+        mesh.blendshapes.push_back(blendshape);
+    }
+
+    HFMModel hfmModel;
+    hfmModel.meshes.push_back(mesh);
+    return hfmModel;
+}
+
+void HFMBlendshapeBlocksTests::testAccumulateAVX2MatchesReference() {
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+    if (!cpuSupportsAVX2()) {
+        QSKIP("AVX2 is not supported on this cpu");
+    }
+
+    const int NUM_BLOCKS = 37;
+    const int NUM_MOVED_BLOCKS = 11;
+    std::mt19937 generator(2);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    std::vector<BlendshapeOffsetUnpacked> reference(NUM_BLOCKS * BLENDSHAPE_BLOCK_SIZE);
+    for (auto& offset : reference) {
+        offset.positionOffset = randomVec3(generator);
+        offset.normalOffset = randomVec3(generator);
+        offset.tangentOffset = randomVec3(generator);
+    }
+    auto avx2 = reference;
+
+    std::vector<int> blockIndices(NUM_BLOCKS);
+    std::iota(blockIndices.begin(), blockIndices.end(), 0);
+    std::shuffle(blockIndices.begin(), blockIndices.end(), generator);
+    blockIndices.resize(NUM_MOVED_BLOCKS);
+
+    std::vector<float> blocks(NUM_MOVED_BLOCKS * BLENDSHAPE_BLOCK_FLOATS);
+    for (auto& value : blocks) {
+        value = distribution(generator);
+    }
+
+    for (float coefficient : { 0.25f, -0.7f, 1.0f }) {
+        accumulateBlendshapeBlocks_ref(reference.data(), blocks.data(), blockIndices.data(), NUM_MOVED_BLOCKS, coefficient);
+        accumulateBlendshapeBlocks_AVX2((float(*)[72])avx2.data(), (const float(*)[72])blocks.data(), blockIndices.data(),
+                                        NUM_MOVED_BLOCKS, coefficient);
+    }
+
+    for (size_t i = 0; i < reference.size(); ++i) {
+        QCOMPARE_WITH_ABS_ERROR(avx2[i].positionOffset, reference[i].positionOffset, EPSILON);
+        QCOMPARE_WITH_ABS_ERROR(avx2[i].normalOffset, reference[i].normalOffset, EPSILON);
+        QCOMPARE_WITH_ABS_ERROR(avx2[i].tangentOffset, reference[i].tangentOffset, EPSILON);
+    }
+#else
+    QSKIP("AVX2 is only available on x86");
+#endif
+}
+
+void HFMBlendshapeBlocksTests::testLayoutKeepsOnlyMovedBlocks() {
+    const int NUM_VERTICES = 8 * BLENDSHAPE_BLOCK_SIZE;
+
+    HFMMesh mesh;
+    mesh.vertices.resize(NUM_VERTICES);
+    HFMBlendshape blendshape;
+    for (int index : { 3, 5, 42 }) {
+        blendshape.indices.push_back(index);
+        blendshape.vertices.push_back(glm::vec3((float)index));
+        blendshape.normals.push_back(glm::vec3(1.0f));
+    }
+    mesh.blendshapes.push_back(blendshape);
+
+    HFMModel hfmModel;
+    hfmModel.meshes.push_back(mesh);
+    hfmModel.meshes.push_back(HFMMesh()); // without blendshapes
+
+    hfm::BlendshapeLayout layout(hfmModel);
+    const auto& meshes = layout.getMeshes();
+    QCOMPARE((int)meshes.size(), 2);
+    QCOMPARE(meshes[0].numVertices, NUM_VERTICES);
+    QCOMPARE(meshes[1].numVertices, 0);
+
+    const auto& blocks = meshes[0].blendshapes[0];
+    QCOMPARE(blocks.blockIndices, std::vector<int>({ 0, 42 / BLENDSHAPE_BLOCK_SIZE }));
+    QCOMPARE((int)blocks.blocks.size(), 2 * BLENDSHAPE_BLOCK_FLOATS);
+
+    auto offsets = (const BlendshapeOffsetUnpacked*)blocks.blocks.data();
+    QCOMPARE_WITH_ABS_ERROR(offsets[5].positionOffset, glm::vec3(5.0f), EPSILON);
+    QCOMPARE_WITH_ABS_ERROR(offsets[BLENDSHAPE_BLOCK_SIZE + 42 % BLENDSHAPE_BLOCK_SIZE].positionOffset, glm::vec3(42.0f), EPSILON);
+    // normals are scaled when laid out
+    QCOMPARE_WITH_ABS_ERROR(offsets[3].normalOffset, glm::vec3(0.01f), EPSILON);
+    QCOMPARE_WITH_ABS_ERROR(offsets[4].positionOffset, glm::vec3(0.0f), EPSILON);
+}
+
+void HFMBlendshapeBlocksTests::testIncrementalBlendMatchesFullBlend() {
+    const int NUM_BLENDSHAPES = 8;
+    auto layout = std::make_shared<const hfm::BlendshapeLayout>(makeModel(200, NUM_BLENDSHAPES, 30));
+
+    // both blend from the same layout
+    hfm::BlendshapeAccumulator incremental(layout);
+    hfm::BlendshapeAccumulator full(layout);
+
+    QVector<float> coefficients { 0.5f, 0.3f, 0.8f, 0.2f, 0.6f, 0.4f, 0.0f, 0.0f };
+    incremental.blend(coefficients);
+
+    // one coefficient at a time, which is applied on top of the previous blend
+    for (int step = 0; step < 20; ++step) {
+        coefficients[step % NUM_BLENDSHAPES] = (float)((step * 37) % 100) / 100.0f;
+        incremental.blend(coefficients);
+    }
+    QVERIFY(incremental.getNumIncrementalBlends() > 0);
+
+    full.blend(coefficients);
+    QCOMPARE(full.getNumIncrementalBlends(), 0);
+
+    const auto& incrementalOffsets = incremental.getOffsets()[0];
+    const auto& fullOffsets = full.getOffsets()[0];
+    QCOMPARE(incrementalOffsets.size(), fullOffsets.size());
+    for (size_t i = 0; i < fullOffsets.size(); ++i) {
+        QCOMPARE_WITH_ABS_ERROR(incrementalOffsets[i].positionOffset, fullOffsets[i].positionOffset, EPSILON);
+        QCOMPARE_WITH_ABS_ERROR(incrementalOffsets[i].normalOffset, fullOffsets[i].normalOffset, EPSILON);
+        QCOMPARE_WITH_ABS_ERROR(incrementalOffsets[i].tangentOffset, fullOffsets[i].tangentOffset, EPSILON);
+    }
+}
@@ -0,0 +1,24 @@
+//
+//  HFMBlendshapeBlocksTests.h
+//  tests/hfm/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef overte_HFMBlendshapeBlocksTests_h
+#define overte_HFMBlendshapeBlocksTests_h
+
+#include <QtCore/QObject>
+
+class HFMBlendshapeBlocksTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testAccumulateAVX2MatchesReference();
+    void testLayoutKeepsOnlyMovedBlocks();
+    void testIncrementalBlendMatchesFullBlend();
+};
+
+#endif // overte_HFMBlendshapeBlocksTests_h
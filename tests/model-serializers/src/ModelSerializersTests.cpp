@@ -20,6 +20,7 @@
 #include "ModelSerializersTests.h"
 #include "GLTFSerializer.h"
 #include "FBXSerializer.h"
+#include "FBXWriter.h"
 #include "OBJSerializer.h"
 
 #include "Gzip.h"
@@ -30,17 +31,71 @@
 #include "AssetClient.h"
 #include "LimitedNodeList.h"
 #include "NodeList.h"
+#include "SharedUtil.h"
 
 #include <QUrl>
 #include <QNetworkAccessManager>
 #include <QNetworkRequest>
 #include <QNetworkReply>
+#include <QBuffer>
 #include <QByteArray>
 #include <QDebug>
 #include <QDirIterator>
 
 QTEST_MAIN(ModelSerializersTests)
 
+// A binary FBX of numGeometries meshes of numVertices vertices each, big enough for its arrays to be compressed.
+// With withModels, each mesh is connected to a model of its own, as FBXSerializer::read needs to make joints of them.
+static QByteArray makeBinaryFBX(int numGeometries, int numVertices, bool withModels = false) {
+    FBXNode connections;
+    connections.name = "Connections";
+    FBXNode objects;
+    objects.name = "Objects";
+    for (int i = 0; i < numGeometries; i++) {
+        QVector<double> vertices(numVertices * 3);
+        for (int j = 0; j < vertices.size(); j++) {
+            vertices[j] = (j % 1000) * 0.5 + i;
+        }
+        QVector<int> indices(numVertices);
+        for (int j = 0; j < numVertices; j++) {
+            indices[j] = (j % 3 == 2) ? -(j + 1) : j;
+        }
+
+        FBXNode verticesNode;
+        verticesNode.name = "Vertices";
+        verticesNode.properties.append(QVariant::fromValue(vertices));
+        FBXNode indicesNode;
+        indicesNode.name = "PolygonVertexIndex";
+        indicesNode.properties.append(QVariant::fromValue(indices));
+
+        FBXNode geometry;
+        geometry.name = "Geometry";
+        geometry.properties << QVariant::fromValue((qint64)(i + 1)) << QByteArray("Geometry::") << QByteArray("Mesh");
+        geometry.children << verticesNode << indicesNode;
+        objects.children.append(geometry);
+
+        if (withModels) {
+            qint64 modelID = numGeometries + i + 1;
+            FBXNode model;
+            model.name = "Model";
+            model.properties << QVariant::fromValue(modelID) << QByteArray("Model::") << QByteArray("Mesh");
+            objects.children.append(model);
+
+            FBXNode connection;
+            connection.name = "C";
+            connection.properties << QByteArray("OO") << QVariant::fromValue((qint64)(i + 1)) << QVariant::fromValue(modelID);
+            connections.children.append(connection);
+        }
+    }
+
+    FBXNode root;
+    root.children.append(objects);
+    if (withModels) {
+        root.children.append(connections);
+    }
+    return FBXWriter::encodeFBX(root);
+}
+
 void ModelSerializersTests::initTestCase() {
     qRegisterMetaType<QNetworkReply*>("QNetworkReply*");
 
@@ -159,3 +214,98 @@ void ModelSerializersTests::loadGLTF() {
     QVERIFY(expectWarnings == (model->loadWarningCount>0));
     QVERIFY(expectErrors == (model->loadErrorCount>0));
 }
+
+void ModelSerializersTests::parseBinaryFBX() {
+    const int NUM_GEOMETRIES = 4;
+    const int NUM_VERTICES = 3000;
+    QByteArray data = makeBinaryFBX(NUM_GEOMETRIES, NUM_VERTICES);
+    QBuffer buffer(&data);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+
+    FBXNode root = FBXSerializer::parseFBX(&buffer);
+    QCOMPARE(root.children.size(), 1);
+    const FBXNode& objects = root.children.at(0);
+    QCOMPARE(objects.name, QByteArray("Objects"));
+    QCOMPARE(objects.children.size(), NUM_GEOMETRIES);
+
+    for (int i = 0; i < NUM_GEOMETRIES; i++) {
+        const FBXNode& geometry = objects.children.at(i);
+        QCOMPARE(geometry.properties.at(0).toLongLong(), (qint64)(i + 1));
+        QCOMPARE(geometry.properties.at(2).toByteArray(), QByteArray("Mesh"));
+        QCOMPARE(geometry.children.size(), 2);
+
+        QVector<double> vertices = FBXSerializer::getDoubleVector(geometry.children.at(0));
+        QCOMPARE(vertices.size(), NUM_VERTICES * 3);
+        for (int j = 0; j < vertices.size(); j++) {
+            QCOMPARE(vertices[j], (j % 1000) * 0.5 + i);
+        }
+
+        QVector<int> indices = FBXSerializer::getIntVector(geometry.children.at(1));
+        QCOMPARE(indices.size(), NUM_VERTICES);
+        for (int j = 0; j < indices.size(); j++) {
+            QCOMPARE(indices[j], (j % 3 == 2) ? -(j + 1) : j);
+        }
+
+        QVector<glm::vec3> positions = FBXSerializer::createVec3Vector(vertices);
+        QCOMPARE(positions.size(), NUM_VERTICES);
+        QCOMPARE(positions.last().z, (float)vertices.last());
+    }
+}
+
+void ModelSerializersTests::parseCorruptBinaryFBX() {
+    QByteArray data = makeBinaryFBX(1, 3000);
+
+    // cut off in the middle of the compressed arrays
+    QByteArray truncated = data.left(data.size() / 2);
+    QBuffer truncatedBuffer(&truncated);
+    QVERIFY(truncatedBuffer.open(QIODevice::ReadOnly));
+    bool threw = false;
+    try {
+        FBXSerializer::parseFBX(&truncatedBuffer);
+    } catch (const QString&) {
+        threw = true;
+    }
+    QVERIFY(threw);
+
+    // the compressed vertices, with the bytes after the zlib header scrambled
+    int vertices = data.indexOf("Vertices");
+    QVERIFY(vertices > 0);
+    const int ARRAY_DATA_OFFSET = 8 + 1 + 3 * 4 + 2;
+    for (int i = 0; i < 64; i++) {
+        data[vertices + ARRAY_DATA_OFFSET + i] = (char)(i * 37);
+    }
+    QBuffer corruptBuffer(&data);
+    QVERIFY(corruptBuffer.open(QIODevice::ReadOnly));
+    threw = false;
+    try {
+        FBXSerializer::parseFBX(&corruptBuffer);
+    } catch (const QString&) {
+        threw = true;
+    }
+    QVERIFY(threw);
+}
+
+void ModelSerializersTests::benchmarkLoadBinaryFBX() {
+    // about the size of a detailed avatar: 32 meshes of 64k vertices
+    const int NUM_GEOMETRIES = 32;
+    const int NUM_VERTICES = 64 * 1024;
+    QByteArray data = makeBinaryFBX(NUM_GEOMETRIES, NUM_VERTICES, true);
+
+    // the peak is for the whole process, so only what the loads add on top of the fixture is theirs
+    ProcessUsageInfo baseline;
+    bool hasUsage = getProcessUsageInfo(baseline);
+
+    QBENCHMARK {
+        HFMModel::Pointer model = FBXSerializer().read(data, hifi::VariantHash());
+        QCOMPARE(model->meshes.size(), NUM_GEOMETRIES);
+    }
+
+    ProcessUsageInfo usage;
+    if (hasUsage && getProcessUsageInfo(usage)) {
+        // when the loads stayed under an earlier peak, all that is known is that they took no more than it
+        uint64_t peakAboveFixture = usage.peakResidentMemoryBytes - baseline.residentMemoryBytes;
+        qInfo() << "Loaded" << data.size() << "bytes of FBX. Peak resident memory above the fixture:"
+                << (usage.peakResidentMemoryBytes > baseline.peakResidentMemoryBytes ? "" : "at most")
+                << peakAboveFixture / (1024 * 1024) << "MB";
+    }
+}
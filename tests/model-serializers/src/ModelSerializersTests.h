@@ -22,6 +22,10 @@ private slots:
     void loadGLTF_data();
     void loadGLTF();
 
+    void parseBinaryFBX();
+    void parseCorruptBinaryFBX();
+    void benchmarkLoadBinaryFBX();
+
 };
 
 #endif // overte_ModelSerializersTests_h
@@ -0,0 +1,165 @@
+//
+//  AssetRequestTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AssetRequestTests.h"
+
+#include <algorithm>
+
+#include <QtTest/QtTest>
+
+#include <AssetRequest.h>
+
+QTEST_MAIN(AssetRequestTests)
+
+static AssetUtils::AssetChunk makeChunk(int64_t size) {
+    static int nextChunk = 0;
+    auto hash = AssetUtils::hashData(QByteArray::number(nextChunk++)).toHex();
+    return { QString::fromLatin1(hash), size };
+}
+
+static ByteRange wholeAsset(int64_t size) {
+    ByteRange range;
+    range.toExclusive = size;
+    return range;
+}
+
+void AssetRequestTests::testSplitEmpty() {
+    QVERIFY(AssetRequest::splitIntoPieces(wholeAsset(0), 0, {}).empty());
+}
+
+void AssetRequestTests::testSplitExactMultiple() {
+    const int64_t rangeSize = AssetRequest::DOWNLOAD_RANGE_SIZE;
+
+    auto pieces = AssetRequest::splitIntoPieces(wholeAsset(3 * rangeSize), 3 * rangeSize, {});
+    QCOMPARE((int)pieces.size(), 3);
+    for (size_t i = 0; i < pieces.size(); i++) {
+        QCOMPARE(pieces[i].range.fromInclusive, (int64_t)i * rangeSize);
+        QCOMPARE(pieces[i].range.size(), rangeSize);
+        QVERIFY(pieces[i].hash.isEmpty());
+    }
+
+    // the first range is the one a whole asset is asked for first
+    pieces = AssetRequest::splitIntoPieces(wholeAsset(rangeSize), rangeSize, {});
+    QCOMPARE((int)pieces.size(), 1);
+    QCOMPARE(pieces[0].range.fromInclusive, (int64_t)0);
+    QCOMPARE(pieces[0].range.toExclusive, rangeSize);
+}
+
+void AssetRequestTests::testSplitRemainder() {
+    const int64_t rangeSize = AssetRequest::DOWNLOAD_RANGE_SIZE;
+    const int64_t remainder = 5;
+
+    const int64_t assetSize = 2 * rangeSize + remainder;
+    auto pieces = AssetRequest::splitIntoPieces(wholeAsset(assetSize), assetSize, {});
+    QCOMPARE((int)pieces.size(), 3);
+    QCOMPARE(pieces[0].range.toExclusive, rangeSize);
+    QCOMPARE(pieces[1].range.fromInclusive, rangeSize);
+    QCOMPARE(pieces[1].range.toExclusive, 2 * rangeSize);
+    QCOMPARE(pieces[2].range.fromInclusive, 2 * rangeSize);
+    QCOMPARE(pieces[2].range.size(), remainder);
+
+    // an asset smaller than a range is a single range
+    pieces = AssetRequest::splitIntoPieces(wholeAsset(remainder), remainder, {});
+    QCOMPARE((int)pieces.size(), 1);
+    QCOMPARE(pieces[0].range.size(), remainder);
+}
+
+void AssetRequestTests::testSplitAlongChunks() {
+    AssetUtils::AssetChunkManifest chunks { makeChunk(100), makeChunk(20000), makeChunk(7) };
+
+    auto pieces = AssetRequest::splitIntoPieces(wholeAsset(20107), 20107, chunks);
+    QCOMPARE((int)pieces.size(), 3);
+    QCOMPARE(pieces[0].range.fromInclusive, (int64_t)0);
+    QCOMPARE(pieces[1].range.fromInclusive, (int64_t)100);
+    QCOMPARE(pieces[2].range.fromInclusive, (int64_t)20100);
+    QCOMPARE(pieces[2].range.toExclusive, (int64_t)20107);
+    for (size_t i = 0; i < pieces.size(); i++) {
+        QCOMPARE(pieces[i].hash, chunks[i].hash);
+    }
+
+    // a manifest that doesn't add up to the asset can't be trusted, so the asset is split as if it had none
+    pieces = AssetRequest::splitIntoPieces(wholeAsset(20108), 20108, chunks);
+    QCOMPARE((int)pieces.size(), 1);
+    QVERIFY(pieces[0].hash.isEmpty());
+    QCOMPARE(pieces[0].range.size(), (int64_t)20108);
+}
+
+void AssetRequestTests::testSplitRange() {
+    const int64_t rangeSize = AssetRequest::DOWNLOAD_RANGE_SIZE;
+    AssetUtils::AssetChunkManifest chunks { makeChunk(100), makeChunk(200), makeChunk(300), makeChunk(400) };
+
+    // the chunks cut by the ends of the range can't be checked on their own
+    ByteRange range;
+    range.fromInclusive = 150;
+    range.toExclusive = 700;
+    auto pieces = AssetRequest::splitIntoPieces(range, 1000, chunks);
+    QCOMPARE((int)pieces.size(), 3);
+    QCOMPARE(pieces[0].range.fromInclusive, (int64_t)150);
+    QCOMPARE(pieces[0].range.toExclusive, (int64_t)300);
+    QVERIFY(pieces[0].hash.isEmpty());
+    QCOMPARE(pieces[1].range.fromInclusive, (int64_t)300);
+    QCOMPARE(pieces[1].range.toExclusive, (int64_t)600);
+    QCOMPARE(pieces[1].hash, chunks[2].hash);
+    QCOMPARE(pieces[2].range.fromInclusive, (int64_t)600);
+    QCOMPARE(pieces[2].range.toExclusive, (int64_t)700);
+    QVERIFY(pieces[2].hash.isEmpty());
+
+    // without a manifest, a range is split from its own start
+    range.fromInclusive = 5;
+    range.toExclusive = 5 + 2 * rangeSize;
+    pieces = AssetRequest::splitIntoPieces(range, 3 * rangeSize, {});
+    QCOMPARE((int)pieces.size(), 2);
+    QCOMPARE(pieces[0].range.fromInclusive, (int64_t)5);
+    QCOMPARE(pieces[1].range.fromInclusive, 5 + rangeSize);
+    QCOMPARE(pieces[1].range.toExclusive, 5 + 2 * rangeSize);
+}
+
+void AssetRequestTests::testGroupIntoRanges() {
+    const int64_t rangeSize = AssetRequest::DOWNLOAD_RANGE_SIZE;
+    const int64_t chunkSize = rangeSize / 4;
+
+    AssetUtils::AssetChunkManifest chunks;
+    for (int i = 0; i < 10; i++) {
+        chunks.push_back(makeChunk(chunkSize));
+    }
+    // a chunk larger than a range still gets a range of its own
+    chunks.push_back(makeChunk(rangeSize + 1));
+    chunks.push_back(makeChunk(chunkSize));
+
+    const int64_t assetSize = 11 * chunkSize + rangeSize + 1;
+    auto pieces = AssetRequest::splitIntoPieces(wholeAsset(assetSize), assetSize, chunks);
+    QCOMPARE((int)pieces.size(), 12);
+
+    // pieces already at hand leave a gap, which ranges don't span
+    pieces.erase(pieces.begin() + 5);
+
+    auto ranges = AssetRequest::groupIntoRanges(pieces);
+    QCOMPARE((int)ranges.size(), 5);
+    QCOMPARE(ranges[0].fromInclusive, (int64_t)0);
+    QCOMPARE(ranges[0].toExclusive, 4 * chunkSize);
+    QCOMPARE(ranges[1].fromInclusive, 4 * chunkSize);
+    QCOMPARE(ranges[1].toExclusive, 5 * chunkSize);
+    QCOMPARE(ranges[2].fromInclusive, 6 * chunkSize);
+    QCOMPARE(ranges[2].toExclusive, 10 * chunkSize);
+    QCOMPARE(ranges[3].size(), rangeSize + 1);
+    QCOMPARE(ranges[4].size(), chunkSize);
+
+    // every range starts and ends on a chunk boundary
+    for (const auto& range : ranges) {
+        auto startsPiece = std::find_if(pieces.begin(), pieces.end(), [&](const AssetRequest::Piece& piece) {
+            return piece.range.fromInclusive == range.fromInclusive;
+        });
+        auto endsPiece = std::find_if(pieces.begin(), pieces.end(), [&](const AssetRequest::Piece& piece) {
+            return piece.range.toExclusive == range.toExclusive;
+        });
+        QVERIFY(startsPiece != pieces.end());
+        QVERIFY(endsPiece != pieces.end());
+    }
+}
@@ -0,0 +1,27 @@
+//
+//  AssetRequestTests.h
+//  tests/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef overte_AssetRequestTests_h
+#define overte_AssetRequestTests_h
+
+#include <QtCore/QObject>
+
+class AssetRequestTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testSplitEmpty();
+    void testSplitExactMultiple();
+    void testSplitRemainder();
+    void testSplitAlongChunks();
+    void testSplitRange();
+    void testGroupIntoRanges();
+};
+
+#endif // overte_AssetRequestTests_h
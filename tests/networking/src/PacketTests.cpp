@@ -14,6 +14,7 @@
 #include <test-utils/QTestExtensions.h>
 
 #include <NLPacket.h>
+#include <ReceivedMessage.h>
 
 QTEST_MAIN(PacketTests)
 
@@ -24,6 +25,30 @@ std::unique_ptr<NLPacket> copyToReadPacket(std::unique_ptr<NLPacket>& packet) {
     return NLPacket::fromReceivedPacket(std::move(data), size, SockAddr());
 }
 
+std::unique_ptr<NLPacket> copyToPooledReadPacket(const NLPacket& packet) {
+    auto size = packet.getDataSize();
+    auto buffer = udt::PacketBuffer::allocate(size);
+    memcpy(buffer.data(), packet.getData(), size);
+    return NLPacket::fromReceivedPacket(std::move(buffer), size, SockAddr());
+}
+
+std::vector<std::unique_ptr<NLPacket>> createMessagePackets(int numPackets) {
+    std::vector<std::unique_ptr<NLPacket>> packets;
+    for (int i = 0; i < numPackets; i++) {
+        auto packet = NLPacket::create(PacketType::Unknown, -1, true, true);
+        while (packet->bytesAvailableForWrite() > 0) {
+            char value = (char)(packet->pos() + i);
+            packet->writePrimitive(value);
+        }
+
+        auto position = numPackets == 1 ? NLPacket::ONLY :
+            i == 0 ? NLPacket::FIRST : i == numPackets - 1 ? NLPacket::LAST : NLPacket::MIDDLE;
+        packet->writeMessageNumber(1, position, i);
+        packets.push_back(std::move(packet));
+    }
+    return packets;
+}
+
 void PacketTests::emptyPacketTest() {
     auto packet = NLPacket::create(PacketType::Unknown);
 
@@ -181,3 +206,116 @@ void PacketTests::primitiveTest() {
     QCOMPARE(recvPacket->peekPrimitive(&noValue), 0);
     QCOMPARE(recvPacket->readPrimitive(&noValue), 0);
 }
+
+void PacketTests::packetBufferPoolTest() {
+    udt::PacketBuffer::resetStats();
+
+    const char* data = nullptr;
+    {
+        auto buffer = udt::PacketBuffer::allocate(udt::MAX_PACKET_SIZE);
+        QVERIFY(!buffer.isNull());
+        QCOMPARE(buffer.useCount(), 1);
+
+        auto reference = buffer;
+        QCOMPARE(buffer.useCount(), 2);
+        QVERIFY(reference.data() == buffer.data());
+
+        data = buffer.data();
+    }
+
+    auto stats = udt::PacketBuffer::getStats();
+    QVERIFY(stats.pooled > 0);
+
+    auto buffer = udt::PacketBuffer::allocate(100);
+    QVERIFY(buffer.data() == data);
+    QCOMPARE(udt::PacketBuffer::getStats().poolReuses, stats.poolReuses + 1);
+
+    // buffers bigger than a packet are not pooled
+    auto bigBuffer = udt::PacketBuffer::allocate(udt::MAX_PACKET_SIZE + 1);
+    QVERIFY(bigBuffer.capacity() > udt::MAX_PACKET_SIZE);
+    bigBuffer.reset();
+    QCOMPARE(bigBuffer.useCount(), 0);
+    QCOMPARE(udt::PacketBuffer::getStats().pooled, stats.pooled - 1);
+}
+
+void PacketTests::receivedMessageTest() {
+    auto packets = createMessagePackets(3);
+
+    QByteArray expected;
+    for (const auto& packet : packets) {
+        expected.append(packet->getPayload(), packet->getPayloadSize());
+    }
+
+    auto firstPacket = copyToPooledReadPacket(*packets[0]);
+    ReceivedMessage message(*firstPacket);
+    QVERIFY(!message.isComplete());
+
+    for (size_t i = 1; i < packets.size(); i++) {
+        auto packet = copyToPooledReadPacket(*packets[i]);
+        message.appendPacket(*packet);
+    }
+    QVERIFY(message.isComplete());
+    QCOMPARE(message.getSize(), (qint64)expected.size());
+
+    // only the head of the message, kept while it was being received, has been copied
+    auto copiedBytes = message.getCopiedBytes();
+
+    // spans point into the packets, across their boundaries
+    auto spans = message.readSpans(expected.size());
+    QCOMPARE(spans.size(), packets.size());
+    QCOMPARE(message.getCopiedBytes(), copiedBytes);
+
+    QByteArray joined;
+    for (const auto& span : spans) {
+        QCOMPARE(span.buffer.useCount(), 2);
+        joined.append(span.data, span.size);
+    }
+    QCOMPARE(joined, expected);
+    QCOMPARE(message.getBytesLeftToRead(), (qint64)0);
+
+    // reads that straddle two packets
+    qint64 boundary = packets[0]->getPayloadSize();
+    message.seek(boundary - 2);
+    uint32_t value;
+    QCOMPARE(message.readPrimitive(&value), (qint64)sizeof(value));
+    QCOMPARE(memcmp(&value, expected.constData() + boundary - 2, sizeof(value)), 0);
+
+    message.seek(0);
+    QCOMPARE(message.readAll(), expected);
+    QCOMPARE(message.getMessage(), expected);
+    QCOMPARE(memcmp(message.getRawMessage(), expected.constData(), expected.size()), 0);
+}
+
+void PacketTests::receivedMessageBenchmark() {
+    const int NUM_PACKETS = 64;
+    auto packets = createMessagePackets(NUM_PACKETS);
+
+    udt::PacketBuffer::resetStats();
+    uint64_t bytesRead = 0;
+    uint64_t copiedBytes = 0;
+    int iterations = 0;
+
+    QBENCHMARK {
+        // copying into the received packets stands in for the socket read
+        auto firstPacket = copyToPooledReadPacket(*packets[0]);
+        ReceivedMessage message(*firstPacket);
+        for (int i = 1; i < NUM_PACKETS; i++) {
+            auto packet = copyToPooledReadPacket(*packets[i]);
+            message.appendPacket(*packet);
+        }
+
+        for (const auto& span : message.readSpans(message.getSize())) {
+            bytesRead += span.size;
+        }
+        copiedBytes += message.getCopiedBytes();
+        iterations++;
+    }
+
+    auto stats = udt::PacketBuffer::getStats();
+    qDebug() << "Read" << bytesRead << "bytes in" << iterations << "messages:" << stats.heapAllocations << "buffer allocations,"
+        << stats.poolReuses << "pool reuses," << copiedBytes << "bytes copied";
+
+    // once the pool is warm, messages are reassembled without allocating and read without copying their payload
+    QVERIFY(stats.heapAllocations <= (uint64_t)NUM_PACKETS);
+    QVERIFY(copiedBytes < bytesRead);
+}
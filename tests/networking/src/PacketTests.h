@@ -36,6 +36,15 @@ private slots:
 
     // Test set/get packet type
     void packetTypeTest();
+
+    // Test that released packet buffers are handed out again
+    void packetBufferPoolTest();
+
+    // Test reading a message reassembled from several packets
+    void receivedMessageTest();
+
+    // Measure buffer allocations and copies when reassembling and reading a message
+    void receivedMessageBenchmark();
 };
 
 #endif // hifi_PacketTests_h
@@ -0,0 +1,150 @@
+//
+//  EntityEditFiltersTests.cpp
+//  tests/script-engine/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityEditFiltersTests.h"
+
+#include <QtTest/QtTest>
+
+#include <DependencyManager.h>
+#include <NodeList.h>
+#include <ScriptCache.h>
+#include <ScriptEngines.h>
+#include <ScriptManager.h>
+#include <StatTracker.h>
+#include <shared/ScriptInitializerMixin.h>
+
+#include <EntityEditFilters.h>
+
+QTEST_MAIN(EntityEditFiltersTests)
+
+static const QString FILTER_URL = "http://localhost/filter.js";
+
+// the filter of the null entity ID is the global one, which every edit goes through
+static bool setGlobalFilter(const QByteArray& script) {
+    auto entityEditFilters = DependencyManager::get<EntityEditFilters>();
+
+    bool added = false;
+    auto connection = QObject::connect(entityEditFilters.data(), &EntityEditFilters::filterAdded,
+                                       [&added](EntityItemID, bool success) { added = success; });
+    entityEditFilters->setFilterScript(EntityItemID(), FILTER_URL, script);
+    QObject::disconnect(connection);
+    return added;
+}
+
+void EntityEditFiltersTests::initTestCase() {
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+    DependencyManager::set<NodeList>(NodeType::EntityServer, INVALID_PORT);
+    DependencyManager::set<ScriptEngines>(ScriptManager::NETWORKLESS_TEST_SCRIPT, QUrl(""));
+    DependencyManager::set<ScriptCache>();
+    DependencyManager::set<StatTracker>();
+    DependencyManager::set<ScriptInitializers>();
+
+    _entityTree = std::make_shared<EntityTree>();
+    _entityTree->createRootElement();
+    DependencyManager::set<EntityEditFilters>(_entityTree);
+}
+
+EntityItemPointer EntityEditFiltersTests::addBox(const QString& name) {
+    EntityItemProperties properties;
+    properties.setType(EntityTypes::Box);
+    properties.setName(name);
+
+    EntityItemPointer entity;
+    _entityTree->withWriteLock([&] {
+        entity = _entityTree->addEntity(EntityItemID(QUuid::createUuid()), properties);
+    });
+    return entity;
+}
+
+// filters the edit of the entity the way the entity server does, with the same properties in and out
+bool EntityEditFiltersTests::filterEdit(const EntityItemPointer& entity, EntityItemProperties& properties, bool& wasChanged) {
+    auto position = entity->getWorldPosition();
+    auto entityID = entity->getEntityItemID();
+    wasChanged = false;
+    return DependencyManager::get<EntityEditFilters>()->filter(position, properties, properties, wasChanged,
+                                                               EntityTree::FilterType::Edit, entityID, entity);
+}
+
+void EntityEditFiltersTests::testCachedResultsDroppedWithScript() {
+    const QByteArray FILTER_SCRIPT =
+        "function filter(properties) {"
+        "    properties.position.y = %1;"
+        "    return properties;"
+        "}"
+        "filter.wantsProperties = ['position'];"
+        "filter.wantsCachedResults = true;";
+    QVERIFY(setGlobalFilter(QString(FILTER_SCRIPT).arg(1).toUtf8()));
+
+    auto entity = addBox("cached");
+    QVERIFY(entity);
+    auto entityEditFilters = DependencyManager::get<EntityEditFilters>();
+    auto stats = entityEditFilters->getStats();
+
+    // the same edit twice runs the filter once
+    for (int i = 0; i < 2; i++) {
+        EntityItemProperties properties;
+        properties.setPosition(glm::vec3(5.0f));
+        bool wasChanged;
+        QVERIFY(filterEdit(entity, properties, wasChanged));
+        QVERIFY(wasChanged);
+        QCOMPARE(properties.getPosition(), glm::vec3(5.0f, 1.0f, 5.0f));
+    }
+    QCOMPARE(entityEditFilters->getStats().scriptCalls, stats.scriptCalls + 1);
+    QCOMPARE(entityEditFilters->getStats().cachedResults, stats.cachedResults + 1);
+
+    // a new version of the script doesn't get the results of the old one
+    QVERIFY(setGlobalFilter(QString(FILTER_SCRIPT).arg(2).toUtf8()));
+    stats = entityEditFilters->getStats();
+
+    EntityItemProperties properties;
+    properties.setPosition(glm::vec3(5.0f));
+    bool wasChanged;
+    QVERIFY(filterEdit(entity, properties, wasChanged));
+    QCOMPARE(properties.getPosition(), glm::vec3(5.0f, 2.0f, 5.0f));
+    QCOMPARE(entityEditFilters->getStats().scriptCalls, stats.scriptCalls + 1);
+    QCOMPARE(entityEditFilters->getStats().cachedResults, stats.cachedResults);
+}
+
+void EntityEditFiltersTests::testSkippedEditsReachTree() {
+    // rejects every edit it is asked about, but only asks about moves
+    QVERIFY(setGlobalFilter(
+        "function filter(properties) {"
+        "    return false;"
+        "}"
+        "filter.wantsProperties = ['position'];"));
+
+    auto entity = addBox("before");
+    QVERIFY(entity);
+    auto entityEditFilters = DependencyManager::get<EntityEditFilters>();
+    auto stats = entityEditFilters->getStats();
+
+    EntityItemProperties rename;
+    rename.setName("after");
+    bool wasChanged;
+    QVERIFY(filterEdit(entity, rename, wasChanged));
+    QVERIFY(!wasChanged);
+    QCOMPARE(entityEditFilters->getStats().skippedEdits, stats.skippedEdits + 1);
+    QCOMPARE(entityEditFilters->getStats().scriptCalls, stats.scriptCalls);
+
+    // the skipped edit goes through as it came
+    QCOMPARE(rename.getName(), QString("after"));
+    QVERIFY(rename.getChangedProperties().getHasProperty(PROP_NAME));
+    QVERIFY(!rename.getChangedProperties().getHasProperty(PROP_POSITION));
+    _entityTree->withWriteLock([&] {
+        QVERIFY(_entityTree->updateEntity(entity->getEntityItemID(), rename));
+    });
+    QCOMPARE(entity->getName(), QString("after"));
+
+    // while a move is up to the filter
+    EntityItemProperties move;
+    move.setPosition(glm::vec3(1.0f));
+    QVERIFY(!filterEdit(entity, move, wasChanged));
+    QCOMPARE(entityEditFilters->getStats().scriptCalls, stats.scriptCalls + 1);
+}
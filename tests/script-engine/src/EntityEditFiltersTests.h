@@ -0,0 +1,32 @@
+//
+//  EntityEditFiltersTests.h
+//  tests/script-engine/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef overte_EntityEditFiltersTests_h
+#define overte_EntityEditFiltersTests_h
+
+#include <QtCore/QObject>
+
+#include <EntityTree.h>
+
+class EntityEditFiltersTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void testCachedResultsDroppedWithScript();
+    void testSkippedEditsReachTree();
+
+private:
+    EntityItemPointer addBox(const QString& name);
+    bool filterEdit(const EntityItemPointer& entity, EntityItemProperties& properties, bool& wasChanged);
+
+    EntityTreePointer _entityTree;
+};
+
+#endif // overte_EntityEditFiltersTests_h
@@ -6,11 +6,16 @@
 //  SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cmath>
+
 #include <QSignalSpy>
 #include <QDebug>
 #include <QFile>
 #include <QTextStream>
 
+#include <test-utils/GLMTestUtils.h>
+#include <test-utils/QTestExtensions.h>
+
 
 #include "ScriptEngineTests.h"
 #include "DependencyManager.h"
@@ -23,13 +28,20 @@
 #include "ResourceManager.h"
 #include "ResourceRequestObserver.h"
 #include "StatTracker.h"
+#include "v8/FastScriptBindings.h"
+#include "EntityItem.h"
+#include "EntityTypes.h"
 
 #include "NodeList.h"
+#include "ScriptValueUtils.h"
+#include "EntityTree.h"
 #include "../../../libraries/entities/src/EntityScriptingInterface.h"
 //#include "../../../libraries/entities/src/EntityScriptingInterface.h"
 
 QTEST_MAIN(ScriptEngineTests)
 
+const float EPSILON = 1.0e-4f;
+
 
 
 
@@ -50,6 +62,16 @@ void ScriptEngineTests::initTestCase() {
     DependencyManager::set<ScriptInitializers>();
    // DependencyManager::set<EntityScriptingInterface>(true);
 
+    // the batch entity functions edit a local tree, which is serverless so that nothing is sent
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+    DependencyManager::set<NodeList>(NodeType::Agent, INVALID_PORT);
+    auto entityScriptingInterface = DependencyManager::set<EntityScriptingInterface>(false);
+    entityScriptingInterface->init();
+    EntityTreePointer entityTree = std::make_shared<EntityTree>();
+    entityTree->createRootElement();
+    entityTree->setIsServerlessMode(true);
+    entityScriptingInterface->setEntityTree(entityTree);
+
 
 }
 
@@ -100,6 +122,45 @@ ScriptManagerPointer ScriptEngineTests::makeManager(const QString &scriptSource,
     return sm;
 }
 
+ScriptManagerPointer ScriptEngineTests::makeEntitiesManager() {
+    auto sm = makeManager("", "testEntities.js");
+    auto engine = sm->engine();
+
+    // only what the batch entity functions need, since the static script initializers don't run for test scripts
+    engine->registerGlobalObject("Entities", DependencyManager::get<EntityScriptingInterface>().data());
+    engine->registerFunction("Entities", "getMultipleEntityPropertiesPacked", EntityScriptingInterface::getMultipleEntityPropertiesPacked);
+    engine->registerFunction("Entities", "editMultipleEntities", EntityScriptingInterface::editMultipleEntities);
+    engine->registerFunction("Entities", "editMultipleEntitiesPacked", EntityScriptingInterface::editMultipleEntitiesPacked);
+    return sm;
+}
+
+static QUuid addTestBox(const glm::vec3& position) {
+    auto entityTree = DependencyManager::get<EntityScriptingInterface>()->getEntityTree();
+
+    EntityItemProperties properties;
+    properties.setType(EntityTypes::Box);
+    properties.setPosition(position);
+    EntityItemID entityID(QUuid::createUuid());
+    EntityItemPointer entity;
+    entityTree->withWriteLock([&] {
+        entity = entityTree->addEntity(entityID, properties);
+    });
+    return entity ? entity->getID() : QUuid();
+}
+
+static glm::vec3 getTestBoxPosition(const QUuid& entityID) {
+    auto entityTree = DependencyManager::get<EntityScriptingInterface>()->getEntityTree();
+
+    glm::vec3 position(NAN);
+    entityTree->withReadLock([&] {
+        auto entity = entityTree->findEntityByID(entityID);
+        if (entity) {
+            position = entity->getWorldPosition();
+        }
+    });
+    return position;
+}
+
 void ScriptEngineTests::testTrivial() {
     auto sm = makeManager("print(\"script works!\"); Script.stop(true);", "testTrivial.js");
     QString printed;
@@ -333,3 +394,201 @@ void ScriptEngineTests::testQuat() {
     sm->run();
 }
 
+void ScriptEngineTests::testFloat32Array() {
+    auto engine = newScriptEngine();
+
+    const QVector<float> values { 1.0f, -2.5f, 3.25f, 0.0f };
+    ScriptValue array = engine->newFloat32Array(values);
+    engine->globalObject().setProperty("packed", array);
+    QCOMPARE(engine->evaluate("packed instanceof Float32Array").toBool(), true);
+    QCOMPARE(engine->evaluate("packed.length").toInt32(), values.size());
+    QCOMPARE(engine->evaluate("packed[1]").toNumber(), -2.5);
+
+    QVector<float> result;
+    QVERIFY(engine->toFloat32Vector(array, result));
+    QCOMPARE(result, values);
+
+    QVERIFY(engine->toFloat32Vector(engine->evaluate("[1, -2.5, 3.25, 0]"), result));
+    QCOMPARE(result, values);
+
+    QVERIFY(engine->toFloat32Vector(engine->evaluate("new Float64Array([1, -2.5, 3.25, 0])"), result));
+    QCOMPARE(result, values);
+
+    QVERIFY(!engine->toFloat32Vector(engine->evaluate("'not an array'"), result));
+}
+
+void ScriptEngineTests::testGetMultipleEntityPropertiesPacked() {
+    auto sm = makeEntitiesManager();
+    auto engine = sm->engine();
+
+    // the last one isn't in the tree
+    const QVector<QUuid> entityIDs { addTestBox(glm::vec3(1.0f, 2.0f, 3.0f)), addTestBox(glm::vec3(-4.0f, 5.0f, -6.0f)),
+                                     QUuid::createUuid() };
+    QVERIFY(!entityIDs[0].isNull() && !entityIDs[1].isNull());
+    engine->globalObject().setProperty("entityIDs", qVectorQUuidToScriptValue(engine.get(), entityIDs));
+
+    ScriptValue packed = engine->evaluate("Entities.getMultipleEntityPropertiesPacked(entityIDs, ['position', 'rotation', 'name'])");
+    QVERIFY(!packed.property("name").isValid() || packed.property("name").isUndefined());
+
+    QVector<float> positions;
+    QVERIFY(engine->toFloat32Vector(packed.property("position"), positions));
+    QCOMPARE(positions.size(), 9);
+    const QVector<float> expectedPositions { 1.0f, 2.0f, 3.0f, -4.0f, 5.0f, -6.0f };
+    QCOMPARE(positions.mid(0, 6), expectedPositions);
+    QVERIFY(std::isnan(positions[6]) && std::isnan(positions[7]) && std::isnan(positions[8]));
+
+    QVector<float> rotations;
+    QVERIFY(engine->toFloat32Vector(packed.property("rotation"), rotations));
+    QCOMPARE(rotations.size(), 12);
+    QVERIFY(std::isnan(rotations[8]) && std::isnan(rotations[11]));
+
+    // a single property name works too
+    QCOMPARE(engine->evaluate("Entities.getMultipleEntityPropertiesPacked(entityIDs, 'position').position.length").toInt32(), 9);
+}
+
+void ScriptEngineTests::testEditMultipleEntities() {
+    auto sm = makeEntitiesManager();
+    auto engine = sm->engine();
+
+    const QVector<QUuid> entityIDs { addTestBox(glm::vec3(0.0f)), addTestBox(glm::vec3(0.0f)) };
+    engine->globalObject().setProperty("entityIDs", qVectorQUuidToScriptValue(engine.get(), entityIDs));
+
+    // one set of properties per entity
+    ScriptValue result = engine->evaluate(
+        "JSON.stringify(Entities.editMultipleEntities(entityIDs, [{ position: { x: 1, y: 0, z: 0 } }, { position: { x: 2, y: 0, z: 0 } }]))");
+    QCOMPARE(result.toString(), engine->evaluate("JSON.stringify(entityIDs)").toString());
+    QCOMPARE_WITH_ABS_ERROR(getTestBoxPosition(entityIDs[0]), glm::vec3(1.0f, 0.0f, 0.0f), EPSILON);
+    QCOMPARE_WITH_ABS_ERROR(getTestBoxPosition(entityIDs[1]), glm::vec3(2.0f, 0.0f, 0.0f), EPSILON);
+
+    // one set of properties for all of them
+    result = engine->evaluate("Entities.editMultipleEntities(entityIDs, { position: { x: 0, y: 3, z: 0 } }).length");
+    QCOMPARE(result.toInt32(), 2);
+    QCOMPARE_WITH_ABS_ERROR(getTestBoxPosition(entityIDs[0]), glm::vec3(0.0f, 3.0f, 0.0f), EPSILON);
+    QCOMPARE_WITH_ABS_ERROR(getTestBoxPosition(entityIDs[1]), glm::vec3(0.0f, 3.0f, 0.0f), EPSILON);
+
+    // a different number of property sets than entities is an error, and nothing is edited
+    result = engine->evaluate(
+        "var caught = '';"
+        "try {"
+        "    Entities.editMultipleEntities(entityIDs, [{ position: { x: 5, y: 5, z: 5 } }]);"
+        "} catch (err) {"
+        "    caught = String(err);"
+        "}"
+        "caught;");
+    QVERIFY(result.toString().contains("editMultipleEntities"));
+    QCOMPARE_WITH_ABS_ERROR(getTestBoxPosition(entityIDs[0]), glm::vec3(0.0f, 3.0f, 0.0f), EPSILON);
+    QCOMPARE_WITH_ABS_ERROR(getTestBoxPosition(entityIDs[1]), glm::vec3(0.0f, 3.0f, 0.0f), EPSILON);
+}
+
+void ScriptEngineTests::testEditMultipleEntitiesPacked() {
+    auto sm = makeEntitiesManager();
+    auto engine = sm->engine();
+
+    const QVector<QUuid> entityIDs { addTestBox(glm::vec3(1.0f, 2.0f, 3.0f)), addTestBox(glm::vec3(4.0f, 5.0f, 6.0f)) };
+    engine->globalObject().setProperty("entityIDs", qVectorQUuidToScriptValue(engine.get(), entityIDs));
+
+    // raise both of them by 1m, as read
+    ScriptValue result = engine->evaluate(
+        "var packed = Entities.getMultipleEntityPropertiesPacked(entityIDs, 'position');"
+        "for (var i = 1; i < packed.position.length; i += 3) {"
+        "    packed.position[i] += 1;"
+        "}"
+        "JSON.stringify(Entities.editMultipleEntitiesPacked(entityIDs, packed));");
+    QCOMPARE(result.toString(), engine->evaluate("JSON.stringify(entityIDs)").toString());
+    QCOMPARE_WITH_ABS_ERROR(getTestBoxPosition(entityIDs[0]), glm::vec3(1.0f, 3.0f, 3.0f), EPSILON);
+    QCOMPARE_WITH_ABS_ERROR(getTestBoxPosition(entityIDs[1]), glm::vec3(4.0f, 6.0f, 6.0f), EPSILON);
+
+    // plain arrays are accepted, but too few values for the entities are skipped
+    engine->evaluate("Entities.editMultipleEntitiesPacked(entityIDs, { position: [0, 0, 0, 7, 7, 7] });");
+    QCOMPARE_WITH_ABS_ERROR(getTestBoxPosition(entityIDs[1]), glm::vec3(7.0f), EPSILON);
+    engine->evaluate("Entities.editMultipleEntitiesPacked(entityIDs, { position: [9, 9, 9] });");
+    QCOMPARE_WITH_ABS_ERROR(getTestBoxPosition(entityIDs[0]), glm::vec3(0.0f), EPSILON);
+    QCOMPARE_WITH_ABS_ERROR(getTestBoxPosition(entityIDs[1]), glm::vec3(7.0f), EPSILON);
+}
+
+void ScriptEngineTests::benchmarkNativeCalls() {
+    // Compares per-call overhead of the generic QMetaMethod/QVariant path and the typed fast path
+    const int CALL_COUNT = 200000;
+    QString script = QString(
+        "var a = { x: 1, y: 2, z: 3 };\n"
+        "var b = { x: 0.5, y: -0.25, z: 0.125 };\n"
+        "var q = Quat.fromPitchYawRollDegrees(10, 20, 30);\n"
+        "print(JSON.stringify([Vec3.sum(a, b), Vec3.multiply(a, 2), Vec3.length(b), Quat.multiply(q, Quat.IDENTITY), Vec3.UP]));\n"
+        "var start = Date.now();\n"
+        "for (var i = 0; i < %1; i++) {\n"
+        "    a = Vec3.sum(a, b);\n"
+        "}\n"
+        "print((Date.now() - start) * 1000 / %1);\n"
+        "Script.stop(true);\n").arg(CALL_COUNT);
+
+    QStringList results;
+    for (bool fastBindings : { false, true }) {
+        FastScriptBindings::setEnabled(fastBindings);
+        auto sm = makeManager(script, "benchmarkNativeCalls.js");
+
+        QStringList printed;
+        connect(sm.get(), &ScriptManager::printedMessage, [&printed](const QString& message, const QString& engineName){
+            printed.append(message);
+        });
+
+        sm->run();
+
+        QCOMPARE(printed.length(), 2);
+        results.append(printed[0]);
+        bool ok = false;
+        double usecsPerCall = printed[1].toDouble(&ok);
+        QVERIFY(ok);
+        qInfo() << (fastBindings ? "Fast" : "Generic") << "binding:" << usecsPerCall << "usec per Vec3.sum call";
+    }
+    FastScriptBindings::setEnabled(true);
+
+    // Both paths have to produce identical values
+    QCOMPARE(results[0], results[1]);
+}
+
+void ScriptEngineTests::benchmarkEntityProperties_data() {
+    QTest::addColumn<QStringList>("propertyNames");
+    QTest::addColumn<bool>("selective");
+
+    const QStringList ONE_PROPERTY { "position" };
+    const QStringList FIVE_PROPERTIES { "position", "rotation", "dimensions", "color", "name" };
+    QTest::newRow("1 property, full read") << ONE_PROPERTY << false;
+    QTest::newRow("1 property, selective read") << ONE_PROPERTY << true;
+    QTest::newRow("5 properties, full read") << FIVE_PROPERTIES << false;
+    QTest::newRow("5 properties, selective read") << FIVE_PROPERTIES << true;
+    QTest::newRow("all properties, full read") << QStringList() << false;
+    QTest::newRow("all properties, selective read") << QStringList() << true;
+}
+
+void ScriptEngineTests::benchmarkEntityProperties() {
+    // Compares reading every property of an entity before filtering with reading only the requested ones
+    QFETCH(QStringList, propertyNames);
+    QFETCH(bool, selective);
+
+    auto engine = newScriptEngine();
+
+    EntityItemProperties properties;
+    properties.setName("benchmark");
+    properties.setUserData("{ \"grabbableKey\": { \"grabbable\": true } }");
+    properties.setDimensions(glm::vec3(0.5f));
+    auto entity = EntityTypes::constructEntityItem(EntityTypes::Box, EntityItemID(QUuid::createUuid()), properties);
+    QVERIFY(entity);
+
+    EntityPropertyFlags desiredProperties;
+    for (const auto& name : propertyNames) {
+        EntityPropertyInfo propertyInfo;
+        QVERIFY(EntityItemProperties::getPropertyInfo(name, propertyInfo));
+        desiredProperties += propertyInfo.propertyEnum;
+    }
+
+    ScriptValue result;
+    QBENCHMARK {
+        EntityItemProperties entityProperties = selective ? entity->getProperties(desiredProperties) : entity->getProperties();
+        entityProperties.setDesiredProperties(desiredProperties);
+        result = entityProperties.copyToScriptValue(engine.get(), false);
+    }
+
+    for (const auto& name : propertyNames) {
+        QVERIFY(result.property(name).isValid());
+    }
+}
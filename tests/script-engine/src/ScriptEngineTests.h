@@ -65,10 +65,18 @@ private slots:
     void testSignal();
     void testSignalWithException();
     void testQuat();
+    void testFloat32Array();
+    void testGetMultipleEntityPropertiesPacked();
+    void testEditMultipleEntities();
+    void testEditMultipleEntitiesPacked();
+    void benchmarkNativeCalls();
+    void benchmarkEntityProperties_data();
+    void benchmarkEntityProperties();
 
 
 private:
     ScriptManagerPointer makeManager(const QString &source, const QString &filename);
+    ScriptManagerPointer makeEntitiesManager();
 
 };
 
@@ -0,0 +1,130 @@
+//
+//  JointDataCodecTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "JointDataCodecTests.h"
+
+#include <QtTest/QtTest>
+
+#include <glm/gtc/quaternion.hpp>
+
+#include <JointDataCodec.h>
+
+QTEST_MAIN(JointDataCodecTests)
+
+const int NUM_JOINTS = 60;
+
+static QVector<JointData> makePose(float phase) {
+    QVector<JointData> joints(NUM_JOINTS);
+    for (int i = 0; i < NUM_JOINTS; i++) {
+        JointData& joint = joints[i];
+        // leave a few joints in their default pose
+        joint.rotationIsDefaultPose = (i % 7) == 0;
+        joint.translationIsDefaultPose = (i % 5) != 0;
+        joint.rotation = glm::angleAxis(0.3f * i + phase, glm::normalize(glm::vec3(1.0f, 0.1f * i, -0.5f)));
+        joint.translation = glm::vec3(0.01f * i, 0.1f + phase, -0.02f * i);
+    }
+    return joints;
+}
+
+static std::vector<bool> allJoints() {
+    return std::vector<bool>(NUM_JOINTS, true);
+}
+
+static void compareJoints(const QVector<JointData>& expected, const QVector<JointData>& actual) {
+    QCOMPARE(actual.size(), expected.size());
+    for (int i = 0; i < expected.size(); i++) {
+        QCOMPARE(actual[i].rotationIsDefaultPose, expected[i].rotationIsDefaultPose);
+        QCOMPARE(actual[i].translationIsDefaultPose, expected[i].translationIsDefaultPose);
+        if (!expected[i].rotationIsDefaultPose) {
+            QVERIFY(fabsf(glm::dot(actual[i].rotation, expected[i].rotation)) > 0.99999f);
+        }
+        if (!expected[i].translationIsDefaultPose) {
+            QVERIFY(glm::distance(actual[i].translation, expected[i].translation) < 0.001f);
+        }
+    }
+}
+
+void JointDataCodecTests::testKeyframeAndDeltas() {
+    JointDataCodec::Keyframe senderKeyframe;
+    JointDataCodec::Keyframe receiverKeyframe;
+    QVector<JointData> received;
+
+    QVector<JointData> pose = makePose(0.0f);
+    QVERIFY(JointDataCodec::needsKeyframe(senderKeyframe, NUM_JOINTS));
+    JointDataCodec::Keyframe newKeyframe;
+    QByteArray keyframeSection = JointDataCodec::encode(pose, {}, {}, senderKeyframe, &newKeyframe);
+    senderKeyframe = newKeyframe;
+    QVERIFY(!JointDataCodec::needsKeyframe(senderKeyframe, NUM_JOINTS));
+
+    bool applied = false;
+    int bytesRead = JointDataCodec::decode(reinterpret_cast<const uint8_t*>(keyframeSection.constData()),
+                                           keyframeSection.size(), receiverKeyframe, received, applied);
+    QCOMPARE(bytesRead, keyframeSection.size());
+    QVERIFY(applied);
+    compareJoints(pose, received);
+
+    // small motions are a fraction of the size of the keyframe
+    for (int frame = 1; frame <= 10; frame++) {
+        pose = makePose(0.001f * frame);
+        QByteArray deltaSection = JointDataCodec::encode(pose, allJoints(), allJoints(), senderKeyframe, nullptr);
+        senderKeyframe.sectionsSinceKeyframe++;
+        QVERIFY(deltaSection.size() < keyframeSection.size() / 2);
+
+        bytesRead = JointDataCodec::decode(reinterpret_cast<const uint8_t*>(deltaSection.constData()),
+                                           deltaSection.size(), receiverKeyframe, received, applied);
+        QCOMPARE(bytesRead, deltaSection.size());
+        QVERIFY(applied);
+        compareJoints(pose, received);
+    }
+}
+
+void JointDataCodecTests::testMissedKeyframe() {
+    JointDataCodec::Keyframe senderKeyframe;
+    QVector<JointData> pose = makePose(0.0f);
+    JointDataCodec::Keyframe newKeyframe;
+    JointDataCodec::encode(pose, {}, {}, senderKeyframe, &newKeyframe);
+    senderKeyframe = newKeyframe;
+
+    // the receiver never got the keyframe, the deltas are skipped without touching its joints
+    JointDataCodec::Keyframe receiverKeyframe;
+    QVector<JointData> received;
+    QByteArray deltaSection = JointDataCodec::encode(makePose(0.01f), allJoints(), allJoints(), senderKeyframe, nullptr);
+    bool applied = true;
+    int bytesRead = JointDataCodec::decode(reinterpret_cast<const uint8_t*>(deltaSection.constData()),
+                                           deltaSection.size(), receiverKeyframe, received, applied);
+    QCOMPARE(bytesRead, deltaSection.size());
+    QVERIFY(!applied);
+    QVERIFY(received.isEmpty());
+
+    // until the next keyframe arrives
+    QByteArray keyframeSection = JointDataCodec::encode(makePose(0.02f), {}, {}, senderKeyframe, &newKeyframe);
+    bytesRead = JointDataCodec::decode(reinterpret_cast<const uint8_t*>(keyframeSection.constData()),
+                                       keyframeSection.size(), receiverKeyframe, received, applied);
+    QCOMPARE(bytesRead, keyframeSection.size());
+    QVERIFY(applied);
+    compareJoints(makePose(0.02f), received);
+}
+
+void JointDataCodecTests::testTruncatedSection() {
+    JointDataCodec::Keyframe senderKeyframe;
+    JointDataCodec::Keyframe newKeyframe;
+    QByteArray section = JointDataCodec::encode(makePose(0.0f), {}, {}, senderKeyframe, &newKeyframe);
+
+    for (int size = 0; size < section.size(); size++) {
+        JointDataCodec::Keyframe receiverKeyframe;
+        QVector<JointData> received;
+        bool applied = true;
+        int bytesRead = JointDataCodec::decode(reinterpret_cast<const uint8_t*>(section.constData()), size,
+                                               receiverKeyframe, received, applied);
+        QCOMPARE(bytesRead, -1);
+        QVERIFY(!applied);
+        QVERIFY(!receiverKeyframe.isValid);
+    }
+}
@@ -0,0 +1,24 @@
+//
+//  JointDataCodecTests.h
+//  tests/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef overte_JointDataCodecTests_h
+#define overte_JointDataCodecTests_h
+
+#include <QtCore/QObject>
+
+class JointDataCodecTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testKeyframeAndDeltas();
+    void testMissedKeyframe();
+    void testTruncatedSection();
+};
+
+#endif // overte_JointDataCodecTests_h
@@ -0,0 +1,106 @@
+//
+//  MappedFileCacheTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "MappedFileCacheTests.h"
+
+#include <QtTest/QtTest>
+
+#include <MappedFileCache.h>
+
+QTEST_MAIN(MappedFileCacheTests)
+
+static int countContentsFiles(const MappedFileCache& cache) {
+    return QDir(cache.getDirectory()).entryList({ "*.data" }, QDir::Files).size();
+}
+
+static QByteArray toByteArray(const MappedFilePointer& mapping) {
+    return QByteArray((const char*)mapping->data(), (int)mapping->size());
+}
+
+void MappedFileCacheTests::initTestCase() {
+    QVERIFY(_testDir.isValid());
+}
+
+void MappedFileCacheTests::testMapAndReuse() {
+    MappedFileCache cache(_testDir.path() + "/reuse");
+    const QByteArray DATA("recording contents");
+
+    auto inserted = cache.insert("atp:/clip.hfr", DATA);
+    QVERIFY(inserted);
+    QCOMPARE(toByteArray(inserted), DATA);
+    QCOMPARE(cache.getMappedBytes(), (qint64)DATA.size());
+
+    // a second cache over the same directory, as in another process, maps the published file
+    MappedFileCache otherCache(_testDir.path() + "/reuse");
+    auto found = otherCache.find("atp:/clip.hfr");
+    QVERIFY(found);
+    QCOMPARE(toByteArray(found), DATA);
+    QCOMPARE(otherCache.getHits(), (quint64)1);
+    QCOMPARE(otherCache.getMisses(), (quint64)0);
+
+    // inserting the same data again maps the existing file rather than writing a new one
+    auto reinserted = otherCache.insert("atp:/clip.hfr", DATA);
+    QVERIFY(reinserted);
+    QCOMPARE(toByteArray(reinserted), DATA);
+    QCOMPARE(otherCache.getStaleReplacements(), (quint64)0);
+    QCOMPARE(countContentsFiles(cache), 1);
+
+    // another key with the same data shares its contents
+    auto shared = cache.insert("atp:/copy-of-clip.hfr", DATA);
+    QVERIFY(shared);
+    QCOMPARE(countContentsFiles(cache), 1);
+    shared.reset();
+
+    // mappings keep the count of mapped bytes until they are released
+    QCOMPARE(otherCache.getMappedBytes(), (qint64)DATA.size() * 2);
+    found.reset();
+    reinserted.reset();
+    QCOMPARE(otherCache.getMappedBytes(), (qint64)0);
+    inserted.reset();
+    QCOMPARE(cache.getMappedBytes(), (qint64)0);
+}
+
+void MappedFileCacheTests::testMissingFile() {
+    MappedFileCache cache(_testDir.path() + "/missing");
+
+    QVERIFY(!cache.find("atp:/nothing.hfr"));
+    QCOMPARE(cache.getHits(), (quint64)0);
+    QCOMPARE(cache.getMisses(), (quint64)1);
+    QCOMPARE(cache.getMappedBytes(), (qint64)0);
+
+    // an empty file is as good as a missing one
+    QVERIFY(!cache.insert("atp:/empty.hfr", QByteArray()));
+    QVERIFY(!cache.find("atp:/empty.hfr"));
+    QCOMPARE(cache.getMisses(), (quint64)2);
+}
+
+void MappedFileCacheTests::testStaleFile() {
+    MappedFileCache cache(_testDir.path() + "/stale");
+    const QByteArray OLD_DATA("the sound as an earlier run decoded it");
+    const QByteArray NEW_DATA("the sound as it is now");
+
+    auto oldMapping = cache.insert("sound:atp:/beep.wav", OLD_DATA);
+    QVERIFY(oldMapping);
+
+    // the key now gives other data, which is published next to the old, still mapped, contents
+    auto newMapping = cache.insert("sound:atp:/beep.wav", NEW_DATA);
+    QVERIFY(newMapping);
+    QCOMPARE(toByteArray(newMapping), NEW_DATA);
+    QCOMPARE(cache.getStaleReplacements(), (quint64)1);
+
+    auto found = cache.find("sound:atp:/beep.wav");
+    QVERIFY(found);
+    QCOMPARE(toByteArray(found), NEW_DATA);
+    QCOMPARE(countContentsFiles(cache), 2);
+
+    // published contents are never replaced, so a mapping of the stale ones still reads what it did
+    QCOMPARE(toByteArray(oldMapping), OLD_DATA);
+    QCOMPARE(QDir(cache.getDirectory()).entryList({ "*.tmp" }, QDir::Files).size(), 0);
+}
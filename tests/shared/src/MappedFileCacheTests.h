@@ -0,0 +1,29 @@
+//
+//  MappedFileCacheTests.h
+//  tests/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef overte_MappedFileCacheTests_h
+#define overte_MappedFileCacheTests_h
+
+#include <QtCore/QObject>
+#include <QtCore/QTemporaryDir>
+
+class MappedFileCacheTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void testMapAndReuse();
+    void testMissingFile();
+    void testStaleFile();
+
+private:
+    QTemporaryDir _testDir;
+};
+
+#endif // overte_MappedFileCacheTests_h
@@ -0,0 +1,72 @@
+//
+//  OpenMetricsTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "OpenMetricsTests.h"
+
+#include <QtTest/QtTest>
+
+#include <OpenMetrics.h>
+
+QTEST_MAIN(OpenMetricsTests)
+
+void OpenMetricsTests::testHistogram() {
+    MetricsHistogram histogram({ 1.0, 2.0, 4.0 });
+    histogram.record(0.5);
+    histogram.record(1.0);
+    histogram.record(3.0);
+    histogram.record(10.0);
+
+    std::vector<uint64_t> bucketCounts;
+    uint64_t count;
+    double sum;
+    histogram.sample(bucketCounts, count, sum);
+
+    QCOMPARE((int)bucketCounts.size(), 4);
+    QCOMPARE(bucketCounts[0], (uint64_t)2);
+    QCOMPARE(bucketCounts[1], (uint64_t)0);
+    QCOMPARE(bucketCounts[2], (uint64_t)1);
+    QCOMPARE(bucketCounts[3], (uint64_t)1);
+    QCOMPARE(count, (uint64_t)4);
+    QCOMPARE(sum, 14.5);
+}
+
+void OpenMetricsTests::testFamiliesAreGrouped() {
+    OpenMetricsWriter metrics;
+    metrics.addGauge("test_rtt", "RTT", 10, { { "node", "a" } });
+    metrics.addCounter("test_frames", "Frames", 3);
+    metrics.addGauge("test_rtt", "RTT", 20, { { "node", "b\"c" } });
+
+    QByteArray expected =
+        "# HELP test_rtt RTT\n"
+        "# TYPE test_rtt gauge\n"
+        "test_rtt{node=\"a\"} 10\n"
+        "test_rtt{node=\"b\\\"c\"} 20\n"
+        "# HELP test_frames Frames\n"
+        "# TYPE test_frames counter\n"
+        "test_frames_total 3\n";
+    QCOMPARE(metrics.getContent(), expected);
+}
+
+void OpenMetricsTests::testHistogramExposition() {
+    MetricsHistogram histogram({ 0.01, 0.1 });
+    histogram.record(0.005);
+    histogram.record(0.05);
+    histogram.record(0.5);
+
+    OpenMetricsWriter metrics;
+    metrics.addHistogram("test_frame_seconds", "Frame time", histogram);
+
+    auto content = metrics.getContent();
+    QVERIFY(content.contains("# TYPE test_frame_seconds histogram\n"));
+    QVERIFY(content.contains("test_frame_seconds_bucket{le=\"0.01\"} 1\n"));
+    QVERIFY(content.contains("test_frame_seconds_bucket{le=\"0.1\"} 2\n"));
+    QVERIFY(content.contains("test_frame_seconds_bucket{le=\"+Inf\"} 3\n"));
+    QVERIFY(content.contains("test_frame_seconds_count 3\n"));
+}
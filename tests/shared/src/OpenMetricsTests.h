@@ -0,0 +1,24 @@
+//
+//  OpenMetricsTests.h
+//  tests/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef overte_OpenMetricsTests_h
+#define overte_OpenMetricsTests_h
+
+#include <QtCore/QObject>
+
+class OpenMetricsTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testHistogram();
+    void testFamiliesAreGrouped();
+    void testHistogramExposition();
+};
+
+#endif // overte_OpenMetricsTests_h
@@ -0,0 +1,121 @@
+//
+//  ParticleStoreTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ParticleStoreTests.h"
+
+#include <cmath>
+
+#include <QtTest/QtTest>
+
+#include <ParticleStore.h>
+
+QTEST_MAIN(ParticleStoreTests)
+
+static ParticleStore::Particle makeParticle(int i) {
+    ParticleStore::Particle particle;
+    particle.seed = (float)i;
+    particle.expiration = 1000000;
+    particle.basePosition = glm::vec3((float)i, 0.0f, 0.0f);
+    particle.velocity = glm::vec3(1.0f, 2.0f, 3.0f);
+    particle.acceleration = glm::vec3(0.0f, -9.8f, 0.1f * i);
+    return particle;
+}
+
+void ParticleStoreTests::testRingBuffer() {
+    ParticleStore particles;
+    QVERIFY(particles.empty());
+
+    // keep the ring wrapping around while it grows
+    int first = 0;
+    int next = 0;
+    for (int i = 0; i < 200; ++i) {
+        particles.push_back(makeParticle(next++));
+        particles.push_back(makeParticle(next++));
+        particles.pop_front();
+        ++first;
+    }
+
+    QCOMPARE(particles.size(), (size_t)(next - first));
+    for (size_t i = 0; i < particles.size(); ++i) {
+        QCOMPARE(particles.at(i).seed, (float)(first + (int)i));
+    }
+
+    particles.clear();
+    QVERIFY(particles.empty());
+}
+
+void ParticleStoreTests::testIntegrate() {
+    const float DELTA_TIME = 1.0f / 60.0f;
+    const uint64_t INTERVAL = 16667;
+
+    ParticleStore particles;
+    for (int i = 0; i < 100; ++i) {
+        particles.push_back(makeParticle(i));
+    }
+    particles.integrate(DELTA_TIME, INTERVAL);
+
+    for (int i = 0; i < 100; ++i) {
+        auto expected = makeParticle(i);
+        glm::vec3 atSquared = (0.5f * DELTA_TIME * DELTA_TIME) * expected.acceleration;
+        expected.relativePosition += expected.velocity * DELTA_TIME + atSquared;
+        expected.velocity += expected.acceleration * DELTA_TIME;
+
+        auto particle = particles.at(i);
+        QCOMPARE(particle.lifetime, DELTA_TIME);
+        QCOMPARE(particle.expiration, (uint64_t)(1000000 - INTERVAL));
+        for (int axis = 0; axis < 3; ++axis) {
+            QVERIFY(fabsf(particle.relativePosition[axis] - expected.relativePosition[axis]) < 1.0e-6f);
+            QVERIFY(fabsf(particle.velocity[axis] - expected.velocity[axis]) < 1.0e-6f);
+        }
+    }
+
+    // expirations stop at zero
+    particles.integrate(DELTA_TIME, 2000000);
+    QCOMPARE(particles.frontExpiration(), (uint64_t)0);
+}
+
+void ParticleStoreTests::testWriteGpuParticles() {
+    ParticleStore particles;
+    for (int i = 0; i < 10; ++i) {
+        particles.push_back(makeParticle(i));
+    }
+    particles.pop_front();
+
+    const glm::vec3 EMITTER_POSITION(0.0f, 5.0f, 0.0f);
+    std::vector<float> output(particles.size() * ParticleStore::GPU_PARTICLE_FLOATS);
+
+    particles.writeGpuParticles(output.data(), true, EMITTER_POSITION);
+    QCOMPARE(output[0], 1.0f);
+    QCOMPARE(output[1], 0.0f);
+    QCOMPARE(output[4], 1.0f);
+
+    particles.writeGpuParticles(output.data(), false, EMITTER_POSITION);
+    QCOMPARE(output[0], 0.0f);
+    QCOMPARE(output[1], 5.0f);
+
+    // rebasing keeps trailing particles where they are
+    particles.rebase(EMITTER_POSITION, true);
+    particles.writeGpuParticles(output.data(), false, EMITTER_POSITION);
+    QCOMPARE(output[0], 1.0f);
+    QCOMPARE(output[1], 0.0f);
+}
+
+void ParticleStoreTests::benchmarkStep10k() {
+    ParticleStore particles;
+    for (int i = 0; i < 10000; ++i) {
+        particles.push_back(makeParticle(i));
+    }
+    std::vector<float> output(particles.size() * ParticleStore::GPU_PARTICLE_FLOATS);
+
+    QBENCHMARK {
+        particles.integrate(1.0f / 90.0f, 11111);
+        particles.writeGpuParticles(output.data(), false, glm::vec3(0.0f));
+    }
+}
@@ -0,0 +1,25 @@
+//
+//  ParticleStoreTests.h
+//  tests/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef overte_ParticleStoreTests_h
+#define overte_ParticleStoreTests_h
+
+#include <QtCore/QObject>
+
+class ParticleStoreTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testRingBuffer();
+    void testIntegrate();
+    void testWriteGpuParticles();
+    void benchmarkStep10k();
+};
+
+#endif // overte_ParticleStoreTests_h
@@ -0,0 +1,222 @@
+//
+//  ResourceLoadSchedulerTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ResourceLoadSchedulerTests.h"
+
+#include <QtTest/QtTest>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include <ResourceLoadScheduler.h>
+
+QTEST_MAIN(ResourceLoadSchedulerTests)
+
+namespace {
+
+class Gate {
+public:
+    void open() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _isOpen = true;
+        _opened.notify_all();
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _opened.wait(lock, [this] { return _isOpen; });
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _opened;
+    bool _isOpen { false };
+};
+
+// A scheduler with one I/O and one CPU thread, whose threads can be held up by jobs waiting on a gate so that the jobs
+// scheduled meanwhile queue up. The gates open before the scheduler goes, even when a check fails.
+struct GatedScheduler {
+    static const int NUM_GATES { 2 };
+
+    GatedScheduler() : scheduler(1, 1) {}
+    ~GatedScheduler() {
+        for (auto& gate : gates) {
+            gate.open();
+        }
+    }
+
+    // schedules a job that holds up whichever thread runs it until the gate opens
+    void hold(int gate) {
+        scheduler.schedule(ResourceLoadScheduler::CPU, [this, gate] {
+            ++numHeld;
+            gates[gate].wait();
+        });
+    }
+
+    std::atomic<int> numHeld { 0 };
+    std::array<Gate, NUM_GATES> gates;
+    ResourceLoadScheduler scheduler;
+};
+
+struct JobCounts {
+    std::atomic<int> numRun { 0 };
+    std::atomic<int> numCancelled { 0 };
+    std::atomic<bool> isStale { false };
+};
+
+class CountingJob : public ResourceLoadJob {
+public:
+    CountingJob(JobCounts& counts) : _counts(counts) {}
+
+    void run() override { ++_counts.numRun; }
+    bool isStale() const override { return _counts.isStale; }
+    void cancelled() override { ++_counts.numCancelled; }
+
+private:
+    JobCounts& _counts;
+};
+
+}
+
+void ResourceLoadSchedulerTests::testPriorityOrder() {
+    GatedScheduler gated;
+    gated.hold(0);
+    gated.hold(1);
+    QTRY_COMPARE(gated.numHeld.load(), 2);
+
+    std::mutex orderMutex;
+    std::vector<int> order;
+    auto record = [&](int job) {
+        return [&, job] {
+            std::unique_lock<std::mutex> lock(orderMutex);
+            order.push_back(job);
+        };
+    };
+
+    const std::vector<float> PRIORITIES { 1.0f, 3.0f, 2.0f, 3.0f };
+    for (int i = 0; i < (int)PRIORITIES.size(); ++i) {
+        float priority = PRIORITIES[i];
+        gated.scheduler.schedule(ResourceLoadScheduler::CPU, record(i), [priority] { return priority; });
+    }
+
+    // priorities are asked for again on updatePriorities, so a raised one counts
+    std::atomic<float> livePriority { 0.0f };
+    gated.scheduler.schedule(ResourceLoadScheduler::CPU, record(4), [&] { return livePriority.load(); });
+    livePriority = 10.0f;
+    gated.scheduler.updatePriorities();
+
+    // one thread runs them all, one at a time
+    gated.gates[0].open();
+    QTRY_COMPARE(gated.scheduler.getStats().completed, (uint64_t)(1 + PRIORITIES.size() + 1));
+
+    // the highest priority first, and equal priorities in the order they were scheduled
+    std::unique_lock<std::mutex> lock(orderMutex);
+    QCOMPARE(order, std::vector<int>({ 4, 1, 3, 2, 0 }));
+}
+
+void ResourceLoadSchedulerTests::testPrioritiesRefreshed() {
+    GatedScheduler gated;
+    gated.hold(0);
+    gated.hold(1);
+    QTRY_COMPARE(gated.numHeld.load(), 2);
+
+    std::mutex orderMutex;
+    std::vector<int> order;
+    std::atomic<float> livePriority { 0.0f };
+    gated.scheduler.schedule(ResourceLoadScheduler::CPU, [&] {
+        std::unique_lock<std::mutex> lock(orderMutex);
+        order.push_back(0);
+    }, [] { return 1.0f; });
+    gated.scheduler.schedule(ResourceLoadScheduler::CPU, [&] {
+        std::unique_lock<std::mutex> lock(orderMutex);
+        order.push_back(1);
+    }, [&] { return livePriority.load(); });
+
+    // the priorities go stale for no longer than the refresh interval
+    livePriority = 2.0f;
+    QTest::qWait(2 * (int)ResourceLoadScheduler::PRIORITY_REFRESH_INTERVAL.count());
+
+    gated.gates[0].open();
+    QTRY_COMPARE(gated.scheduler.getStats().completed, (uint64_t)3);
+
+    std::unique_lock<std::mutex> lock(orderMutex);
+    QCOMPARE(order, std::vector<int>({ 1, 0 }));
+}
+
+void ResourceLoadSchedulerTests::testCancel() {
+    GatedScheduler gated;
+    gated.hold(0);
+    gated.hold(1);
+    QTRY_COMPARE(gated.numHeld.load(), 2);
+
+    JobCounts keptCounts;
+    JobCounts droppedCounts;
+    auto keptID = gated.scheduler.schedule(ResourceLoadScheduler::IO, new CountingJob(keptCounts));
+    auto droppedID = gated.scheduler.schedule(ResourceLoadScheduler::IO, new CountingJob(droppedCounts));
+    QVERIFY(keptID != droppedID);
+
+    QVERIFY(gated.scheduler.cancel(droppedID));
+    QCOMPARE(droppedCounts.numCancelled.load(), 1);
+    QVERIFY(!gated.scheduler.cancel(droppedID));
+    QVERIFY(!gated.scheduler.cancel(ResourceLoadScheduler::INVALID_JOB_ID));
+    QCOMPARE(gated.scheduler.getStats().queued[ResourceLoadScheduler::IO], (size_t)1);
+
+    gated.gates[0].open();
+    QTRY_COMPARE(keptCounts.numRun.load(), 1);
+
+    // too late once it ran
+    QVERIFY(!gated.scheduler.cancel(keptID));
+    QCOMPARE(keptCounts.numCancelled.load(), 0);
+    QCOMPARE(droppedCounts.numRun.load(), 0);
+    QCOMPARE(gated.scheduler.getStats().cancelled, (uint64_t)1);
+}
+
+void ResourceLoadSchedulerTests::testStaleJobsDropped() {
+    GatedScheduler gated;
+    gated.hold(0);
+    gated.hold(1);
+    QTRY_COMPARE(gated.numHeld.load(), 2);
+
+    JobCounts freshCounts;
+    JobCounts staleCounts;
+    gated.scheduler.schedule(ResourceLoadScheduler::CPU, new CountingJob(staleCounts));
+    gated.scheduler.schedule(ResourceLoadScheduler::CPU, new CountingJob(freshCounts));
+
+    // a job can go stale while it waits
+    staleCounts.isStale = true;
+
+    gated.gates[0].open();
+    QTRY_COMPARE(freshCounts.numRun.load(), 1);
+
+    // dropped jobs are cancelled before the job picked with them runs
+    QCOMPARE(staleCounts.numRun.load(), 0);
+    QCOMPARE(staleCounts.numCancelled.load(), 1);
+    QCOMPARE(gated.scheduler.getStats().cancelled, (uint64_t)1);
+}
+
+void ResourceLoadSchedulerTests::testLaneStealing() {
+    GatedScheduler gated;
+    gated.hold(0);
+    QTRY_COMPARE(gated.numHeld.load(), 1);
+
+    // with one thread held by a CPU job, the next CPU job can only run on the other thread, so exactly one of the two
+    // ran on the thread of the I/O lane
+    JobCounts counts;
+    gated.scheduler.schedule(ResourceLoadScheduler::CPU, new CountingJob(counts));
+    QTRY_COMPARE(gated.scheduler.getStats().completed, (uint64_t)1);
+    QCOMPARE(counts.numRun.load(), 1);
+
+    auto stats = gated.scheduler.getStats();
+    QCOMPARE(stats.stolen, (uint64_t)1);
+    QCOMPARE(stats.running[ResourceLoadScheduler::IO] + stats.running[ResourceLoadScheduler::CPU], (size_t)1);
+}
@@ -0,0 +1,26 @@
+//
+//  ResourceLoadSchedulerTests.h
+//  tests/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef overte_ResourceLoadSchedulerTests_h
+#define overte_ResourceLoadSchedulerTests_h
+
+#include <QtCore/QObject>
+
+class ResourceLoadSchedulerTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testPriorityOrder();
+    void testPrioritiesRefreshed();
+    void testCancel();
+    void testStaleJobsDropped();
+    void testLaneStealing();
+};
+
+#endif // overte_ResourceLoadSchedulerTests_h
@@ -0,0 +1,88 @@
+//
+//  StatTrackerTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "StatTrackerTests.h"
+
+#include <QtTest/QtTest>
+
+#include <thread>
+#include <vector>
+
+#include <StatTracker.h>
+
+QTEST_MAIN(StatTrackerTests)
+
+void StatTrackerTests::initTestCase() {
+    DependencyManager::set<StatTracker>();
+}
+
+void StatTrackerTests::testNamedStats() {
+    auto statTracker = DependencyManager::get<StatTracker>();
+
+    QCOMPARE(statTracker->getStat("Unknown").toLongLong(), (qint64)0);
+
+    statTracker->setStat("Named", 10);
+    statTracker->updateStat("Named", 5);
+    statTracker->incrementStat("Named");
+    statTracker->decrementStat("Named");
+    statTracker->decrementStat("Named");
+    QCOMPARE(statTracker->getStat("Named").toLongLong(), (qint64)14);
+
+    statTracker->setStat("Named", 3);
+    QCOMPARE(statTracker->getStat("Named").toLongLong(), (qint64)3);
+
+    auto stats = statTracker->getStats();
+    QVERIFY(stats.contains("Named"));
+    QCOMPARE(stats["Named"].toLongLong(), (qint64)3);
+}
+
+void StatTrackerTests::testCounterHandles() {
+    auto statTracker = DependencyManager::get<StatTracker>();
+
+    auto counter = statTracker->getCounter("Handle");
+    QVERIFY(counter == statTracker->getCounter("Handle"));
+
+    counter->update(7);
+    statTracker->incrementStat("Handle");
+    QCOMPARE(statTracker->getStat("Handle").toLongLong(), (qint64)8);
+
+    {
+        CounterStat scoped(counter);
+        QCOMPARE(counter->get(), (int64_t)9);
+    }
+    QCOMPARE(counter->get(), (int64_t)8);
+}
+
+void StatTrackerTests::testMultiThreadedUpdates() {
+    auto statTracker = DependencyManager::get<StatTracker>();
+    auto counter = statTracker->getCounter("Threaded");
+
+    const int NUM_THREADS = 8;
+    const int NUM_UPDATES = 100000;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back([statTracker, counter, NUM_UPDATES] {
+            for (int j = 0; j < NUM_UPDATES; ++j) {
+                counter->increment();
+                if (j % 100 == 0) {
+                    statTracker->updateStat("Threaded", 2);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const int64_t EXPECTED = (int64_t)NUM_THREADS * (NUM_UPDATES + 2 * (NUM_UPDATES / 100));
+    QCOMPARE(counter->get(), EXPECTED);
+    QCOMPARE(statTracker->getStat("Threaded").toLongLong(), (qint64)EXPECTED);
+}
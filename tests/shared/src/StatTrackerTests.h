@@ -0,0 +1,25 @@
+//
+//  StatTrackerTests.h
+//  tests/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef overte_StatTrackerTests_h
+#define overte_StatTrackerTests_h
+
+#include <QtCore/QObject>
+
+class StatTrackerTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void testNamedStats();
+    void testCounterHandles();
+    void testMultiThreadedUpdates();
+};
+
+#endif // overte_StatTrackerTests_h
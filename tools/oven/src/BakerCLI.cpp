@@ -16,8 +16,15 @@
 #include <QtCore/QDebug>
 #include <QFile>
 
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <thread>
 #include <unordered_map>
 
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+
 #include "OvenCLIApplication.h"
 #include "ModelBakingLoggingCategory.h"
 #include "baking/BakerLibrary.h"
@@ -91,7 +98,8 @@ void BakerCLI::bakeFile(QUrl inputUrl, const QString& outputPath, const QString&
             auto it = STRING_TO_TEXTURE_USAGE_TYPE_MAP.find(type);
             if (it == STRING_TO_TEXTURE_USAGE_TYPE_MAP.end()) {
                 qCDebug(model_baking) << "Unknown texture usage type:" << type;
-                QCoreApplication::exit(OVEN_STATUS_CODE_FAIL);
+                finish(OVEN_STATUS_CODE_FAIL);
+                return;
             }
             _baker = std::unique_ptr<Baker> { new TextureBaker(inputUrl, it->second, outputPath) };
             _baker->moveToThread(Oven::instance().getNextWorkerThread());
@@ -100,7 +108,7 @@ void BakerCLI::bakeFile(QUrl inputUrl, const QString& outputPath, const QString&
 
     if (!_baker) {
         qCDebug(model_baking) << "Failed to determine baker type for file" << inputUrl;
-        QCoreApplication::exit(OVEN_STATUS_CODE_FAIL);
+        finish(OVEN_STATUS_CODE_FAIL);
         return;
     }
 
@@ -125,5 +133,64 @@ void BakerCLI::handleFinishedBaker() {
             errorFile.close();
         }
     }
-    QCoreApplication::exit(exitCode);
+    finish(exitCode);
+}
+
+void BakerCLI::finish(int statusCode) {
+    if (!_isWorker) {
+        QCoreApplication::exit(statusCode);
+        return;
+    }
+
+    if (_baker) {
+        disconnect(_baker.get(), nullptr, this, nullptr);
+        // the baker lives on a worker thread, so it has to be deleted there
+        _baker.release()->deleteLater();
+    }
+
+    // one write per result, so it can't be split up by log output from other threads
+    fprintf(stdout, "%s %lld %d\n", OVEN_WORKER_RESULT_PREFIX, (long long)_workerJobID, statusCode);
+    fflush(stdout);
+
+    _workerJobID = 0;
+    QMetaObject::invokeMethod(this, "startNextWorkerJob", Qt::QueuedConnection);
+}
+
+void BakerCLI::startWorker() {
+    _isWorker = true;
+
+    // standard input can't be watched portably by the event loop, so a thread blocks on it and hands each line over.
+    // the worker quits once its input is closed, which is how the asset server shuts it down.
+    std::thread([this] {
+        std::string line;
+        while (std::getline(std::cin, line)) {
+            QByteArray job = QByteArray::fromStdString(line).trimmed();
+            if (!job.isEmpty()) {
+                QMetaObject::invokeMethod(this, "queueWorkerJob", Qt::QueuedConnection, Q_ARG(QByteArray, job));
+            }
+        }
+        QMetaObject::invokeMethod(QCoreApplication::instance(), "quit", Qt::QueuedConnection);
+    }).detach();
+}
+
+void BakerCLI::queueWorkerJob(const QByteArray& job) {
+    _workerJobs.enqueue(job);
+    if (_workerJobID == 0) {
+        startNextWorkerJob();
+    }
+}
+
+void BakerCLI::startNextWorkerJob() {
+    while (_workerJobID == 0 && !_workerJobs.isEmpty()) {
+        // a job is a JSON object on a single line: { "id": 1, "input": "...", "output": "...", "type": "..." }
+        auto job = QJsonDocument::fromJson(_workerJobs.dequeue()).object();
+        auto jobID = (qint64)job["id"].toDouble();
+        if (jobID <= 0) {
+            qCWarning(model_baking) << "Ignoring a bake job without an ID";
+            continue;
+        }
+
+        _workerJobID = jobID;
+        bakeFile(QDir::fromNativeSeparators(job["input"].toString()), job["output"].toString(), job["type"].toString());
+    }
 }
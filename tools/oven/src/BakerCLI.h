@@ -13,6 +13,7 @@
 #define hifi_BakerCLI_h
 
 #include <QtCore/QObject>
+#include <QtCore/QQueue>
 #include <QDir>
 #include <QUrl>
 
@@ -27,6 +28,9 @@ static const int OVEN_STATUS_CODE_ABORT { 2 };
 
 static const QString OVEN_ERROR_FILENAME = "errors.txt";
 
+// a worker reports each finished job on its standard output as this prefix, followed by the job ID and status code
+static const char OVEN_WORKER_RESULT_PREFIX[] = "oven-job-finished";
+
 class BakerCLI : public QObject {
     Q_OBJECT
 
@@ -36,12 +40,24 @@ public:
 public slots:
     void bakeFile(QUrl inputUrl, const QString& outputPath, const QString& type = QString());
 
+    /// Stays running and bakes the jobs that arrive on standard input, so that the process startup, Qt and plugin
+    /// initialization are paid once for a whole queue of bakes instead of once per bake
+    void startWorker();
+
 private slots:
     void handleFinishedBaker();  
+    void queueWorkerJob(const QByteArray& job);
+    void startNextWorkerJob();
 
 private:
+    void finish(int statusCode);
+
     QDir _outputPath;
     std::unique_ptr<Baker> _baker;
+
+    bool _isWorker { false };
+    QQueue<QByteArray> _workerJobs;
+    qint64 _workerJobID { 0 };
 };
 
 #endif // hifi_BakerCLI_h
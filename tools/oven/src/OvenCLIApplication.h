@@ -47,6 +47,7 @@ private:
     static QUrl _inputUrlParameter;
     static QUrl _outputUrlParameter;
     static QString _typeParameter;
+    static bool _workerMode;
 };
 
 #endif // hifi_OvenCLIApplication_h